@@ -94,7 +94,8 @@ namespace engine
 
     void Debug::WriteToFile(std::string_view prefix, std::string_view msg)
     {
-        //std::lock_guard<std::mutex> lock(s_mutex);
+        // 에셋 로드 워커에서도 로그를 남김
+        std::lock_guard<std::mutex> lock(s_mutex);
 
         std::ofstream file(s_logFilePath, std::ios::app);
         if (file.is_open())
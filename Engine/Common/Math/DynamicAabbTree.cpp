@@ -0,0 +1,455 @@
+﻿#include "EnginePCH.h"
+#include "DynamicAabbTree.h"
+
+namespace engine
+{
+    DynamicAabbTree::DynamicAabbTree()
+    {
+        m_nodes.reserve(256);
+        m_stack.reserve(256);
+    }
+
+    std::int32_t DynamicAabbTree::CreateProxy(const DirectX::BoundingBox& bounds, void* userData)
+    {
+        const std::int32_t proxyId = AllocateNode();
+
+        const Vector3 margin(m_margin, m_margin, m_margin);
+        Node& node = m_nodes[proxyId];
+        node.minPoint = Vector3(bounds.Center) - Vector3(bounds.Extents) - margin;
+        node.maxPoint = Vector3(bounds.Center) + Vector3(bounds.Extents) + margin;
+        node.userData = userData;
+        node.height = 0;
+
+        InsertLeaf(proxyId);
+
+        ++m_proxyCount;
+
+        return proxyId;
+    }
+
+    void DynamicAabbTree::DestroyProxy(std::int32_t proxyId)
+    {
+        assert(0 <= proxyId && proxyId < static_cast<std::int32_t>(m_nodes.size()));
+        assert(m_nodes[proxyId].IsLeaf());
+
+        RemoveLeaf(proxyId);
+        FreeNode(proxyId);
+
+        --m_proxyCount;
+    }
+
+    bool DynamicAabbTree::MoveProxy(std::int32_t proxyId, const DirectX::BoundingBox& bounds)
+    {
+        assert(0 <= proxyId && proxyId < static_cast<std::int32_t>(m_nodes.size()));
+        assert(m_nodes[proxyId].IsLeaf());
+
+        const Vector3 minPoint = Vector3(bounds.Center) - Vector3(bounds.Extents);
+        const Vector3 maxPoint = Vector3(bounds.Center) + Vector3(bounds.Extents);
+
+        Node& node = m_nodes[proxyId];
+        if (node.minPoint.x <= minPoint.x && node.minPoint.y <= minPoint.y && node.minPoint.z <= minPoint.z &&
+            maxPoint.x <= node.maxPoint.x && maxPoint.y <= node.maxPoint.y && maxPoint.z <= node.maxPoint.z)
+        {
+            return false; // 아직 fat AABB 안에 있음
+        }
+
+        RemoveLeaf(proxyId);
+
+        const Vector3 margin(m_margin, m_margin, m_margin);
+        m_nodes[proxyId].minPoint = minPoint - margin;
+        m_nodes[proxyId].maxPoint = maxPoint + margin;
+
+        InsertLeaf(proxyId);
+
+        return true;
+    }
+
+    void* DynamicAabbTree::GetUserData(std::int32_t proxyId) const
+    {
+        assert(0 <= proxyId && proxyId < static_cast<std::int32_t>(m_nodes.size()));
+
+        return m_nodes[proxyId].userData;
+    }
+
+    DirectX::BoundingBox DynamicAabbTree::GetFatBounds(std::int32_t proxyId) const
+    {
+        assert(0 <= proxyId && proxyId < static_cast<std::int32_t>(m_nodes.size()));
+
+        return ToBoundingBox(m_nodes[proxyId]);
+    }
+
+    std::int32_t DynamicAabbTree::GetProxyCount() const
+    {
+        return m_proxyCount;
+    }
+
+    std::int32_t DynamicAabbTree::GetHeight() const
+    {
+        return m_root != NullNode ? m_nodes[m_root].height : 0;
+    }
+
+    void DynamicAabbTree::SetMargin(float margin)
+    {
+        m_margin = margin;
+    }
+
+    void DynamicAabbTree::Clear()
+    {
+        m_nodes.clear();
+        m_root = NullNode;
+        m_freeList = NullNode;
+        m_proxyCount = 0;
+    }
+
+    std::int32_t DynamicAabbTree::AllocateNode()
+    {
+        if (m_freeList == NullNode)
+        {
+            m_nodes.emplace_back();
+
+            return static_cast<std::int32_t>(m_nodes.size() - 1);
+        }
+
+        const std::int32_t node = m_freeList;
+        m_freeList = m_nodes[node].parent;
+        m_nodes[node] = Node{};
+
+        return node;
+    }
+
+    void DynamicAabbTree::FreeNode(std::int32_t node)
+    {
+        m_nodes[node].parent = m_freeList;
+        m_nodes[node].userData = nullptr;
+        m_nodes[node].height = -1;
+        m_freeList = node;
+    }
+
+    void DynamicAabbTree::InsertLeaf(std::int32_t leaf)
+    {
+        if (m_root == NullNode)
+        {
+            m_root = leaf;
+            m_nodes[m_root].parent = NullNode;
+
+            return;
+        }
+
+        // 1. 표면적 증가량이 가장 작은 형제를 찾음
+        const Vector3 leafMin = m_nodes[leaf].minPoint;
+        const Vector3 leafMax = m_nodes[leaf].maxPoint;
+
+        std::int32_t index = m_root;
+        while (!m_nodes[index].IsLeaf())
+        {
+            const Node& node = m_nodes[index];
+
+            const float area = GetSurfaceArea(node.minPoint, node.maxPoint);
+            const float combinedArea = GetSurfaceArea(
+                Vector3::Min(node.minPoint, leafMin),
+                Vector3::Max(node.maxPoint, leafMax));
+
+            // 여기서 새 부모를 만들 때의 비용
+            const float cost = 2.0f * combinedArea;
+
+            // 아래로 내려갈 때 조상들이 커지는 비용
+            const float inheritanceCost = 2.0f * (combinedArea - area);
+
+            auto descendCost = [&](std::int32_t child)
+                {
+                    const Node& c = m_nodes[child];
+                    const float newArea = GetSurfaceArea(
+                        Vector3::Min(c.minPoint, leafMin),
+                        Vector3::Max(c.maxPoint, leafMax));
+
+                    if (c.IsLeaf())
+                    {
+                        return newArea + inheritanceCost;
+                    }
+
+                    return newArea - GetSurfaceArea(c.minPoint, c.maxPoint) + inheritanceCost;
+                };
+
+            const float cost1 = descendCost(node.child1);
+            const float cost2 = descendCost(node.child2);
+
+            if (cost < cost1 && cost < cost2)
+            {
+                break;
+            }
+
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+
+        const std::int32_t sibling = index;
+
+        // 2. 새 부모 생성 (AllocateNode가 m_nodes를 키울 수 있으므로 참조를 먼저 잡지 않음)
+        const std::int32_t oldParent = m_nodes[sibling].parent;
+        const std::int32_t newParent = AllocateNode();
+
+        m_nodes[newParent].parent = oldParent;
+        m_nodes[newParent].userData = nullptr;
+        m_nodes[newParent].minPoint = Vector3::Min(leafMin, m_nodes[sibling].minPoint);
+        m_nodes[newParent].maxPoint = Vector3::Max(leafMax, m_nodes[sibling].maxPoint);
+        m_nodes[newParent].height = m_nodes[sibling].height + 1;
+        m_nodes[newParent].child1 = sibling;
+        m_nodes[newParent].child2 = leaf;
+
+        m_nodes[sibling].parent = newParent;
+        m_nodes[leaf].parent = newParent;
+
+        if (oldParent != NullNode)
+        {
+            if (m_nodes[oldParent].child1 == sibling)
+            {
+                m_nodes[oldParent].child1 = newParent;
+            }
+            else
+            {
+                m_nodes[oldParent].child2 = newParent;
+            }
+        }
+        else
+        {
+            m_root = newParent;
+        }
+
+        // 3. 올라가면서 AABB와 높이를 갱신
+        index = m_nodes[leaf].parent;
+        while (index != NullNode)
+        {
+            index = Balance(index);
+
+            Node& node = m_nodes[index];
+            const Node& child1 = m_nodes[node.child1];
+            const Node& child2 = m_nodes[node.child2];
+
+            node.height = 1 + std::max(child1.height, child2.height);
+            node.minPoint = Vector3::Min(child1.minPoint, child2.minPoint);
+            node.maxPoint = Vector3::Max(child1.maxPoint, child2.maxPoint);
+
+            index = node.parent;
+        }
+    }
+
+    void DynamicAabbTree::RemoveLeaf(std::int32_t leaf)
+    {
+        if (leaf == m_root)
+        {
+            m_root = NullNode;
+
+            return;
+        }
+
+        const std::int32_t parent = m_nodes[leaf].parent;
+        const std::int32_t grandParent = m_nodes[parent].parent;
+        const std::int32_t sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+        if (grandParent != NullNode)
+        {
+            // 부모를 없애고 형제를 조부모에 붙임
+            if (m_nodes[grandParent].child1 == parent)
+            {
+                m_nodes[grandParent].child1 = sibling;
+            }
+            else
+            {
+                m_nodes[grandParent].child2 = sibling;
+            }
+
+            m_nodes[sibling].parent = grandParent;
+            FreeNode(parent);
+
+            std::int32_t index = grandParent;
+            while (index != NullNode)
+            {
+                index = Balance(index);
+
+                Node& node = m_nodes[index];
+                const Node& child1 = m_nodes[node.child1];
+                const Node& child2 = m_nodes[node.child2];
+
+                node.minPoint = Vector3::Min(child1.minPoint, child2.minPoint);
+                node.maxPoint = Vector3::Max(child1.maxPoint, child2.maxPoint);
+                node.height = 1 + std::max(child1.height, child2.height);
+
+                index = node.parent;
+            }
+        }
+        else
+        {
+            m_root = sibling;
+            m_nodes[sibling].parent = NullNode;
+            FreeNode(parent);
+        }
+    }
+
+    // a가 불균형이면 회전하고 새 서브트리 루트를 반환
+    std::int32_t DynamicAabbTree::Balance(std::int32_t iA)
+    {
+        Node& a = m_nodes[iA];
+        if (a.IsLeaf() || a.height < 2)
+        {
+            return iA;
+        }
+
+        const std::int32_t iB = a.child1;
+        const std::int32_t iC = a.child2;
+        Node& b = m_nodes[iB];
+        Node& c = m_nodes[iC];
+
+        const std::int32_t balance = c.height - b.height;
+
+        // c를 위로 올림
+        if (balance > 1)
+        {
+            const std::int32_t iF = c.child1;
+            const std::int32_t iG = c.child2;
+            Node& f = m_nodes[iF];
+            Node& g = m_nodes[iG];
+
+            c.child1 = iA;
+            c.parent = a.parent;
+            a.parent = iC;
+
+            if (c.parent != NullNode)
+            {
+                if (m_nodes[c.parent].child1 == iA)
+                {
+                    m_nodes[c.parent].child1 = iC;
+                }
+                else
+                {
+                    m_nodes[c.parent].child2 = iC;
+                }
+            }
+            else
+            {
+                m_root = iC;
+            }
+
+            if (f.height > g.height)
+            {
+                c.child2 = iF;
+                a.child2 = iG;
+                g.parent = iA;
+
+                a.minPoint = Vector3::Min(b.minPoint, g.minPoint);
+                a.maxPoint = Vector3::Max(b.maxPoint, g.maxPoint);
+                c.minPoint = Vector3::Min(a.minPoint, f.minPoint);
+                c.maxPoint = Vector3::Max(a.maxPoint, f.maxPoint);
+
+                a.height = 1 + std::max(b.height, g.height);
+                c.height = 1 + std::max(a.height, f.height);
+            }
+            else
+            {
+                c.child2 = iG;
+                a.child2 = iF;
+                f.parent = iA;
+
+                a.minPoint = Vector3::Min(b.minPoint, f.minPoint);
+                a.maxPoint = Vector3::Max(b.maxPoint, f.maxPoint);
+                c.minPoint = Vector3::Min(a.minPoint, g.minPoint);
+                c.maxPoint = Vector3::Max(a.maxPoint, g.maxPoint);
+
+                a.height = 1 + std::max(b.height, f.height);
+                c.height = 1 + std::max(a.height, g.height);
+            }
+
+            return iC;
+        }
+
+        // b를 위로 올림
+        if (balance < -1)
+        {
+            const std::int32_t iD = b.child1;
+            const std::int32_t iE = b.child2;
+            Node& d = m_nodes[iD];
+            Node& e = m_nodes[iE];
+
+            b.child1 = iA;
+            b.parent = a.parent;
+            a.parent = iB;
+
+            if (b.parent != NullNode)
+            {
+                if (m_nodes[b.parent].child1 == iA)
+                {
+                    m_nodes[b.parent].child1 = iB;
+                }
+                else
+                {
+                    m_nodes[b.parent].child2 = iB;
+                }
+            }
+            else
+            {
+                m_root = iB;
+            }
+
+            if (d.height > e.height)
+            {
+                b.child2 = iD;
+                a.child1 = iE;
+                e.parent = iA;
+
+                a.minPoint = Vector3::Min(c.minPoint, e.minPoint);
+                a.maxPoint = Vector3::Max(c.maxPoint, e.maxPoint);
+                b.minPoint = Vector3::Min(a.minPoint, d.minPoint);
+                b.maxPoint = Vector3::Max(a.maxPoint, d.maxPoint);
+
+                a.height = 1 + std::max(c.height, e.height);
+                b.height = 1 + std::max(a.height, d.height);
+            }
+            else
+            {
+                b.child2 = iE;
+                a.child1 = iD;
+                d.parent = iA;
+
+                a.minPoint = Vector3::Min(c.minPoint, d.minPoint);
+                a.maxPoint = Vector3::Max(c.maxPoint, d.maxPoint);
+                b.minPoint = Vector3::Min(a.minPoint, e.minPoint);
+                b.maxPoint = Vector3::Max(a.maxPoint, e.maxPoint);
+
+                a.height = 1 + std::max(c.height, d.height);
+                b.height = 1 + std::max(a.height, e.height);
+            }
+
+            return iB;
+        }
+
+        return iA;
+    }
+
+    DirectX::BoundingBox DynamicAabbTree::ToBoundingBox(const Node& node)
+    {
+        return DirectX::BoundingBox(
+            (node.minPoint + node.maxPoint) * 0.5f,
+            (node.maxPoint - node.minPoint) * 0.5f);
+    }
+
+    float DynamicAabbTree::GetSurfaceArea(const Vector3& minPoint, const Vector3& maxPoint)
+    {
+        const Vector3 d = maxPoint - minPoint;
+
+        return d.x * d.y + d.y * d.z + d.z * d.x;
+    }
+
+    bool DynamicAabbTree::RayIntersects(const Vector3& origin, const Vector3& invDirection, float maxDistance, const Node& node)
+    {
+        // slab test
+        const float tx1 = (node.minPoint.x - origin.x) * invDirection.x;
+        const float tx2 = (node.maxPoint.x - origin.x) * invDirection.x;
+        const float ty1 = (node.minPoint.y - origin.y) * invDirection.y;
+        const float ty2 = (node.maxPoint.y - origin.y) * invDirection.y;
+        const float tz1 = (node.minPoint.z - origin.z) * invDirection.z;
+        const float tz2 = (node.maxPoint.z - origin.z) * invDirection.z;
+
+        const float tMin = std::max({ std::min(tx1, tx2), std::min(ty1, ty2), std::min(tz1, tz2), 0.0f });
+        const float tMax = std::min({ std::max(tx1, tx2), std::max(ty1, ty2), std::max(tz1, tz2), maxDistance });
+
+        return tMin <= tMax;
+    }
+}
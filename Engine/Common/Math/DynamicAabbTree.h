@@ -0,0 +1,265 @@
+﻿#pragma once
+
+namespace engine
+{
+    // 동적 AABB 트리 (리프에 여유분을 둔 fat AABB를 저장해서 조금 움직일 때는 트리를 건드리지 않음)
+    // 삽입 시 표면적 비용이 가장 작은 형제를 찾고, 올라가면서 회전으로 높이를 맞춤
+    class DynamicAabbTree
+    {
+    public:
+        static constexpr std::int32_t NullNode = -1;
+
+    private:
+        struct Node
+        {
+            Vector3 minPoint;
+            Vector3 maxPoint;
+            void* userData = nullptr;
+
+            std::int32_t parent = NullNode; // free 상태에서는 다음 free 노드
+            std::int32_t child1 = NullNode;
+            std::int32_t child2 = NullNode;
+            std::int32_t height = -1; // 리프 0, free -1
+
+            bool IsLeaf() const { return child1 == NullNode; }
+        };
+
+        std::vector<Node> m_nodes;
+        std::vector<std::int32_t> m_stack; // 쿼리 순회용
+        std::int32_t m_root = NullNode;
+        std::int32_t m_freeList = NullNode;
+        std::int32_t m_proxyCount = 0;
+        float m_margin = 0.1f;
+
+    public:
+        DynamicAabbTree();
+
+    public:
+        std::int32_t CreateProxy(const DirectX::BoundingBox& bounds, void* userData);
+        void DestroyProxy(std::int32_t proxyId);
+
+        // fat AABB를 벗어났을 때만 다시 삽입하고 true를 반환
+        bool MoveProxy(std::int32_t proxyId, const DirectX::BoundingBox& bounds);
+
+        void* GetUserData(std::int32_t proxyId) const;
+        DirectX::BoundingBox GetFatBounds(std::int32_t proxyId) const;
+
+        std::int32_t GetProxyCount() const;
+        std::int32_t GetHeight() const;
+        void SetMargin(float margin);
+
+        void Clear();
+
+    public:
+        // callback(userData) -> bool, false를 반환하면 순회를 멈춤
+        template <typename Callback>
+        void QueryFrustum(const DirectX::BoundingFrustum& frustum, Callback&& callback);
+
+        template <typename Callback>
+        void QueryBox(const DirectX::BoundingBox& box, Callback&& callback);
+
+        template <typename Callback>
+        void QuerySphere(const DirectX::BoundingSphere& sphere, Callback&& callback);
+
+        // direction은 정규화되어 있어야 함
+        // callback(userData, distance) -> float
+        // 반환값으로 이후 탐색할 최대 거리를 정함 (0 이하면 중단, maxDistance를 그대로 반환하면 계속)
+        template <typename Callback>
+        void QueryRay(const Vector3& origin, const Vector3& direction, float maxDistance, Callback&& callback);
+
+    private:
+        std::int32_t AllocateNode();
+        void FreeNode(std::int32_t node);
+
+        void InsertLeaf(std::int32_t leaf);
+        void RemoveLeaf(std::int32_t leaf);
+        std::int32_t Balance(std::int32_t a);
+
+        template <typename Overlap, typename Callback>
+        void Query(Overlap&& overlap, Callback&& callback);
+
+        static DirectX::BoundingBox ToBoundingBox(const Node& node);
+        static float GetSurfaceArea(const Vector3& minPoint, const Vector3& maxPoint);
+        static bool RayIntersects(const Vector3& origin, const Vector3& invDirection, float maxDistance, const Node& node);
+    };
+
+    template<typename Callback>
+    inline void DynamicAabbTree::QueryFrustum(const DirectX::BoundingFrustum& frustum, Callback&& callback)
+    {
+        if (m_root == NullNode)
+        {
+            return;
+        }
+
+        m_stack.clear();
+        m_stack.push_back(m_root);
+
+        while (!m_stack.empty())
+        {
+            const std::int32_t nodeId = m_stack.back();
+            m_stack.pop_back();
+
+            const Node& node = m_nodes[nodeId];
+            const DirectX::ContainmentType containment = frustum.Contains(ToBoundingBox(node));
+
+            if (containment == DirectX::DISJOINT)
+            {
+                continue;
+            }
+
+            if (containment == DirectX::CONTAINS)
+            {
+                // 완전히 들어온 서브트리는 더 검사하지 않고 리프를 모두 넘김
+                const size_t base = m_stack.size();
+                m_stack.push_back(nodeId);
+
+                while (m_stack.size() > base)
+                {
+                    const Node& inner = m_nodes[m_stack.back()];
+                    m_stack.pop_back();
+
+                    if (inner.IsLeaf())
+                    {
+                        if (!callback(inner.userData))
+                        {
+                            return;
+                        }
+                    }
+                    else
+                    {
+                        m_stack.push_back(inner.child1);
+                        m_stack.push_back(inner.child2);
+                    }
+                }
+
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                if (!callback(node.userData))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                m_stack.push_back(node.child1);
+                m_stack.push_back(node.child2);
+            }
+        }
+    }
+
+    template<typename Callback>
+    inline void DynamicAabbTree::QueryBox(const DirectX::BoundingBox& box, Callback&& callback)
+    {
+        const Vector3 minPoint = Vector3(box.Center) - Vector3(box.Extents);
+        const Vector3 maxPoint = Vector3(box.Center) + Vector3(box.Extents);
+
+        Query([&](const Node& node)
+            {
+                return node.minPoint.x <= maxPoint.x && node.maxPoint.x >= minPoint.x &&
+                    node.minPoint.y <= maxPoint.y && node.maxPoint.y >= minPoint.y &&
+                    node.minPoint.z <= maxPoint.z && node.maxPoint.z >= minPoint.z;
+            },
+            callback);
+    }
+
+    template<typename Callback>
+    inline void DynamicAabbTree::QuerySphere(const DirectX::BoundingSphere& sphere, Callback&& callback)
+    {
+        const Vector3 center = sphere.Center;
+        const float radiusSq = sphere.Radius * sphere.Radius;
+
+        Query([&](const Node& node)
+            {
+                const Vector3 closest = Vector3::Max(node.minPoint, Vector3::Min(center, node.maxPoint));
+                return Vector3::DistanceSquared(center, closest) <= radiusSq;
+            },
+            callback);
+    }
+
+    template<typename Callback>
+    inline void DynamicAabbTree::QueryRay(const Vector3& origin, const Vector3& direction, float maxDistance, Callback&& callback)
+    {
+        if (m_root == NullNode)
+        {
+            return;
+        }
+
+        const Vector3 invDirection(
+            direction.x != 0.0f ? 1.0f / direction.x : FLT_MAX,
+            direction.y != 0.0f ? 1.0f / direction.y : FLT_MAX,
+            direction.z != 0.0f ? 1.0f / direction.z : FLT_MAX);
+
+        m_stack.clear();
+        m_stack.push_back(m_root);
+
+        while (!m_stack.empty())
+        {
+            const Node& node = m_nodes[m_stack.back()];
+            m_stack.pop_back();
+
+            if (!RayIntersects(origin, invDirection, maxDistance, node))
+            {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                float distance = 0.0f;
+                if (!ToBoundingBox(node).Intersects(origin, direction, distance) || distance > maxDistance)
+                {
+                    continue;
+                }
+
+                maxDistance = callback(node.userData, distance);
+                if (maxDistance <= 0.0f)
+                {
+                    return;
+                }
+            }
+            else
+            {
+                m_stack.push_back(node.child1);
+                m_stack.push_back(node.child2);
+            }
+        }
+    }
+
+    template<typename Overlap, typename Callback>
+    inline void DynamicAabbTree::Query(Overlap&& overlap, Callback&& callback)
+    {
+        if (m_root == NullNode)
+        {
+            return;
+        }
+
+        m_stack.clear();
+        m_stack.push_back(m_root);
+
+        while (!m_stack.empty())
+        {
+            const Node& node = m_nodes[m_stack.back()];
+            m_stack.pop_back();
+
+            if (!overlap(node))
+            {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                if (!callback(node.userData))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                m_stack.push_back(node.child1);
+                m_stack.push_back(node.child2);
+            }
+        }
+    }
+}
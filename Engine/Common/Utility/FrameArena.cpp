@@ -0,0 +1,152 @@
+﻿#include "EnginePCH.h"
+#include "FrameArena.h"
+
+namespace engine
+{
+    void FrameArena::BeginFrame()
+    {
+        const std::uint32_t next = (m_bufferIndex.load(std::memory_order_relaxed) + 1) % BufferCount;
+
+        {
+            std::lock_guard lock(m_mutex);
+
+            m_usedBytes = 0;
+            for (auto& threadArena : m_threadArenas)
+            {
+                ResetBuffer(threadArena->buffers[next]);
+            }
+            m_peakUsedBytes = std::max(m_peakUsedBytes, m_usedBytes);
+        }
+
+        // 리셋이 끝난 뒤에 바꿔야 다른 스레드가 비우는 중인 버퍼에 할당하지 않음
+        m_bufferIndex.store(next, std::memory_order_release);
+    }
+
+    void* FrameArena::Allocate(std::size_t size, std::size_t alignment)
+    {
+        Buffer& buffer = GetThreadArena().buffers[m_bufferIndex.load(std::memory_order_acquire)];
+
+        while (true)
+        {
+            if (buffer.blockIndex < buffer.blocks.size())
+            {
+                Block& block = buffer.blocks[buffer.blockIndex];
+
+                const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.data.get());
+                const std::uintptr_t aligned = (base + buffer.offset + alignment - 1) & ~(alignment - 1);
+
+                if (aligned + size <= base + block.size)
+                {
+                    buffer.offset = aligned + size - base;
+                    return reinterpret_cast<void*>(aligned);
+                }
+
+                ++buffer.blockIndex;
+                buffer.offset = 0;
+                continue;
+            }
+
+            const std::size_t blockSize = std::max(DefaultBlockSize, size + alignment);
+            buffer.blocks.push_back(Block{ std::make_unique<std::byte[]>(blockSize), blockSize });
+            buffer.blockIndex = buffer.blocks.size() - 1;
+            buffer.offset = 0;
+
+            m_reservedBytes.fetch_add(blockSize, std::memory_order_relaxed);
+            m_blockAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    FrameArenaStats FrameArena::GetStats()
+    {
+        std::lock_guard lock(m_mutex);
+
+        FrameArenaStats stats;
+        stats.usedBytes = m_usedBytes;
+        stats.peakUsedBytes = m_peakUsedBytes;
+        stats.reservedBytes = m_reservedBytes.load(std::memory_order_relaxed);
+        stats.threadCount = m_threadArenas.size();
+        stats.blockAllocationCount = m_blockAllocationCount.load(std::memory_order_relaxed);
+
+        return stats;
+    }
+
+    FrameArena::ThreadArena& FrameArena::GetThreadArena()
+    {
+        // 처음 할당할 때 받고 스레드가 끝나면 돌려줌
+        thread_local ThreadArenaHandle handle;
+
+        if (handle.threadArena == nullptr)
+        {
+            std::lock_guard lock(m_mutex);
+
+            // 끝난 스레드의 것이 있으면 이어서 씀 (리셋하지 않으므로 그 스레드가 남긴 데이터도 그대로 유효)
+            ThreadArena* threadArena = nullptr;
+            for (auto& candidate : m_threadArenas)
+            {
+                if (!candidate->isInUse)
+                {
+                    threadArena = candidate.get();
+                    break;
+                }
+            }
+
+            if (threadArena == nullptr)
+            {
+                m_threadArenas.push_back(std::make_unique<ThreadArena>());
+                threadArena = m_threadArenas.back().get();
+            }
+
+            threadArena->isInUse = true;
+            handle.threadArena = threadArena;
+        }
+
+        return *handle.threadArena;
+    }
+
+    void FrameArena::ReleaseThreadArena(ThreadArena* threadArena)
+    {
+        std::lock_guard lock(m_mutex);
+
+        threadArena->isInUse = false;
+    }
+
+    FrameArena::ThreadArenaHandle::~ThreadArenaHandle()
+    {
+        if (threadArena != nullptr)
+        {
+            FrameArena::Get().ReleaseThreadArena(threadArena);
+        }
+    }
+
+    void FrameArena::ResetBuffer(Buffer& buffer)
+    {
+        if (buffer.blocks.empty())
+        {
+            return;
+        }
+
+        std::size_t usedBytes = buffer.offset;
+        std::size_t totalSize = 0;
+        for (std::size_t i = 0; i < buffer.blocks.size(); ++i)
+        {
+            totalSize += buffer.blocks[i].size;
+            if (i < buffer.blockIndex)
+            {
+                usedBytes += buffer.blocks[i].size;
+            }
+        }
+        m_usedBytes += usedBytes;
+
+        // 넘쳐서 블록이 여러 개가 됐으면 합친 크기의 블록 하나로 바꿈 (예약한 총량은 그대로)
+        if (buffer.blocks.size() > 1)
+        {
+            buffer.blocks.clear();
+            buffer.blocks.push_back(Block{ std::make_unique<std::byte[]>(totalSize), totalSize });
+
+            m_blockAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        buffer.blockIndex = 0;
+        buffer.offset = 0;
+    }
+}
@@ -0,0 +1,127 @@
+﻿#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Common/Utility/Singleton.h"
+
+namespace engine
+{
+    struct FrameArenaStats
+    {
+        std::size_t usedBytes = 0; // 가장 최근에 리셋한 버퍼가 쓴 양 (모든 스레드 합)
+        std::size_t peakUsedBytes = 0;
+        std::size_t reservedBytes = 0;
+        std::size_t threadCount = 0;
+        std::uint64_t blockAllocationCount = 0; // 블록을 힙에서 새로 만든 횟수 (안정되면 더 늘지 않음)
+    };
+
+    // 한 프레임 동안만 쓰는 임시 데이터용 선형 할당기
+    // - 스레드마다 sub-arena가 있어서 할당은 잠금 없이 포인터만 밀고, 해제는 하지 않음
+    // - 버퍼 2개를 번갈아 쓰므로 이번 프레임에 할당한 것은 다음 프레임이 끝날 때까지 유효
+    // - 블록이 모자라면 하나 더 만들고, 리셋할 때 하나로 합쳐서 계속 재사용 (몇 프레임 뒤부터는 힙 할당 없음)
+    // BeginFrame은 WinApp::Update 맨 앞에서만 호출하고, 프레임 경계를 넘어 도는 잡에서는 쓰지 않음
+    class FrameArena :
+        public Singleton<FrameArena>
+    {
+    private:
+        static constexpr std::size_t BufferCount = 2;
+        static constexpr std::size_t DefaultBlockSize = 256 * 1024;
+
+        struct Block
+        {
+            std::unique_ptr<std::byte[]> data;
+            std::size_t size = 0;
+        };
+
+        struct Buffer
+        {
+            std::vector<Block> blocks;
+            std::size_t blockIndex = 0;
+            std::size_t offset = 0; // blocks[blockIndex] 안의 위치
+        };
+
+        struct ThreadArena
+        {
+            Buffer buffers[BufferCount];
+            bool isInUse = false; // 스레드가 끝나면 false가 되고 새 스레드가 이어서 씀
+        };
+
+        // 스레드가 끝날 때 sub-arena를 돌려주기 위한 thread_local
+        struct ThreadArenaHandle
+        {
+            ThreadArena* threadArena = nullptr;
+
+            ~ThreadArenaHandle();
+        };
+
+        std::mutex m_mutex;
+        std::vector<std::unique_ptr<ThreadArena>> m_threadArenas;
+
+        std::atomic<std::uint32_t> m_bufferIndex{ 0 };
+
+        std::size_t m_usedBytes = 0;
+        std::size_t m_peakUsedBytes = 0;
+        std::atomic<std::size_t> m_reservedBytes{ 0 }; // 블록 목록은 각 스레드가 잠금 없이 늘리므로 따로 셈
+        std::atomic<std::uint64_t> m_blockAllocationCount{ 0 };
+
+    private:
+        FrameArena() = default;
+        ~FrameArena() = default;
+
+    public:
+        // 다음 버퍼로 넘어가면서 그 버퍼 (두 프레임 전에 쓴 것)를 비움
+        void BeginFrame();
+
+        void* Allocate(std::size_t size, std::size_t alignment);
+
+        FrameArenaStats GetStats();
+
+    private:
+        ThreadArena& GetThreadArena();
+        void ReleaseThreadArena(ThreadArena* threadArena);
+        void ResetBuffer(Buffer& buffer);
+
+    private:
+        friend class Singleton<FrameArena>;
+    };
+
+    // STL 컨테이너용 (deallocate는 아무것도 하지 않으므로 미리 reserve하는 것이 좋음)
+    template <typename T>
+    class FrameAllocator
+    {
+    public:
+        using value_type = T;
+
+    public:
+        FrameAllocator() = default;
+
+        template <typename U>
+        FrameAllocator(const FrameAllocator<U>&) noexcept
+        {
+        }
+
+    public:
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(FrameArena::Get().Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T*, std::size_t) noexcept
+        {
+        }
+
+        template <typename U>
+        bool operator==(const FrameAllocator<U>&) const noexcept
+        {
+            return true;
+        }
+    };
+
+    // 이번 프레임과 다음 프레임까지만 유효 (멤버나 static에 저장하면 안 됨)
+    template <typename T>
+    using FrameVector = std::vector<T, FrameAllocator<T>>;
+}
@@ -0,0 +1,472 @@
+﻿#include "JobSystem.h"
+
+#include <cassert>
+
+namespace engine
+{
+    namespace
+    {
+        // 현재 스레드가 쓰는 deque 번호 (잡 시스템 밖의 스레드는 -1)
+        thread_local std::int32_t t_queueIndex = -1;
+    }
+
+    bool JobCounter::IsDone() const
+    {
+        if (m_value.load(std::memory_order_acquire) != 0)
+        {
+            return false;
+        }
+
+        // 마지막 잡이 Complete에서 잠금을 풀 때까지 기다림 (true를 받은 쪽이 바로 counter를 해제할 수 있으므로)
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return true;
+    }
+
+    void JobSystem::JobRing::Reserve(std::size_t capacity)
+    {
+        if (capacity <= m_nodes.size())
+        {
+            return;
+        }
+
+        // 앞에서부터 순서대로 옮김
+        std::vector<JobNode*> nodes(capacity);
+        for (std::size_t i = 0; i < m_count; ++i)
+        {
+            nodes[i] = m_nodes[(m_head + i) % m_nodes.size()];
+        }
+
+        m_nodes.swap(nodes);
+        m_head = 0;
+    }
+
+    bool JobSystem::JobRing::IsEmpty() const
+    {
+        return m_count == 0;
+    }
+
+    void JobSystem::JobRing::PushBack(JobNode* node)
+    {
+        if (m_count == m_nodes.size())
+        {
+            Reserve(m_nodes.empty() ? InitialQueueCapacity : m_nodes.size() * 2);
+        }
+
+        m_nodes[(m_head + m_count) % m_nodes.size()] = node;
+        ++m_count;
+    }
+
+    JobNode* JobSystem::JobRing::PopBack()
+    {
+        --m_count;
+        return m_nodes[(m_head + m_count) % m_nodes.size()];
+    }
+
+    JobNode* JobSystem::JobRing::PopFront()
+    {
+        JobNode* node = m_nodes[m_head];
+        m_head = (m_head + 1) % m_nodes.size();
+        --m_count;
+
+        return node;
+    }
+
+    JobSystem::~JobSystem()
+    {
+        Shutdown();
+    }
+
+    void JobSystem::Initialize(std::uint32_t workerCount)
+    {
+        assert(!m_isRunning && "JobSystem is already initialized");
+
+        if (workerCount == 0)
+        {
+            const std::uint32_t hardwareCount = std::thread::hardware_concurrency();
+            workerCount = hardwareCount > 1 ? hardwareCount - 1 : 1;
+        }
+
+        m_mainThreadId = std::this_thread::get_id();
+        t_queueIndex = 0;
+
+        m_queues.clear();
+        for (std::uint32_t i = 0; i < workerCount + 1; ++i)
+        {
+            m_queues.push_back(std::make_unique<WorkQueue>());
+            m_queues.back()->jobs.Reserve(InitialQueueCapacity);
+        }
+        m_mainThreadJobs.Reserve(InitialQueueCapacity);
+        m_backgroundJobs.Reserve(InitialQueueCapacity);
+
+        m_isRunning = true;
+
+        m_workers.reserve(workerCount);
+        for (std::uint32_t i = 0; i < workerCount; ++i)
+        {
+            m_workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+        }
+    }
+
+    void JobSystem::Shutdown()
+    {
+        if (!m_isRunning)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_isRunning = false;
+        }
+        m_sleepCondition.notify_all();
+
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+        m_workers.clear();
+
+        // 남은 잡은 메인 스레드에서 마저 실행
+        while (true)
+        {
+            JobNode* node = TryPop(0);
+            if (node == nullptr)
+            {
+                node = TrySteal(0);
+            }
+            if (node == nullptr)
+            {
+                node = TryPopMainThreadJob();
+            }
+            if (node == nullptr)
+            {
+                node = TryPopBackgroundJob();
+            }
+
+            if (node == nullptr)
+            {
+                break;
+            }
+
+            Execute(node);
+        }
+
+        m_queues.clear();
+    }
+
+    void JobSystem::ExecuteMainThreadJobs()
+    {
+        assert(IsMainThread());
+
+        while (JobNode* node = TryPopMainThreadJob())
+        {
+            Execute(node);
+        }
+    }
+
+    void JobSystem::Wait(JobCounter& counter)
+    {
+        while (!counter.IsDone())
+        {
+            if (!TryExecuteOne())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::uint32_t JobSystem::GetWorkerCount() const
+    {
+        return static_cast<std::uint32_t>(m_workers.size());
+    }
+
+    bool JobSystem::IsMainThread() const
+    {
+        return std::this_thread::get_id() == m_mainThreadId;
+    }
+
+    void JobSystem::Submit(JobNode* node)
+    {
+        if (m_queues.empty())
+        {
+            // 초기화 전에는 바로 실행
+            Execute(node);
+            return;
+        }
+
+        Push(node);
+    }
+
+    void JobSystem::SubmitAfter(JobCounter& dependency, JobNode* node)
+    {
+        {
+            std::lock_guard<std::mutex> lock(dependency.m_mutex);
+            if (dependency.m_value.load(std::memory_order_acquire) != 0)
+            {
+                node->next = dependency.m_continuations;
+                dependency.m_continuations = node;
+                return;
+            }
+        }
+
+        Submit(node);
+    }
+
+    void JobSystem::SubmitToMainThread(JobNode* node)
+    {
+        if (IsMainThread() && m_queues.empty())
+        {
+            Execute(node);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mainThreadMutex);
+        m_mainThreadJobs.PushBack(node);
+    }
+
+    void JobSystem::SubmitToBackground(JobNode* node)
+    {
+        if (m_workers.empty())
+        {
+            // 꺼내 갈 워커가 없으면 (초기화 전 / 종료 후) 바로 실행
+            Execute(node);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_backgroundMutex);
+            m_backgroundJobs.PushBack(node);
+            m_pendingJobCount.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+        m_sleepCondition.notify_one();
+    }
+
+    void JobSystem::WorkerLoop(std::uint32_t queueIndex)
+    {
+        t_queueIndex = static_cast<std::int32_t>(queueIndex);
+
+        while (true)
+        {
+            if (TryExecuteOne())
+            {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepCondition.wait(lock, [this]()
+                {
+                    return m_pendingJobCount.load(std::memory_order_acquire) > 0 || !m_isRunning;
+                });
+
+            if (!m_isRunning)
+            {
+                return;
+            }
+        }
+    }
+
+    bool JobSystem::TryExecuteOne()
+    {
+        // 메인 스레드 전용 잡은 메인 스레드에서만
+        if (IsMainThread())
+        {
+            if (JobNode* node = TryPopMainThreadJob())
+            {
+                Execute(node);
+                return true;
+            }
+        }
+
+        if (t_queueIndex < 0)
+        {
+            return false;
+        }
+
+        const std::uint32_t queueIndex = static_cast<std::uint32_t>(t_queueIndex);
+
+        JobNode* node = TryPop(queueIndex);
+        if (node == nullptr)
+        {
+            node = TrySteal(queueIndex);
+        }
+
+        // 백그라운드 잡은 프레임 잡이 없을 때 워커만
+        if (node == nullptr && queueIndex != 0)
+        {
+            node = TryPopBackgroundJob();
+        }
+
+        if (node == nullptr)
+        {
+            return false;
+        }
+
+        Execute(node);
+        return true;
+    }
+
+    JobNode* JobSystem::TryPop(std::uint32_t queueIndex)
+    {
+        WorkQueue& queue = *m_queues[queueIndex];
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.IsEmpty())
+        {
+            return nullptr;
+        }
+
+        m_pendingJobCount.fetch_sub(1, std::memory_order_acq_rel);
+
+        return queue.jobs.PopBack();
+    }
+
+    JobNode* JobSystem::TrySteal(std::uint32_t thiefIndex)
+    {
+        const std::uint32_t queueCount = static_cast<std::uint32_t>(m_queues.size());
+
+        for (std::uint32_t i = 1; i < queueCount; ++i)
+        {
+            WorkQueue& queue = *m_queues[(thiefIndex + i) % queueCount];
+
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.jobs.IsEmpty())
+            {
+                continue;
+            }
+
+            m_pendingJobCount.fetch_sub(1, std::memory_order_acq_rel);
+
+            return queue.jobs.PopFront();
+        }
+
+        return nullptr;
+    }
+
+    JobNode* JobSystem::TryPopMainThreadJob()
+    {
+        std::lock_guard<std::mutex> lock(m_mainThreadMutex);
+        if (m_mainThreadJobs.IsEmpty())
+        {
+            return nullptr;
+        }
+
+        return m_mainThreadJobs.PopFront();
+    }
+
+    JobNode* JobSystem::TryPopBackgroundJob()
+    {
+        std::lock_guard<std::mutex> lock(m_backgroundMutex);
+        if (m_backgroundJobs.IsEmpty())
+        {
+            return nullptr;
+        }
+
+        m_pendingJobCount.fetch_sub(1, std::memory_order_acq_rel);
+
+        return m_backgroundJobs.PopFront();
+    }
+
+    void JobSystem::Push(JobNode* node)
+    {
+        // 잡 시스템 밖의 스레드에서 넣은 잡은 메인 스레드 deque로 (워커가 훔쳐감)
+        const std::uint32_t queueIndex = t_queueIndex >= 0 ? static_cast<std::uint32_t>(t_queueIndex) : 0;
+
+        {
+            WorkQueue& queue = *m_queues[queueIndex];
+
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.PushBack(node);
+            m_pendingJobCount.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        {
+            // 워커가 대기에 들어가는 사이에 알림을 놓치지 않도록 잠금을 한번 거침
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+        m_sleepCondition.notify_one();
+    }
+
+    void JobSystem::Execute(JobNode* node)
+    {
+        node->execute(node->storage);
+
+        // 카운터를 줄이면 기다리던 쪽이 바로 반환할 수 있으므로 노드를 먼저 돌려줌
+        JobCounter* counter = node->counter;
+        ReleaseNode(node);
+
+        if (counter != nullptr)
+        {
+            Complete(counter);
+        }
+    }
+
+    void JobSystem::Complete(JobCounter* counter)
+    {
+        JobNode* continuations = nullptr;
+
+        {
+            // 값이 0이 되는 것과 continuation을 꺼내는 것을 같은 잠금 안에서 처리해야
+            // RunAfter와 엇갈려도 잡을 잃지 않음
+            std::lock_guard<std::mutex> lock(counter->m_mutex);
+            if (counter->m_value.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return;
+            }
+
+            // 목록은 역순으로 쌓여 있으므로 걸어둔 순서로 되돌림
+            while (counter->m_continuations != nullptr)
+            {
+                JobNode* node = counter->m_continuations;
+                counter->m_continuations = node->next;
+                node->next = continuations;
+                continuations = node;
+            }
+        }
+
+        while (continuations != nullptr)
+        {
+            JobNode* node = continuations;
+            continuations = node->next;
+            node->next = nullptr;
+
+            Submit(node);
+        }
+    }
+
+    JobNode* JobSystem::AcquireNode()
+    {
+        std::lock_guard<std::mutex> lock(m_nodePoolMutex);
+
+        if (m_freeNodes == nullptr)
+        {
+            m_nodeChunks.push_back(std::make_unique<JobNode[]>(NodeChunkSize));
+
+            JobNode* chunk = m_nodeChunks.back().get();
+            for (std::size_t i = 0; i < NodeChunkSize; ++i)
+            {
+                chunk[i].next = m_freeNodes;
+                m_freeNodes = &chunk[i];
+            }
+        }
+
+        JobNode* node = m_freeNodes;
+        m_freeNodes = node->next;
+        node->next = nullptr;
+
+        return node;
+    }
+
+    void JobSystem::ReleaseNode(JobNode* node)
+    {
+        node->execute = nullptr;
+        node->counter = nullptr;
+
+        std::lock_guard<std::mutex> lock(m_nodePoolMutex);
+        node->next = m_freeNodes;
+        m_freeNodes = node;
+    }
+}
@@ -0,0 +1,284 @@
+﻿#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Common/Utility/Singleton.h"
+
+// 그래픽스/Windows 의존성 없이 표준 라이브러리만 사용 (PCH도 사용하지 않음)
+
+namespace engine
+{
+    class JobCounter;
+
+    // 잡 하나 (JobSystem의 풀에서 꺼내 쓰고 실행이 끝나면 돌려줌)
+    // std::function 대신 캡처를 노드 안에 바로 만들므로 InlineSize 이하면 힙 할당이 없음 (넘으면 그 잡만 힙에 둠)
+    struct JobNode
+    {
+        static constexpr std::size_t InlineSize = 64;
+
+        alignas(std::max_align_t) std::byte storage[InlineSize];
+        void (*execute)(void* storage) = nullptr; // 호출한 뒤 캡처도 소멸시킴
+        JobCounter* counter = nullptr;
+        JobNode* next = nullptr; // 풀의 빈 노드 / 카운터의 continuation 목록
+
+        template <typename Function>
+        void Emplace(Function&& function);
+    };
+
+    // 잡 완료를 세는 카운터
+    // Run에 넘기면 잡 하나당 1씩 늘었다가 끝나면 줄어듦, 0이 되면 RunAfter로 걸어둔 잡들이 실행됨
+    // 스택에 둔 카운터는 JobSystem::Wait가 반환되거나 IsDone이 true를 돌려준 뒤에 해제해야 함
+    class JobCounter
+    {
+    private:
+        std::atomic<std::int32_t> m_value{ 0 };
+        mutable std::mutex m_mutex;
+        JobNode* m_continuations = nullptr;
+
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+    public:
+        bool IsDone() const;
+
+    private:
+        friend class JobSystem;
+    };
+
+    // work-stealing 잡 시스템
+    // 스레드마다 deque를 하나씩 가지고, 자기 것은 뒤에서(LIFO) 꺼내고 다른 스레드 것은 앞에서(FIFO) 훔침
+    // 메인 스레드는 0번 deque를 쓰며 Wait 중에는 같이 일함
+    // RunInBackground로 넣은 잡은 따로 모아서 워커만 (프레임 잡이 없을 때) 꺼내 감
+    // 잡 노드와 deque는 재사용하므로 처음 몇 프레임이 지나면 Run / ParallelFor가 힙 할당을 하지 않음
+    class JobSystem :
+        public Singleton<JobSystem>
+    {
+    private:
+        static constexpr std::size_t NodeChunkSize = 256;
+        static constexpr std::size_t InitialQueueCapacity = 1024;
+
+        // 링 버퍼 deque (꽉 차면 두 배로 늘리고 줄이지 않음)
+        class JobRing
+        {
+        private:
+            std::vector<JobNode*> m_nodes;
+            std::size_t m_head = 0;
+            std::size_t m_count = 0;
+
+        public:
+            void Reserve(std::size_t capacity);
+
+            bool IsEmpty() const;
+            void PushBack(JobNode* node);
+            JobNode* PopBack();
+            JobNode* PopFront();
+        };
+
+        struct WorkQueue
+        {
+            std::mutex mutex;
+            JobRing jobs;
+        };
+
+        std::vector<std::unique_ptr<WorkQueue>> m_queues; // 0: 메인 스레드, 1~: 워커
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_mainThreadMutex;
+        JobRing m_mainThreadJobs;
+
+        std::mutex m_backgroundMutex;
+        JobRing m_backgroundJobs; // 넣은 순서대로
+
+        std::mutex m_nodePoolMutex;
+        std::vector<std::unique_ptr<JobNode[]>> m_nodeChunks;
+        JobNode* m_freeNodes = nullptr;
+
+        std::mutex m_sleepMutex;
+        std::condition_variable m_sleepCondition;
+        std::atomic<std::int32_t> m_pendingJobCount{ 0 };
+        std::atomic<bool> m_isRunning{ false };
+
+        std::thread::id m_mainThreadId;
+
+    private:
+        JobSystem() = default;
+        ~JobSystem();
+
+    public:
+        // workerCount가 0이면 (코어 수 - 1)개를 만듦
+        void Initialize(std::uint32_t workerCount = 0);
+        void Shutdown();
+
+        template <typename Function>
+        void Run(Function&& function, JobCounter* counter = nullptr);
+
+        // dependency가 0이 된 뒤에 function을 실행
+        template <typename Function>
+        void RunAfter(JobCounter& dependency, Function&& function, JobCounter* counter = nullptr);
+
+        // 메인 스레드에서만 실행되어야 하는 잡 (ExecuteMainThreadJobs 또는 메인 스레드의 Wait에서 실행)
+        template <typename Function>
+        void RunOnMainThread(Function&& function, JobCounter* counter = nullptr);
+        void ExecuteMainThreadJobs();
+
+        // 오래 걸리는 잡 (에셋 임포트 / 텍스처 디코드)
+        // 메인 스레드의 Wait / ParallelFor는 이 잡을 실행하지 않으므로 프레임 중간에 임포트가 끼어들지 않음
+        // 기다리는 쪽(메인 스레드 포함)은 워커가 끝낼 때까지 기다림
+        template <typename Function>
+        void RunInBackground(Function&& function, JobCounter* counter = nullptr);
+
+        // counter가 0이 될 때까지 다른 잡을 실행하면서 기다림
+        void Wait(JobCounter& counter);
+
+        // [0, count)를 grainSize씩 나눠서 function(begin, end)를 병렬로 실행하고 끝날 때까지 기다림
+        template <typename Function>
+        void ParallelFor(std::uint32_t count, std::uint32_t grainSize, Function&& function);
+
+        std::uint32_t GetWorkerCount() const;
+        bool IsMainThread() const;
+
+    private:
+        template <typename Function>
+        JobNode* CreateJob(Function&& function, JobCounter* counter);
+
+        void Submit(JobNode* node);
+        void SubmitAfter(JobCounter& dependency, JobNode* node);
+        void SubmitToMainThread(JobNode* node);
+        void SubmitToBackground(JobNode* node);
+
+        void WorkerLoop(std::uint32_t queueIndex);
+
+        bool TryExecuteOne();
+        JobNode* TryPop(std::uint32_t queueIndex);
+        JobNode* TrySteal(std::uint32_t thiefIndex);
+        JobNode* TryPopMainThreadJob();
+        JobNode* TryPopBackgroundJob();
+
+        void Push(JobNode* node);
+        void Execute(JobNode* node);
+        void Complete(JobCounter* counter);
+
+        JobNode* AcquireNode();
+        void ReleaseNode(JobNode* node);
+
+    private:
+        friend class Singleton<JobSystem>;
+    };
+
+    template <typename Function>
+    inline void JobNode::Emplace(Function&& function)
+    {
+        using Callable = std::decay_t<Function>;
+
+        if constexpr (sizeof(Callable) <= InlineSize && alignof(Callable) <= alignof(std::max_align_t))
+        {
+            ::new (static_cast<void*>(storage)) Callable(std::forward<Function>(function));
+
+            execute = [](void* data)
+                {
+                    Callable& callable = *std::launder(static_cast<Callable*>(data));
+                    callable();
+                    callable.~Callable();
+                };
+        }
+        else
+        {
+            ::new (static_cast<void*>(storage)) Callable*(new Callable(std::forward<Function>(function)));
+
+            execute = [](void* data)
+                {
+                    std::unique_ptr<Callable> callable{ *std::launder(static_cast<Callable**>(data)) };
+                    (*callable)();
+                };
+        }
+    }
+
+    template <typename Function>
+    inline void JobSystem::Run(Function&& function, JobCounter* counter)
+    {
+        Submit(CreateJob(std::forward<Function>(function), counter));
+    }
+
+    template <typename Function>
+    inline void JobSystem::RunAfter(JobCounter& dependency, Function&& function, JobCounter* counter)
+    {
+        SubmitAfter(dependency, CreateJob(std::forward<Function>(function), counter));
+    }
+
+    template <typename Function>
+    inline void JobSystem::RunOnMainThread(Function&& function, JobCounter* counter)
+    {
+        SubmitToMainThread(CreateJob(std::forward<Function>(function), counter));
+    }
+
+    template <typename Function>
+    inline void JobSystem::RunInBackground(Function&& function, JobCounter* counter)
+    {
+        SubmitToBackground(CreateJob(std::forward<Function>(function), counter));
+    }
+
+    template <typename Function>
+    inline JobNode* JobSystem::CreateJob(Function&& function, JobCounter* counter)
+    {
+        JobNode* node = AcquireNode();
+        node->Emplace(std::forward<Function>(function));
+        node->counter = counter;
+
+        if (counter != nullptr)
+        {
+            counter->m_value.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        return node;
+    }
+
+    template<typename Function>
+    inline void JobSystem::ParallelFor(std::uint32_t count, std::uint32_t grainSize, Function&& function)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (grainSize == 0)
+        {
+            grainSize = 1;
+        }
+
+        if (m_workers.empty() || count <= grainSize)
+        {
+            function(0u, count);
+            return;
+        }
+
+        JobCounter counter;
+
+        for (std::uint32_t begin = grainSize; begin < count; begin += grainSize)
+        {
+            const std::uint32_t end = begin + grainSize < count ? begin + grainSize : count;
+
+            Run([&function, begin, end]()
+                {
+                    function(begin, end);
+                },
+                &counter);
+        }
+
+        // 호출한 스레드도 첫 구간을 맡음
+        function(0u, grainSize);
+
+        Wait(counter);
+    }
+}
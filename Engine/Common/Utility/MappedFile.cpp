@@ -0,0 +1,80 @@
+﻿#include "EnginePCH.h"
+#include "MappedFile.h"
+
+namespace engine
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    bool MappedFile::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+        m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(m_file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            // 크기가 0인 파일은 매핑할 수 없음
+            Close();
+            return false;
+        }
+
+        m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mapping == nullptr)
+        {
+            Close();
+            return false;
+        }
+
+        m_data = static_cast<const std::byte*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (m_data == nullptr)
+        {
+            Close();
+            return false;
+        }
+
+        m_size = static_cast<std::size_t>(fileSize.QuadPart);
+
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data != nullptr)
+        {
+            UnmapViewOfFile(m_data);
+            m_data = nullptr;
+        }
+
+        if (m_mapping != nullptr)
+        {
+            CloseHandle(m_mapping);
+            m_mapping = nullptr;
+        }
+
+        if (m_file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(m_file);
+            m_file = INVALID_HANDLE_VALUE;
+        }
+
+        m_size = 0;
+    }
+
+    bool MappedFile::IsOpen() const
+    {
+        return m_data != nullptr;
+    }
+
+    std::span<const std::byte> MappedFile::GetBytes() const
+    {
+        return { m_data, m_size };
+    }
+}
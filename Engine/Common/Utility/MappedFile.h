@@ -0,0 +1,34 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace engine
+{
+    // 읽기 전용 메모리 맵 파일 (내용을 복사하지 않고 파일 데이터를 바로 읽음)
+    class MappedFile
+    {
+    private:
+        HANDLE m_file = INVALID_HANDLE_VALUE;
+        HANDLE m_mapping = nullptr;
+        const std::byte* m_data = nullptr;
+        std::size_t m_size = 0;
+
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+    public:
+        // 파일이 없거나 비어 있으면 false
+        bool Open(const std::filesystem::path& path);
+        void Close();
+
+        bool IsOpen() const;
+        // Close 전까지만 유효
+        std::span<const std::byte> GetBytes() const;
+    };
+}
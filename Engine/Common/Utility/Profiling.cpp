@@ -1,9 +1,63 @@
 ﻿#include "EnginePCH.h"
 #include "Profiling.h"
 
+#include <atomic>
 #include <psapi.h>
 #pragma comment(lib, "psapi.lib")
 
+#ifdef _DEBUG
+namespace
+{
+    std::atomic<UINT64> g_heapAllocationCount{ 0 };
+}
+
+// 프레임 중 힙 할당이 없는지 확인하기 위해 전역 operator new를 교체해서 횟수를 셈
+// 배열 / nothrow 버전은 기본 구현이 아래 함수들을 호출함
+void* operator new(std::size_t size)
+{
+    g_heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size != 0 ? size : 1))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    g_heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* ptr = _aligned_malloc(size != 0 ? size : 1, static_cast<std::size_t>(alignment)))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    _aligned_free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    _aligned_free(ptr);
+}
+#endif // _DEBUG
+
 namespace engine
 {
     namespace
@@ -15,6 +69,9 @@ namespace engine
         UINT64 g_vramUsage = 0;
         UINT64 g_dramUsage = 0;
         UINT64 g_pageFileUsage = 0;
+
+        UINT64 g_lastHeapAllocationCount = 0;
+        UINT64 g_lastFrameHeapAllocations = 0;
     }
 
     void Profiling::UpdateFPS(bool print)
@@ -55,6 +112,14 @@ namespace engine
         g_pageFileUsage = pmc.PagefileUsage;
     }
 
+    void Profiling::UpdateHeapAllocations()
+    {
+        const UINT64 count = GetHeapAllocationCount();
+
+        g_lastFrameHeapAllocations = count - g_lastHeapAllocationCount;
+        g_lastHeapAllocationCount = count;
+    }
+
     int Profiling::GetLastFPS()
     {
         return g_lastFPS;
@@ -74,4 +139,18 @@ namespace engine
     {
         return g_pageFileUsage;
     }
+
+    UINT64 Profiling::GetHeapAllocationCount()
+    {
+#ifdef _DEBUG
+        return g_heapAllocationCount.load(std::memory_order_relaxed);
+#else
+        return 0;
+#endif // _DEBUG
+    }
+
+    UINT64 Profiling::GetLastFrameHeapAllocations()
+    {
+        return g_lastFrameHeapAllocations;
+    }
 }
@@ -8,10 +8,16 @@ namespace engine
         static void UpdateFPS(bool print);
         static void UpdateVRAMUsage(UINT64 usage);
         static void UpdateMemoryUsage();
+        // 프레임 시작마다 호출 (지난 프레임의 힙 할당 횟수를 기록)
+        static void UpdateHeapAllocations();
 
         static int GetLastFPS();
         static UINT64 GetVRAMUsage();
         static UINT64 GetDRAMUsage();
         static UINT64 GetPageFileUsage();
+
+        // 전역 operator new 호출 횟수 (디버그 빌드에서만 셈, 릴리즈는 0)
+        static UINT64 GetHeapAllocationCount();
+        static UINT64 GetLastFrameHeapAllocations();
     };
 }
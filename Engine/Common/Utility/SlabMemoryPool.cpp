@@ -0,0 +1,70 @@
+﻿#include "EnginePCH.h"
+#include "SlabMemoryPool.h"
+
+namespace engine
+{
+    namespace
+    {
+        struct MemoryPoolRegistry
+        {
+            std::mutex mutex;
+            std::vector<SlabMemoryPoolBase*> pools;
+        };
+
+        // 풀은 여러 번역 단위의 전역 변수라서 초기화 순서와 상관없도록 함수 안의 static으로 둠
+        MemoryPoolRegistry& GetRegistry()
+        {
+            static MemoryPoolRegistry registry;
+            return registry;
+        }
+    }
+
+    SlabMemoryPoolBase::SlabMemoryPoolBase(const char* name) :
+        m_name{ name }
+    {
+        auto& registry = GetRegistry();
+
+        std::lock_guard lock(registry.mutex);
+        registry.pools.push_back(this);
+    }
+
+    SlabMemoryPoolBase::~SlabMemoryPoolBase()
+    {
+        auto& registry = GetRegistry();
+
+        std::lock_guard lock(registry.mutex);
+        std::erase(registry.pools, this);
+    }
+
+    std::vector<MemoryPoolStats> GetMemoryPoolStats()
+    {
+        auto& registry = GetRegistry();
+
+        std::lock_guard lock(registry.mutex);
+
+        std::vector<MemoryPoolStats> stats;
+        stats.reserve(registry.pools.size());
+
+        for (auto pool : registry.pools)
+        {
+            stats.push_back(pool->GetStats());
+        }
+
+        return stats;
+    }
+
+    std::size_t ReleaseEmptyMemoryPoolPages()
+    {
+        auto& registry = GetRegistry();
+
+        std::lock_guard lock(registry.mutex);
+
+        std::size_t releasedCount = 0;
+        for (auto pool : registry.pools)
+        {
+            releasedCount += pool->ReleaseEmptyPages();
+        }
+
+        return releasedCount;
+    }
+}
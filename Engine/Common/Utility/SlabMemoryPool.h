@@ -0,0 +1,353 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace engine
+{
+    struct MemoryPoolStats
+    {
+        const char* name = "";
+        std::size_t slotSize = 0;
+        std::size_t pageCount = 0;
+        std::size_t capacity = 0; // 모든 페이지의 slot 수
+        std::int64_t liveCount = 0;
+        std::int64_t peakCount = 0;
+        std::int64_t fallbackCount = 0; // 크기가 달라서 (파생 타입) ::operator new로 넘긴 횟수
+    };
+
+    // 타입과 상관없이 모든 풀의 통계를 모으고 빈 페이지를 반환하기 위한 공통 부분
+    class SlabMemoryPoolBase
+    {
+    protected:
+        const char* m_name;
+
+    public:
+        explicit SlabMemoryPoolBase(const char* name);
+        virtual ~SlabMemoryPoolBase();
+
+        SlabMemoryPoolBase(const SlabMemoryPoolBase&) = delete;
+        SlabMemoryPoolBase& operator=(const SlabMemoryPoolBase&) = delete;
+
+    public:
+        virtual MemoryPoolStats GetStats() const = 0;
+        // 살아있는 slot이 하나도 없는 페이지를 해제하고 해제한 페이지 수를 돌려줌
+        virtual std::size_t ReleaseEmptyPages() = 0;
+    };
+
+    // 생성된 모든 SlabMemoryPool
+    std::vector<MemoryPoolStats> GetMemoryPoolStats();
+    // 씬을 내린 직후 호출 (다음 씬이 작으면 메모리를 돌려줌)
+    std::size_t ReleaseEmptyMemoryPoolPages();
+
+    // 고정 크기 slot을 SlotsPerPage개씩 페이지 단위로 늘려가며 할당
+    // - 다 차면 새 페이지를 만들므로 개수 제한이 없음 (::operator new로 넘기는 건 크기가 다른 파생 타입뿐)
+    // - 공유 free list는 mutex로 보호
+    // - UseThreadCache면 스레드마다 slot을 몇 개씩 들고 있어서 대부분 잠금 없이 끝남
+    //   캐시가 풀을 가리키므로 정적 수명인 풀에서만 사용
+    template <typename T, std::size_t SlotsPerPage = 256, bool UseThreadCache = false>
+    requires std::is_class_v<T> && (SlotsPerPage > 0)
+    class SlabMemoryPool :
+        public SlabMemoryPoolBase
+    {
+    private:
+        union Slot
+        {
+            alignas(T) std::byte element[sizeof(T)];
+            Slot* next;
+        };
+
+        struct Page
+        {
+            Slot slots[SlotsPerPage];
+        };
+
+        struct ThreadCache
+        {
+            SlabMemoryPool* owner = nullptr;
+            Slot* head = nullptr;
+            std::size_t count = 0;
+
+            ~ThreadCache()
+            {
+                if (owner != nullptr)
+                {
+                    owner->Flush(*this, count);
+                }
+            }
+        };
+
+        static constexpr std::size_t ThreadCacheBatch = 32;
+
+    private:
+        mutable std::mutex m_mutex;
+        std::vector<Page*> m_pages;
+        Slot* m_freeList = nullptr;
+
+        std::atomic<std::int64_t> m_liveCount = 0;
+        std::atomic<std::int64_t> m_peakCount = 0;
+        std::atomic<std::int64_t> m_fallbackCount = 0;
+
+    public:
+        explicit SlabMemoryPool(const char* name) :
+            SlabMemoryPoolBase{ name }
+        {
+        }
+
+        ~SlabMemoryPool() override
+        {
+            if constexpr (UseThreadCache)
+            {
+                // 다른 스레드의 캐시는 스레드가 먼저 끝났다고 가정
+                if (auto& cache = GetThreadCache(); cache.owner == this)
+                {
+                    cache = ThreadCache{};
+                }
+            }
+
+            for (Page* page : m_pages)
+            {
+                delete page;
+            }
+        }
+
+    public:
+        void* Allocate(std::size_t size)
+        {
+            if (size != sizeof(T)) [[unlikely]]
+            {
+                m_fallbackCount.fetch_add(1, std::memory_order_relaxed);
+                return ::operator new(size);
+            }
+
+            Slot* slot = nullptr;
+
+            if constexpr (UseThreadCache)
+            {
+                auto& cache = GetThreadCache();
+                if (cache.owner == nullptr)
+                {
+                    cache.owner = this;
+                }
+
+                if (cache.owner == this)
+                {
+                    if (cache.head == nullptr)
+                    {
+                        Refill(cache);
+                    }
+
+                    slot = cache.head;
+                    cache.head = slot->next;
+                    --cache.count;
+                }
+            }
+
+            if (slot == nullptr)
+            {
+                std::lock_guard lock(m_mutex);
+                slot = PopShared();
+            }
+
+            const std::int64_t live = m_liveCount.fetch_add(1, std::memory_order_relaxed) + 1;
+            std::int64_t peak = m_peakCount.load(std::memory_order_relaxed);
+            while (live > peak && !m_peakCount.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+            {
+            }
+
+            return slot;
+        }
+
+        // size는 sized operator delete가 넘겨주는 실제 타입 크기
+        void Deallocate(void* ptr, std::size_t size)
+        {
+            if (ptr == nullptr)
+            {
+                return;
+            }
+
+            if (size != sizeof(T)) [[unlikely]]
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            m_liveCount.fetch_sub(1, std::memory_order_relaxed);
+
+            Slot* slot = static_cast<Slot*>(ptr);
+
+            if constexpr (UseThreadCache)
+            {
+                if (auto& cache = GetThreadCache(); cache.owner == this)
+                {
+                    slot->next = cache.head;
+                    cache.head = slot;
+
+                    // 한 스레드에서 해제만 계속하는 경우 절반을 돌려줌
+                    if (++cache.count >= ThreadCacheBatch * 2)
+                    {
+                        Flush(cache, ThreadCacheBatch);
+                    }
+                    return;
+                }
+            }
+
+            std::lock_guard lock(m_mutex);
+            slot->next = m_freeList;
+            m_freeList = slot;
+        }
+
+        MemoryPoolStats GetStats() const override
+        {
+            MemoryPoolStats stats;
+            stats.name = m_name;
+            stats.slotSize = sizeof(Slot);
+            stats.liveCount = m_liveCount.load(std::memory_order_relaxed);
+            stats.peakCount = m_peakCount.load(std::memory_order_relaxed);
+            stats.fallbackCount = m_fallbackCount.load(std::memory_order_relaxed);
+
+            std::lock_guard lock(m_mutex);
+            stats.pageCount = m_pages.size();
+            stats.capacity = m_pages.size() * SlotsPerPage;
+
+            return stats;
+        }
+
+        std::size_t ReleaseEmptyPages() override
+        {
+            std::lock_guard lock(m_mutex);
+
+            if (m_pages.empty())
+            {
+                return 0;
+            }
+
+            // 공유 free list에 있는 slot을 페이지별로 셈 (스레드 캐시에 있는 slot의 페이지는 해제하지 않음)
+            std::sort(m_pages.begin(), m_pages.end());
+            std::vector<std::size_t> freeCounts(m_pages.size(), 0);
+
+            for (Slot* slot = m_freeList; slot != nullptr; slot = slot->next)
+            {
+                ++freeCounts[FindPage(slot)];
+            }
+
+            std::vector<std::uint8_t> isReleased(m_pages.size(), 0);
+            std::size_t releasedCount = 0;
+            for (std::size_t i = 0; i < m_pages.size(); ++i)
+            {
+                if (freeCounts[i] == SlotsPerPage)
+                {
+                    isReleased[i] = 1;
+                    ++releasedCount;
+                }
+            }
+
+            if (releasedCount == 0)
+            {
+                return 0;
+            }
+
+            // 남는 페이지의 slot만으로 free list를 다시 엮음 (순서 유지)
+            Slot* head = nullptr;
+            Slot** tail = &head;
+            for (Slot* slot = m_freeList; slot != nullptr; slot = slot->next)
+            {
+                if (isReleased[FindPage(slot)] == 0)
+                {
+                    *tail = slot;
+                    tail = &slot->next;
+                }
+            }
+            *tail = nullptr;
+            m_freeList = head;
+
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < m_pages.size(); ++i)
+            {
+                if (isReleased[i] != 0)
+                {
+                    delete m_pages[i];
+                }
+                else
+                {
+                    m_pages[kept++] = m_pages[i];
+                }
+            }
+            m_pages.resize(kept);
+
+            return releasedCount;
+        }
+
+    private:
+        static ThreadCache& GetThreadCache()
+        {
+            thread_local ThreadCache cache;
+            return cache;
+        }
+
+        // m_mutex를 잡은 상태에서 호출
+        Slot* PopShared()
+        {
+            if (m_freeList == nullptr) [[unlikely]]
+            {
+                Page* page = new Page;
+                m_pages.push_back(page);
+
+                // 주소 순으로 나가도록 엮음
+                for (std::size_t i = 0; i < SlotsPerPage - 1; ++i)
+                {
+                    page->slots[i].next = &page->slots[i + 1];
+                }
+                page->slots[SlotsPerPage - 1].next = nullptr;
+
+                m_freeList = &page->slots[0];
+            }
+
+            Slot* slot = m_freeList;
+            m_freeList = slot->next;
+            return slot;
+        }
+
+        void Refill(ThreadCache& cache)
+        {
+            std::lock_guard lock(m_mutex);
+
+            for (std::size_t i = 0; i < ThreadCacheBatch; ++i)
+            {
+                Slot* slot = PopShared();
+                slot->next = cache.head;
+                cache.head = slot;
+            }
+            cache.count += ThreadCacheBatch;
+        }
+
+        void Flush(ThreadCache& cache, std::size_t count)
+        {
+            std::lock_guard lock(m_mutex);
+
+            for (std::size_t i = 0; i < count && cache.head != nullptr; ++i)
+            {
+                Slot* slot = cache.head;
+                cache.head = slot->next;
+                --cache.count;
+
+                slot->next = m_freeList;
+                m_freeList = slot;
+            }
+        }
+
+        // m_pages가 주소 순으로 정렬된 상태에서 호출
+        std::size_t FindPage(const Slot* slot) const
+        {
+            auto it = std::upper_bound(m_pages.begin(), m_pages.end(), slot,
+                [](const Slot* s, const Page* page) { return s < page->slots; });
+
+            return static_cast<std::size_t>(it - m_pages.begin()) - 1;
+        }
+    };
+}
@@ -7,6 +7,8 @@
 #include <imgui_impl_dx11.h>
 
 #include "Common/Utility/Profiling.h"
+#include "Common/Utility/FrameArena.h"
+#include "Common/Utility/JobSystem.h"
 #include "Core/Graphics/Device/GraphicsDevice.h"
 #include "Core/Graphics/Resource/ResourceManager.h"
 #include "Core/App/ConfigLoader.h"
@@ -161,6 +163,8 @@ namespace engine
         ImGui_ImplWin32_Init(m_hWnd);
         ImGui_ImplDX11_Init(GraphicsDevice::Get().GetDevice().Get(), GraphicsDevice::Get().GetDeviceContext().Get());
 
+        JobSystem::Get().Initialize();
+
         AssetManager::Get().Initialize();
         ResourceManager::Get().Initialize();
 
@@ -195,6 +199,9 @@ namespace engine
         ImGui_ImplWin32_Shutdown();
         ImGui::DestroyContext();
 
+        // 잡이 참조하는 시스템들이 내려가기 전에 워커부터 정리
+        JobSystem::Get().Shutdown();
+
         EditorManager::Get().Shutdown();
         PhysicsSystem::Get().Shutdown();
         SceneManager::Get().Shutdown();
@@ -229,10 +236,21 @@ namespace engine
 
     void WinApp::Update()
     {
+        // 두 프레임 전의 임시 데이터를 비움
+        FrameArena::Get().BeginFrame();
+        Profiling::UpdateHeapAllocations();
+
         Profiling::UpdateFPS(true);
         Time::Update();
         Input::Update();
 
+        // 워커에서 넘긴 메인 스레드 전용 작업 처리
+        JobSystem::Get().ExecuteMainThreadJobs();
+
+        // 워커에서 끝난 비동기 로드를 반영 (메시가 먼저, 메시를 받은 렌더러가 텍스처를 요청함)
+        AssetManager::Get().PublishCompletedLoads();
+        ResourceManager::Get().PublishCompletedLoads();
+
 #ifdef _DEBUG
         switch (EditorManager::Get().GetEditorState())
         {
@@ -260,6 +278,8 @@ namespace engine
 
     void WinApp::Render()
     {
+        SystemManager::Get().GetTransformSystem().UpdateWorldMatrices();
+
         SystemManager::Get().GetRenderSystem().Render();
 
 #ifdef _DEBUG
@@ -284,6 +304,9 @@ namespace engine
         PhysicsSystem::Get().Update(Time::FixedDeltaTime());
         CollisionSystem::Get().ProcessEvents();
 
+        // 스크립트와 물리에서 움직인 Transform을 한번에 갱신
+        SystemManager::Get().GetTransformSystem().UpdateWorldMatrices();
+
         SystemManager::Get().GetCameraSystem().Update();
 
         SystemManager::Get().GetAnimatorSystem().Update();
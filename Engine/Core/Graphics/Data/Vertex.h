@@ -2,6 +2,7 @@
 
 #include <d3d11.h>
 #include <directxtk/SimpleMath.h> 
+#include <DirectXPackedVector.h>
 #include <array>
 
 namespace engine
@@ -9,6 +10,7 @@ namespace engine
     using Vector2 = DirectX::SimpleMath::Vector2;
     using Vector3 = DirectX::SimpleMath::Vector3;
     using Vector4 = DirectX::SimpleMath::Vector4;
+    using Matrix = DirectX::SimpleMath::Matrix;
 
     enum class VertexFormat
     {
@@ -17,7 +19,11 @@ namespace engine
         PositionNormal,
         PositionColor,
         PositionTexCoord,
-        BoneWeight
+        BoneWeight,
+        Compact,
+        CompactBoneWeight,
+        CommonInstanced,
+        Sprite
     };
 
     struct CommonVertex
@@ -220,4 +226,104 @@ namespace engine
 
         static constexpr VertexFormat vertexFormat = VertexFormat::BoneWeight;
     };
+
+    // 압축 정점 (24바이트, CommonVertex는 56바이트)
+    // - normal / tangent는 8면체 인코딩, binormal은 셰이더에서 cross(normal, tangent) * 부호로 복원
+    // - 인코드 / 디코드는 VertexCompression.h
+    struct CompactVertex
+    {
+        Vector3 position;
+        DirectX::PackedVector::XMHALF2 texCoord;
+        DirectX::PackedVector::XMSHORTN2 normal;
+        DirectX::PackedVector::XMUDECN4 tangent; // xy: 8면체 좌표를 [0, 1]로, w: binormal 부호 (0: -1, 1: +1)
+
+        static constexpr std::array<D3D11_INPUT_ELEMENT_DESC, 4> layout
+        {
+            // SemanticName , SemanticIndex , Format , InputSlot , AlignedByteOffset , InputSlotClass , InstanceDataStepRate
+            D3D11_INPUT_ELEMENT_DESC{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 0,  D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            D3D11_INPUT_ELEMENT_DESC{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT,       0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            D3D11_INPUT_ELEMENT_DESC{ "NORMAL",   0, DXGI_FORMAT_R16G16_SNORM,       0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            D3D11_INPUT_ELEMENT_DESC{ "TANGENT",  0, DXGI_FORMAT_R10G10B10A2_UNORM,  0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 }
+        };
+
+        static constexpr VertexFormat vertexFormat = VertexFormat::Compact;
+    };
+
+    static_assert(sizeof(CompactVertex) == 24);
+
+    // 압축 스키닝 정점 (32바이트, BoneWeightVertex는 104바이트)
+    // 본 번호는 MAX_BONE_NUM(128)보다 작으므로 8비트, 가중치는 합이 255가 되도록 8비트로 양자화
+    struct CompactBoneWeightVertex
+    {
+        Vector3 position;
+        DirectX::PackedVector::XMHALF2 texCoord;
+        DirectX::PackedVector::XMSHORTN2 normal;
+        DirectX::PackedVector::XMUDECN4 tangent;
+        DirectX::PackedVector::XMUBYTE4 blendIndices;
+        DirectX::PackedVector::XMUBYTEN4 blendWeights;
+
+        static constexpr std::array<D3D11_INPUT_ELEMENT_DESC, 6> layout
+        {
+            // SemanticName , SemanticIndex , Format , InputSlot , AlignedByteOffset , InputSlotClass , InstanceDataStepRate
+            D3D11_INPUT_ELEMENT_DESC{ "POSITION",     0, DXGI_FORMAT_R32G32B32_FLOAT,   0, 0,  D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            D3D11_INPUT_ELEMENT_DESC{ "TEXCOORD",     0, DXGI_FORMAT_R16G16_FLOAT,      0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            D3D11_INPUT_ELEMENT_DESC{ "NORMAL",       0, DXGI_FORMAT_R16G16_SNORM,      0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            D3D11_INPUT_ELEMENT_DESC{ "TANGENT",      0, DXGI_FORMAT_R10G10B10A2_UNORM, 0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            D3D11_INPUT_ELEMENT_DESC{ "BLENDINDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT,     0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            D3D11_INPUT_ELEMENT_DESC{ "BLENDWEIGHT",  0, DXGI_FORMAT_R8G8B8A8_UNORM,    0, 28, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        };
+
+        static constexpr VertexFormat vertexFormat = VertexFormat::CompactBoneWeight;
+    };
+
+    static_assert(sizeof(CompactBoneWeightVertex) == 32);
+
+    // 인스턴싱 VS의 인스턴스별 입력 (슬롯 1, 전치하지 않은 행을 HLSL에서 float4 4개로 받아 행렬을 만듦)
+    struct InstanceData
+    {
+        Matrix world;
+        Matrix worldInverseTranspose;
+    };
+
+    // CommonVertex (슬롯 0) + InstanceData (슬롯 1), 입력 레이아웃 전용
+    struct InstancedCommonVertex
+    {
+        static constexpr std::array<D3D11_INPUT_ELEMENT_DESC, 13> layout
+        {
+            // SemanticName , SemanticIndex , Format , InputSlot , AlignedByteOffset , InputSlotClass , InstanceDataStepRate
+            D3D11_INPUT_ELEMENT_DESC{ "POSITION",        0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 0,   D3D11_INPUT_PER_VERTEX_DATA,   0 },
+            D3D11_INPUT_ELEMENT_DESC{ "TEXCOORD",        0, DXGI_FORMAT_R32G32_FLOAT,       0, 12,  D3D11_INPUT_PER_VERTEX_DATA,   0 },
+            D3D11_INPUT_ELEMENT_DESC{ "NORMAL",          0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 20,  D3D11_INPUT_PER_VERTEX_DATA,   0 },
+            D3D11_INPUT_ELEMENT_DESC{ "TANGENT",         0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 32,  D3D11_INPUT_PER_VERTEX_DATA,   0 },
+            D3D11_INPUT_ELEMENT_DESC{ "BINORMAL",        0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 44,  D3D11_INPUT_PER_VERTEX_DATA,   0 },
+            D3D11_INPUT_ELEMENT_DESC{ "INSTANCE_WORLD",  0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0,   D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            D3D11_INPUT_ELEMENT_DESC{ "INSTANCE_WORLD",  1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16,  D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            D3D11_INPUT_ELEMENT_DESC{ "INSTANCE_WORLD",  2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 32,  D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            D3D11_INPUT_ELEMENT_DESC{ "INSTANCE_WORLD",  3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 48,  D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            D3D11_INPUT_ELEMENT_DESC{ "INSTANCE_NORMAL", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 64,  D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            D3D11_INPUT_ELEMENT_DESC{ "INSTANCE_NORMAL", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 80,  D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            D3D11_INPUT_ELEMENT_DESC{ "INSTANCE_NORMAL", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 96,  D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            D3D11_INPUT_ELEMENT_DESC{ "INSTANCE_NORMAL", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 112, D3D11_INPUT_PER_INSTANCE_DATA, 1 }
+        };
+
+        static constexpr VertexFormat vertexFormat = VertexFormat::CommonInstanced;
+    };
+
+    // SpriteBatch가 CPU에서 펼친 월드 공간 쿼드 정점 (색은 머티리얼 상수 버퍼 대신 정점에)
+    struct SpriteVertex
+    {
+        Vector3 position;
+        Vector2 texCoord;
+        Vector4 color;
+
+        static constexpr std::array<D3D11_INPUT_ELEMENT_DESC, 3> layout
+        {
+            // SemanticName , SemanticIndex , Format , InputSlot , AlignedByteOffset , InputSlotClass , InstanceDataStepRate
+            D3D11_INPUT_ELEMENT_DESC{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 0,  D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            D3D11_INPUT_ELEMENT_DESC{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,       0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            D3D11_INPUT_ELEMENT_DESC{ "COLOR",    0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 }
+        };
+
+        static constexpr VertexFormat vertexFormat = VertexFormat::Sprite;
+    };
 }
\ No newline at end of file
@@ -0,0 +1,200 @@
+﻿#include "EnginePCH.h"
+#include "VertexCompression.h"
+
+namespace engine
+{
+    using namespace DirectX::PackedVector;
+
+    namespace
+    {
+        float SignNotZero(float value)
+        {
+            return value >= 0.0f ? 1.0f : -1.0f;
+        }
+
+        // 공통 부분 (position / texCoord / normal / tangent / binormal 부호)
+        template <typename TCompact, typename TVertex>
+        void EncodeSurface(const TVertex& vertex, TCompact& outVertex)
+        {
+            outVertex.position = vertex.position;
+            outVertex.texCoord = XMHALF2{ vertex.texCoord.x, vertex.texCoord.y };
+
+            const Vector2 normal = EncodeOctahedral(vertex.normal);
+            outVertex.normal = XMSHORTN2{ normal.x, normal.y };
+
+            // 텍스처가 뒤집힌 면이면 binormal이 cross(normal, tangent)의 반대
+            const float sign = vertex.normal.Cross(vertex.tangent).Dot(vertex.binormal) < 0.0f ? 0.0f : 1.0f;
+            const Vector2 tangent = EncodeOctahedral(vertex.tangent) * 0.5f + Vector2{ 0.5f, 0.5f };
+            outVertex.tangent = XMUDECN4{ tangent.x, tangent.y, 0.0f, sign };
+        }
+
+        template <typename TVertex, typename TCompact>
+        void DecodeSurface(const TCompact& vertex, TVertex& outVertex)
+        {
+            outVertex.position = vertex.position;
+
+            Vector2 texCoord;
+            DirectX::XMStoreFloat2(&texCoord, XMLoadHalf2(&vertex.texCoord));
+            outVertex.texCoord = texCoord;
+
+            Vector2 normal;
+            DirectX::XMStoreFloat2(&normal, XMLoadShortN2(&vertex.normal));
+            outVertex.normal = DecodeOctahedral(normal);
+
+            Vector4 tangent;
+            DirectX::XMStoreFloat4(&tangent, XMLoadUDecN4(&vertex.tangent));
+            outVertex.tangent = DecodeOctahedral(Vector2{ tangent.x, tangent.y } * 2.0f - Vector2{ 1.0f, 1.0f });
+
+            const float sign = tangent.w > 0.5f ? 1.0f : -1.0f;
+            outVertex.binormal = outVertex.normal.Cross(outVertex.tangent) * sign;
+            outVertex.binormal.Normalize();
+        }
+    }
+
+    Vector2 EncodeOctahedral(const Vector3& direction)
+    {
+        const float length = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+        if (length <= 0.0f)
+        {
+            return Vector2{ 0.0f, 0.0f };
+        }
+
+        const Vector3 n = direction / length;
+        if (n.z >= 0.0f)
+        {
+            return Vector2{ n.x, n.y };
+        }
+
+        // 아래 반구는 대각선 기준으로 접어서 바깥 삼각형에
+        return Vector2{
+            (1.0f - std::abs(n.y)) * SignNotZero(n.x),
+            (1.0f - std::abs(n.x)) * SignNotZero(n.y) };
+    }
+
+    Vector3 DecodeOctahedral(const Vector2& encoded)
+    {
+        Vector3 n{ encoded.x, encoded.y, 1.0f - std::abs(encoded.x) - std::abs(encoded.y) };
+
+        const float t = std::max(-n.z, 0.0f);
+        n.x += n.x >= 0.0f ? -t : t;
+        n.y += n.y >= 0.0f ? -t : t;
+        n.Normalize();
+
+        return n;
+    }
+
+    CompactVertex EncodeCompactVertex(const CommonVertex& vertex)
+    {
+        CompactVertex result;
+        EncodeSurface(vertex, result);
+
+        return result;
+    }
+
+    CommonVertex DecodeCompactVertex(const CompactVertex& vertex)
+    {
+        CommonVertex result;
+        DecodeSurface(vertex, result);
+
+        return result;
+    }
+
+    CompactBoneWeightVertex EncodeCompactVertex(const BoneWeightVertex& vertex)
+    {
+        CompactBoneWeightVertex result;
+        EncodeSurface(vertex, result);
+
+        // 가중치 합이 정확히 255가 되도록 반올림 오차를 가장 큰 가중치에 몰아줌
+        std::array<std::uint8_t, 4> indices{};
+        std::array<int, 4> weights{};
+        int sum = 0;
+        int largest = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            assert(vertex.blendIndices[i] <= UINT8_MAX);
+
+            indices[i] = static_cast<std::uint8_t>(vertex.blendIndices[i]);
+            weights[i] = static_cast<int>(std::lround(std::clamp(vertex.blendWeights[i], 0.0f, 1.0f) * 255.0f));
+            sum += weights[i];
+
+            if (weights[i] > weights[largest])
+            {
+                largest = i;
+            }
+        }
+
+        if (sum > 0)
+        {
+            weights[largest] = std::clamp(weights[largest] + 255 - sum, 0, 255);
+        }
+
+        result.blendIndices = XMUBYTE4{ indices[0], indices[1], indices[2], indices[3] };
+        result.blendWeights = XMUBYTEN4{
+            static_cast<std::uint8_t>(weights[0]),
+            static_cast<std::uint8_t>(weights[1]),
+            static_cast<std::uint8_t>(weights[2]),
+            static_cast<std::uint8_t>(weights[3]) };
+
+        return result;
+    }
+
+    BoneWeightVertex DecodeCompactVertex(const CompactBoneWeightVertex& vertex)
+    {
+        BoneWeightVertex result;
+        DecodeSurface(vertex, result);
+
+        const std::array<std::uint8_t, 4> indices{ vertex.blendIndices.x, vertex.blendIndices.y, vertex.blendIndices.z, vertex.blendIndices.w };
+        const std::array<std::uint8_t, 4> weights{ vertex.blendWeights.x, vertex.blendWeights.y, vertex.blendWeights.z, vertex.blendWeights.w };
+        for (int i = 0; i < 4; ++i)
+        {
+            result.blendIndices[i] = indices[i];
+            result.blendWeights[i] = weights[i] / 255.0f;
+        }
+
+        return result;
+    }
+
+    std::vector<CompactVertex> EncodeCompactVertices(std::span<const CommonVertex> vertices)
+    {
+        std::vector<CompactVertex> result;
+        result.reserve(vertices.size());
+
+        for (const auto& vertex : vertices)
+        {
+            result.push_back(EncodeCompactVertex(vertex));
+        }
+
+        return result;
+    }
+
+    std::vector<CompactBoneWeightVertex> EncodeCompactVertices(std::span<const BoneWeightVertex> vertices)
+    {
+        std::vector<CompactBoneWeightVertex> result;
+        result.reserve(vertices.size());
+
+        for (const auto& vertex : vertices)
+        {
+            result.push_back(EncodeCompactVertex(vertex));
+        }
+
+        return result;
+    }
+
+    bool TryConvertToShortIndices(std::span<const DWORD> indices, std::vector<WORD>& outIndices)
+    {
+        outIndices.clear();
+
+        if (std::ranges::any_of(indices, [](DWORD index) { return index >= 0xFFFF; }))
+        {
+            return false;
+        }
+
+        outIndices.reserve(indices.size());
+        for (const DWORD index : indices)
+        {
+            outIndices.push_back(static_cast<WORD>(index));
+        }
+
+        return true;
+    }
+}
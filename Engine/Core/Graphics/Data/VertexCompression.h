@@ -0,0 +1,26 @@
+﻿#pragma once
+
+#include <span>
+
+#include "Core/Graphics/Data/Vertex.h"
+
+namespace engine
+{
+    // 단위 벡터 <-> 8면체 좌표 ([-1, 1]^2, 길이가 0이면 +Z)
+    Vector2 EncodeOctahedral(const Vector3& direction);
+    Vector3 DecodeOctahedral(const Vector2& encoded);
+
+    // binormal은 부호만 남기므로 디코드 결과는 cross(normal, tangent) * 부호 (단위 길이)
+    CompactVertex EncodeCompactVertex(const CommonVertex& vertex);
+    CommonVertex DecodeCompactVertex(const CompactVertex& vertex);
+
+    // 본 번호가 255를 넘으면 assert
+    CompactBoneWeightVertex EncodeCompactVertex(const BoneWeightVertex& vertex);
+    BoneWeightVertex DecodeCompactVertex(const CompactBoneWeightVertex& vertex);
+
+    std::vector<CompactVertex> EncodeCompactVertices(std::span<const CommonVertex> vertices);
+    std::vector<CompactBoneWeightVertex> EncodeCompactVertices(std::span<const BoneWeightVertex> vertices);
+
+    // 모든 인덱스가 16비트에 들어가면 변환하고 true (0xFFFF는 strip cut 값이라 쓰지 않음)
+    bool TryConvertToShortIndices(std::span<const DWORD> indices, std::vector<WORD>& outIndices);
+}
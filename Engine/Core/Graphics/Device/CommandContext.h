@@ -0,0 +1,52 @@
+﻿#pragma once
+
+#include "Core/Graphics/Device/GraphicsHandles.h"
+
+namespace engine
+{
+    class Renderer;
+    enum class RenderType;
+
+    // 패스 구분 / 바인드 / 업로드 / 드로우 명령
+    // - D3D11CommandContext: ID3D11DeviceContext (즉시 / deferred)로 그대로 넘김
+    // - NullCommandContext: GPU 없이 명령과 횟수만 기록 (헤드리스 검사 / 프레임별 제출 비용 측정)
+    // 리소스는 GraphicsHandles.h의 핸들로 받으므로 이 헤더와 null 백엔드는 D3D11 없이 빌드됨
+    class CommandContext
+    {
+    public:
+        virtual ~CommandContext() = default;
+
+    public:
+        // name은 패스가 끝날 때까지 유효해야 함 (문자열 리터럴)
+        virtual void BeginPass(const char* name) = 0;
+        virtual void EndPass() = 0;
+
+        virtual void SetPrimitiveTopology(PrimitiveTopology topology) = 0;
+        virtual void SetInputLayout(InputLayoutHandle inputLayout) = 0;
+        virtual void SetVertexBuffer(std::uint32_t slot, BufferHandle buffer, std::uint32_t stride) = 0;
+        virtual void SetIndexBuffer(BufferHandle buffer, IndexFormat format) = 0;
+
+        virtual void SetVertexShader(VertexShaderHandle shader) = 0;
+        virtual void SetPixelShader(PixelShaderHandle shader) = 0;
+        virtual void SetVSConstantBuffer(std::uint32_t slot, BufferHandle buffer) = 0;
+        virtual void SetPSConstantBuffer(std::uint32_t slot, BufferHandle buffer) = 0;
+        virtual void SetPSSampler(std::uint32_t slot, SamplerHandle samplerState) = 0;
+        virtual void SetPSShaderResources(std::uint32_t startSlot, std::uint32_t count, const ShaderResourceHandle* views) = 0;
+
+        virtual void SetRasterizerState(RasterizerStateHandle rasterizerState) = 0;
+        virtual RasterizerStateHandle GetRasterizerState() const = 0; // 바인드된 상태 (참조를 늘리지 않음)
+
+        // 기본 사용 버퍼 전체 (UpdateSubresource)
+        virtual void UpdateBuffer(BufferHandle buffer, const void* data, std::uint32_t byteSize) = 0;
+
+        // D3D11_USAGE_DYNAMIC 버퍼 앞부분 (Map WRITE_DISCARD)
+        virtual void UploadDynamicBuffer(BufferHandle buffer, const void* data, std::uint32_t byteSize) = 0;
+
+        virtual void DrawIndexed(std::uint32_t indexCount, std::uint32_t startIndex, std::int32_t baseVertex) = 0;
+        virtual void DrawIndexedInstanced(std::uint32_t indexCount, std::uint32_t instanceCount, std::uint32_t startIndex, std::int32_t baseVertex, std::uint32_t startInstance) = 0;
+
+        // 아직 packet을 만들지 않는 렌더러의 Renderer::Draw (렌더러가 즉시 context로 직접 그리므로 D3D11은 즉시 context에서만)
+        // null 백엔드는 렌더러를 부르지 않고 드로우 하나로 기록함
+        virtual void DrawRenderer(const Renderer& renderer, RenderType type) = 0;
+    };
+}
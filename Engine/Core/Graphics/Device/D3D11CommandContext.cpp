@@ -0,0 +1,153 @@
+﻿#include "EnginePCH.h"
+#include "D3D11CommandContext.h"
+
+#include "Framework/Object/Component/Renderer.h"
+
+namespace engine
+{
+    D3D11CommandContext::D3D11CommandContext(ID3D11DeviceContext* context) :
+        m_context{ context }
+    {
+        m_context->QueryInterface(IID_PPV_ARGS(&m_annotation));
+    }
+
+    void D3D11CommandContext::BeginPass(const char* name)
+    {
+        if (m_annotation == nullptr)
+        {
+            return;
+        }
+
+        // 패스 이름은 ASCII
+        std::array<wchar_t, 64> wideName{};
+        for (std::size_t i = 0; i + 1 < wideName.size() && name[i] != '\0'; ++i)
+        {
+            wideName[i] = static_cast<wchar_t>(name[i]);
+        }
+
+        m_annotation->BeginEvent(wideName.data());
+    }
+
+    void D3D11CommandContext::EndPass()
+    {
+        if (m_annotation != nullptr)
+        {
+            m_annotation->EndEvent();
+        }
+    }
+
+    void D3D11CommandContext::SetPrimitiveTopology(PrimitiveTopology topology)
+    {
+        m_context->IASetPrimitiveTopology(ToD3D11Topology(topology));
+    }
+
+    void D3D11CommandContext::SetInputLayout(InputLayoutHandle inputLayout)
+    {
+        m_context->IASetInputLayout(FromHandle<ID3D11InputLayout>(inputLayout));
+    }
+
+    void D3D11CommandContext::SetVertexBuffer(std::uint32_t slot, BufferHandle buffer, std::uint32_t stride)
+    {
+        ID3D11Buffer* buffers[] = { FromHandle<ID3D11Buffer>(buffer) };
+        const UINT offset = 0;
+        m_context->IASetVertexBuffers(slot, 1, buffers, &stride, &offset);
+    }
+
+    void D3D11CommandContext::SetIndexBuffer(BufferHandle buffer, IndexFormat format)
+    {
+        m_context->IASetIndexBuffer(FromHandle<ID3D11Buffer>(buffer), ToDXGIFormat(format), 0);
+    }
+
+    void D3D11CommandContext::SetVertexShader(VertexShaderHandle shader)
+    {
+        m_context->VSSetShader(FromHandle<ID3D11VertexShader>(shader), nullptr, 0);
+    }
+
+    void D3D11CommandContext::SetPixelShader(PixelShaderHandle shader)
+    {
+        m_context->PSSetShader(FromHandle<ID3D11PixelShader>(shader), nullptr, 0);
+    }
+
+    void D3D11CommandContext::SetVSConstantBuffer(std::uint32_t slot, BufferHandle buffer)
+    {
+        ID3D11Buffer* buffers[] = { FromHandle<ID3D11Buffer>(buffer) };
+        m_context->VSSetConstantBuffers(slot, 1, buffers);
+    }
+
+    void D3D11CommandContext::SetPSConstantBuffer(std::uint32_t slot, BufferHandle buffer)
+    {
+        ID3D11Buffer* buffers[] = { FromHandle<ID3D11Buffer>(buffer) };
+        m_context->PSSetConstantBuffers(slot, 1, buffers);
+    }
+
+    void D3D11CommandContext::SetPSSampler(std::uint32_t slot, SamplerHandle samplerState)
+    {
+        ID3D11SamplerState* samplerStates[] = { FromHandle<ID3D11SamplerState>(samplerState) };
+        m_context->PSSetSamplers(slot, 1, samplerStates);
+    }
+
+    void D3D11CommandContext::SetPSShaderResources(std::uint32_t startSlot, std::uint32_t count, const ShaderResourceHandle* views)
+    {
+        std::array<ID3D11ShaderResourceView*, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT> rawViews{};
+        assert(count <= rawViews.size());
+
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            rawViews[i] = FromHandle<ID3D11ShaderResourceView>(views[i]);
+        }
+
+        m_context->PSSetShaderResources(startSlot, count, rawViews.data());
+    }
+
+    void D3D11CommandContext::SetRasterizerState(RasterizerStateHandle rasterizerState)
+    {
+        m_context->RSSetState(FromHandle<ID3D11RasterizerState>(rasterizerState));
+    }
+
+    RasterizerStateHandle D3D11CommandContext::GetRasterizerState() const
+    {
+        // RSGetState는 참조를 늘리므로 바로 놓음 (바인드되어 있는 동안은 살아 있음)
+        Microsoft::WRL::ComPtr<ID3D11RasterizerState> rasterizerState;
+        m_context->RSGetState(&rasterizerState);
+
+        return ToHandle(rasterizerState.Get());
+    }
+
+    void D3D11CommandContext::UpdateBuffer(BufferHandle buffer, const void* data, std::uint32_t byteSize)
+    {
+        m_context->UpdateSubresource(FromHandle<ID3D11Buffer>(buffer), 0, nullptr, data, 0, 0);
+    }
+
+    void D3D11CommandContext::UploadDynamicBuffer(BufferHandle buffer, const void* data, std::uint32_t byteSize)
+    {
+        ID3D11Buffer* rawBuffer = FromHandle<ID3D11Buffer>(buffer);
+
+        D3D11_MAPPED_SUBRESOURCE mapped{};
+        HR_CHECK(m_context->Map(rawBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped));
+        std::memcpy(mapped.pData, data, byteSize);
+        m_context->Unmap(rawBuffer, 0);
+    }
+
+    void D3D11CommandContext::DrawIndexed(std::uint32_t indexCount, std::uint32_t startIndex, std::int32_t baseVertex)
+    {
+        m_context->DrawIndexed(indexCount, startIndex, baseVertex);
+    }
+
+    void D3D11CommandContext::DrawIndexedInstanced(std::uint32_t indexCount, std::uint32_t instanceCount, std::uint32_t startIndex, std::int32_t baseVertex, std::uint32_t startInstance)
+    {
+        m_context->DrawIndexedInstanced(indexCount, instanceCount, startIndex, baseVertex, startInstance);
+    }
+
+    void D3D11CommandContext::DrawRenderer(const Renderer& renderer, RenderType type)
+    {
+        // Renderer::Draw는 GraphicsDevice의 즉시 context로 그리므로 deferred context에 기록할 수 없음
+        assert(m_context->GetType() == D3D11_DEVICE_CONTEXT_IMMEDIATE);
+
+        renderer.Draw(type);
+    }
+
+    ID3D11DeviceContext* D3D11CommandContext::GetDeviceContext() const
+    {
+        return m_context;
+    }
+}
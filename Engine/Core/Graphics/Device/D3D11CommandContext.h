@@ -0,0 +1,50 @@
+﻿#pragma once
+
+#include <d3d11_1.h>
+
+#include "Core/Graphics/Device/CommandContext.h"
+#include "Core/Graphics/Device/D3D11Handles.h"
+
+namespace engine
+{
+    // ID3D11DeviceContext로 그대로 넘기는 백엔드 (즉시 context는 GraphicsDevice, deferred context는 DeferredContextPool이 가짐)
+    class D3D11CommandContext :
+        public CommandContext
+    {
+    private:
+        ID3D11DeviceContext* m_context = nullptr;
+        Microsoft::WRL::ComPtr<ID3DUserDefinedAnnotation> m_annotation; // 없으면 패스 구분을 건너뜀
+
+    public:
+        explicit D3D11CommandContext(ID3D11DeviceContext* context);
+
+    public:
+        void BeginPass(const char* name) override;
+        void EndPass() override;
+
+        void SetPrimitiveTopology(PrimitiveTopology topology) override;
+        void SetInputLayout(InputLayoutHandle inputLayout) override;
+        void SetVertexBuffer(std::uint32_t slot, BufferHandle buffer, std::uint32_t stride) override;
+        void SetIndexBuffer(BufferHandle buffer, IndexFormat format) override;
+
+        void SetVertexShader(VertexShaderHandle shader) override;
+        void SetPixelShader(PixelShaderHandle shader) override;
+        void SetVSConstantBuffer(std::uint32_t slot, BufferHandle buffer) override;
+        void SetPSConstantBuffer(std::uint32_t slot, BufferHandle buffer) override;
+        void SetPSSampler(std::uint32_t slot, SamplerHandle samplerState) override;
+        void SetPSShaderResources(std::uint32_t startSlot, std::uint32_t count, const ShaderResourceHandle* views) override;
+
+        void SetRasterizerState(RasterizerStateHandle rasterizerState) override;
+        RasterizerStateHandle GetRasterizerState() const override;
+
+        void UpdateBuffer(BufferHandle buffer, const void* data, std::uint32_t byteSize) override;
+        void UploadDynamicBuffer(BufferHandle buffer, const void* data, std::uint32_t byteSize) override;
+
+        void DrawIndexed(std::uint32_t indexCount, std::uint32_t startIndex, std::int32_t baseVertex) override;
+        void DrawIndexedInstanced(std::uint32_t indexCount, std::uint32_t instanceCount, std::uint32_t startIndex, std::int32_t baseVertex, std::uint32_t startInstance) override;
+        void DrawRenderer(const Renderer& renderer, RenderType type) override;
+
+    public:
+        ID3D11DeviceContext* GetDeviceContext() const;
+    };
+}
@@ -0,0 +1,85 @@
+﻿#pragma once
+
+#include "Core/Graphics/Device/GraphicsHandles.h"
+
+namespace engine
+{
+    // D3D11 리소스 <-> CommandContext 핸들 (D3D11 백엔드와 리소스를 가진 쪽에서만 씀)
+    inline BufferHandle ToHandle(ID3D11Buffer* buffer)
+    {
+        return BufferHandle{ buffer };
+    }
+
+    inline InputLayoutHandle ToHandle(ID3D11InputLayout* inputLayout)
+    {
+        return InputLayoutHandle{ inputLayout };
+    }
+
+    inline VertexShaderHandle ToHandle(ID3D11VertexShader* shader)
+    {
+        return VertexShaderHandle{ shader };
+    }
+
+    inline PixelShaderHandle ToHandle(ID3D11PixelShader* shader)
+    {
+        return PixelShaderHandle{ shader };
+    }
+
+    inline SamplerHandle ToHandle(ID3D11SamplerState* samplerState)
+    {
+        return SamplerHandle{ samplerState };
+    }
+
+    inline ShaderResourceHandle ToHandle(ID3D11ShaderResourceView* view)
+    {
+        return ShaderResourceHandle{ view };
+    }
+
+    inline RasterizerStateHandle ToHandle(ID3D11RasterizerState* rasterizerState)
+    {
+        return RasterizerStateHandle{ rasterizerState };
+    }
+
+    // 핸들은 const void*로 들고 있으므로 D3D11 호출에 넘길 때만 const를 뗌
+    template <typename T, typename Tag>
+    T* FromHandle(GraphicsHandle<Tag> handle)
+    {
+        return static_cast<T*>(const_cast<void*>(handle.Get()));
+    }
+
+    inline IndexFormat ToIndexFormat(DXGI_FORMAT format)
+    {
+        switch (format)
+        {
+        case DXGI_FORMAT_R16_UINT:
+            return IndexFormat::UInt16;
+        case DXGI_FORMAT_R32_UINT:
+            return IndexFormat::UInt32;
+        default:
+            return IndexFormat::Unknown;
+        }
+    }
+
+    inline DXGI_FORMAT ToDXGIFormat(IndexFormat format)
+    {
+        switch (format)
+        {
+        case IndexFormat::UInt16:
+            return DXGI_FORMAT_R16_UINT;
+        case IndexFormat::UInt32:
+            return DXGI_FORMAT_R32_UINT;
+        default:
+            return DXGI_FORMAT_UNKNOWN;
+        }
+    }
+
+    inline D3D11_PRIMITIVE_TOPOLOGY ToD3D11Topology(PrimitiveTopology topology)
+    {
+        switch (topology)
+        {
+        case PrimitiveTopology::TriangleList:
+        default:
+            return D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+        }
+    }
+}
@@ -0,0 +1,139 @@
+﻿#include "EnginePCH.h"
+#include "DeferredContextPool.h"
+
+namespace engine
+{
+    namespace
+    {
+        // Get 계열은 AddRef한 raw 포인터를 돌려주므로 ComPtr로 넘겨받음
+        template <typename T, std::size_t N>
+        void AttachAll(std::array<Microsoft::WRL::ComPtr<T>, N>& target, std::array<T*, N>& raw)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                target[i].Attach(raw[i]);
+            }
+        }
+
+        template <typename T, std::size_t N>
+        std::array<T*, N> ToRawArray(const std::array<Microsoft::WRL::ComPtr<T>, N>& source)
+        {
+            std::array<T*, N> raw{};
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                raw[i] = source[i].Get();
+            }
+
+            return raw;
+        }
+    }
+
+    void DeviceContextState::Capture(ID3D11DeviceContext* context)
+    {
+        viewportCount = static_cast<UINT>(viewports.size());
+        context->RSGetViewports(&viewportCount, viewports.data());
+        context->RSGetState(rasterizerState.ReleaseAndGetAddressOf());
+
+        std::array<ID3D11RenderTargetView*, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT> rawRenderTargets{};
+        context->OMGetRenderTargets(static_cast<UINT>(rawRenderTargets.size()), rawRenderTargets.data(), depthStencilView.ReleaseAndGetAddressOf());
+        AttachAll(renderTargets, rawRenderTargets);
+
+        context->OMGetDepthStencilState(depthStencilState.ReleaseAndGetAddressOf(), &stencilRef);
+        context->OMGetBlendState(blendState.ReleaseAndGetAddressOf(), blendFactor.data(), &sampleMask);
+
+        std::array<ID3D11Buffer*, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT> rawBuffers{};
+        context->VSGetConstantBuffers(0, static_cast<UINT>(rawBuffers.size()), rawBuffers.data());
+        AttachAll(vsConstantBuffers, rawBuffers);
+
+        context->PSGetConstantBuffers(0, static_cast<UINT>(rawBuffers.size()), rawBuffers.data());
+        AttachAll(psConstantBuffers, rawBuffers);
+
+        std::array<ID3D11SamplerState*, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT> rawSamplers{};
+        context->PSGetSamplers(0, static_cast<UINT>(rawSamplers.size()), rawSamplers.data());
+        AttachAll(psSamplers, rawSamplers);
+
+        std::array<ID3D11ShaderResourceView*, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT> rawShaderResources{};
+        context->PSGetShaderResources(0, static_cast<UINT>(rawShaderResources.size()), rawShaderResources.data());
+        AttachAll(psShaderResources, rawShaderResources);
+    }
+
+    void DeviceContextState::Apply(ID3D11DeviceContext* context) const
+    {
+        context->RSSetViewports(viewportCount, viewports.data());
+        context->RSSetState(rasterizerState.Get());
+
+        const auto rawRenderTargets = ToRawArray(renderTargets);
+        context->OMSetRenderTargets(static_cast<UINT>(rawRenderTargets.size()), rawRenderTargets.data(), depthStencilView.Get());
+        context->OMSetDepthStencilState(depthStencilState.Get(), stencilRef);
+        context->OMSetBlendState(blendState.Get(), blendFactor.data(), sampleMask);
+
+        const auto rawVSBuffers = ToRawArray(vsConstantBuffers);
+        context->VSSetConstantBuffers(0, static_cast<UINT>(rawVSBuffers.size()), rawVSBuffers.data());
+
+        const auto rawPSBuffers = ToRawArray(psConstantBuffers);
+        context->PSSetConstantBuffers(0, static_cast<UINT>(rawPSBuffers.size()), rawPSBuffers.data());
+
+        const auto rawSamplers = ToRawArray(psSamplers);
+        context->PSSetSamplers(0, static_cast<UINT>(rawSamplers.size()), rawSamplers.data());
+
+        const auto rawShaderResources = ToRawArray(psShaderResources);
+        context->PSSetShaderResources(0, static_cast<UINT>(rawShaderResources.size()), rawShaderResources.data());
+    }
+
+    void DeferredContextPool::Reserve(ID3D11Device* device, std::size_t count)
+    {
+        if (m_contexts.empty())
+        {
+            D3D11_FEATURE_DATA_THREADING threading{};
+            if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threading, sizeof(threading))))
+            {
+                m_hasDriverCommandLists = threading.DriverCommandLists == TRUE;
+            }
+        }
+
+        while (m_contexts.size() < count)
+        {
+            Microsoft::WRL::ComPtr<ID3D11DeviceContext> context;
+            HR_CHECK(device->CreateDeferredContext(0, &context));
+
+            m_commandContexts.emplace_back(context.Get());
+            m_contexts.push_back(std::move(context));
+            m_commandLists.emplace_back();
+        }
+    }
+
+    ID3D11DeviceContext* DeferredContextPool::GetContext(std::size_t index) const
+    {
+        return m_contexts[index].Get();
+    }
+
+    CommandContext& DeferredContextPool::GetCommandContext(std::size_t index)
+    {
+        return m_commandContexts[index];
+    }
+
+    void DeferredContextPool::Finish(std::size_t index)
+    {
+        // FALSE: 끝나면 deferred context를 기본 상태로 되돌림 (다음 기록은 어차피 Apply부터)
+        HR_CHECK(m_contexts[index]->FinishCommandList(FALSE, m_commandLists[index].ReleaseAndGetAddressOf()));
+    }
+
+    void DeferredContextPool::Execute(ID3D11DeviceContext* immediateContext, std::size_t index)
+    {
+        assert(m_commandLists[index] != nullptr);
+
+        // TRUE: 실행 뒤에 즉시 context의 패스 상태를 되살림 (뒤이어 즉시 context로 그리는 packet / 스프라이트가 씀)
+        immediateContext->ExecuteCommandList(m_commandLists[index].Get(), TRUE);
+        m_commandLists[index].Reset();
+    }
+
+    std::size_t DeferredContextPool::GetCount() const
+    {
+        return m_contexts.size();
+    }
+
+    bool DeferredContextPool::HasDriverCommandLists() const
+    {
+        return m_hasDriverCommandLists;
+    }
+}
@@ -0,0 +1,60 @@
+﻿#pragma once
+
+#include "Core/Graphics/Device/D3D11CommandContext.h"
+
+namespace engine
+{
+    // 즉시 context에 바인드된 패스 상태 (렌더 타깃 / 뷰포트 / 래스터라이저 / 깊이 / 블렌드 / VS, PS 상수 버퍼 / PS 샘플러, SRV)
+    // deferred context는 기본 상태에서 시작하므로 기록 전에 Capture한 것을 Apply함
+    struct DeviceContextState
+    {
+        std::array<D3D11_VIEWPORT, D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE> viewports{};
+        UINT viewportCount = 0;
+        Microsoft::WRL::ComPtr<ID3D11RasterizerState> rasterizerState;
+
+        std::array<Microsoft::WRL::ComPtr<ID3D11RenderTargetView>, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT> renderTargets;
+        Microsoft::WRL::ComPtr<ID3D11DepthStencilView> depthStencilView;
+        Microsoft::WRL::ComPtr<ID3D11DepthStencilState> depthStencilState;
+        UINT stencilRef = 0;
+        Microsoft::WRL::ComPtr<ID3D11BlendState> blendState;
+        std::array<float, 4> blendFactor{};
+        UINT sampleMask = 0xffffffff;
+
+        std::array<Microsoft::WRL::ComPtr<ID3D11Buffer>, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT> vsConstantBuffers;
+        std::array<Microsoft::WRL::ComPtr<ID3D11Buffer>, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT> psConstantBuffers;
+        std::array<Microsoft::WRL::ComPtr<ID3D11SamplerState>, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT> psSamplers;
+        std::array<Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT> psShaderResources;
+
+        void Capture(ID3D11DeviceContext* context);
+        void Apply(ID3D11DeviceContext* context) const;
+    };
+
+    // 워커 스레드에서 드로우를 기록할 deferred context 모음
+    // - context 하나는 한 번에 한 스레드만 씀 (index마다 다른 잡)
+    // - Finish로 만든 command list는 즉시 context에서 Execute한 순서대로 실행되고, 즉시 context의 상태는 그대로 남음
+    class DeferredContextPool
+    {
+    private:
+        std::vector<Microsoft::WRL::ComPtr<ID3D11DeviceContext>> m_contexts;
+        std::vector<D3D11CommandContext> m_commandContexts;
+        std::vector<Microsoft::WRL::ComPtr<ID3D11CommandList>> m_commandLists;
+
+        bool m_hasDriverCommandLists = false; // false면 런타임이 command list를 흉내 냄 (동작은 같지만 느릴 수 있음)
+
+    public:
+        // 모자라면 더 만듦 (메인 스레드에서)
+        void Reserve(ID3D11Device* device, std::size_t count);
+
+        ID3D11DeviceContext* GetContext(std::size_t index) const;
+        CommandContext& GetCommandContext(std::size_t index);
+
+        // index의 기록을 끝내고 command list로 만듦 (기록한 스레드에서)
+        void Finish(std::size_t index);
+
+        // 즉시 context에서 실행하고 command list를 버림 (메인 스레드에서)
+        void Execute(ID3D11DeviceContext* immediateContext, std::size_t index);
+
+        std::size_t GetCount() const;
+        bool HasDriverCommandLists() const;
+    };
+}
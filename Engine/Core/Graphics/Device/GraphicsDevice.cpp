@@ -8,6 +8,7 @@
 #include <imgui_impl_dx11.h>
 
 #include "Common/Utility/Profiling.h"
+#include "Core/Graphics/Device/D3D11CommandContext.h"
 #include "Core/Graphics/Data/Vertex.h"
 #include "Core/Graphics/Resource/ResourceManager.h"
 #include "Core/Graphics/Resource/Texture.h"
@@ -136,6 +137,7 @@ namespace engine
         m_backBufferRTV.Reset();
 
         m_swapChain.Reset();
+        m_commandContext.reset();
         m_deviceContext.Reset();
         m_device.Reset();
     }
@@ -554,6 +556,11 @@ namespace engine
         return m_deviceContext;
     }
 
+    CommandContext& GraphicsDevice::GetCommandContext() const
+    {
+        return *m_commandContext;
+    }
+
     const D3D11_VIEWPORT& GraphicsDevice::GetViewport() const
     {
         return m_gameViewport;
@@ -740,6 +747,8 @@ namespace engine
                     &m_device,
                     &actualFeatureLevel,
                     &m_deviceContext));
+
+                m_commandContext = std::make_unique<D3D11CommandContext>(m_deviceContext.Get());
             }
 
             // create swap chain
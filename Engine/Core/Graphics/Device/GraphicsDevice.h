@@ -17,6 +17,8 @@ namespace engine
     class SamplerState;
     class ConstantBuffer;
     class DepthStencilState;
+    class CommandContext;
+    class D3D11CommandContext;
 
     struct GBufferResources
     {
@@ -55,6 +57,8 @@ namespace engine
         Microsoft::WRL::ComPtr<ID3D11DeviceContext> m_deviceContext;
         Microsoft::WRL::ComPtr<IDXGISwapChain1> m_swapChain;
 
+        std::unique_ptr<D3D11CommandContext> m_commandContext; // 즉시 context
+
         Microsoft::WRL::ComPtr<ID3D11RenderTargetView> m_backBufferRTV;
 
         std::unique_ptr<Texture> m_finalBuffer;
@@ -189,6 +193,7 @@ namespace engine
 
         const Microsoft::WRL::ComPtr<ID3D11Device>& GetDevice() const;
         const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& GetDeviceContext() const;
+        CommandContext& GetCommandContext() const;
         const D3D11_VIEWPORT& GetViewport() const;
         float GetMaxHDRNits() const;
         int GetShadowMapSize() const;
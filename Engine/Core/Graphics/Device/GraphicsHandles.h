@@ -0,0 +1,57 @@
+﻿#pragma once
+
+#include <compare>
+#include <cstdint>
+
+namespace engine
+{
+    // CommandContext로 넘기는 리소스 핸들 (백엔드가 아닌 코드가 D3D11 헤더 없이 다루도록)
+    // D3D11 백엔드는 ID3D11* 포인터를 그대로 담고 (D3D11Handles.h), null 백엔드는 비교 / 기록만 하고 역참조하지 않음
+    // Tag로 종류를 나눠서 버퍼 자리에 셰이더를 넘기는 실수를 막음
+    template <typename Tag>
+    class GraphicsHandle
+    {
+    private:
+        const void* m_pointer = nullptr;
+
+    public:
+        constexpr GraphicsHandle() = default;
+        constexpr explicit GraphicsHandle(const void* pointer) :
+            m_pointer{ pointer }
+        {
+        }
+
+    public:
+        constexpr const void* Get() const
+        {
+            return m_pointer;
+        }
+
+        constexpr explicit operator bool() const
+        {
+            return m_pointer != nullptr;
+        }
+
+        constexpr auto operator<=>(const GraphicsHandle&) const = default;
+    };
+
+    using BufferHandle = GraphicsHandle<struct BufferHandleTag>;
+    using InputLayoutHandle = GraphicsHandle<struct InputLayoutHandleTag>;
+    using VertexShaderHandle = GraphicsHandle<struct VertexShaderHandleTag>;
+    using PixelShaderHandle = GraphicsHandle<struct PixelShaderHandleTag>;
+    using SamplerHandle = GraphicsHandle<struct SamplerHandleTag>;
+    using ShaderResourceHandle = GraphicsHandle<struct ShaderResourceHandleTag>;
+    using RasterizerStateHandle = GraphicsHandle<struct RasterizerStateHandleTag>;
+
+    enum class PrimitiveTopology : std::uint8_t
+    {
+        TriangleList,
+    };
+
+    enum class IndexFormat : std::uint8_t
+    {
+        Unknown,
+        UInt16,
+        UInt32,
+    };
+}
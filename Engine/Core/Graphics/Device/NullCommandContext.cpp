@@ -0,0 +1,162 @@
+﻿#include "EnginePCH.h"
+#include "NullCommandContext.h"
+
+namespace engine
+{
+    CommandStats& CommandStats::operator+=(const CommandStats& other)
+    {
+        commandCount += other.commandCount;
+        passCount += other.passCount;
+        drawCount += other.drawCount;
+        instanceCount += other.instanceCount;
+        stateChangeCount += other.stateChangeCount;
+        uploadCount += other.uploadCount;
+        uploadedBytes += other.uploadedBytes;
+
+        return *this;
+    }
+
+    NullCommandContext::NullCommandContext(bool recordsCommands) :
+        m_recordsCommands{ recordsCommands }
+    {
+    }
+
+    void NullCommandContext::BeginPass(const char* name)
+    {
+        ++m_stats.passCount;
+        Record(CommandType::BeginPass, name, 0, 0);
+    }
+
+    void NullCommandContext::EndPass()
+    {
+        Record(CommandType::EndPass, nullptr, 0, 0);
+    }
+
+    void NullCommandContext::SetPrimitiveTopology(PrimitiveTopology topology)
+    {
+        RecordStateChange(CommandType::SetPrimitiveTopology, nullptr, 0, static_cast<std::uint32_t>(topology));
+    }
+
+    void NullCommandContext::SetInputLayout(InputLayoutHandle inputLayout)
+    {
+        RecordStateChange(CommandType::SetInputLayout, inputLayout.Get(), 0, 0);
+    }
+
+    void NullCommandContext::SetVertexBuffer(std::uint32_t slot, BufferHandle buffer, std::uint32_t stride)
+    {
+        RecordStateChange(CommandType::SetVertexBuffer, buffer.Get(), slot, stride);
+    }
+
+    void NullCommandContext::SetIndexBuffer(BufferHandle buffer, IndexFormat format)
+    {
+        RecordStateChange(CommandType::SetIndexBuffer, buffer.Get(), 0, static_cast<std::uint32_t>(format));
+    }
+
+    void NullCommandContext::SetVertexShader(VertexShaderHandle shader)
+    {
+        RecordStateChange(CommandType::SetVertexShader, shader.Get(), 0, 0);
+    }
+
+    void NullCommandContext::SetPixelShader(PixelShaderHandle shader)
+    {
+        RecordStateChange(CommandType::SetPixelShader, shader.Get(), 0, 0);
+    }
+
+    void NullCommandContext::SetVSConstantBuffer(std::uint32_t slot, BufferHandle buffer)
+    {
+        RecordStateChange(CommandType::SetVSConstantBuffer, buffer.Get(), slot, 0);
+    }
+
+    void NullCommandContext::SetPSConstantBuffer(std::uint32_t slot, BufferHandle buffer)
+    {
+        RecordStateChange(CommandType::SetPSConstantBuffer, buffer.Get(), slot, 0);
+    }
+
+    void NullCommandContext::SetPSSampler(std::uint32_t slot, SamplerHandle samplerState)
+    {
+        RecordStateChange(CommandType::SetPSSampler, samplerState.Get(), slot, 0);
+    }
+
+    void NullCommandContext::SetPSShaderResources(std::uint32_t startSlot, std::uint32_t count, const ShaderResourceHandle* views)
+    {
+        RecordStateChange(CommandType::SetPSShaderResources, count > 0 ? views[0].Get() : nullptr, startSlot, count);
+    }
+
+    void NullCommandContext::SetRasterizerState(RasterizerStateHandle rasterizerState)
+    {
+        m_rasterizerState = rasterizerState;
+        RecordStateChange(CommandType::SetRasterizerState, rasterizerState.Get(), 0, 0);
+    }
+
+    RasterizerStateHandle NullCommandContext::GetRasterizerState() const
+    {
+        return m_rasterizerState;
+    }
+
+    void NullCommandContext::UpdateBuffer(BufferHandle buffer, const void* data, std::uint32_t byteSize)
+    {
+        ++m_stats.uploadCount;
+        m_stats.uploadedBytes += byteSize;
+        Record(CommandType::UpdateBuffer, buffer.Get(), 0, byteSize);
+    }
+
+    void NullCommandContext::UploadDynamicBuffer(BufferHandle buffer, const void* data, std::uint32_t byteSize)
+    {
+        ++m_stats.uploadCount;
+        m_stats.uploadedBytes += byteSize;
+        Record(CommandType::UploadDynamicBuffer, buffer.Get(), 0, byteSize);
+    }
+
+    void NullCommandContext::DrawIndexed(std::uint32_t indexCount, std::uint32_t startIndex, std::int32_t baseVertex)
+    {
+        ++m_stats.drawCount;
+        Record(CommandType::DrawIndexed, nullptr, startIndex, indexCount, baseVertex);
+    }
+
+    void NullCommandContext::DrawIndexedInstanced(std::uint32_t indexCount, std::uint32_t instanceCount, std::uint32_t startIndex, std::int32_t baseVertex, std::uint32_t startInstance)
+    {
+        ++m_stats.drawCount;
+        m_stats.instanceCount += instanceCount;
+        Record(CommandType::DrawIndexedInstanced, nullptr, startInstance, instanceCount, baseVertex);
+    }
+
+    void NullCommandContext::DrawRenderer(const Renderer& renderer, RenderType type)
+    {
+        // 렌더러는 즉시 context로 GPU에 그리므로 부르지 않음 (무엇을 바인드할지 모르므로 드로우 하나로만 셈)
+        ++m_stats.drawCount;
+        Record(CommandType::DrawRenderer, &renderer, 0, static_cast<std::uint32_t>(type));
+    }
+
+    void NullCommandContext::Reset()
+    {
+        m_commands.clear();
+        m_stats = CommandStats{};
+        m_rasterizerState = {};
+    }
+
+    std::span<const RecordedCommand> NullCommandContext::GetCommands() const
+    {
+        return m_commands;
+    }
+
+    const CommandStats& NullCommandContext::GetStats() const
+    {
+        return m_stats;
+    }
+
+    void NullCommandContext::Record(CommandType type, const void* object, std::uint32_t slot, std::uint32_t value, std::int32_t baseVertex)
+    {
+        ++m_stats.commandCount;
+
+        if (m_recordsCommands)
+        {
+            m_commands.push_back(RecordedCommand{ type, object, slot, value, baseVertex });
+        }
+    }
+
+    void NullCommandContext::RecordStateChange(CommandType type, const void* object, std::uint32_t slot, std::uint32_t value)
+    {
+        ++m_stats.stateChangeCount;
+        Record(type, object, slot, value);
+    }
+}
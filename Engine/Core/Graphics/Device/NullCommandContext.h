@@ -0,0 +1,113 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Core/Graphics/Device/CommandContext.h"
+
+namespace engine
+{
+    enum class CommandType : std::uint8_t
+    {
+        BeginPass,
+        EndPass,
+        SetPrimitiveTopology,
+        SetInputLayout,
+        SetVertexBuffer,
+        SetIndexBuffer,
+        SetVertexShader,
+        SetPixelShader,
+        SetVSConstantBuffer,
+        SetPSConstantBuffer,
+        SetPSSampler,
+        SetPSShaderResources,
+        SetRasterizerState,
+        UpdateBuffer,
+        UploadDynamicBuffer,
+        DrawIndexed,
+        DrawIndexedInstanced,
+        DrawRenderer,
+    };
+
+    // 기록한 명령 하나
+    // - object: 바인드한 리소스 / 셰이더 (패스는 이름, SRV 여러 개는 첫 번째, DrawRenderer는 렌더러)
+    // - slot: 슬롯 / 시작 인덱스 (instanced는 시작 인스턴스)
+    // - value: 개수 / stride / 바이트 / 인덱스 수 (instanced는 인스턴스 수, DrawRenderer는 RenderType)
+    // - baseVertex: 드로우만
+    struct RecordedCommand
+    {
+        CommandType type;
+        const void* object = nullptr;
+        std::uint32_t slot = 0;
+        std::uint32_t value = 0;
+        std::int32_t baseVertex = 0;
+
+        bool operator==(const RecordedCommand& other) const = default;
+    };
+
+    struct CommandStats
+    {
+        std::uint32_t commandCount = 0;
+        std::uint32_t passCount = 0;
+        std::uint32_t drawCount = 0; // DrawRenderer 포함
+        std::uint32_t instanceCount = 0; // DrawIndexedInstanced로 그린 인스턴스
+        std::uint32_t stateChangeCount = 0; // Set 명령 (바로 앞과 같아도 셈, 건너뛰는 것은 호출하는 쪽의 일)
+        std::uint32_t uploadCount = 0;
+        std::uint64_t uploadedBytes = 0;
+
+        CommandStats& operator+=(const CommandStats& other);
+    };
+
+    // GPU 없이 명령과 횟수만 기록하는 백엔드
+    // 두 프레임의 GetCommands를 비교하거나 GetStats로 바인드 / 업로드가 늘었는지 확인 (Reset 전까지 쌓임)
+    class NullCommandContext :
+        public CommandContext
+    {
+    private:
+        std::vector<RecordedCommand> m_commands;
+        CommandStats m_stats;
+
+        RasterizerStateHandle m_rasterizerState;
+        bool m_recordsCommands = true; // false면 횟수만 (긴 측정에서 메모리를 쓰지 않도록)
+
+    public:
+        explicit NullCommandContext(bool recordsCommands = true);
+
+    public:
+        void BeginPass(const char* name) override;
+        void EndPass() override;
+
+        void SetPrimitiveTopology(PrimitiveTopology topology) override;
+        void SetInputLayout(InputLayoutHandle inputLayout) override;
+        void SetVertexBuffer(std::uint32_t slot, BufferHandle buffer, std::uint32_t stride) override;
+        void SetIndexBuffer(BufferHandle buffer, IndexFormat format) override;
+
+        void SetVertexShader(VertexShaderHandle shader) override;
+        void SetPixelShader(PixelShaderHandle shader) override;
+        void SetVSConstantBuffer(std::uint32_t slot, BufferHandle buffer) override;
+        void SetPSConstantBuffer(std::uint32_t slot, BufferHandle buffer) override;
+        void SetPSSampler(std::uint32_t slot, SamplerHandle samplerState) override;
+        void SetPSShaderResources(std::uint32_t startSlot, std::uint32_t count, const ShaderResourceHandle* views) override;
+
+        void SetRasterizerState(RasterizerStateHandle rasterizerState) override;
+        RasterizerStateHandle GetRasterizerState() const override;
+
+        void UpdateBuffer(BufferHandle buffer, const void* data, std::uint32_t byteSize) override;
+        void UploadDynamicBuffer(BufferHandle buffer, const void* data, std::uint32_t byteSize) override;
+
+        void DrawIndexed(std::uint32_t indexCount, std::uint32_t startIndex, std::int32_t baseVertex) override;
+        void DrawIndexedInstanced(std::uint32_t indexCount, std::uint32_t instanceCount, std::uint32_t startIndex, std::int32_t baseVertex, std::uint32_t startInstance) override;
+        void DrawRenderer(const Renderer& renderer, RenderType type) override;
+
+    public:
+        void Reset();
+
+        std::span<const RecordedCommand> GetCommands() const;
+        const CommandStats& GetStats() const;
+
+    private:
+        void Record(CommandType type, const void* object, std::uint32_t slot, std::uint32_t value, std::int32_t baseVertex = 0);
+        void RecordStateChange(CommandType type, const void* object, std::uint32_t slot, std::uint32_t value);
+    };
+}
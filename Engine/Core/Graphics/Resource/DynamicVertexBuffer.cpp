@@ -0,0 +1,53 @@
+﻿#include "EnginePCH.h"
+#include "DynamicVertexBuffer.h"
+
+#include "Core/Graphics/Device/GraphicsDevice.h"
+#include "Core/Graphics/Device/CommandContext.h"
+#include "Core/Graphics/Device/D3D11Handles.h"
+
+namespace engine
+{
+    namespace
+    {
+        constexpr UINT MinByteWidth = 64 * 1024;
+    }
+
+    void DynamicVertexBuffer::Update(CommandContext& context, const void* data, UINT byteSize)
+    {
+        if (byteSize == 0)
+        {
+            return;
+        }
+
+        if (byteSize > m_byteWidth)
+        {
+            m_byteWidth = std::max(std::max(m_byteWidth * 2, byteSize), MinByteWidth);
+
+            D3D11_BUFFER_DESC desc{};
+            desc.ByteWidth = m_byteWidth;
+            desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+            desc.Usage = D3D11_USAGE_DYNAMIC;
+            desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+            m_buffer.Reset();
+            HR_CHECK(GraphicsDevice::Get().GetDevice()->CreateBuffer(&desc, nullptr, &m_buffer));
+        }
+
+        context.UploadDynamicBuffer(ToHandle(m_buffer.Get()), data, byteSize);
+    }
+
+    const Microsoft::WRL::ComPtr<ID3D11Buffer>& DynamicVertexBuffer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    ID3D11Buffer* DynamicVertexBuffer::GetRawBuffer() const
+    {
+        return m_buffer.Get();
+    }
+
+    UINT DynamicVertexBuffer::GetByteWidth() const
+    {
+        return m_byteWidth;
+    }
+}
@@ -0,0 +1,36 @@
+﻿#pragma once
+
+#include <span>
+
+#include "Core/Graphics/Resource/Resource.h"
+
+namespace engine
+{
+    class CommandContext;
+
+    // CPU에서 매 패스 다시 채우는 정점 버퍼 (인스턴스 데이터 / 배칭한 스프라이트)
+    // - WRITE_DISCARD로 덮어쓰므로 같은 프레임의 앞 드로우가 쓰던 내용은 드라이버가 따로 유지함
+    // - 모자라면 두 배로 다시 만들고 줄이지는 않음
+    class DynamicVertexBuffer :
+        public Resource
+    {
+    private:
+        Microsoft::WRL::ComPtr<ID3D11Buffer> m_buffer;
+        UINT m_byteWidth = 0;
+
+    public:
+        // 버퍼를 키우는 것은 디바이스로, 올리는 것은 context로 (null 백엔드면 바이트 수만 셈)
+        template <typename T>
+        void Update(CommandContext& context, std::span<const T> elements)
+        {
+            Update(context, elements.data(), static_cast<UINT>(elements.size_bytes()));
+        }
+
+        void Update(CommandContext& context, const void* data, UINT byteSize);
+
+    public:
+        const Microsoft::WRL::ComPtr<ID3D11Buffer>& GetBuffer() const;
+        ID3D11Buffer* GetRawBuffer() const;
+        UINT GetByteWidth() const;
+    };
+}
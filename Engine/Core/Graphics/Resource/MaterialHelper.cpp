@@ -12,13 +12,14 @@ namespace engine
 		out.clear();
 		out.reserve(data->GetMaterials().size());
 
+		// 텍스처는 워커에서 디코드하고, 끝날 때까지 텍스처가 없을 때와 같은 기본 텍스처로 그림
 		for (const auto& material : data->GetMaterials())
 		{
 			Textures textures{};
 
 			if (material.materialFlags & static_cast<std::uint64_t>(MaterialKey::BASE_COLOR_TEXTURE))
 			{
-				textures.baseColor = ResourceManager::Get().GetOrCreateTexture(material.texturePaths.at(MaterialKey::BASE_COLOR_TEXTURE));
+				textures.baseColor = ResourceManager::Get().RequestTexture(material.texturePaths.at(MaterialKey::BASE_COLOR_TEXTURE), DefaultTextureType::White).Get();
 			}
 			else
 			{
@@ -27,7 +28,7 @@ namespace engine
 
 			if (material.materialFlags & static_cast<std::uint64_t>(MaterialKey::NORMAL_TEXTURE))
 			{
-				textures.normal = ResourceManager::Get().GetOrCreateTexture(material.texturePaths.at(MaterialKey::NORMAL_TEXTURE));
+				textures.normal = ResourceManager::Get().RequestTexture(material.texturePaths.at(MaterialKey::NORMAL_TEXTURE), DefaultTextureType::Normal).Get();
 			}
 			else
 			{
@@ -36,7 +37,7 @@ namespace engine
 
 			if (material.materialFlags & static_cast<std::uint64_t>(MaterialKey::EMISSIVE_TEXTURE))
 			{
-				textures.emissive = ResourceManager::Get().GetOrCreateTexture(material.texturePaths.at(MaterialKey::EMISSIVE_TEXTURE));
+				textures.emissive = ResourceManager::Get().RequestTexture(material.texturePaths.at(MaterialKey::EMISSIVE_TEXTURE), DefaultTextureType::White).Get();
 			}
 			else
 			{
@@ -45,7 +46,7 @@ namespace engine
 
 			if (material.materialFlags & static_cast<std::uint64_t>(MaterialKey::METALNESS_TEXTURE))
 			{
-				textures.metalness = ResourceManager::Get().GetOrCreateTexture(material.texturePaths.at(MaterialKey::METALNESS_TEXTURE));
+				textures.metalness = ResourceManager::Get().RequestTexture(material.texturePaths.at(MaterialKey::METALNESS_TEXTURE), DefaultTextureType::Black).Get();
 			}
 			else
 			{
@@ -54,7 +55,7 @@ namespace engine
 
 			if (material.materialFlags & static_cast<std::uint64_t>(MaterialKey::ROUGHNESS_TEXTURE))
 			{
-				textures.roughness = ResourceManager::Get().GetOrCreateTexture(material.texturePaths.at(MaterialKey::ROUGHNESS_TEXTURE));
+				textures.roughness = ResourceManager::Get().RequestTexture(material.texturePaths.at(MaterialKey::ROUGHNESS_TEXTURE), DefaultTextureType::White).Get();
 			}
 			else
 			{
@@ -63,7 +64,7 @@ namespace engine
 
 			if (material.materialFlags & static_cast<std::uint64_t>(MaterialKey::AMBIENT_OCCLUSION_TEXTURE))
 			{
-				textures.ambientOcclusion = ResourceManager::Get().GetOrCreateTexture(material.texturePaths.at(MaterialKey::AMBIENT_OCCLUSION_TEXTURE));
+				textures.ambientOcclusion = ResourceManager::Get().RequestTexture(material.texturePaths.at(MaterialKey::AMBIENT_OCCLUSION_TEXTURE), DefaultTextureType::White).Get();
 			}
 			else
 			{
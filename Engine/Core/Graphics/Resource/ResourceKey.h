@@ -3,6 +3,7 @@
 #include <string>
 
 #include "Core/Graphics/Data/Vertex.h"
+#include "Framework/Asset/FBXData.h"
 
 namespace engine
 {
@@ -14,6 +15,15 @@ namespace engine
         auto operator<=>(const VertexBufferKey&) const = default;
     };
 
+    struct IndexBufferKey
+    {
+        std::string filePath;
+        FBXAssetKind kind; // 같은 FBX라도 Static / Skeletal 임포트는 인덱스가 다름
+        DXGI_FORMAT format; // R16_UINT / R32_UINT
+
+        auto operator<=>(const IndexBufferKey&) const = default;
+    };
+
     inline void HashCombine(size_t& seed, size_t hashValue)
     {
         seed ^= hashValue + 0x9e3779b9 + (seed << 6) + (seed >> 2);
@@ -44,4 +54,19 @@ namespace std
             return seed;
         }
     };
+
+    template <>
+    struct hash<engine::IndexBufferKey>
+    {
+        size_t operator()(const engine::IndexBufferKey& key) const
+        {
+            size_t seed = 0;
+
+            engine::HashCombine(seed, hash<std::string>()(key.filePath));
+            engine::HashCombine(seed, hash<size_t>()(static_cast<size_t>(key.kind)));
+            engine::HashCombine(seed, hash<size_t>()(static_cast<size_t>(key.format)));
+
+            return seed;
+        }
+    };
 }
\ No newline at end of file
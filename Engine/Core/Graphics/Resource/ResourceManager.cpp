@@ -1,6 +1,8 @@
 ﻿#include "EnginePCH.h"
 #include "ResourceManager.h"
 
+#include <DirectXTex.h>
+
 #include "Core/Graphics/Resource/IndexBuffer.h"
 #include "Core/Graphics/Resource/Texture.h"
 #include "Core/Graphics/Resource/ConstantBuffer.h"
@@ -13,9 +15,31 @@
 #include "Framework/Asset/AssetManager.h"
 #include "Framework/Asset/StaticMeshData.h"
 #include "Framework/Asset/GeometryData.h"
+#include "Common/Utility/JobSystem.h"
 
 namespace engine
 {
+    struct ResourceManager::PendingTextureLoad
+    {
+        std::string filePath;
+        std::shared_ptr<AssetRequest<Texture>::State> request; // data는 자리 표시자를 빌린 Texture
+
+        // 워커에서 채움 (counter가 0이 된 뒤에만 읽음)
+        DirectX::ScratchImage image;
+        bool isDecoded = false;
+
+        JobCounter counter;
+    };
+
+    namespace
+    {
+        // 기본 도형은 GeometryData의 32비트 인덱스 하나뿐
+        IndexBufferKey MakeGeometryIndexBufferKey(const std::string& name)
+        {
+            return IndexBufferKey{ name, FBXAssetKind::Static, DXGI_FORMAT_R32_UINT };
+        }
+    }
+
     ResourceManager::~ResourceManager() = default;
 
     void ResourceManager::Initialize()
@@ -36,6 +60,23 @@ namespace engine
         m_sceneCachedResources.clear();
     }
 
+    void ResourceManager::PublishCompletedLoads()
+    {
+        if (m_pendingTextures.IsEmpty())
+        {
+            return;
+        }
+
+        // 콜백에서 새 요청을 걸 수 있으므로 목록에서 먼저 빼고 알림
+        std::vector<std::shared_ptr<PendingTextureLoad>> completed;
+        m_pendingTextures.TakeCompleted(completed);
+
+        for (const auto& pending : completed)
+        {
+            PublishTexture(*pending);
+        }
+    }
+
     void ResourceManager::Cleanup()
     {
         // 직접 use_count 감소
@@ -47,14 +88,18 @@ namespace engine
 
         m_globalCachedResources.clear();
         m_sceneCachedResources.clear();
+
+        m_pendingTextures.Clear();
     }
 
     std::shared_ptr<IndexBuffer> ResourceManager::GetOrCreateIndexBuffer(
         const std::string& filePath,
+        FBXAssetKind kind,
         const std::vector<DWORD>& indices,
         LifeScope scope)
     {
-        if (auto find = m_indexBuffers.find(filePath); find != m_indexBuffers.end())
+        IndexBufferKey key{ filePath, kind, DXGI_FORMAT_R32_UINT };
+        if (auto find = m_indexBuffers.find(key); find != m_indexBuffers.end())
         {
             if (!find->second.expired())
             {
@@ -67,16 +112,19 @@ namespace engine
 
         CacheResource(indexBuffer, scope);
 
-        m_indexBuffers[filePath] = indexBuffer;
+        m_indexBuffers[key] = indexBuffer;
 
         return indexBuffer;
     }
 
-    std::shared_ptr<IndexBuffer> ResourceManager::GetOrCreateIndexBuffer(const std::string& filePath,
+    std::shared_ptr<IndexBuffer> ResourceManager::GetOrCreateIndexBuffer(
+        const std::string& filePath,
+        FBXAssetKind kind,
         const std::vector<WORD>& indices,
         LifeScope scope)
     {
-        if (auto find = m_indexBuffers.find(filePath); find != m_indexBuffers.end())
+        IndexBufferKey key{ filePath, kind, DXGI_FORMAT_R16_UINT };
+        if (auto find = m_indexBuffers.find(key); find != m_indexBuffers.end())
         {
             if (!find->second.expired())
             {
@@ -89,13 +137,16 @@ namespace engine
 
         CacheResource(indexBuffer, scope);
 
-        m_indexBuffers[filePath] = indexBuffer;
+        m_indexBuffers[key] = indexBuffer;
 
         return indexBuffer;
     }
 
     std::shared_ptr<Texture> ResourceManager::GetOrCreateTexture(const std::string& filePath, LifeScope scope)
     {
+        // 비동기 요청이 걸려 있으면 자리 표시자가 캐시에 있으므로 디코드를 기다림
+        FinishPendingTexture(filePath);
+
         if (auto find = m_textures.find(filePath); find != m_textures.end())
         {
             if (!find->second.expired())
@@ -114,6 +165,41 @@ namespace engine
         return texture;
     }
 
+    AssetRequest<Texture> ResourceManager::RequestTexture(const std::string& filePath, DefaultTextureType placeholder, LifeScope scope)
+    {
+        if (auto pending = m_pendingTextures.Find(filePath))
+        {
+            return AssetRequest<Texture>{ pending->request };
+        }
+
+        if (auto find = m_textures.find(filePath); find != m_textures.end())
+        {
+            if (!find->second.expired())
+            {
+                return AssetRequest<Texture>::FromData(find->second.lock());
+            }
+        }
+
+        auto texture = std::make_shared<Texture>();
+        texture->CreatePlaceholder(*GetDefaultTexture(placeholder));
+
+        CacheResource(texture, scope);
+
+        m_textures[filePath] = texture;
+
+        auto pending = std::make_shared<PendingTextureLoad>();
+        pending->filePath = filePath;
+        pending->request = std::make_shared<AssetRequest<Texture>::State>();
+        pending->request->data = texture;
+
+        m_pendingTextures.Start(filePath, pending, [](PendingTextureLoad& load)
+            {
+                load.isDecoded = Texture::Decode(load.filePath, load.image);
+            });
+
+        return AssetRequest<Texture>{ pending->request };
+    }
+
     std::shared_ptr<Texture> ResourceManager::GetOrCreateTexture(
         const std::string& name,
         UINT width,
@@ -364,7 +450,7 @@ namespace engine
 
     std::shared_ptr<IndexBuffer> ResourceManager::GetGeometryIndexBuffer(const std::string& name)
     {
-        if (auto find = m_indexBuffers.find(name); find != m_indexBuffers.end())
+        if (auto find = m_indexBuffers.find(MakeGeometryIndexBufferKey(name)); find != m_indexBuffers.end())
         {
             if (!find->second.expired())
             {
@@ -585,7 +671,7 @@ namespace engine
             indexBuffer->Create(geometryData->GetIndices());
 
             CacheResource(indexBuffer, LifeScope::Global);
-            m_indexBuffers["DefaultQuad"] = indexBuffer;
+            m_indexBuffers[MakeGeometryIndexBufferKey("DefaultQuad")] = indexBuffer;
         }
 
         {
@@ -601,7 +687,7 @@ namespace engine
             indexBuffer->Create(geometryData->GetIndices());
 
             CacheResource(indexBuffer, LifeScope::Global);
-            m_indexBuffers["DefaultCube"] = indexBuffer;
+            m_indexBuffers[MakeGeometryIndexBufferKey("DefaultCube")] = indexBuffer;
         }
 
         {
@@ -617,7 +703,7 @@ namespace engine
             indexBuffer->Create(geometryData->GetIndices());
 
             CacheResource(indexBuffer, LifeScope::Global);
-            m_indexBuffers["DefaultSphere"] = indexBuffer;
+            m_indexBuffers[MakeGeometryIndexBufferKey("DefaultSphere")] = indexBuffer;
         }
 
         {
@@ -633,7 +719,7 @@ namespace engine
             indexBuffer->Create(geometryData->GetIndices());
 
             CacheResource(indexBuffer, LifeScope::Global);
-            m_indexBuffers["DefaultPlane"] = indexBuffer;
+            m_indexBuffers[MakeGeometryIndexBufferKey("DefaultPlane")] = indexBuffer;
         }
 
         {
@@ -649,10 +735,42 @@ namespace engine
             indexBuffer->Create(geometryData->GetIndices());
 
             CacheResource(indexBuffer, LifeScope::Global);
-            m_indexBuffers["DefaultCone"] = indexBuffer;
+            m_indexBuffers[MakeGeometryIndexBufferKey("DefaultCone")] = indexBuffer;
         }
     }
 
+    void ResourceManager::FinishPendingTexture(const std::string& filePath)
+    {
+        const std::shared_ptr<PendingTextureLoad> pending = m_pendingTextures.Take(filePath);
+        if (!pending)
+        {
+            return;
+        }
+
+        JobSystem::Get().Wait(pending->counter);
+
+        PublishTexture(*pending);
+    }
+
+    void ResourceManager::PublishTexture(PendingTextureLoad& pending)
+    {
+        const std::shared_ptr<Texture>& texture = pending.request->data;
+
+        if (pending.isDecoded)
+        {
+            texture->Create(pending.image);
+        }
+        else
+        {
+            // 자리 표시자를 그대로 씀
+            LOG_ERROR("ResourceManager - 텍스처 디코드 실패: {}", pending.filePath);
+        }
+
+        pending.image.Release();
+
+        pending.request->Complete(texture);
+    }
+
     void ResourceManager::CacheResource(const std::shared_ptr<Resource>& resource, LifeScope scope)
     {
         switch (scope)
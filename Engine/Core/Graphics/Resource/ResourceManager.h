@@ -4,6 +4,8 @@
 #include "Core/Graphics/Resource/VertexBuffer.h"
 #include "Core/Graphics/Resource/DefaultResourceTypes.h"
 #include "Common/Utility/CommonTypes.h"
+#include "Framework/Asset/AssetRequest.h"
+#include "Framework/Asset/PendingLoadMap.h"
 
 namespace engine
 {
@@ -27,7 +29,7 @@ namespace engine
     {
     private:
         std::unordered_map<VertexBufferKey, std::weak_ptr<VertexBuffer>> m_vertexBuffers;
-        std::unordered_map<std::string, std::weak_ptr<IndexBuffer>> m_indexBuffers;
+        std::unordered_map<IndexBufferKey, std::weak_ptr<IndexBuffer>> m_indexBuffers;
         std::unordered_map<std::string, std::weak_ptr<Texture>> m_textures;
         std::unordered_map<std::string, std::weak_ptr<ConstantBuffer>> m_constantBuffers;
         std::unordered_map<std::string, std::weak_ptr<VertexShader>> m_vertexShaders;
@@ -47,6 +49,10 @@ namespace engine
         std::vector<std::shared_ptr<Resource>> m_globalCachedResources;
         std::vector<std::shared_ptr<Resource>> m_sceneCachedResources;
 
+        // 워커에서 디코드 중인 텍스처 (메인 스레드에서만 접근)
+        struct PendingTextureLoad;
+        PendingLoadMap<PendingTextureLoad> m_pendingTextures;
+
     private:
         ResourceManager() = default;
         ~ResourceManager();
@@ -57,6 +63,9 @@ namespace engine
         void CleanupSceneScope();
         void Cleanup();
 
+        // 프레임 시작에 메인 스레드에서 호출, 디코드가 끝난 텍스처를 GPU에 올리고 요청한 쪽에 알림
+        void PublishCompletedLoads();
+
     public:
         // VertexBuffer는 버텍스 타입별로 구분이 필요하기 때문에 템플릿으로 만듦
         template <IsVertex T>
@@ -84,15 +93,26 @@ namespace engine
             return vertexBuffer;
         }
 
+        // kind는 인덱스를 만든 임포트 종류 (같은 파일이라도 Static / Skeletal은 인덱스가 다름)
         std::shared_ptr<IndexBuffer> GetOrCreateIndexBuffer(
             const std::string& filePath,
+            FBXAssetKind kind,
             const std::vector<DWORD>& indices,
             LifeScope scope = LifeScope::Owning);
         std::shared_ptr<IndexBuffer> GetOrCreateIndexBuffer(
             const std::string& filePath,
+            FBXAssetKind kind,
             const std::vector<WORD>& indices,
             LifeScope scope = LifeScope::Owning);
         std::shared_ptr<Texture> GetOrCreateTexture(const std::string& filePath, LifeScope scope = LifeScope::Owning);
+
+        // 디코드는 워커 스레드에서, 끝날 때까지 placeholder의 뷰를 빌려 쓰는 Texture를 바로 돌려줌
+        // 같은 파일을 다시 요청하면 같은 Texture를 돌려주고, GetOrCreateTexture로 요청하면 디코드가 끝날 때까지 기다림
+        AssetRequest<Texture> RequestTexture(
+            const std::string& filePath,
+            DefaultTextureType placeholder = DefaultTextureType::White,
+            LifeScope scope = LifeScope::Owning);
+
         std::shared_ptr<Texture> GetOrCreateTexture(
             const std::string& name,
             UINT width,
@@ -156,6 +176,9 @@ namespace engine
 
         void CacheResource(const std::shared_ptr<Resource>& resource, LifeScope scope);
 
+        void FinishPendingTexture(const std::string& filePath);
+        void PublishTexture(PendingTextureLoad& pending);
+
     private:
         friend class Singleton<ResourceManager>;
     };
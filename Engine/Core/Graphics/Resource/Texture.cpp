@@ -115,6 +115,56 @@ namespace engine
         m_desc = GetTextureDescFromSRV(m_srv.Get());
     }
 
+    bool Texture::Decode(const std::string& filePath, DirectX::ScratchImage& outImage)
+    {
+        // WIC는 스레드마다 COM 초기화가 필요함 (메인 스레드는 WinApp에서)
+        thread_local const HRESULT t_comResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+        (void)t_comResult;
+
+        const std::filesystem::path path{ filePath };
+        const auto extension = path.extension();
+
+        HRESULT hr = S_OK;
+        if (extension == ".tga" || extension == ".TGA")
+        {
+            hr = DirectX::LoadFromTGAFile(path.c_str(), nullptr, outImage);
+        }
+        else if (extension == ".dds" || extension == ".DDS")
+        {
+            hr = DirectX::LoadFromDDSFile(path.c_str(), DirectX::DDS_FLAGS_NONE, nullptr, outImage);
+        }
+        else
+        {
+            hr = DirectX::LoadFromWICFile(path.c_str(), DirectX::WIC_FLAGS_NONE, nullptr, outImage);
+        }
+
+        return SUCCEEDED(hr);
+    }
+
+    void Texture::Create(const DirectX::ScratchImage& image)
+    {
+        const auto& device = GraphicsDevice::Get().GetDevice();
+
+        // 자리 표시자에서 빌린 텍스처는 놓음
+        m_texture.Reset();
+
+        HR_CHECK(CreateShaderResourceView(
+            device.Get(),
+            image.GetImages(),
+            image.GetImageCount(),
+            image.GetMetadata(),
+            &m_srv));
+
+        m_desc = GetTextureDescFromSRV(m_srv.Get());
+    }
+
+    void Texture::CreatePlaceholder(const Texture& source)
+    {
+        m_texture = source.m_texture;
+        m_srv = source.m_srv;
+        m_desc = source.m_desc;
+    }
+
     void Texture::Create(UINT width, UINT height, DXGI_FORMAT format, UINT bindFlags)
     {
         D3D11_TEXTURE2D_DESC desc{};
@@ -1,6 +1,12 @@
 ﻿#pragma once
 
 #include "Core/Graphics/Resource/Resource.h"
+#include "Core/Graphics/Device/D3D11Handles.h"
+
+namespace DirectX
+{
+    class ScratchImage;
+}
 
 namespace engine
 {
@@ -24,6 +30,13 @@ namespace engine
             DXGI_FORMAT dsvFormat = DXGI_FORMAT_UNKNOWN);
         void Create(const std::array<unsigned char, 4>& color);
 
+        // 비동기 로드용: Decode는 워커 스레드에서 (GPU 리소스를 만들지 않음), Create는 메인 스레드에서
+        static bool Decode(const std::string& filePath, DirectX::ScratchImage& outImage);
+        void Create(const DirectX::ScratchImage& image);
+
+        // 로드가 끝날 때까지 source의 뷰를 빌려 씀
+        void CreatePlaceholder(const Texture& source);
+
     public:
         const Microsoft::WRL::ComPtr<ID3D11Texture2D>& GetTexture() const;
         const Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>& GetSRV() const;
@@ -41,6 +54,8 @@ namespace engine
 
     struct Textures
     {
+        static constexpr UINT Count = 6;
+
         std::shared_ptr<Texture> baseColor;
         std::shared_ptr<Texture> normal;
         std::shared_ptr<Texture> metalness;
@@ -48,7 +63,7 @@ namespace engine
         std::shared_ptr<Texture> ambientOcclusion;
         std::shared_ptr<Texture> emissive;
 
-        std::array<ID3D11ShaderResourceView*, 6> AsRawArray() const
+        std::array<ID3D11ShaderResourceView*, Count> AsRawArray() const
         {
             return {
                 baseColor->GetRawSRV(),
@@ -59,5 +74,17 @@ namespace engine
                 emissive->GetRawSRV(),
             };
         }
+
+        std::array<ShaderResourceHandle, Count> AsHandles() const
+        {
+            return {
+                ToHandle(baseColor->GetRawSRV()),
+                ToHandle(normal->GetRawSRV()),
+                ToHandle(metalness->GetRawSRV()),
+                ToHandle(roughness->GetRawSRV()),
+                ToHandle(ambientOcclusion->GetRawSRV()),
+                ToHandle(emissive->GetRawSRV()),
+            };
+        }
     };
 }
\ No newline at end of file
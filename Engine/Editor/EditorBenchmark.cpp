@@ -0,0 +1,2533 @@
+﻿#include "EnginePCH.h"
+#include "EditorBenchmark.h"
+
+#include <fstream>
+#include <random>
+
+#include <DirectXTex.h>
+
+#include "Common/Math/DynamicAabbTree.h"
+#include "Common/Utility/FrameArena.h"
+#include "Common/Utility/JobSystem.h"
+#include "Common/Utility/MappedFile.h"
+#include "Common/Utility/Profiling.h"
+#include "Core/Graphics/Data/ShaderSlotTypes.h"
+#include "Core/Graphics/Data/VertexCompression.h"
+#include "Core/Graphics/Device/NullCommandContext.h"
+#include "Core/Graphics/Resource/Texture.h"
+#include "Framework/Animation/SkinningKernel.h"
+#include "Framework/Asset/AssetManager.h"
+#include "Framework/Asset/AnimationData.h"
+#include "Framework/Asset/FBXData.h"
+#include "Framework/Asset/SkeletalMeshData.h"
+#include "Framework/Asset/SkeletonData.h"
+#include "Framework/Asset/StaticMeshData.h"
+#include "Framework/Object/Object.h"
+#include "Framework/Object/Component/ComponentFactory.h"
+#include "Framework/Object/Component/RectTransform.h"
+#include "Framework/Object/Component/Collider.h"
+#include "Framework/Object/Component/Light.h"
+#include "Framework/Object/Component/Renderer.h"
+#include "Framework/Object/Component/SkeletalAnimator.h"
+#include "Framework/Physics/CollisionTypes.h"
+#include "Framework/Scene/Scene.h"
+#include "Framework/Scene/SceneBinary.h"
+#include "Framework/Scene/SceneManager.h"
+#include "Framework/Scene/SceneSnapshot.h"
+#include "Framework/System/ComponentColumns.h"
+#include "Framework/System/RenderQueue.h"
+#include "Framework/System/SpriteBatch.h"
+#include "Framework/System/TransformSystem.h"
+#include "Editor/EditorManager.h"
+
+namespace engine
+{
+    namespace
+    {
+        std::vector<std::string> g_results;
+
+        // 최적화로 쿼리 결과가 버려지지 않도록 누적
+        volatile std::size_t g_sink = 0;
+
+        double GetElapsedMicroseconds(const TimePoint& start)
+        {
+            return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        }
+
+        // SoA 이전 Transform과 같은 방식 (개별 할당, 자식 포인터 목록, 재귀 lazy 갱신)
+        struct LegacyTransform
+        {
+            Vector3 localPosition{ 0.0f, 0.0f, 0.0f };
+            Quaternion localRotation = Quaternion::Identity;
+            Vector3 localScale{ 1.0f, 1.0f, 1.0f };
+            Matrix world;
+
+            LegacyTransform* parent = nullptr;
+            std::vector<LegacyTransform*> children;
+
+            bool isDirty = true;
+
+            const Matrix& GetWorld()
+            {
+                if (isDirty)
+                {
+                    const Matrix local = Matrix::CreateScale(localScale) *
+                        Matrix::CreateFromQuaternion(localRotation) *
+                        Matrix::CreateTranslation(localPosition);
+
+                    world = parent != nullptr ? local * parent->GetWorld() : local;
+                    isDirty = false;
+                }
+
+                return world;
+            }
+
+            void MarkDirty()
+            {
+                if (isDirty)
+                {
+                    return;
+                }
+
+                isDirty = true;
+
+                for (auto child : children)
+                {
+                    child->MarkDirty();
+                }
+            }
+        };
+
+        // 컴포넌트마다 따로 할당하고 시스템이 포인터 목록으로 가상 Update를 부르던 방식
+        // name / handle은 Object가 들고 있는 것 (데이터 사이에 끼어서 캐시 라인을 차지함)
+        class LegacyMover
+        {
+        public:
+            std::string name = "Mover";
+            std::uint64_t handle = 0;
+            Vector3 position;
+            Vector3 velocity;
+            float scale = 1.0f;
+            Matrix world;
+
+        public:
+            virtual ~LegacyMover() = default;
+
+            virtual void Update(float deltaTime)
+            {
+                position += velocity * deltaTime;
+                world = Matrix::CreateScale(scale) * Matrix::CreateTranslation(position);
+            }
+        };
+
+        // ComponentColumns의 Owner (slot 핸들만 가짐)
+        struct ColumnMover
+        {
+            std::int32_t slot = -1;
+        };
+
+        enum MoverColumn : std::size_t
+        {
+            PositionColumn,
+            VelocityColumn,
+            ScaleColumn,
+            WorldColumn
+        };
+
+        using MoverColumns = ComponentColumns<ColumnMover, Vector3, Vector3, float, Matrix>;
+
+        struct HeapVectors
+        {
+            template <typename T>
+            using Vector = std::vector<T>;
+        };
+
+        struct FrameVectors
+        {
+            template <typename T>
+            using Vector = FrameVector<T>;
+        };
+
+        // RenderSystem의 투명 정렬 목록, CollisionSystem의 접촉점 복사 / 반전, 디버그 렌더러의 콜라이더 목록과 같은 일
+        template <typename Vectors>
+        std::size_t RunTransientFrame(const std::vector<float>& distances, int eventCount, int contactCount)
+        {
+            typename Vectors::template Vector<std::pair<float, Renderer*>> sortList;
+            sortList.reserve(distances.size());
+            for (float distance : distances)
+            {
+                sortList.emplace_back(distance, nullptr);
+            }
+
+            std::sort(sortList.begin(), sortList.end(),
+                [](const auto& a, const auto& b)
+                {
+                    return a.first > b.first;
+                });
+
+            std::size_t sink = sortList.size();
+
+            for (int e = 0; e < eventCount; ++e)
+            {
+                typename Vectors::template Vector<ContactPoint> contacts;
+                contacts.reserve(contactCount);
+                for (int c = 0; c < contactCount; ++c)
+                {
+                    contacts.push_back(ContactPoint{ Vector3(static_cast<float>(c), 0.0f, 0.0f), Vector3::UnitY, -0.01f, 1.0f });
+                }
+
+                auto flipped = contacts;
+                for (auto& contact : flipped)
+                {
+                    contact.normal = -contact.normal;
+                }
+
+                sink += flipped.size();
+            }
+
+            typename Vectors::template Vector<Collider*> colliders;
+            colliders.reserve(eventCount * 2);
+            for (int i = 0; i < eventCount * 2; ++i)
+            {
+                colliders.push_back(nullptr);
+            }
+
+            return sink + colliders.size();
+        }
+
+        class RegistryTestObject :
+            public Object
+        {
+        public:
+            std::string GetType() const override
+            {
+                return "RegistryTestObject";
+            }
+        };
+    }
+
+    void EditorBenchmark::OnGui()
+    {
+        if (ImGui::Button("Spatial Query"))
+        {
+            RunSpatialQuery();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Transform Hierarchy"))
+        {
+            RunTransformHierarchy();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Skeletal Animation"))
+        {
+            RunSkeletalAnimation();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Animation Compression"))
+        {
+            ReportAnimationCompression();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Skinning Kernel"))
+        {
+            RunSkinningKernel();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Object Registry"))
+        {
+            RunObjectRegistryStress();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Component Lookup"))
+        {
+            RunComponentLookup();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Archetype Update"))
+        {
+            RunArchetypeUpdate();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Frame Arena"))
+        {
+            RunFrameArena();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Scene Load"))
+        {
+            RunSceneLoad();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Play Snapshot"))
+        {
+            RunPlaySnapshot();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Mesh Cook"))
+        {
+            RunMeshCook();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Asset Streaming"))
+        {
+            RunAssetStreaming();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Vertex Compression"))
+        {
+            RunVertexCompression();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Render Queue"))
+        {
+            RunRenderQueue();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Static Instancing"))
+        {
+            RunStaticInstancing();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Sprite Batch"))
+        {
+            RunSpriteBatch();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Parallel Submit"))
+        {
+            RunParallelSubmit();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Command Recording"))
+        {
+            RunCommandRecording();
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Clear"))
+        {
+            g_results.clear();
+        }
+
+        for (const auto& result : g_results)
+        {
+            ImGui::TextUnformatted(result.c_str());
+        }
+    }
+
+    void EditorBenchmark::RunSpatialQuery()
+    {
+        constexpr int queryCount = 100;
+        constexpr float worldHalfSize = 500.0f;
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> positionDist(-worldHalfSize, worldHalfSize);
+        std::uniform_real_distribution<float> extentDist(0.5f, 3.0f);
+        std::uniform_real_distribution<float> angleDist(0.0f, DirectX::XM_2PI);
+
+        const Matrix projection = DirectX::XMMatrixPerspectiveFovLH(ToRadian(60.0f), 16.0f / 9.0f, 0.1f, 200.0f);
+        const DirectX::BoundingFrustum localFrustum(projection);
+
+        for (const int objectCount : { 1000, 10000, 100000 })
+        {
+            std::vector<DirectX::BoundingBox> boxes(objectCount);
+            for (auto& box : boxes)
+            {
+                box.Center = Vector3(positionDist(rng), positionDist(rng), positionDist(rng));
+                box.Extents = Vector3(extentDist(rng), extentDist(rng), extentDist(rng));
+            }
+
+            DynamicAabbTree tree;
+            const TimePoint buildStart = Clock::now();
+            for (auto& box : boxes)
+            {
+                tree.CreateProxy(box, &box);
+            }
+            const double buildUs = GetElapsedMicroseconds(buildStart);
+
+            std::vector<DirectX::BoundingFrustum> frustums(queryCount);
+            std::vector<std::pair<Vector3, Vector3>> rays(queryCount);
+            for (int i = 0; i < queryCount; ++i)
+            {
+                const Vector3 position(positionDist(rng), positionDist(rng), positionDist(rng));
+                const Matrix world = Matrix::CreateFromYawPitchRoll(angleDist(rng), angleDist(rng), 0.0f) *
+                    Matrix::CreateTranslation(position);
+
+                localFrustum.Transform(frustums[i], world);
+                rays[i] = { position, GetForward(world) };
+            }
+
+            // frustum
+            std::size_t linearHits = 0;
+            TimePoint start = Clock::now();
+            for (const auto& frustum : frustums)
+            {
+                for (const auto& box : boxes)
+                {
+                    if (frustum.Intersects(box))
+                    {
+                        ++linearHits;
+                    }
+                }
+            }
+            const double linearFrustumUs = GetElapsedMicroseconds(start) / queryCount;
+
+            std::size_t treeHits = 0;
+            start = Clock::now();
+            for (const auto& frustum : frustums)
+            {
+                tree.QueryFrustum(frustum, [&](void* userData)
+                    {
+                        if (frustum.Intersects(*static_cast<DirectX::BoundingBox*>(userData)))
+                        {
+                            ++treeHits;
+                        }
+
+                        return true;
+                    });
+            }
+            const double treeFrustumUs = GetElapsedMicroseconds(start) / queryCount;
+
+            // ray (가장 가까운 것)
+            constexpr float maxDistance = 2.0f * worldHalfSize;
+
+            start = Clock::now();
+            for (const auto& [origin, direction] : rays)
+            {
+                float closest = maxDistance;
+                for (const auto& box : boxes)
+                {
+                    float distance = 0.0f;
+                    if (box.Intersects(origin, direction, distance) && distance < closest)
+                    {
+                        closest = distance;
+                    }
+                }
+                g_sink = g_sink + static_cast<std::size_t>(closest);
+            }
+            const double linearRayUs = GetElapsedMicroseconds(start) / queryCount;
+
+            start = Clock::now();
+            for (const auto& [origin, direction] : rays)
+            {
+                float closest = maxDistance;
+                tree.QueryRay(origin, direction, maxDistance, [&](void* userData, float)
+                    {
+                        float distance = 0.0f;
+                        if (static_cast<DirectX::BoundingBox*>(userData)->Intersects(origin, direction, distance) && distance < closest)
+                        {
+                            closest = distance;
+                        }
+
+                        return closest;
+                    });
+                g_sink = g_sink + static_cast<std::size_t>(closest);
+            }
+            const double treeRayUs = GetElapsedMicroseconds(start) / queryCount;
+
+            g_sink = g_sink + linearHits + treeHits;
+
+            AddResult(std::format("[BVH] {} objects: build {:.0f}us, height {}", objectCount, buildUs, tree.GetHeight()));
+            AddResult(std::format("  frustum  linear {:.1f}us / bvh {:.1f}us (x{:.1f}), hits {} / {}",
+                linearFrustumUs, treeFrustumUs, linearFrustumUs / treeFrustumUs, linearHits, treeHits));
+            AddResult(std::format("  ray      linear {:.1f}us / bvh {:.1f}us (x{:.1f})",
+                linearRayUs, treeRayUs, linearRayUs / treeRayUs));
+        }
+    }
+
+    void EditorBenchmark::RunTransformHierarchy()
+    {
+        // 스켈레톤처럼 루트 하나에 깊이 있는 자식들이 달린 계층을 여러 개 만들고 매 프레임 루트를 모두 움직임
+        constexpr int frameCount = 60;
+        constexpr int chainLength = 16;
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> offsetDist(-1.0f, 1.0f);
+
+        for (const int objectCount : { 4096, 16384, 65536 })
+        {
+            const int hierarchyCount = objectCount / chainLength;
+
+            // 생성 순서를 섞어서 풀 안에서 부모/자식이 흩어져 있는 상황을 만듦
+            std::vector<int> creationOrder(objectCount);
+            for (int i = 0; i < objectCount; ++i)
+            {
+                creationOrder[i] = i;
+            }
+            std::shuffle(creationOrder.begin(), creationOrder.end(), rng);
+
+            // i번째 노드의 부모는 같은 체인의 i - 1번째 (체인의 첫 노드는 루트)
+            auto getParent = [](int i)
+                {
+                    return i % chainLength == 0 ? -1 : i - 1;
+                };
+
+            // legacy
+            std::vector<std::unique_ptr<LegacyTransform>> legacyStorage(objectCount);
+            std::vector<LegacyTransform*> legacy(objectCount);
+            for (int i : creationOrder)
+            {
+                legacyStorage[i] = std::make_unique<LegacyTransform>();
+                legacy[i] = legacyStorage[i].get();
+                legacy[i]->localPosition = Vector3(offsetDist(rng), offsetDist(rng), offsetDist(rng));
+            }
+
+            for (int i = 0; i < objectCount; ++i)
+            {
+                if (const int parent = getParent(i); parent != -1)
+                {
+                    legacy[i]->parent = legacy[parent];
+                    legacy[parent]->children.push_back(legacy[i]);
+                }
+            }
+
+            // SoA
+            TransformSystem transformSystem;
+            std::vector<std::int32_t> slots(objectCount);
+            for (int i : creationOrder)
+            {
+                slots[i] = transformSystem.CreateSlot(nullptr);
+                transformSystem.m_localPositions[slots[i]] = legacy[i]->localPosition;
+            }
+
+            for (int i = 0; i < objectCount; ++i)
+            {
+                if (const int parent = getParent(i); parent != -1)
+                {
+                    transformSystem.SetParentSlot(slots[i], slots[parent]);
+                }
+            }
+
+            TimePoint start = Clock::now();
+            transformSystem.UpdateWorldMatrices();
+            const double sortUs = GetElapsedMicroseconds(start);
+
+            // 정렬 후 slot이 바뀌었으므로 루트를 다시 찾음
+            std::vector<std::int32_t> roots;
+            for (std::int32_t slot = 0; slot < static_cast<std::int32_t>(transformSystem.m_parents.size()); ++slot)
+            {
+                if (transformSystem.m_parents[slot] == -1)
+                {
+                    roots.push_back(slot);
+                }
+            }
+
+            // 자식 목록 (Transform::MarkDirty의 전파와 같은 일을 함)
+            std::vector<std::vector<std::int32_t>> children(transformSystem.m_parents.size());
+            for (std::int32_t slot = 0; slot < static_cast<std::int32_t>(transformSystem.m_parents.size()); ++slot)
+            {
+                if (const std::int32_t parent = transformSystem.m_parents[slot]; parent != -1)
+                {
+                    children[parent].push_back(slot);
+                }
+            }
+
+            auto markDirty = [&](auto&& self, std::int32_t slot) -> void
+                {
+                    if (!transformSystem.MarkDirty(slot))
+                    {
+                        return;
+                    }
+
+                    for (std::int32_t child : children[slot])
+                    {
+                        self(self, child);
+                    }
+                };
+
+            float sink = 0.0f;
+
+            start = Clock::now();
+            for (int frame = 0; frame < frameCount; ++frame)
+            {
+                for (int h = 0; h < hierarchyCount; ++h)
+                {
+                    LegacyTransform* root = legacy[h * chainLength];
+                    root->localPosition.x += 0.01f;
+                    root->MarkDirty();
+                }
+
+                // 컴포넌트 순서대로 world를 읽음 (렌더러, 물리 등)
+                for (int i : creationOrder)
+                {
+                    sink += legacy[i]->GetWorld()._41;
+                }
+            }
+            const double legacyUs = GetElapsedMicroseconds(start) / frameCount;
+
+            start = Clock::now();
+            for (int frame = 0; frame < frameCount; ++frame)
+            {
+                for (std::int32_t root : roots)
+                {
+                    transformSystem.m_localPositions[root].x += 0.01f;
+                    markDirty(markDirty, root);
+                }
+
+                transformSystem.UpdateWorldMatrices();
+
+                for (const auto& world : transformSystem.m_worlds)
+                {
+                    sink += world._41;
+                }
+            }
+            const double soaUs = GetElapsedMicroseconds(start) / frameCount;
+
+            g_sink = g_sink + static_cast<std::size_t>(sink);
+
+            AddResult(std::format("[Transform] {} objects ({} hierarchies x {}): sort {:.0f}us",
+                objectCount, hierarchyCount, chainLength, sortUs));
+            AddResult(std::format("  per frame  legacy {:.1f}us / soa {:.1f}us (x{:.1f})",
+                legacyUs, soaUs, legacyUs / soaUs));
+        }
+    }
+
+    void EditorBenchmark::RunSkeletalAnimation()
+    {
+        constexpr int frameCount = 30;
+        const std::string path = "Resource/Model/Girl.fbx";
+
+        auto animationData = AssetManager::Get().GetOrCreateAnimationData(path);
+        auto skeletonData = AssetManager::Get().GetOrCreateSkeletonData(path);
+        if (animationData == nullptr || skeletonData == nullptr || animationData->GetAnimations().empty())
+        {
+            AddResult("[Animation] Girl.fbx 애니메이션 없음");
+            return;
+        }
+
+        const int clipCount = static_cast<int>(animationData->GetAnimations().size());
+
+        auto& jobSystem = JobSystem::Get();
+        const std::uint32_t maxThreadCount = jobSystem.GetWorkerCount() + 1;
+
+        std::vector<std::uint32_t> threadCounts;
+        for (std::uint32_t threadCount = 1; threadCount < maxThreadCount; threadCount *= 2)
+        {
+            threadCounts.push_back(threadCount);
+        }
+        threadCounts.push_back(maxThreadCount);
+
+        for (const int animatorCount : { 16, 64, 256 })
+        {
+            // 씬에 올리지 않고 AnimatorSystem에도 등록하지 않은 애니메이터
+            std::vector<std::unique_ptr<SkeletalAnimator>> animators(animatorCount);
+            for (int i = 0; i < animatorCount; ++i)
+            {
+                animators[i] = std::make_unique<SkeletalAnimator>();
+                animators[i]->SetAnimationData(path);
+                animators[i]->SetSkeletonData(skeletonData);
+                animators[i]->Play(i % clipCount);
+            }
+
+            AddResult(std::format("[Animation] {} animators, {} clips", animatorCount, clipCount));
+
+            double singleUs = 0.0;
+
+            for (const std::uint32_t threadCount : threadCounts)
+            {
+                // 구간 수를 threadCount로 맞춰서 동시에 도는 스레드 수를 제한
+                const std::uint32_t grainSize = (animatorCount + threadCount - 1) / threadCount;
+
+                const TimePoint start = Clock::now();
+                for (int frame = 0; frame < frameCount; ++frame)
+                {
+                    jobSystem.ParallelFor(static_cast<std::uint32_t>(animatorCount), grainSize,
+                        [&animators](std::uint32_t begin, std::uint32_t end)
+                        {
+                            for (std::uint32_t i = begin; i < end; ++i)
+                            {
+                                animators[i]->Update();
+                            }
+                        });
+                }
+                const double frameUs = GetElapsedMicroseconds(start) / frameCount;
+
+                if (threadCount == 1)
+                {
+                    singleUs = frameUs;
+                }
+
+                AddResult(std::format("  {} threads  {:.1f}us / frame (x{:.2f})", threadCount, frameUs, singleUs / frameUs));
+            }
+
+            for (const auto& animator : animators)
+            {
+                g_sink = g_sink + static_cast<std::size_t>(animator->GetFinalBoneMatrices()[0]._44);
+            }
+        }
+    }
+
+    void EditorBenchmark::ReportAnimationCompression()
+    {
+        for (const std::string path : { "Resource/Model/Girl.fbx", "Resource/Model/SkinningTest.fbx" })
+        {
+            auto animationData = AssetManager::Get().GetOrCreateAnimationData(path);
+            if (animationData == nullptr || animationData->GetCompressionStats().empty())
+            {
+                AddResult(std::format("[Compression] {}: 압축된 클립 없음", path));
+                continue;
+            }
+
+            std::size_t totalRawBytes = 0;
+            std::size_t totalCompressedBytes = 0;
+
+            AddResult(std::format("[Compression] {}", path));
+
+            for (const auto& stats : animationData->GetCompressionStats())
+            {
+                totalRawBytes += stats.rawBytes;
+                totalCompressedBytes += stats.compressedBytes;
+
+                AddResult(std::format("  {}: {:.1f}KB -> {:.1f}KB (x{:.1f}), keys {} -> {}",
+                    stats.name,
+                    stats.rawBytes / 1024.0,
+                    stats.compressedBytes / 1024.0,
+                    static_cast<double>(stats.rawBytes) / std::max<std::size_t>(stats.compressedBytes, 1),
+                    stats.rawKeyCount,
+                    stats.compressedKeyCount));
+                AddResult(std::format("    max error  position {:.4f} / rotation {:.3f}deg / scale {:.4f}",
+                    stats.maxPositionError,
+                    ToDegree(stats.maxRotationError),
+                    stats.maxScaleError));
+            }
+
+            AddResult(std::format("  total {:.1f}KB -> {:.1f}KB", totalRawBytes / 1024.0, totalCompressedBytes / 1024.0));
+        }
+    }
+
+    void EditorBenchmark::RunSkinningKernel()
+    {
+        constexpr int poseCount = 64;
+        constexpr int iterationCount = 2000;
+        const std::string path = "Resource/Model/Girl.fbx";
+
+        auto animationData = AssetManager::Get().GetOrCreateAnimationData(path);
+        auto skeletonData = AssetManager::Get().GetOrCreateSkeletonData(path);
+        if (animationData == nullptr || skeletonData == nullptr || animationData->GetAnimations().empty())
+        {
+            AddResult("[Skinning] Girl.fbx 애니메이션 없음");
+            return;
+        }
+
+        std::vector<Bone> skeleton;
+        skeletonData->SetupSkeletonInstance(skeleton);
+
+        AnimationPose bindPose;
+        CreateBindPose(skeleton, bindPose);
+
+        // 첫 번째 클립을 고르게 샘플링한 포즈들
+        const auto& animation = animationData->GetAnimations().front();
+        std::vector<AnimationPose> poses(poseCount);
+        std::vector<LastKeyIndex> keyIndices;
+        for (int i = 0; i < poseCount; ++i)
+        {
+            SamplePose(animation, animation.duration * i / poseCount, bindPose, keyIndices, poses[i]);
+        }
+
+        const auto& boneOffsets = skeletonData->GetBoneOffsets();
+        std::vector<Bone> referenceSkeleton = skeleton;
+        BoneMatrixArray matrices{};
+        BoneMatrixArray referenceMatrices{};
+
+        float maxError = 0.0f;
+        for (const auto& pose : poses)
+        {
+            BuildSkinningMatrices(pose, skeleton, boneOffsets, matrices);
+            BuildSkinningMatricesReference(pose, referenceSkeleton, boneOffsets, referenceMatrices);
+
+            for (const auto& bone : skeleton)
+            {
+                const float* a = &matrices[bone.index]._11;
+                const float* b = &referenceMatrices[bone.index]._11;
+                for (int k = 0; k < 16; ++k)
+                {
+                    maxError = std::max(maxError, std::abs(a[k] - b[k]));
+                }
+            }
+        }
+
+        TimePoint start = Clock::now();
+        for (int i = 0; i < iterationCount; ++i)
+        {
+            BuildSkinningMatricesReference(poses[i % poseCount], referenceSkeleton, boneOffsets, referenceMatrices);
+        }
+        const double referenceUs = GetElapsedMicroseconds(start) / iterationCount;
+
+        start = Clock::now();
+        for (int i = 0; i < iterationCount; ++i)
+        {
+            BuildSkinningMatrices(poses[i % poseCount], skeleton, boneOffsets, matrices);
+        }
+        const double simdUs = GetElapsedMicroseconds(start) / iterationCount;
+
+        g_sink = g_sink + static_cast<std::size_t>(matrices[0]._44 + referenceMatrices[0]._44);
+
+        AddResult(std::format("[Skinning] {} bones, max error {:.2e}", skeleton.size(), maxError));
+        AddResult(std::format("  reference {:.2f}us / simd {:.2f}us (x{:.2f})", referenceUs, simdUs, referenceUs / simdUs));
+    }
+
+    void EditorBenchmark::RunObjectRegistryStress()
+    {
+        constexpr std::uint32_t iterationCount = 20000;
+        constexpr std::uint32_t liveCount = 64; // 스레드마다 동시에 살아있는 객체 수
+        constexpr std::uint32_t publishedCount = 4096;
+
+        auto& jobSystem = JobSystem::Get();
+        const std::uint32_t threadCount = jobSystem.GetWorkerCount() + 1;
+
+        // 다른 스레드가 만든 핸들을 조회해보기 위한 공유 슬롯 (index << 32 | generation)
+        std::vector<std::atomic<std::uint64_t>> published(publishedCount);
+        std::atomic<std::uint32_t> errorCount = 0;
+        std::atomic<std::uint64_t> foreignHitCount = 0;
+
+        auto pack = [](Handle handle)
+            {
+                return static_cast<std::uint64_t>(handle.index) << 32 | handle.generation;
+            };
+
+        auto unpack = [](std::uint64_t value)
+            {
+                return Handle{ static_cast<std::uint32_t>(value >> 32), static_cast<std::uint32_t>(value) };
+            };
+
+        const TimePoint start = Clock::now();
+
+        jobSystem.ParallelFor(threadCount, 1,
+            [&](std::uint32_t begin, std::uint32_t)
+            {
+                std::mt19937 rng(begin + 1);
+                std::vector<std::unique_ptr<RegistryTestObject>> objects(liveCount);
+                std::uint32_t errors = 0;
+                std::uint64_t foreignHits = 0;
+
+                for (std::uint32_t i = 0; i < iterationCount; ++i)
+                {
+                    auto& slot = objects[rng() % liveCount];
+
+                    if (slot != nullptr)
+                    {
+                        // 삭제한 핸들은 바로 무효가 되어야 함
+                        const Handle handle = slot->GetHandle();
+                        slot.reset();
+
+                        errors += Object::GetObjectFromHandle(handle) != nullptr ? 1 : 0;
+                    }
+                    else
+                    {
+                        slot = std::make_unique<RegistryTestObject>();
+
+                        const Handle handle = slot->GetHandle();
+                        errors += Object::GetObjectFromHandle(handle) != slot.get() ? 1 : 0;
+
+                        published[rng() % publishedCount].store(pack(handle), std::memory_order_relaxed);
+                    }
+
+                    // 다른 스레드 객체는 언제든 삭제될 수 있으므로 조회만 하고 역참조하지 않음
+                    const std::uint64_t value = published[rng() % publishedCount].load(std::memory_order_relaxed);
+                    if (value != 0 && Object::GetObjectFromHandle(unpack(value)) != nullptr)
+                    {
+                        ++foreignHits;
+                    }
+                }
+
+                // 남은 객체 정리 후 자기 핸들이 모두 무효인지 확인
+                for (auto& object : objects)
+                {
+                    if (object != nullptr)
+                    {
+                        const Handle handle = object->GetHandle();
+                        object.reset();
+
+                        errors += Object::GetObjectFromHandle(handle) != nullptr ? 1 : 0;
+                    }
+                }
+
+                errorCount += errors;
+                foreignHitCount += foreignHits;
+            });
+
+        const double elapsedUs = GetElapsedMicroseconds(start);
+
+        // 전부 삭제되었으므로 공유 슬롯의 핸들도 모두 무효여야 함
+        std::uint32_t staleCount = 0;
+        for (const auto& value : published)
+        {
+            const std::uint64_t handle = value.load(std::memory_order_relaxed);
+            if (handle != 0 && Object::GetObjectFromHandle(unpack(handle)) != nullptr)
+            {
+                ++staleCount;
+            }
+        }
+
+        const double operationCount = static_cast<double>(threadCount) * iterationCount * 2;
+
+        AddResult(std::format("[Object Registry] {} threads x {} iterations", threadCount, iterationCount));
+        AddResult(std::format("  {:.1f}ms, {:.0f} ops / ms, foreign hits {}",
+            elapsedUs / 1000.0, operationCount / (elapsedUs / 1000.0), foreignHitCount.load()));
+        AddResult(std::format("  errors {}, stale handles {}", errorCount.load(), staleCount));
+    }
+
+    void EditorBenchmark::RunComponentLookup()
+    {
+        constexpr int objectCount = 1000;
+        constexpr int repeatCount = 100;
+
+        // 생성자에 부작용 없는 컴포넌트들 (씬과 시스템에 등록하지 않음, Light / Camera는 데이터 행만 만들었다 지움)
+        const std::array<const char*, 13> componentNames
+        {
+            "Light", "Camera", "SpriteAnimator", "SkeletalAnimator", "StaticMeshRenderer",
+            "SkeletalMeshRenderer", "SpriteRenderer", "Rigidbody", "BoxCollider",
+            "SphereCollider", "CapsuleCollider", "CharacterController", "Canvas"
+        };
+
+        struct LookupObject
+        {
+            std::vector<std::unique_ptr<Component>> components;
+            ComponentLookup lookup;
+        };
+
+        auto findByCast = []<typename T>(const LookupObject& object) -> T*
+        {
+            for (const auto& component : object.components)
+            {
+                if (T* casted = dynamic_cast<T*>(component.get()); casted != nullptr)
+                {
+                    return casted;
+                }
+            }
+
+            return nullptr;
+        };
+
+        auto findByType = []<typename T>(const LookupObject& object) -> T*
+        {
+            const std::uint32_t typeId = GetComponentTypeId<T>();
+            if (!object.lookup.Has(typeId))
+            {
+                return nullptr;
+            }
+
+            return static_cast<T*>(object.components[object.lookup.Find(typeId)].get());
+        };
+
+        for (const std::size_t componentCount : { std::size_t{ 8 }, componentNames.size() })
+        {
+            std::vector<LookupObject> objects(objectCount);
+            for (int i = 0; i < objectCount; ++i)
+            {
+                // 객체마다 순서를 돌려서 찾는 컴포넌트 위치를 섞음
+                for (std::size_t k = 0; k < componentCount; ++k)
+                {
+                    auto component = ComponentFactory::Get().Create(componentNames[(i + k) % componentNames.size()]);
+                    objects[i].lookup.Add(component->GetTypeMask(), objects[i].components.size());
+                    objects[i].components.push_back(std::move(component));
+                }
+            }
+
+            // RectTransform은 항상 없음 (Transform::MarkDirty 경로), 나머지는 구체 / 베이스 타입
+            auto run = [&](auto find)
+                {
+                    std::size_t hits = 0;
+
+                    const TimePoint start = Clock::now();
+                    for (int repeat = 0; repeat < repeatCount; ++repeat)
+                    {
+                        for (const auto& object : objects)
+                        {
+                            hits += find.template operator()<RectTransform>(object) != nullptr;
+                            hits += find.template operator()<SkeletalAnimator>(object) != nullptr;
+                            hits += find.template operator()<Light>(object) != nullptr;
+                            hits += find.template operator()<Renderer>(object) != nullptr;
+                            hits += find.template operator()<Collider>(object) != nullptr;
+                        }
+                    }
+                    const double elapsedUs = GetElapsedMicroseconds(start);
+
+                    g_sink = g_sink + hits;
+
+                    return std::pair{ elapsedUs * 1000.0 / (repeatCount * objectCount * 5), hits };
+                };
+
+            const auto [castNs, castHits] = run(findByCast);
+            const auto [typeNs, typeHits] = run(findByType);
+
+            AddResult(std::format("[Component Lookup] {} objects x {} components", objectCount, componentCount));
+            AddResult(std::format("  dynamic_cast {:.1f}ns / type id {:.1f}ns per lookup (x{:.1f}){}",
+                castNs, typeNs, castNs / typeNs, castHits == typeHits ? "" : "  결과 불일치"));
+        }
+    }
+
+    void EditorBenchmark::RunArchetypeUpdate()
+    {
+        constexpr int frameCount = 60;
+        constexpr float deltaTime = 1.0f / 60.0f;
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+        for (const int entityCount : { 10000, 100000 })
+        {
+            std::vector<Vector3> positions(entityCount);
+            std::vector<Vector3> velocities(entityCount);
+            for (int i = 0; i < entityCount; ++i)
+            {
+                positions[i] = Vector3(dist(rng), dist(rng), dist(rng));
+                velocities[i] = Vector3(dist(rng), dist(rng), dist(rng));
+            }
+
+            // 다른 할당 사이에 흩어진 상황을 만들기 위해 생성 순서와 시스템 등록 순서를 섞음
+            std::vector<int> order(entityCount);
+            for (int i = 0; i < entityCount; ++i)
+            {
+                order[i] = i;
+            }
+            std::shuffle(order.begin(), order.end(), rng);
+
+            std::vector<std::unique_ptr<LegacyMover>> legacyStorage(entityCount);
+            for (int i : order)
+            {
+                legacyStorage[i] = std::make_unique<LegacyMover>();
+                legacyStorage[i]->position = positions[i];
+                legacyStorage[i]->velocity = velocities[i];
+            }
+
+            std::vector<LegacyMover*> legacy(entityCount);
+            for (int i = 0; i < entityCount; ++i)
+            {
+                legacy[i] = legacyStorage[order[i]].get();
+            }
+
+            std::vector<ColumnMover> movers(entityCount);
+            MoverColumns columns;
+            columns.Reserve(entityCount);
+            for (int i = 0; i < entityCount; ++i)
+            {
+                movers[i].slot = columns.Add(&movers[i], positions[i], velocities[i], 1.0f, Matrix::Identity);
+            }
+
+            TimePoint start = Clock::now();
+            for (int frame = 0; frame < frameCount; ++frame)
+            {
+                for (auto mover : legacy)
+                {
+                    mover->Update(deltaTime);
+                }
+            }
+            const double legacyUs = GetElapsedMicroseconds(start) / frameCount;
+
+            start = Clock::now();
+            for (int frame = 0; frame < frameCount; ++frame)
+            {
+                auto& columnPositions = columns.GetColumn<PositionColumn>();
+                const auto& columnVelocities = columns.GetColumn<VelocityColumn>();
+                const auto& columnScales = columns.GetColumn<ScaleColumn>();
+                auto& columnWorlds = columns.GetColumn<WorldColumn>();
+
+                const std::size_t count = columns.GetSize();
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    columnPositions[i] += columnVelocities[i] * deltaTime;
+                    columnWorlds[i] = Matrix::CreateScale(columnScales[i]) * Matrix::CreateTranslation(columnPositions[i]);
+                }
+            }
+            const double columnUs = GetElapsedMicroseconds(start) / frameCount;
+
+            // 같은 결과인지 확인
+            float maxError = 0.0f;
+            for (int i = 0; i < entityCount; ++i)
+            {
+                const Vector3 diff = legacyStorage[i]->world.Translation() - columns.Get<WorldColumn>(movers[i].slot).Translation();
+                maxError = std::max({ maxError, std::abs(diff.x), std::abs(diff.y), std::abs(diff.z) });
+            }
+
+            // 1/4을 무작위로 지운 뒤에도 핸들이 자기 행을 가리키는지 확인
+            std::shuffle(order.begin(), order.end(), rng);
+            for (int k = 0; k < entityCount / 4; ++k)
+            {
+                ColumnMover& removed = movers[order[k]];
+                if (ColumnMover* moved = columns.Remove(removed.slot); moved != nullptr)
+                {
+                    moved->slot = removed.slot;
+                }
+                removed.slot = -1;
+            }
+
+            std::size_t brokenHandles = 0;
+            for (std::int32_t slot = 0; slot < static_cast<std::int32_t>(columns.GetSize()); ++slot)
+            {
+                brokenHandles += columns.GetOwner(slot)->slot != slot;
+            }
+
+            g_sink = g_sink + static_cast<std::size_t>(legacy.front()->world._41 + columns.Get<WorldColumn>(0)._41);
+
+            AddResult(std::format("[Archetype] {} entities, max error {:.2e}, broken handles after removal {}",
+                entityCount, maxError, brokenHandles));
+            AddResult(std::format("  per frame  virtual {:.1f}us / columns {:.1f}us (x{:.1f})",
+                legacyUs, columnUs, legacyUs / columnUs));
+        }
+    }
+
+    void EditorBenchmark::RunFrameArena()
+    {
+        // 이 시점 (에디터 렌더 중 버튼 처리)에는 프레임 아레나 메모리를 들고 있는 곳이 없으므로 BeginFrame을 직접 돌려도 됨
+        constexpr int warmupFrameCount = 8;
+        constexpr int frameCount = 120;
+        constexpr int eventCount = 256;
+        constexpr int contactCount = 4;
+
+        if (Profiling::GetHeapAllocationCount() == 0)
+        {
+            AddResult("[Frame Arena] 힙 할당 횟수는 디버그 빌드에서만 셈");
+        }
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> distanceDist(0.0f, 10000.0f);
+
+        for (const int rendererCount : { 1000, 10000 })
+        {
+            std::vector<float> distances(rendererCount);
+            for (float& distance : distances)
+            {
+                distance = distanceDist(rng);
+            }
+
+            auto run = [&]<typename Vectors>(Vectors)
+                {
+                    for (int frame = 0; frame < warmupFrameCount; ++frame)
+                    {
+                        FrameArena::Get().BeginFrame();
+                        g_sink = g_sink + RunTransientFrame<Vectors>(distances, eventCount, contactCount);
+                    }
+
+                    const UINT64 allocationCount = Profiling::GetHeapAllocationCount();
+
+                    const TimePoint start = Clock::now();
+                    for (int frame = 0; frame < frameCount; ++frame)
+                    {
+                        FrameArena::Get().BeginFrame();
+                        g_sink = g_sink + RunTransientFrame<Vectors>(distances, eventCount, contactCount);
+                    }
+                    const double elapsedUs = GetElapsedMicroseconds(start) / frameCount;
+
+                    const double allocationsPerFrame = static_cast<double>(Profiling::GetHeapAllocationCount() - allocationCount) / frameCount;
+
+                    return std::pair{ elapsedUs, allocationsPerFrame };
+                };
+
+            const auto [heapUs, heapAllocations] = run(HeapVectors{});
+            const auto [frameUs, frameAllocations] = run(FrameVectors{});
+
+            const auto stats = FrameArena::Get().GetStats();
+
+            AddResult(std::format("[Frame Arena] {} renderers, {} collision events x {} contacts (arena {}KB used / {}KB reserved)",
+                rendererCount, eventCount, contactCount, stats.usedBytes / 1024, stats.reservedBytes / 1024));
+            AddResult(std::format("  per frame  std::vector {:.1f}us, {:.1f} heap allocs / frame arena {:.1f}us, {:.1f} heap allocs",
+                heapUs, heapAllocations, frameUs, frameAllocations));
+        }
+    }
+
+    void EditorBenchmark::RunSceneLoad()
+    {
+        if (EditorManager::Get().GetEditorState() != EditorState::Edit)
+        {
+            AddResult("[Scene Load] Edit 모드에서만 실행");
+            return;
+        }
+
+        constexpr int iterationCount = 5;
+
+        Scene* scene = SceneManager::Get().GetScene();
+
+        // 벤치마크가 씬을 바꾸므로 끝나면 되돌림
+        json editingScene;
+        scene->SaveToJson(editingScene);
+
+        // 로드한 객체를 에디터 루프처럼 초기화까지 끝내고 다음 로드에서 지움 (시간에는 넣지 않음)
+        auto loadAndMeasure = [&](auto load)
+            {
+                double totalUs = 0.0;
+                for (int i = 0; i < iterationCount; ++i)
+                {
+                    const TimePoint start = Clock::now();
+                    load();
+                    totalUs += GetElapsedMicroseconds(start);
+
+                    SceneManager::Get().ProcessPendingAdds(false);
+                }
+
+                return totalUs / iterationCount / 1000.0;
+            };
+
+        for (const auto& entry : std::filesystem::directory_iterator("Resource/Scene"))
+        {
+            if (entry.path().extension() != ".json")
+            {
+                continue;
+            }
+
+            const std::filesystem::path jsonPath = entry.path();
+            std::filesystem::path binaryPath = jsonPath;
+            binaryPath.replace_extension(".scenebin");
+
+            // 변환
+            json root;
+            {
+                std::ifstream i(jsonPath);
+                i >> root;
+            }
+
+            std::vector<std::byte> binary;
+            if (!SceneBinary::ConvertFromJson(root, binary))
+            {
+                AddResult(std::format("[Scene Load] {}: 변환 실패", jsonPath.filename().string()));
+                continue;
+            }
+
+            {
+                std::ofstream o(binaryPath, std::ios::binary);
+                o.write(reinterpret_cast<const char*>(binary.data()), static_cast<std::streamsize>(binary.size()));
+            }
+
+            // 바이너리 -> JSON -> 바이너리가 같은지 확인
+            json roundTrip;
+            std::vector<std::byte> roundTripBinary;
+            const bool isRoundTripEqual = SceneBinary::ConvertToJson(binary, roundTrip) &&
+                SceneBinary::ConvertFromJson(roundTrip, roundTripBinary) &&
+                roundTripBinary == binary;
+
+            // 첫 로드에서 에셋 캐시가 채워지므로 한 번씩 미리 로드
+            scene->LoadFromJson(root);
+            SceneManager::Get().ProcessPendingAdds(false);
+
+            const double jsonMs = loadAndMeasure([&]()
+                {
+                    std::ifstream i(jsonPath);
+
+                    json parsed;
+                    i >> parsed;
+
+                    scene->LoadFromJson(parsed);
+                });
+
+            const double binaryMs = loadAndMeasure([&]()
+                {
+                    MappedFile file;
+                    if (!file.Open(binaryPath))
+                    {
+                        return;
+                    }
+
+                    const SceneBinaryReader reader{ file.GetBytes() };
+                    if (reader.IsValid())
+                    {
+                        scene->LoadFromBinary(reader);
+                    }
+                });
+
+            AddResult(std::format("[Scene Load] {}: {} objects, {}KB -> {}KB, round trip {}",
+                jsonPath.filename().string(),
+                root.value("NumGameObjects", 0),
+                std::filesystem::file_size(jsonPath) / 1024,
+                binary.size() / 1024,
+                isRoundTripEqual ? "OK" : "MISMATCH"));
+            AddResult(std::format("  JSON {:.3f}ms / binary {:.3f}ms ({:.1f}x)",
+                jsonMs, binaryMs, binaryMs > 0.0 ? jsonMs / binaryMs : 0.0));
+        }
+
+        scene->LoadFromJson(editingScene);
+    }
+
+    void EditorBenchmark::RunPlaySnapshot()
+    {
+        if (EditorManager::Get().GetEditorState() != EditorState::Edit)
+        {
+            AddResult("[Play Snapshot] Edit 모드에서만 실행");
+            return;
+        }
+
+        constexpr int iterationCount = 5;
+
+        Scene* scene = SceneManager::Get().GetScene();
+
+        json editingScene;
+        scene->SaveToJson(editingScene);
+
+        for (const int objectCount : { 1000, 5000 })
+        {
+            std::mt19937 rng(1234);
+            std::uniform_real_distribution<float> positionDist(-100.0f, 100.0f);
+
+            // 10개에 하나는 Light, 절반은 앞 객체의 자식
+            scene->Clear();
+
+            GameObject* parent = nullptr;
+            for (int i = 0; i < objectCount; ++i)
+            {
+                GameObject* go = scene->CreateGameObject(std::format("Object_{}", i));
+                go->GetTransform()->SetLocalPosition(Vector3{ positionDist(rng), positionDist(rng), positionDist(rng) });
+
+                if (i % 10 == 0)
+                {
+                    go->AddComponent<Light>();
+                }
+
+                if (i % 2 == 1 && parent != nullptr)
+                {
+                    go->GetTransform()->SetParent(parent->GetTransform());
+                }
+                else
+                {
+                    parent = go;
+                }
+            }
+            SceneManager::Get().ProcessPendingAdds(false);
+
+            // Play 중에 움직인 것처럼 Transform 1%를 바꿈 (시간에는 넣지 않음)
+            auto simulatePlay = [&]()
+                {
+                    const auto& gameObjects = scene->GetGameObjects();
+                    for (std::size_t i = 0; i < gameObjects.size(); i += 100)
+                    {
+                        gameObjects[i]->GetTransform()->Translate(Vector3{ 1.0f, 0.0f, 0.0f });
+                    }
+                };
+
+            // 이전 방식: Play에서 저장 + 다시 로드, Stop에서 다시 로드
+            json tempScene;
+            double jsonPlayUs = 0.0;
+            double jsonStopUs = 0.0;
+            for (int i = 0; i < iterationCount; ++i)
+            {
+                TimePoint start = Clock::now();
+                tempScene.clear();
+                scene->SaveToJson(tempScene);
+                scene->LoadFromJson(tempScene);
+                SceneManager::Get().ProcessPendingAdds(false);
+                jsonPlayUs += GetElapsedMicroseconds(start);
+
+                simulatePlay();
+
+                start = Clock::now();
+                scene->LoadFromJson(tempScene);
+                SceneManager::Get().ProcessPendingAdds(false);
+                jsonStopUs += GetElapsedMicroseconds(start);
+            }
+
+            SceneSnapshot snapshot;
+            SceneRestoreStats stats;
+            double snapshotPlayUs = 0.0;
+            double snapshotStopUs = 0.0;
+            for (int i = 0; i < iterationCount; ++i)
+            {
+                TimePoint start = Clock::now();
+                SceneManager::Get().ProcessPendingAdds(false);
+                snapshot.Capture(*scene);
+                snapshotPlayUs += GetElapsedMicroseconds(start);
+
+                simulatePlay();
+
+                start = Clock::now();
+                stats = snapshot.Restore(*scene);
+                SceneManager::Get().ProcessPendingAdds(false);
+                snapshotStopUs += GetElapsedMicroseconds(start);
+            }
+
+            AddResult(std::format("[Play Snapshot] {} objects, snapshot {}KB / JSON {}KB",
+                objectCount, snapshot.GetMemorySize() / 1024, tempScene.dump().size() / 1024));
+            AddResult(std::format("  Play  JSON {:.2f}ms / snapshot {:.2f}ms", jsonPlayUs / iterationCount / 1000.0, snapshotPlayUs / iterationCount / 1000.0));
+            AddResult(std::format("  Stop  JSON {:.2f}ms / snapshot {:.2f}ms", jsonStopUs / iterationCount / 1000.0, snapshotStopUs / iterationCount / 1000.0));
+            AddResult(std::format("  unchanged {}, restored {}, recreated {}, destroyed {}",
+                stats.unchangedCount, stats.restoredCount, stats.recreatedCount, stats.destroyedCount));
+        }
+
+        scene->LoadFromJson(editingScene);
+    }
+
+    void EditorBenchmark::RunMeshCook()
+    {
+        constexpr int iterationCount = 3;
+
+        // 개수가 같으면 같은 결과로 봄 (내용은 Cook / Create가 그대로 복사)
+        auto describe = [](FBXAssetKind kind, const FBXAssetData& data)
+            {
+                if (kind == FBXAssetKind::Static)
+                {
+                    const auto mesh = data.GetStaticMeshData();
+                    return std::format("{} vertices / {} indices / {} materials",
+                        mesh->GetVertices().size(), mesh->GetIndexCount(), data.GetMaterialData()->GetMaterials().size());
+                }
+
+                const auto mesh = data.GetSkeletalMeshData();
+                return std::format("{} vertices / {} indices / {} bones / {} clips",
+                    mesh->GetVertices().size(), mesh->GetIndexCount(),
+                    data.GetSkeletonData()->GetBones().size(), data.GetAnimationData()->GetAnimations().size());
+            };
+
+        for (const std::string path : { "Resource/Model/Girl.fbx", "Resource/Model/char.fbx" })
+        {
+            for (const FBXAssetKind kind : { FBXAssetKind::Static, FBXAssetKind::Skeletal })
+            {
+                const char* kindName = kind == FBXAssetKind::Static ? "Static" : "Skeletal";
+
+                double importUs = 0.0;
+                FBXAssetData imported;
+                for (int i = 0; i < iterationCount; ++i)
+                {
+                    imported = FBXAssetData{};
+
+                    const TimePoint start = Clock::now();
+                    imported.Import(kind, path);
+                    importUs += GetElapsedMicroseconds(start);
+                }
+
+                if (!imported.SaveCooked(path))
+                {
+                    AddResult(std::format("[Mesh Cook] {} ({}): 쿠킹 실패", path, kindName));
+                    continue;
+                }
+
+                double cookedUs = 0.0;
+                bool isLoaded = true;
+                FBXAssetData cooked;
+                for (int i = 0; i < iterationCount; ++i)
+                {
+                    cooked = FBXAssetData{};
+
+                    const TimePoint start = Clock::now();
+                    isLoaded = cooked.LoadCooked(kind, path) && isLoaded;
+                    cookedUs += GetElapsedMicroseconds(start);
+                }
+
+                if (!isLoaded)
+                {
+                    AddResult(std::format("[Mesh Cook] {} ({}): .cooked 로드 실패", path, kindName));
+                    continue;
+                }
+
+                const std::string importedDesc = describe(kind, imported);
+
+                AddResult(std::format("[Mesh Cook] {} ({}): {}KB -> {}KB, {}",
+                    path, kindName,
+                    std::filesystem::file_size(path) / 1024,
+                    std::filesystem::file_size(FBXAssetData::GetCookedPath(kind, path)) / 1024,
+                    importedDesc == describe(kind, cooked) ? "OK" : "MISMATCH"));
+                AddResult(std::format("  {}", importedDesc));
+                AddResult(std::format("  Assimp {:.2f}ms / cooked {:.2f}ms ({:.1f}x)",
+                    importUs / iterationCount / 1000.0,
+                    cookedUs / iterationCount / 1000.0,
+                    cookedUs > 0.0 ? importUs / cookedUs : 0.0));
+            }
+        }
+    }
+
+    void EditorBenchmark::RunAssetStreaming()
+    {
+        auto collect = [](const char* directory, std::initializer_list<std::string_view> extensions)
+            {
+                std::vector<std::string> paths;
+                for (const auto& entry : std::filesystem::directory_iterator(directory))
+                {
+                    const std::string extension = entry.path().extension().string();
+                    if (std::ranges::find(extensions, extension) != extensions.end())
+                    {
+                        paths.push_back(entry.path().generic_string());
+                    }
+                }
+
+                return paths;
+            };
+
+        const std::vector<std::string> modelPaths = collect("Resource/Model", { ".fbx" });
+        const std::vector<std::string> texturePaths = collect("Resource/Texture", { ".png", ".jpg", ".tga", ".dds" });
+
+        // AssetManager / ResourceManager의 워커 잡과 같은 작업 (캐시를 거치지 않음)
+        auto load = [&](std::size_t index)
+            {
+                if (index < modelPaths.size())
+                {
+                    FBXAssetData fbx;
+                    fbx.Create(FBXAssetKind::Static, modelPaths[index]);
+                    g_sink = g_sink + fbx.GetStaticMeshData()->GetVertices().size();
+                }
+                else
+                {
+                    DirectX::ScratchImage image;
+                    if (Texture::Decode(texturePaths[index - modelPaths.size()], image))
+                    {
+                        g_sink = g_sink + image.GetPixelsSize();
+                    }
+                }
+            };
+
+        const std::size_t itemCount = modelPaths.size() + texturePaths.size();
+
+        // .cooked가 없으면 첫 로드에서 쓰므로 한 번씩 미리 로드
+        for (const auto& path : modelPaths)
+        {
+            FBXAssetData fbx;
+            fbx.Create(FBXAssetKind::Static, path);
+        }
+
+        TimePoint start = Clock::now();
+        for (std::size_t i = 0; i < itemCount; ++i)
+        {
+            load(i);
+        }
+        const double serialUs = GetElapsedMicroseconds(start);
+
+        start = Clock::now();
+        {
+            JobCounter counter;
+            for (std::size_t i = 0; i < itemCount; ++i)
+            {
+                JobSystem::Get().Run([&load, i]() { load(i); }, &counter);
+            }
+            JobSystem::Get().Wait(counter);
+        }
+        const double parallelUs = GetElapsedMicroseconds(start);
+
+        AddResult(std::format("[Asset Streaming] {} FBX + {} textures, {} workers",
+            modelPaths.size(), texturePaths.size(), JobSystem::Get().GetWorkerCount()));
+        AddResult(std::format("  main thread serial {:.2f}ms / workers {:.2f}ms ({:.1f}x)",
+            serialUs / 1000.0, parallelUs / 1000.0, parallelUs > 0.0 ? serialUs / parallelUs : 0.0));
+
+        // 같은 파일을 4번 요청하고 GetOrCreate로 기다림 (이미 캐시에 있으면 바로 끝남)
+        constexpr int duplicateCount = 4;
+
+        std::size_t sharedCount = 0;
+        start = Clock::now();
+        for (const auto& path : modelPaths)
+        {
+            std::vector<AssetRequest<StaticMeshData>> requests;
+            for (int i = 0; i < duplicateCount; ++i)
+            {
+                requests.push_back(AssetManager::Get().RequestStaticMeshData(path));
+            }
+
+            const auto data = AssetManager::Get().GetOrCreateStaticMeshData(path);
+
+            const bool isShared = std::ranges::all_of(requests, [&data](const AssetRequest<StaticMeshData>& request)
+                {
+                    return request.IsReady() && request.Get() == data;
+                });
+            sharedCount += isShared ? 1 : 0;
+        }
+        const double requestUs = GetElapsedMicroseconds(start);
+
+        AddResult(std::format("  {} requests x {} files: {}/{} shared one load, {:.2f}ms",
+            duplicateCount, modelPaths.size(), sharedCount, modelPaths.size(), requestUs / 1000.0));
+    }
+
+    void EditorBenchmark::RunVertexCompression()
+    {
+        struct ErrorStats
+        {
+            float normalDegree = 0.0f;
+            float tangentDegree = 0.0f;
+            float texCoord = 0.0f;
+            float weight = 0.0f;
+            std::size_t signMismatchCount = 0; // 복원한 binormal이 원본과 반대 방향
+            std::size_t weightSumMismatchCount = 0; // 양자화한 가중치 합이 255가 아님
+        };
+
+        auto getAngleDegree = [](Vector3 original, const Vector3& decoded)
+            {
+                if (original.LengthSquared() <= 0.0f)
+                {
+                    return 0.0f;
+                }
+
+                original.Normalize();
+                return ToDegree(std::acos(std::clamp(original.Dot(decoded), -1.0f, 1.0f)));
+            };
+
+        auto accumulate = [&getAngleDegree](ErrorStats& stats, const auto& original, const auto& decoded)
+            {
+                stats.normalDegree = std::max(stats.normalDegree, getAngleDegree(original.normal, decoded.normal));
+                stats.tangentDegree = std::max(stats.tangentDegree, getAngleDegree(original.tangent, decoded.tangent));
+                stats.texCoord = std::max({ stats.texCoord,
+                    std::abs(original.texCoord.x - decoded.texCoord.x),
+                    std::abs(original.texCoord.y - decoded.texCoord.y) });
+
+                if (original.binormal.Dot(decoded.binormal) < 0.0f)
+                {
+                    ++stats.signMismatchCount;
+                }
+            };
+
+        // 16비트에 들어가는 인덱스는 import 시 이미 옮겨져 있음
+        auto reportIndices = [](const auto& mesh)
+            {
+                if (const auto& shortIndices = mesh.GetShortIndices(); !shortIndices.empty())
+                {
+                    AddResult(std::format("  indices {}: {:.1f}KB -> {:.1f}KB (16bit)",
+                        shortIndices.size(), shortIndices.size() * sizeof(DWORD) / 1024.0, shortIndices.size() * sizeof(WORD) / 1024.0));
+                    return;
+                }
+
+                const auto& indices = mesh.GetIndices();
+                if (!indices.empty())
+                {
+                    AddResult(std::format("  indices {}: 32bit 유지 (최대 {})", indices.size(), *std::ranges::max_element(indices)));
+                }
+            };
+
+        for (const std::string path : { "Resource/Model/Girl.fbx", "Resource/Model/char.fbx" })
+        {
+            FBXAssetData staticFbx;
+            staticFbx.Create(FBXAssetKind::Static, path);
+
+            if (const auto mesh = staticFbx.GetStaticMeshData(); mesh != nullptr && !mesh->GetVertices().empty())
+            {
+                const auto& vertices = mesh->GetVertices();
+
+                const TimePoint start = Clock::now();
+                const std::vector<CompactVertex> compactVertices = EncodeCompactVertices(vertices);
+                const double encodeUs = GetElapsedMicroseconds(start);
+
+                ErrorStats stats;
+                for (std::size_t i = 0; i < vertices.size(); ++i)
+                {
+                    accumulate(stats, vertices[i], DecodeCompactVertex(compactVertices[i]));
+                }
+
+                AddResult(std::format("[Vertex Compression] {} (Static): {} vertices {:.1f}KB -> {:.1f}KB, encode {:.0f}us",
+                    path, vertices.size(),
+                    vertices.size() * sizeof(CommonVertex) / 1024.0, compactVertices.size() * sizeof(CompactVertex) / 1024.0, encodeUs));
+                AddResult(std::format("  max error  normal {:.3f}deg / tangent {:.3f}deg / uv {:.5f}, binormal sign mismatches {}",
+                    stats.normalDegree, stats.tangentDegree, stats.texCoord, stats.signMismatchCount));
+                reportIndices(*mesh);
+            }
+
+            FBXAssetData skeletalFbx;
+            skeletalFbx.Create(FBXAssetKind::Skeletal, path);
+
+            const auto mesh = skeletalFbx.GetSkeletalMeshData();
+            if (mesh == nullptr || mesh->GetBoneWeightVertices().empty())
+            {
+                continue;
+            }
+
+            const auto& vertices = mesh->GetBoneWeightVertices();
+
+            const TimePoint start = Clock::now();
+            const std::vector<CompactBoneWeightVertex> compactVertices = EncodeCompactVertices(vertices);
+            const double encodeUs = GetElapsedMicroseconds(start);
+
+            ErrorStats stats;
+            for (std::size_t i = 0; i < vertices.size(); ++i)
+            {
+                const BoneWeightVertex decoded = DecodeCompactVertex(compactVertices[i]);
+                accumulate(stats, vertices[i], decoded);
+
+                int weightSum = 0;
+                for (int j = 0; j < 4; ++j)
+                {
+                    stats.weight = std::max(stats.weight, std::abs(vertices[i].blendWeights[j] - decoded.blendWeights[j]));
+                    weightSum += static_cast<int>(std::lround(decoded.blendWeights[j] * 255.0f));
+                }
+
+                if (weightSum != 255)
+                {
+                    ++stats.weightSumMismatchCount;
+                }
+            }
+
+            AddResult(std::format("[Vertex Compression] {} (Skeletal): {} vertices {:.1f}KB -> {:.1f}KB, encode {:.0f}us",
+                path, vertices.size(),
+                vertices.size() * sizeof(BoneWeightVertex) / 1024.0, compactVertices.size() * sizeof(CompactBoneWeightVertex) / 1024.0, encodeUs));
+            AddResult(std::format("  max error  normal {:.3f}deg / tangent {:.3f}deg / uv {:.5f} / weight {:.4f}",
+                stats.normalDegree, stats.tangentDegree, stats.texCoord, stats.weight));
+            AddResult(std::format("  binormal sign mismatches {}, weight sum != 1 {}", stats.signMismatchCount, stats.weightSumMismatchCount));
+            reportIndices(*mesh);
+        }
+    }
+
+    void EditorBenchmark::RunRenderQueue()
+    {
+        constexpr std::size_t packetCount = 20000;
+        constexpr std::size_t objectCount = 8000;
+        constexpr std::size_t meshCount = 64;
+        constexpr std::size_t vertexShaderCount = 3;
+        constexpr std::size_t pixelShaderCount = 4;
+        constexpr std::size_t materialCount = 128;
+        constexpr int iterationCount = 5;
+
+        // 헤드리스라 D3D 객체 대신 겹치지 않는 가짜 주소를 씀 (context 없이 Submit하므로 역참조하지 않음)
+        std::vector<std::byte> addressSpace(objectCount + meshCount * 2 + vertexShaderCount + pixelShaderCount + materialCount * 2 + 4);
+        std::size_t nextAddress = 0;
+        auto makeAddress = [&addressSpace, &nextAddress]()
+            {
+                return static_cast<void*>(addressSpace.data() + nextAddress++);
+            };
+
+        std::vector<const Renderer*> renderers;
+        for (std::size_t i = 0; i < objectCount; ++i)
+        {
+            renderers.push_back(static_cast<const Renderer*>(makeAddress()));
+        }
+
+        std::vector<std::pair<BufferHandle, BufferHandle>> meshes;
+        for (std::size_t i = 0; i < meshCount; ++i)
+        {
+            meshes.emplace_back(BufferHandle{ makeAddress() }, BufferHandle{ makeAddress() });
+        }
+
+        std::vector<VertexShaderHandle> vertexShaders;
+        for (std::size_t i = 0; i < vertexShaderCount; ++i)
+        {
+            vertexShaders.push_back(VertexShaderHandle{ makeAddress() });
+        }
+
+        std::vector<PixelShaderHandle> pixelShaders;
+        for (std::size_t i = 0; i < pixelShaderCount; ++i)
+        {
+            pixelShaders.push_back(PixelShaderHandle{ makeAddress() });
+        }
+
+        const InputLayoutHandle inputLayout{ makeAddress() };
+        const SamplerHandle samplerState{ makeAddress() };
+
+        // 머티리얼은 텍스처 SRV로 구분 (나머지 슬롯은 비워 둠)
+        std::vector<std::array<ShaderResourceHandle, Textures::Count>> materials(materialCount);
+        for (auto& material : materials)
+        {
+            material[0] = ShaderResourceHandle{ makeAddress() }; // BaseColor
+            material[1] = ShaderResourceHandle{ makeAddress() }; // Normal
+        }
+
+        // 렌더러 하나가 섹션 2~3개를 연달아 추가 (실제 CollectDrawPackets처럼 같은 메시 / 셰이더)
+        std::mt19937 random{ 21 };
+        std::uniform_int_distribution<std::size_t> objectDist(0, objectCount - 1);
+        std::uniform_int_distribution<std::size_t> meshDist(0, meshCount - 1);
+        std::uniform_int_distribution<std::size_t> vertexShaderDist(0, vertexShaderCount - 1);
+        std::uniform_int_distribution<std::size_t> pixelShaderDist(0, pixelShaderCount - 1);
+        std::uniform_int_distribution<std::size_t> materialDist(0, materialCount - 1);
+        std::uniform_real_distribution<float> positionDist(-500.0f, 500.0f);
+
+        std::vector<std::pair<DrawPacket, Vector3>> packets;
+        packets.reserve(packetCount);
+        while (packets.size() < packetCount)
+        {
+            DrawPacket packet;
+            packet.renderer = renderers[objectDist(random)];
+            packet.type = random() % 4 == 0 ? RenderType::Cutout : RenderType::Opaque;
+            packet.vertexShader = vertexShaders[vertexShaderDist(random)];
+            packet.pixelShader = pixelShaders[pixelShaderDist(random)];
+            packet.inputLayout = inputLayout;
+            std::tie(packet.vertexBuffer, packet.indexBuffer) = meshes[meshDist(random)];
+            packet.vertexStride = sizeof(CommonVertex);
+            packet.indexFormat = IndexFormat::UInt16;
+            packet.samplerState = samplerState;
+            packet.textureCount = Textures::Count;
+
+            const Vector3 position{ positionDist(random), positionDist(random), positionDist(random) };
+            const std::size_t sectionCount = 2 + random() % 2;
+            for (std::size_t i = 0; i < sectionCount && packets.size() < packetCount; ++i)
+            {
+                packet.textures = materials[materialDist(random)];
+                packet.baseVertex = static_cast<INT>(packets.size()); // 검증용 추가 순서 (startIndex는 메시 키에 섞이므로 안 씀)
+                packets.emplace_back(packet, position);
+            }
+        }
+
+        auto build = [&packets]()
+            {
+                RenderQueue queue{ Vector3::Zero };
+                queue.Reserve(packets.size());
+                for (const auto& [packet, position] : packets)
+                {
+                    queue.Add(packet, position);
+                }
+                return queue;
+            };
+
+        double buildUs = 0.0;
+        double sortUs = 0.0;
+        double stableSortUs = 0.0;
+        bool isSameOrder = true;
+        RenderQueueStats unsortedStats;
+        RenderQueueStats sortedStats;
+
+        for (int iteration = 0; iteration < iterationCount; ++iteration)
+        {
+            TimePoint start = Clock::now();
+            RenderQueue queue = build();
+            buildUs += GetElapsedMicroseconds(start);
+
+            unsortedStats = queue.Submit(nullptr);
+
+            // 기준: 같은 키를 std::stable_sort (키가 같으면 추가한 순서)
+            std::vector<std::pair<std::uint64_t, UINT>> expected;
+            expected.reserve(queue.GetPacketCount());
+            for (std::size_t i = 0; i < queue.GetPacketCount(); ++i)
+            {
+                expected.emplace_back(queue.GetSortKey(i), static_cast<UINT>(queue.GetPacket(i).baseVertex));
+            }
+
+            start = Clock::now();
+            std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+            stableSortUs += GetElapsedMicroseconds(start);
+
+            start = Clock::now();
+            queue.Sort();
+            sortUs += GetElapsedMicroseconds(start);
+
+            for (std::size_t i = 0; i < queue.GetPacketCount(); ++i)
+            {
+                if (queue.GetSortKey(i) != expected[i].first || static_cast<UINT>(queue.GetPacket(i).baseVertex) != expected[i].second)
+                {
+                    isSameOrder = false;
+                    break;
+                }
+            }
+
+            sortedStats = queue.Submit(nullptr);
+        }
+
+        const std::uint32_t totalBinds = sortedStats.bindCount + sortedStats.skippedBindCount; // 매번 전부 바인드할 때
+
+        AddResult(std::format("[Render Queue] {} packets ({} objects, {} meshes, {} shaders, {} materials)",
+            packetCount, objectCount, meshCount, vertexShaderCount * pixelShaderCount, materialCount));
+        AddResult(std::format("  build {:.0f}us / radix sort {:.0f}us / std::stable_sort {:.0f}us, order {}",
+            buildUs / iterationCount, sortUs / iterationCount, stableSortUs / iterationCount, isSameOrder ? "OK" : "다름"));
+        AddResult(std::format("  binds  always {} / insertion order {} / sorted {} (avoided {}, x{:.1f} fewer than insertion order)",
+            totalBinds, unsortedStats.bindCount, sortedStats.bindCount,
+            totalBinds - sortedStats.bindCount,
+            static_cast<double>(unsortedStats.bindCount) / std::max<std::uint32_t>(sortedStats.bindCount, 1)));
+        AddResult(std::format("  draws {} / {}", unsortedStats.drawCount, sortedStats.drawCount));
+    }
+
+    void EditorBenchmark::RunStaticInstancing()
+    {
+        constexpr std::size_t objectCount = 4000;
+        constexpr std::size_t meshCount = 16;
+        constexpr std::size_t sectionCount = 2;
+        constexpr std::size_t materialCount = 8;
+        constexpr std::size_t customShaderPercent = 10; // 사용자 VS라 인스턴싱하지 않는 렌더러
+        constexpr int iterationCount = 5;
+
+        // 헤드리스라 D3D 객체 대신 겹치지 않는 가짜 주소를 씀 (context 없이 Submit하므로 역참조하지 않음)
+        std::vector<std::byte> addressSpace(objectCount + meshCount * 2 + meshCount * sectionCount * 2 + 16);
+        std::size_t nextAddress = 0;
+        auto makeAddress = [&addressSpace, &nextAddress]()
+            {
+                return static_cast<void*>(addressSpace.data() + nextAddress++);
+            };
+
+        std::vector<const Renderer*> renderers;
+        for (std::size_t i = 0; i < objectCount; ++i)
+        {
+            renderers.push_back(static_cast<const Renderer*>(makeAddress()));
+        }
+
+        std::vector<std::pair<BufferHandle, BufferHandle>> meshes;
+        for (std::size_t i = 0; i < meshCount; ++i)
+        {
+            meshes.emplace_back(BufferHandle{ makeAddress() }, BufferHandle{ makeAddress() });
+        }
+
+        const VertexShaderHandle vertexShader{ makeAddress() };
+        const VertexShaderHandle shadowVertexShader{ makeAddress() };
+        const VertexShaderHandle customVertexShader{ makeAddress() };
+        const VertexShaderHandle instancedVertexShader{ makeAddress() };
+        const VertexShaderHandle shadowInstancedVertexShader{ makeAddress() };
+        const PixelShaderHandle pixelShader{ makeAddress() };
+        const InputLayoutHandle inputLayout{ makeAddress() };
+        const InputLayoutHandle instancedInputLayout{ makeAddress() };
+        const SamplerHandle samplerState{ makeAddress() };
+
+        // 같은 FBX의 섹션은 렌더러가 달라도 같은 텍스처 SRV를 씀 (ResourceManager 캐시)
+        std::vector<std::array<ShaderResourceHandle, Textures::Count>> sectionTextures(meshCount * sectionCount);
+        for (auto& textures : sectionTextures)
+        {
+            textures[0] = ShaderResourceHandle{ makeAddress() }; // BaseColor
+            textures[1] = ShaderResourceHandle{ makeAddress() }; // Normal
+        }
+
+        std::mt19937 random{ 22 };
+        std::uniform_int_distribution<std::size_t> meshDist(0, meshCount - 1);
+        std::uniform_int_distribution<std::size_t> materialDist(0, materialCount - 1);
+        std::uniform_real_distribution<float> positionDist(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> angleDist(0.0f, DirectX::XM_2PI);
+        std::uniform_real_distribution<float> scaleDist(0.5f, 2.0f);
+
+        struct Instance
+        {
+            std::size_t mesh;
+            std::uint64_t instanceKey; // 머티리얼 상수 버퍼 해시 대신 번호 + 1
+            bool isCustomShader;
+            Matrix world;
+        };
+
+        std::vector<Instance> instances(objectCount);
+        for (auto& instance : instances)
+        {
+            instance.mesh = meshDist(random);
+            instance.instanceKey = materialDist(random) + 1;
+            instance.isCustomShader = random() % 100 < customShaderPercent;
+            instance.world = Matrix::CreateScale(scaleDist(random)) *
+                Matrix::CreateFromYawPitchRoll(angleDist(random), angleDist(random), angleDist(random)) *
+                Matrix::CreateTranslation(positionDist(random), positionDist(random), positionDist(random));
+        }
+
+        // StaticMeshRenderer::CollectDrawPackets와 같은 모양 (그림자 / 지오메트리 패스)
+        auto build = [&](RenderType type)
+            {
+                RenderQueue queue{ Vector3::Zero };
+                queue.Reserve(objectCount * sectionCount);
+
+                for (std::size_t i = 0; i < objectCount; ++i)
+                {
+                    const Instance& instance = instances[i];
+
+                    DrawPacket packet;
+                    packet.renderer = renderers[i];
+                    packet.type = type;
+                    packet.pixelShader = type == RenderType::Shadow ? PixelShaderHandle{} : pixelShader;
+                    packet.inputLayout = inputLayout;
+                    std::tie(packet.vertexBuffer, packet.indexBuffer) = meshes[instance.mesh];
+                    packet.vertexStride = sizeof(CommonVertex);
+                    packet.indexFormat = IndexFormat::UInt16;
+                    packet.samplerState = samplerState;
+                    packet.textureCount = type == RenderType::Shadow ? 0 : Textures::Count;
+
+                    if (instance.isCustomShader)
+                    {
+                        packet.vertexShader = type == RenderType::Shadow ? shadowVertexShader : customVertexShader;
+                    }
+                    else
+                    {
+                        packet.vertexShader = type == RenderType::Shadow ? shadowVertexShader : vertexShader;
+                        packet.world = instance.world;
+                        packet.instancedVertexShader = type == RenderType::Shadow ? shadowInstancedVertexShader : instancedVertexShader;
+                        packet.instancedInputLayout = instancedInputLayout;
+                        packet.instanceKey = type == RenderType::Shadow ? 1 : instance.instanceKey;
+                    }
+
+                    for (std::size_t section = 0; section < sectionCount; ++section)
+                    {
+                        packet.textures = sectionTextures[instance.mesh * sectionCount + section];
+                        packet.indexCount = 300;
+                        packet.startIndex = static_cast<UINT>(section * 300);
+
+                        queue.Add(packet, instance.world.Translation());
+                    }
+                }
+
+                return queue;
+            };
+
+        // world * (world^-1^T)^T = I
+        auto isInverseTranspose = [](const InstanceData& data)
+            {
+                const Matrix product = data.world * data.worldInverseTranspose.Transpose();
+                for (int row = 0; row < 4; ++row)
+                {
+                    for (int column = 0; column < 4; ++column)
+                    {
+                        if (std::abs(product.m[row][column] - (row == column ? 1.0f : 0.0f)) > 1e-3f)
+                        {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            };
+
+        for (const RenderType type : { RenderType::Shadow, RenderType::Opaque })
+        {
+            double batchUs = 0.0;
+            bool isValid = true;
+            RenderQueueStats sortedStats;
+            RenderQueueStats instancedStats;
+
+            for (int iteration = 0; iteration < iterationCount; ++iteration)
+            {
+                RenderQueue queue = build(type);
+                queue.Sort();
+
+                sortedStats = queue.Submit(nullptr);
+
+                const TimePoint start = Clock::now();
+                queue.BuildInstanceBatches();
+                batchUs += GetElapsedMicroseconds(start);
+
+                instancedStats = queue.Submit(nullptr);
+
+                // 모든 packet을 한 번씩 그리고, 모은 행렬 수가 instanced 드로우로 그린 packet 수와 같아야 함
+                const auto packed = queue.GetInstances();
+                if (instancedStats.drawCount - instancedStats.instancedDrawCount + instancedStats.instanceCount != instancedStats.packetCount ||
+                    packed.size() != instancedStats.instanceCount)
+                {
+                    isValid = false;
+                }
+
+                // 모은 행렬은 정렬 순서대로 인스턴싱할 수 있는 packet의 world를 건너뛰며 따라가야 함
+                std::size_t order = 0;
+                for (const InstanceData& data : packed)
+                {
+                    while (order < queue.GetPacketCount() &&
+                        (queue.GetPacket(order).instanceKey == 0 || queue.GetPacket(order).world != data.world))
+                    {
+                        ++order;
+                    }
+
+                    if (order == queue.GetPacketCount() || !isInverseTranspose(data))
+                    {
+                        isValid = false;
+                        break;
+                    }
+
+                    ++order;
+                }
+            }
+
+            AddResult(std::format("[Static Instancing] {} pass: {} packets ({} objects, {} meshes x {} sections, {} materials, {}% custom VS)",
+                type == RenderType::Shadow ? "Shadow" : "Geometry",
+                sortedStats.packetCount, objectCount, meshCount, sectionCount, materialCount, customShaderPercent));
+            AddResult(std::format("  draws {} -> {} ({} instanced draws, {} instances, x{:.1f} fewer), batch {:.0f}us, {}",
+                sortedStats.drawCount, instancedStats.drawCount,
+                instancedStats.instancedDrawCount, instancedStats.instanceCount,
+                static_cast<double>(sortedStats.drawCount) / std::max<std::uint32_t>(instancedStats.drawCount, 1),
+                batchUs / iterationCount, isValid ? "OK" : "다름"));
+        }
+    }
+
+    void EditorBenchmark::RunSpriteBatch()
+    {
+        constexpr std::size_t spriteCount = 5000;
+        constexpr std::size_t textureCount = 24;
+        constexpr std::size_t shaderCount = 3;
+        constexpr std::size_t rasterizerCount = 2;
+        constexpr int iterationCount = 10;
+
+        // 헤드리스라 D3D 객체 대신 겹치지 않는 가짜 주소를 씀 (SpriteBatch는 역참조하지 않음)
+        std::vector<std::byte> addressSpace(textureCount + shaderCount + rasterizerCount);
+        std::size_t nextAddress = 0;
+        auto makeAddress = [&addressSpace, &nextAddress]()
+            {
+                return static_cast<void*>(addressSpace.data() + nextAddress++);
+            };
+
+        std::vector<ShaderResourceHandle> textures;
+        for (std::size_t i = 0; i < textureCount; ++i)
+        {
+            textures.push_back(ShaderResourceHandle{ makeAddress() });
+        }
+
+        std::vector<PixelShaderHandle> pixelShaders;
+        for (std::size_t i = 0; i < shaderCount; ++i)
+        {
+            pixelShaders.push_back(PixelShaderHandle{ makeAddress() });
+        }
+
+        std::vector<RasterizerStateHandle> rasterizerStates;
+        for (std::size_t i = 0; i < rasterizerCount; ++i)
+        {
+            rasterizerStates.push_back(RasterizerStateHandle{ makeAddress() });
+        }
+
+        std::mt19937 random{ 23 };
+        std::uniform_int_distribution<std::size_t> textureDist(0, textureCount - 1);
+        std::uniform_int_distribution<std::size_t> shaderDist(0, shaderCount - 1);
+        std::uniform_int_distribution<std::size_t> rasterizerDist(0, rasterizerCount - 1);
+        std::uniform_real_distribution<float> positionDist(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> angleDist(0.0f, DirectX::XM_2PI);
+        std::uniform_real_distribution<float> sizeDist(0.5f, 4.0f);
+        std::uniform_real_distribution<float> uvDist(0.0f, 0.5f);
+
+        // color.x에 번호를 넣어서 펼친 정점에서 원래 스프라이트를 찾음
+        std::vector<SpriteDrawItem> items(spriteCount);
+        for (std::size_t i = 0; i < spriteCount; ++i)
+        {
+            SpriteDrawItem& item = items[i];
+            item.pixelShader = pixelShaders[shaderDist(random)];
+            item.texture = textures[textureDist(random)];
+            item.rasterizerState = rasterizerStates[rasterizerDist(random)];
+            item.world = Matrix::CreateScale(sizeDist(random), sizeDist(random), 1.0f) *
+                Matrix::CreateRotationY(angleDist(random)) *
+                Matrix::CreateTranslation(positionDist(random), positionDist(random), positionDist(random));
+            item.uvOffset = Vector2{ uvDist(random), uvDist(random) };
+            item.uvScale = Vector2{ 0.5f, 0.5f };
+            item.color = Vector4{ static_cast<float>(i), 1.0f, 1.0f, 1.0f };
+        }
+
+        auto getItemIndex = [](const SpriteVertex* quad)
+            {
+                return static_cast<std::size_t>(quad[0].color.x);
+            };
+
+        for (const bool sortByState : { true, false })
+        {
+            SpriteBatch batch;
+            double buildUs = 0.0;
+            bool isValid = true;
+
+            for (int iteration = 0; iteration < iterationCount; ++iteration)
+            {
+                batch.Clear();
+                batch.Reserve(spriteCount);
+
+                for (const SpriteDrawItem& item : items)
+                {
+                    batch.Add(item);
+                }
+
+                const TimePoint start = Clock::now();
+                batch.Build(sortByState);
+                buildUs += GetElapsedMicroseconds(start);
+            }
+
+            const auto vertices = batch.GetVertices();
+            const auto batches = batch.GetBatches();
+
+            if (vertices.size() != spriteCount * SpriteBatch::VerticesPerSprite)
+            {
+                isValid = false;
+            }
+
+            std::size_t coveredCount = 0;
+            for (const SpriteBatch::Batch& range : batches)
+            {
+                if (range.firstSprite != coveredCount || range.spriteCount > SpriteBatch::MaxBatchSpriteCount)
+                {
+                    isValid = false;
+                    break;
+                }
+
+                std::size_t previousIndex = 0;
+                for (std::uint32_t i = 0; i < range.spriteCount && isValid; ++i)
+                {
+                    const SpriteVertex* quad = vertices.data() + (range.firstSprite + i) * SpriteBatch::VerticesPerSprite;
+                    const std::size_t index = getItemIndex(quad);
+                    const SpriteDrawItem& item = items[index];
+
+                    // 묶음 안의 스프라이트는 상태가 같고, 추가한 순서를 지켜야 함 (정렬해도 stable)
+                    if (item.pixelShader != range.pixelShader ||
+                        item.texture != range.texture ||
+                        item.rasterizerState != range.rasterizerState ||
+                        (i > 0 && index <= previousIndex))
+                    {
+                        isValid = false;
+                    }
+
+                    // 추가 순서를 유지하면 정점도 번호 순서 그대로
+                    if (!sortByState && index != range.firstSprite + i)
+                    {
+                        isValid = false;
+                    }
+
+                    // pivot이 가운데라 쿼드 중심은 world의 위치, TL의 uv는 uvOffset
+                    const Vector3 center = (quad[0].position + quad[2].position) * 0.5f;
+                    if (Vector3::DistanceSquared(center, item.world.Translation()) > 1e-4f ||
+                        Vector2::DistanceSquared(quad[1].texCoord, item.uvOffset) > 1e-8f)
+                    {
+                        isValid = false;
+                    }
+
+                    previousIndex = index;
+                }
+
+                coveredCount += range.spriteCount;
+            }
+
+            if (coveredCount != spriteCount)
+            {
+                isValid = false;
+            }
+
+            AddResult(std::format("[Sprite Batch] {}: {} sprites ({} textures, {} shaders, {} cull modes) -> {} draws, build {:.0f}us, {}",
+                sortByState ? "sorted" : "in order",
+                spriteCount, textureCount, shaderCount, rasterizerCount,
+                batches.size(), buildUs / iterationCount, isValid ? "OK" : "다름"));
+        }
+    }
+
+    void EditorBenchmark::RunParallelSubmit()
+    {
+        constexpr std::size_t packetCount = 20000;
+        constexpr std::size_t objectCount = 8000;
+        constexpr std::size_t meshCount = 64;
+        constexpr std::size_t shaderCount = 4;
+        constexpr std::size_t materialCount = 64;
+        constexpr std::size_t rendererDrawPercent = 2; // 아직 packet을 만들지 않는 렌더러
+        constexpr std::size_t minBatchCount = 64;
+        constexpr int iterationCount = 10;
+
+        // 헤드리스라 D3D 객체 대신 겹치지 않는 가짜 주소를 씀 (context 없이 Submit하므로 역참조하지 않음)
+        std::vector<std::byte> addressSpace(objectCount + meshCount * 2 + shaderCount * 2 + materialCount * 2 + 4);
+        std::size_t nextAddress = 0;
+        auto makeAddress = [&addressSpace, &nextAddress]()
+            {
+                return static_cast<void*>(addressSpace.data() + nextAddress++);
+            };
+
+        std::vector<const Renderer*> renderers;
+        for (std::size_t i = 0; i < objectCount; ++i)
+        {
+            renderers.push_back(static_cast<const Renderer*>(makeAddress()));
+        }
+
+        std::vector<std::pair<BufferHandle, BufferHandle>> meshes;
+        for (std::size_t i = 0; i < meshCount; ++i)
+        {
+            meshes.emplace_back(BufferHandle{ makeAddress() }, BufferHandle{ makeAddress() });
+        }
+
+        std::vector<std::pair<VertexShaderHandle, PixelShaderHandle>> shaders;
+        for (std::size_t i = 0; i < shaderCount; ++i)
+        {
+            shaders.emplace_back(VertexShaderHandle{ makeAddress() }, PixelShaderHandle{ makeAddress() });
+        }
+
+        const InputLayoutHandle inputLayout{ makeAddress() };
+        const SamplerHandle samplerState{ makeAddress() };
+
+        std::vector<std::array<ShaderResourceHandle, Textures::Count>> materials(materialCount);
+        for (auto& material : materials)
+        {
+            material[0] = ShaderResourceHandle{ makeAddress() }; // BaseColor
+            material[1] = ShaderResourceHandle{ makeAddress() }; // Normal
+        }
+
+        std::mt19937 random{ 24 };
+        std::uniform_int_distribution<std::size_t> objectDist(0, objectCount - 1);
+        std::uniform_int_distribution<std::size_t> meshDist(0, meshCount - 1);
+        std::uniform_int_distribution<std::size_t> shaderDist(0, shaderCount - 1);
+        std::uniform_int_distribution<std::size_t> materialDist(0, materialCount - 1);
+        std::uniform_int_distribution<std::size_t> percentDist(0, 99);
+        std::uniform_real_distribution<float> positionDist(-500.0f, 500.0f);
+
+        RenderQueue queue{ Vector3::Zero };
+        queue.Reserve(packetCount);
+
+        for (std::size_t i = 0; i < packetCount; ++i)
+        {
+            DrawPacket packet;
+            packet.renderer = renderers[objectDist(random)];
+            packet.type = random() % 4 == 0 ? RenderType::Cutout : RenderType::Opaque;
+            packet.usesRendererDraw = percentDist(random) < rendererDrawPercent;
+
+            if (!packet.usesRendererDraw)
+            {
+                std::tie(packet.vertexShader, packet.pixelShader) = shaders[shaderDist(random)];
+                packet.inputLayout = inputLayout;
+                std::tie(packet.vertexBuffer, packet.indexBuffer) = meshes[meshDist(random)];
+                packet.vertexStride = sizeof(CommonVertex);
+                packet.indexFormat = IndexFormat::UInt16;
+                packet.samplerState = samplerState;
+                packet.textures = materials[materialDist(random)];
+                packet.textureCount = Textures::Count;
+            }
+
+            queue.Add(packet, Vector3{ positionDist(random), positionDist(random), positionDist(random) });
+        }
+
+        queue.Sort();
+
+        JobSystem& jobSystem = JobSystem::Get();
+        const std::size_t threadCount = jobSystem.GetWorkerCount() + 1;
+
+        const auto chunks = queue.MakeSubmitChunks(threadCount, minBatchCount);
+
+        // 구간은 빈틈없이 이어지고, 기록 구간에는 usesRendererDraw가 없고, 즉시 구간에는 그것만 있어야 함
+        bool isValid = true;
+        std::size_t nextBatch = 0;
+        std::vector<std::uint32_t> recordedChunks;
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            const RenderQueue::SubmitChunk& chunk = chunks[i];
+            if (chunk.firstBatch != nextBatch || chunk.batchCount == 0)
+            {
+                isValid = false;
+            }
+
+            // BuildInstanceBatches를 하지 않았으므로 드로우 묶음 번호 == packet 순서
+            for (std::size_t order = chunk.firstBatch; order < chunk.firstBatch + chunk.batchCount; ++order)
+            {
+                if (queue.GetPacket(order).usesRendererDraw == chunk.isRecordable)
+                {
+                    isValid = false;
+                }
+            }
+
+            if (chunk.isRecordable)
+            {
+                recordedChunks.push_back(static_cast<std::uint32_t>(i));
+            }
+
+            nextBatch += chunk.batchCount;
+        }
+
+        if (nextBatch != queue.GetBatchCount())
+        {
+            isValid = false;
+        }
+
+        double serialUs = 0.0;
+        double parallelUs = 0.0;
+        RenderQueueStats serialStats;
+        RenderQueueStats chunkedStats;
+
+        for (int iteration = 0; iteration < iterationCount; ++iteration)
+        {
+            TimePoint start = Clock::now();
+            serialStats = queue.Submit(nullptr);
+            serialUs += GetElapsedMicroseconds(start);
+
+            std::vector<RenderQueueStats> chunkStats(chunks.size());
+
+            start = Clock::now();
+            jobSystem.ParallelFor(static_cast<std::uint32_t>(recordedChunks.size()), 1,
+                [&](std::uint32_t begin, std::uint32_t end)
+                {
+                    for (std::uint32_t i = begin; i < end; ++i)
+                    {
+                        const RenderQueue::SubmitChunk& chunk = chunks[recordedChunks[i]];
+                        chunkStats[recordedChunks[i]] = queue.Submit(nullptr, {}, chunk.firstBatch, chunk.batchCount);
+                    }
+                });
+
+            chunkedStats = RenderQueueStats{};
+            for (std::size_t i = 0; i < chunks.size(); ++i)
+            {
+                if (!chunks[i].isRecordable)
+                {
+                    chunkStats[i] = queue.Submit(nullptr, {}, chunks[i].firstBatch, chunks[i].batchCount);
+                }
+
+                chunkedStats += chunkStats[i];
+            }
+            parallelUs += GetElapsedMicroseconds(start);
+        }
+
+        // 구간마다 처음에 다시 바인드하므로 바인드만 늘어남
+        if (chunkedStats.packetCount != serialStats.packetCount ||
+            chunkedStats.drawCount != serialStats.drawCount ||
+            chunkedStats.bindCount < serialStats.bindCount)
+        {
+            isValid = false;
+        }
+
+        AddResult(std::format("[Parallel Submit] {} packets ({}% renderer draw), {} threads -> {} chunks ({} recorded)",
+            packetCount, rendererDrawPercent, threadCount, chunks.size(), recordedChunks.size()));
+        AddResult(std::format("  serial {:.0f}us vs chunked {:.0f}us, draws {} / {}, binds {} -> {} (+{}), {}",
+            serialUs / iterationCount, parallelUs / iterationCount,
+            serialStats.drawCount, chunkedStats.drawCount,
+            serialStats.bindCount, chunkedStats.bindCount, chunkedStats.bindCount - serialStats.bindCount,
+            isValid ? "OK" : "다름"));
+    }
+
+    void EditorBenchmark::RunCommandRecording()
+    {
+        constexpr std::size_t spriteCount = 5000;
+        constexpr std::size_t textureCount = 24;
+        constexpr std::size_t shaderCount = 3;
+        constexpr std::size_t rasterizerCount = 2;
+        constexpr int iterationCount = 10;
+
+        // 헤드리스라 D3D 객체 대신 겹치지 않는 가짜 주소를 씀 (null 백엔드는 역참조하지 않음)
+        std::vector<std::byte> addressSpace(textureCount + shaderCount + rasterizerCount + 2);
+        std::size_t nextAddress = 0;
+        auto makeAddress = [&addressSpace, &nextAddress]()
+            {
+                return static_cast<void*>(addressSpace.data() + nextAddress++);
+            };
+
+        std::vector<ShaderResourceHandle> textures;
+        for (std::size_t i = 0; i < textureCount; ++i)
+        {
+            textures.push_back(ShaderResourceHandle{ makeAddress() });
+        }
+
+        std::vector<PixelShaderHandle> pixelShaders;
+        for (std::size_t i = 0; i < shaderCount; ++i)
+        {
+            pixelShaders.push_back(PixelShaderHandle{ makeAddress() });
+        }
+
+        std::vector<RasterizerStateHandle> rasterizerStates;
+        for (std::size_t i = 0; i < rasterizerCount; ++i)
+        {
+            rasterizerStates.push_back(RasterizerStateHandle{ makeAddress() });
+        }
+
+        // 패스가 바인드해 둔 래스터라이저 상태 (Submit이 끝나면 이것으로 되돌려야 함)
+        const RasterizerStateHandle passRasterizerState{ makeAddress() };
+        const BufferHandle vertexBuffer{ makeAddress() };
+
+        std::mt19937 random{ 25 };
+        std::uniform_int_distribution<std::size_t> textureDist(0, textureCount - 1);
+        std::uniform_int_distribution<std::size_t> shaderDist(0, shaderCount - 1);
+        std::uniform_int_distribution<std::size_t> rasterizerDist(0, rasterizerCount - 1);
+        std::uniform_real_distribution<float> positionDist(-100.0f, 100.0f);
+
+        SpriteBatch batch;
+        batch.Reserve(spriteCount);
+
+        for (std::size_t i = 0; i < spriteCount; ++i)
+        {
+            SpriteDrawItem item;
+            item.pixelShader = pixelShaders[shaderDist(random)];
+            item.texture = textures[textureDist(random)];
+            item.rasterizerState = rasterizerStates[rasterizerDist(random)];
+            item.world = Matrix::CreateTranslation(positionDist(random), positionDist(random), positionDist(random));
+
+            batch.Add(item);
+        }
+
+        batch.Build(true);
+        const auto batches = batch.GetBatches();
+
+        NullCommandContext recorder;
+        std::vector<RecordedCommand> firstCommands;
+        SpriteBatchStats spriteStats;
+        double recordUs = 0.0;
+        bool isValid = true;
+
+        for (int iteration = 0; iteration < iterationCount; ++iteration)
+        {
+            recorder.Reset();
+            recorder.SetRasterizerState(passRasterizerState);
+
+            const TimePoint start = Clock::now();
+            spriteStats = batch.Submit(recorder);
+            recordUs += GetElapsedMicroseconds(start);
+
+            // 같은 입력이면 명령도 같아야 함 (프레임끼리 비교해서 바인드가 늘었는지 찾는 용도)
+            const auto commands = recorder.GetCommands();
+            if (iteration == 0)
+            {
+                firstCommands.assign(commands.begin(), commands.end());
+            }
+            else if (!std::equal(commands.begin(), commands.end(), firstCommands.begin(), firstCommands.end()))
+            {
+                isValid = false;
+            }
+        }
+
+        // 기록한 명령을 따라가며 드로우마다 그 묶음의 상태가 바인드되어 있어야 함
+        const void* pixelShader = nullptr;
+        const void* texture = nullptr;
+        const void* rasterizerState = nullptr;
+        std::size_t drawIndex = 0;
+        std::size_t drawnSpriteCount = 0;
+
+        for (const RecordedCommand& command : recorder.GetCommands())
+        {
+            switch (command.type)
+            {
+            case CommandType::SetPixelShader:
+                pixelShader = command.object;
+                break;
+
+            case CommandType::SetPSShaderResources:
+                if (command.slot == static_cast<UINT>(TextureSlot::BaseColor))
+                {
+                    texture = command.object;
+                }
+                break;
+
+            case CommandType::SetRasterizerState:
+                rasterizerState = command.object;
+                break;
+
+            case CommandType::DrawIndexed:
+            {
+                if (drawIndex >= batches.size())
+                {
+                    isValid = false;
+                    break;
+                }
+
+                const SpriteBatch::Batch& range = batches[drawIndex++];
+                if (pixelShader != range.pixelShader.Get() ||
+                    texture != range.texture.Get() ||
+                    rasterizerState != range.rasterizerState.Get() ||
+                    command.value != range.spriteCount * SpriteBatch::IndicesPerSprite ||
+                    command.baseVertex != static_cast<INT>(range.firstSprite * SpriteBatch::VerticesPerSprite))
+                {
+                    isValid = false;
+                }
+
+                drawnSpriteCount += command.value / SpriteBatch::IndicesPerSprite;
+                break;
+            }
+
+            default:
+                break;
+            }
+        }
+
+        if (drawIndex != batches.size() ||
+            drawnSpriteCount != spriteCount ||
+            recorder.GetStats().drawCount != spriteStats.drawCount ||
+            rasterizerState != passRasterizerState.Get())
+        {
+            isValid = false;
+        }
+
+        // 업로드는 내용을 복사하지 않고 바이트 수만 셈
+        const auto vertices = batch.GetVertices();
+        const UINT vertexBytes = static_cast<UINT>(vertices.size_bytes());
+        recorder.UploadDynamicBuffer(vertexBuffer, vertices.data(), vertexBytes);
+
+        const CommandStats& stats = recorder.GetStats();
+        if (stats.uploadCount != 1 || stats.uploadedBytes != vertexBytes)
+        {
+            isValid = false;
+        }
+
+        // 묶음마다 셰이더 / 텍스처 / 래스터라이저를 모두 바인드할 때와 비교
+        const std::size_t bindAllCount = batches.size() * 3 + 2;
+
+        AddResult(std::format("[Command Recording] {} sprites -> {} draws, {} commands ({} state changes, all binds {}), record {:.1f}us, {}",
+            spriteCount, stats.drawCount, stats.commandCount, stats.stateChangeCount, bindAllCount,
+            recordUs / iterationCount, isValid ? "OK" : "다름"));
+    }
+
+    void EditorBenchmark::AddResult(std::string result)
+    {
+        LOG_PRINT("{}", result);
+
+        g_results.push_back(std::move(result));
+    }
+}
@@ -0,0 +1,78 @@
+﻿#pragma once
+
+namespace engine
+{
+    // 에디터 Profile 창에서 실행하는 CPU 마이크로벤치마크
+    // 결과는 창에 표시하고 로그로도 남김
+    class EditorBenchmark
+    {
+    public:
+        static void OnGui();
+
+        // 선형 탐색 vs BVH (frustum / ray 쿼리), 1k / 10k / 100k 개
+        static void RunSpatialQuery();
+
+        // 포인터 계층 + lazy GetWorld vs TransformSystem SoA 일괄 갱신
+        static void RunTransformHierarchy();
+
+        // Girl.fbx 애니메이터 N개를 1 / 2 / 4 / ... 스레드로 나눠서 갱신
+        static void RunSkeletalAnimation();
+
+        // 번들된 스켈레탈 FBX의 클립별 압축 전/후 메모리와 최대 오차
+        static void ReportAnimationCompression();
+
+        // 스키닝 행렬 커널: SimpleMath 기준 구현 vs XMVECTOR 구현 (결과 차이와 시간)
+        static void RunSkinningKernel();
+
+        // 모든 스레드에서 Object 생성 / 삭제 / 핸들 조회를 동시에 돌리고 잘못된 조회 수를 셈
+        static void RunObjectRegistryStress();
+
+        // 컴포넌트 8 / 13개 객체에서 dynamic_cast 순회 vs 타입 번호 조회
+        static void RunComponentLookup();
+
+        // 엔티티 10k / 100k개 갱신: 개별 할당 + 가상 Update 포인터 순회 vs ComponentColumns 열 순회
+        static void RunArchetypeUpdate();
+
+        // 렌더 정렬 목록 / 충돌 접촉점 같은 프레임 임시 데이터: std::vector vs FrameVector의 프레임당 힙 할당 수
+        static void RunFrameArena();
+
+        // Resource/Scene의 씬마다 JSON 파싱 + LoadFromJson vs .scenebin 메모리 맵 + LoadFromBinary (.scenebin도 새로 씀)
+        static void RunSceneLoad();
+
+        // 객체 1k / 5k개 씬의 에디터 Play / Stop: JSON 저장 + 다시 로드 vs SceneSnapshot (Stop 전에 Transform 1%를 바꿈)
+        static void RunPlaySnapshot();
+
+        // Girl.fbx / char.fbx를 Static / Skeletal로: Assimp 임포트 vs .cooked 메모리 맵 로드 (.cooked도 새로 씀)
+        static void RunMeshCook();
+
+        // Resource/Model의 FBX + Resource/Texture의 텍스처: 메인 스레드에서 차례로 vs 워커로 나눠서 파싱 / 디코드
+        // 같은 파일을 여러 번 Request하면 로드가 한 번만 일어나는지도 확인
+        static void RunAssetStreaming();
+
+        // Girl.fbx / char.fbx의 정점을 CompactVertex로 인코드 -> 디코드해서 원본과의 최대 오차, 크기, 16비트 인덱스 가능 여부
+        static void RunVertexCompression();
+
+        // 가짜 상태로 만든 섹션 2만 개 (메시 64 / 셰이더 12 / 머티리얼 128): 추가한 순서 vs 정렬 후 바인드 횟수, radix vs std::stable_sort
+        // RenderQueue를 context 없이 Submit하므로 헤드리스 검사를 겸함 (정렬 결과가 stable_sort와 같은지 확인)
+        static void RunRenderQueue();
+
+        // 같은 FBX를 여러 번 배치한 씬 (렌더러 4000개, 메시 16 x 섹션 2, 머티리얼 8): 섹션마다 DrawIndexed vs 인스턴싱 묶음
+        // context 없이 Submit하고 모은 행렬이 원래 world / 역전치와 같은지 확인 (헤드리스 검사)
+        static void RunStaticInstancing();
+
+        // 빌보드 스프라이트 5000개 (텍스처 24 / 셰이더 3 / 컬 모드 2): 상태 정렬 vs 추가 순서 유지에서 드로우 수와 Build 시간
+        // 펼친 정점으로 묶음마다 상태가 같은지, 순서가 유지되는지, 쿼드 위치 / uv가 맞는지 확인 (헤드리스 검사)
+        static void RunSpriteBatch();
+
+        // 정렬한 packet 2만 개 (2%는 usesRendererDraw)를 MakeSubmitChunks로 나눠 JobSystem 워커에서 context 없이 Submit
+        // 구간이 빈틈없이 이어지는지, usesRendererDraw가 기록 구간에 섞이지 않는지, 드로우 수가 한 번에 Submit한 것과 같은지 확인 (헤드리스 검사)
+        static void RunParallelSubmit();
+
+        // 정렬한 스프라이트 5000개를 SpriteBatch::Submit으로 NullCommandContext에 기록 (GPU 없이)
+        // 기록한 명령을 다시 따라가며 드로우마다 묶음 상태가 바인드되어 있는지, 매번 같은 명령이 나오는지, 패스 상태로 되돌리는지 확인 (헤드리스 검사)
+        static void RunCommandRecording();
+
+    private:
+        static void AddResult(std::string result);
+    };
+}
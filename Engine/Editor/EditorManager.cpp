@@ -4,10 +4,14 @@
 #include <fstream>
 
 #include "Common/Utility/Profiling.h"
+#include "Common/Utility/FrameArena.h"
+#include "Common/Utility/JobSystem.h"
+#include "Common/Utility/SlabMemoryPool.h"
 #include "Common/Utility/StringHelper.h"
 #include "Core/Graphics/Device/GraphicsDevice.h"
 #include "Framework/Scene/SceneManager.h"
 #include "Framework/Scene/Scene.h"
+#include "Framework/Scene/SceneSnapshot.h"
 #include "Framework/Object/GameObject/GameObject.h"
 #include "Framework/Object/Component/Transform.h"
 #include "Framework/Object/Component/ComponentFactory.h"
@@ -20,6 +24,7 @@
 
 #include "Editor/EditorCamera.h"
 #include "Editor/EditorGrid.h"
+#include "Editor/EditorBenchmark.h"
 
 #include "Framework/Physics/PhysicsDebugRenderer.h"
 #include "Framework/Physics/PhysicsSystem.h"
@@ -29,7 +34,8 @@ namespace engine
 {
     namespace
     {
-        nlohmann::ordered_json g_tempScene;
+        // Play 직전 상태 (Stop에서 바뀐 것만 되돌림)
+        SceneSnapshot g_playSnapshot;
     }
 
     EditorManager::EditorManager() = default;
@@ -136,14 +142,15 @@ namespace engine
             if (ImGui::Button("Play"))
             {
                 auto scene = SceneManager::Get().GetScene();
-                g_tempScene.clear();
-                scene->SaveToJson(g_tempScene);
-                scene->LoadFromJson(g_tempScene);
+                scene->ProcessPendingAdds(false);
+                g_playSnapshot.Capture(*scene);
 
-                // 물리 씬 생성
+                m_editorState = EditorState::Play;
+
+                // 물리 씬 생성 (물리 컴포넌트 Awake 포함)
                 PhysicsSystem::Get().CreateScenePhysics(scene);
 
-                m_editorState = EditorState::Play;
+                scene->BeginPlay();
 
                 m_selectedObject = nullptr;
             }
@@ -153,15 +160,21 @@ namespace engine
             if (ImGui::Button("Stop"))
             {
                 auto scene = SceneManager::Get().GetScene();
-                
-                // 물리 씬 파괴
-                PhysicsSystem::Get().DestroyScenePhysics(scene);
-                
-                if (scene && !g_tempScene.empty())
+                scene->EndPlay();
+
+                m_editorState = EditorState::Edit;
+
+                // 물리 컴포넌트를 다시 만들 수 있으므로 물리 씬보다 먼저
+                if (!g_playSnapshot.IsEmpty())
                 {
-                    scene->LoadFromJson(g_tempScene);
+                    const SceneRestoreStats stats = g_playSnapshot.Restore(*scene);
+                    LOG_INFO("[Editor] Stop - unchanged {}, restored {}, recreated {}, destroyed {}",
+                        stats.unchangedCount, stats.restoredCount, stats.recreatedCount, stats.destroyedCount);
                 }
-                m_editorState = EditorState::Edit;
+
+                // 물리 씬 파괴
+                PhysicsSystem::Get().DestroyScenePhysics(scene);
+                CollisionSystem::Get().Reset();
 
                 m_selectedObject = nullptr;
             }
@@ -973,6 +986,130 @@ namespace engine
             ImGui::Text("DRAM: %s", FormatBytes(Profiling::GetDRAMUsage()).c_str());
             ImGui::Text("VRAM: %s", FormatBytes(Profiling::GetVRAMUsage()).c_str());
             ImGui::Text("PageFile: %s", FormatBytes(Profiling::GetPageFileUsage()).c_str());
+            ImGui::Text("Job Workers: %u", JobSystem::Get().GetWorkerCount());
+
+            ImGui::Separator();
+
+            auto& renderSystem = SystemManager::Get().GetRenderSystem();
+
+            bool useFrustumCulling = renderSystem.IsFrustumCullingEnabled();
+            if (ImGui::Checkbox("Frustum Culling", &useFrustumCulling))
+            {
+                renderSystem.SetFrustumCullingEnabled(useFrustumCulling);
+            }
+
+            const auto& cullingStats = renderSystem.GetCullingStats();
+            ImGui::Text("Camera: %u / %u (culled %u)",
+                cullingStats.cameraVisible,
+                cullingStats.cameraTested,
+                cullingStats.cameraTested - cullingStats.cameraVisible);
+            ImGui::Text("Shadow: %u / %u (culled %u)",
+                cullingStats.shadowVisible,
+                cullingStats.shadowTested,
+                cullingStats.shadowTested - cullingStats.shadowVisible);
+            ImGui::Text("BVH: %d proxies, height %d", cullingStats.treeProxyCount, cullingStats.treeHeight);
+
+            bool sortDrawPackets = renderSystem.IsDrawPacketSortEnabled();
+            if (ImGui::Checkbox("Sort Draw Packets", &sortDrawPackets))
+            {
+                renderSystem.SetDrawPacketSortEnabled(sortDrawPackets);
+            }
+
+            bool useInstancing = renderSystem.IsInstancingEnabled();
+            if (ImGui::Checkbox("Instancing", &useInstancing))
+            {
+                renderSystem.SetInstancingEnabled(useInstancing);
+            }
+
+            bool recordInParallel = renderSystem.IsParallelRecordingEnabled();
+            if (ImGui::Checkbox("Parallel Recording", &recordInParallel))
+            {
+                renderSystem.SetParallelRecordingEnabled(recordInParallel);
+            }
+
+            bool useNullBackend = renderSystem.IsNullBackendEnabled();
+            if (ImGui::Checkbox("Null Backend", &useNullBackend))
+            {
+                renderSystem.SetNullBackendEnabled(useNullBackend);
+            }
+
+            bool batchSprites = renderSystem.IsSpriteBatchingEnabled();
+            if (ImGui::Checkbox("Batch Sprites", &batchSprites))
+            {
+                renderSystem.SetSpriteBatchingEnabled(batchSprites);
+            }
+
+            const auto& queueStats = renderSystem.GetRenderQueueStats();
+            ImGui::Text("Draws: %u, binds %u (skipped %u)",
+                queueStats.drawCount,
+                queueStats.bindCount,
+                queueStats.skippedBindCount);
+            ImGui::Text("Instanced: %u draws, %u instances",
+                queueStats.instancedDrawCount,
+                queueStats.instanceCount);
+            ImGui::Text("Command lists: %u", queueStats.commandListCount);
+
+            if (useNullBackend)
+            {
+                const auto& commandStats = renderSystem.GetNullBackendStats();
+                ImGui::Text("Null: %u commands, %u draws, %u state changes",
+                    commandStats.commandCount,
+                    commandStats.drawCount,
+                    commandStats.stateChangeCount);
+                ImGui::Text("Uploads: %u (%.1f KB)",
+                    commandStats.uploadCount,
+                    static_cast<double>(commandStats.uploadedBytes) / 1024.0);
+            }
+
+            const auto& spriteStats = renderSystem.GetSpriteBatchStats();
+            ImGui::Text("Sprites: %u in %u draws",
+                spriteStats.spriteCount,
+                spriteStats.drawCount);
+
+            if (ImGui::TreeNode("Memory Pools"))
+            {
+                for (const auto& stats : GetMemoryPoolStats())
+                {
+                    ImGui::Text("%s: %lld live (peak %lld) / %zu slots, %zu pages x %zuB, fallback %lld",
+                        stats.name,
+                        stats.liveCount,
+                        stats.peakCount,
+                        stats.capacity,
+                        stats.pageCount,
+                        stats.slotSize,
+                        stats.fallbackCount);
+                }
+
+                if (ImGui::Button("Release Empty Pages"))
+                {
+                    LOG_INFO("빈 풀 페이지 {}개 반환", ReleaseEmptyMemoryPoolPages());
+                }
+
+                ImGui::TreePop();
+            }
+
+            if (ImGui::TreeNode("Frame Arena"))
+            {
+                const FrameArenaStats stats = FrameArena::Get().GetStats();
+
+                ImGui::Text("Used: %.1f KB (peak %.1f KB) / Reserved: %.1f KB",
+                    stats.usedBytes / 1024.0,
+                    stats.peakUsedBytes / 1024.0,
+                    stats.reservedBytes / 1024.0);
+                ImGui::Text("Threads: %zu, Block Allocations: %llu", stats.threadCount, stats.blockAllocationCount);
+#ifdef _DEBUG
+                ImGui::Text("Heap Allocations (last frame): %llu", Profiling::GetLastFrameHeapAllocations());
+#endif
+
+                ImGui::TreePop();
+            }
+
+            if (ImGui::TreeNode("Benchmark"))
+            {
+                EditorBenchmark::OnGui();
+
+                ImGui::TreePop();
+            }
         }
 
         // Physics Debug
@@ -0,0 +1,115 @@
+﻿#include "EnginePCH.h"
+#include "AnimationPose.h"
+
+#include "Framework/Asset/AnimationData.h"
+
+namespace engine
+{
+    namespace
+    {
+        float GetBoneWeight(const std::vector<float>& boneWeights, std::size_t index)
+        {
+            return boneWeights.empty() ? 1.0f : boneWeights[index];
+        }
+    }
+
+    void AnimationPose::Resize(std::size_t boneCount)
+    {
+        positions.resize(boneCount, Vector3(0.0f, 0.0f, 0.0f));
+        rotations.resize(boneCount, Quaternion::Identity);
+        scales.resize(boneCount, Vector3(1.0f, 1.0f, 1.0f));
+    }
+
+    std::size_t AnimationPose::GetBoneCount() const
+    {
+        return positions.size();
+    }
+
+    void CreateBindPose(const std::vector<Bone>& bones, AnimationPose& out)
+    {
+        out.Resize(bones.size());
+
+        for (std::size_t i = 0; i < bones.size(); ++i)
+        {
+            Matrix local = bones[i].local;
+            local.Decompose(out.scales[i], out.rotations[i], out.positions[i]);
+        }
+    }
+
+    void SamplePose(
+        const Animation& animation,
+        float time,
+        const AnimationPose& bindPose,
+        std::vector<LastKeyIndex>& inOutKeyIndices,
+        AnimationPose& out)
+    {
+        const std::size_t boneCount = bindPose.GetBoneCount();
+
+        out.Resize(boneCount);
+        inOutKeyIndices.resize(boneCount);
+
+        for (std::size_t i = 0; i < boneCount; ++i)
+        {
+            const BoneAnimation* channel = animation.GetBoneAnimation(static_cast<unsigned int>(i));
+            if (channel == nullptr)
+            {
+                out.positions[i] = bindPose.positions[i];
+                out.rotations[i] = bindPose.rotations[i];
+                out.scales[i] = bindPose.scales[i];
+
+                continue;
+            }
+
+            channel->Evaluate(time, inOutKeyIndices[i], out.positions[i], out.rotations[i], out.scales[i]);
+        }
+    }
+
+    void BlendPose(
+        const AnimationPose& a,
+        const AnimationPose& b,
+        float weight,
+        const std::vector<float>& boneWeights,
+        AnimationPose& out)
+    {
+        const std::size_t boneCount = a.GetBoneCount();
+
+        out.Resize(boneCount);
+
+        for (std::size_t i = 0; i < boneCount; ++i)
+        {
+            const float t = weight * GetBoneWeight(boneWeights, i);
+
+            out.positions[i] = Vector3::Lerp(a.positions[i], b.positions[i], t);
+            out.rotations[i] = Quaternion::Lerp(a.rotations[i], b.rotations[i], t); // 부호 보정 + 정규화 (nlerp)
+            out.scales[i] = Vector3::Lerp(a.scales[i], b.scales[i], t);
+        }
+    }
+
+    void AddPose(
+        const AnimationPose& base,
+        const AnimationPose& additive,
+        const AnimationPose& reference,
+        float weight,
+        const std::vector<float>& boneWeights,
+        AnimationPose& out)
+    {
+        const std::size_t boneCount = base.GetBoneCount();
+
+        out.Resize(boneCount);
+
+        for (std::size_t i = 0; i < boneCount; ++i)
+        {
+            const float t = weight * GetBoneWeight(boneWeights, i);
+
+            Quaternion inverseReference;
+            reference.rotations[i].Inverse(inverseReference);
+
+            // base == reference, t == 1이면 additive와 같아짐
+            const Quaternion delta = inverseReference * additive.rotations[i];
+
+            out.positions[i] = base.positions[i] + (additive.positions[i] - reference.positions[i]) * t;
+            out.rotations[i] = base.rotations[i] * Quaternion::Lerp(Quaternion::Identity, delta, t);
+            out.scales[i] = base.scales[i] + (additive.scales[i] - reference.scales[i]) * t;
+        }
+    }
+}
@@ -0,0 +1,50 @@
+﻿#pragma once
+
+#include "Framework/Asset/SkeletonData.h"
+
+namespace engine
+{
+    struct Animation;
+
+    // 로컬 공간 본 포즈 (SoA, 본 번호 순)
+    // 클립 샘플링과 블렌딩은 여기서 하고 모델 공간 행렬은 마지막에 한번만 만듦
+    struct AnimationPose
+    {
+        std::vector<Vector3> positions;
+        std::vector<Quaternion> rotations;
+        std::vector<Vector3> scales;
+
+        void Resize(std::size_t boneCount);
+        std::size_t GetBoneCount() const;
+    };
+
+    // 스켈레톤의 local 행렬을 분해해서 바인드 포즈를 만듦
+    void CreateBindPose(const std::vector<Bone>& bones, AnimationPose& out);
+
+    // 채널이 없는 본은 bindPose 값을 씀
+    void SamplePose(
+        const Animation& animation,
+        float time,
+        const AnimationPose& bindPose,
+        std::vector<LastKeyIndex>& inOutKeyIndices,
+        AnimationPose& out);
+
+    // out = lerp(a, b, weight * boneWeights[i]) (boneWeights가 비어있으면 모든 본 1)
+    // out은 a와 같아도 됨
+    void BlendPose(
+        const AnimationPose& a,
+        const AnimationPose& b,
+        float weight,
+        const std::vector<float>& boneWeights,
+        AnimationPose& out);
+
+    // out = base에 (additive - reference) 차이를 weight * boneWeights[i]만큼 더함
+    // out은 base와 같아도 됨
+    void AddPose(
+        const AnimationPose& base,
+        const AnimationPose& additive,
+        const AnimationPose& reference,
+        float weight,
+        const std::vector<float>& boneWeights,
+        AnimationPose& out);
+}
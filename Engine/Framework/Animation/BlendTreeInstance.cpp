@@ -0,0 +1,419 @@
+﻿#include "EnginePCH.h"
+#include "BlendTreeInstance.h"
+
+#include "Framework/Asset/AnimationData.h"
+#include "Framework/Asset/BlendTreeData.h"
+
+namespace engine
+{
+    namespace
+    {
+        const std::vector<float> g_allBones; // 마스크 없음 (모든 본 1)
+    }
+
+    void BlendTreeInstance::Setup(
+        const std::shared_ptr<BlendTreeData>& blendTreeData,
+        const std::shared_ptr<AnimationData>& animationData,
+        const std::vector<Bone>& skeleton,
+        const AnimationPose& bindPose)
+    {
+        m_blendTreeData = blendTreeData;
+        m_animationData = animationData;
+        m_bindPose = bindPose;
+        m_frame = 0;
+
+        m_states.clear();
+        m_maskWeights.clear();
+        m_referencePoses.clear();
+
+        if (!IsValid())
+        {
+            return;
+        }
+
+        m_parameters = m_blendTreeData->GetDefaultParameters();
+
+        const auto& nodes = m_blendTreeData->GetNodes();
+        const std::size_t boneCount = m_bindPose.GetBoneCount();
+
+        m_states.resize(nodes.size());
+
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            const auto& node = nodes[i];
+            auto& state = m_states[i];
+
+            state.scratch.Resize(boneCount);
+            state.keyIndices.resize(boneCount);
+            state.weights.resize(node.children.size());
+
+            if (node.type != BlendTreeNodeType::Clip || m_animationData == nullptr)
+            {
+                continue;
+            }
+
+            const auto& animations = m_animationData->GetAnimations();
+
+            if (!node.clipName.empty())
+            {
+                for (const auto& animation : animations)
+                {
+                    if (animation.name == node.clipName)
+                    {
+                        state.clip = &animation;
+                        break;
+                    }
+                }
+            }
+            else if (node.clipIndex < static_cast<std::int32_t>(animations.size()))
+            {
+                state.clip = &animations[node.clipIndex];
+            }
+
+            if (state.clip == nullptr)
+            {
+                LOG_INFO("블렌드 트리 노드 {}: 클립 없음", node.name);
+            }
+        }
+
+        // 지정한 본의 가중치를 자식까지 물려줌 (부모가 자식보다 앞에 있음)
+        for (const auto& mask : m_blendTreeData->GetMasks())
+        {
+            std::vector<float> explicitWeights(boneCount, -1.0f);
+
+            for (const auto& maskBone : mask.bones)
+            {
+                for (std::size_t i = 0; i < skeleton.size(); ++i)
+                {
+                    if (skeleton[i].name == maskBone.boneName)
+                    {
+                        explicitWeights[i] = maskBone.weight;
+                        break;
+                    }
+                }
+            }
+
+            std::vector<float> weights(boneCount, 0.0f);
+            for (std::size_t i = 0; i < boneCount; ++i)
+            {
+                if (explicitWeights[i] >= 0.0f)
+                {
+                    weights[i] = explicitWeights[i];
+                }
+                else if (skeleton[i].parentIndex != -1)
+                {
+                    weights[i] = weights[skeleton[i].parentIndex];
+                }
+            }
+
+            m_maskWeights.push_back(std::move(weights));
+        }
+
+        // additive 레이어의 기준 포즈는 reference 클립의 첫 프레임 (없으면 바인드 포즈)
+        m_referencePoses.resize(nodes.size());
+
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            const auto& node = nodes[i];
+            if (node.type != BlendTreeNodeType::Layer || !node.isAdditive)
+            {
+                continue;
+            }
+
+            if (node.reference != -1 && m_states[node.reference].clip != nullptr)
+            {
+                std::vector<LastKeyIndex> keyIndices;
+                SamplePose(*m_states[node.reference].clip, 0.0f, m_bindPose, keyIndices, m_referencePoses[i]);
+            }
+            else
+            {
+                m_referencePoses[i] = m_bindPose;
+            }
+        }
+    }
+
+    bool BlendTreeInstance::IsValid() const
+    {
+        return m_blendTreeData != nullptr && m_blendTreeData->GetRoot() != -1;
+    }
+
+    const std::shared_ptr<BlendTreeData>& BlendTreeInstance::GetBlendTreeData() const
+    {
+        return m_blendTreeData;
+    }
+
+    void BlendTreeInstance::SetParameter(const std::string& name, float value)
+    {
+        if (m_blendTreeData == nullptr)
+        {
+            return;
+        }
+
+        SetParameter(m_blendTreeData->GetParameterIndex(name), value);
+    }
+
+    void BlendTreeInstance::SetParameter(std::int32_t index, float value)
+    {
+        if (index < 0 || index >= static_cast<std::int32_t>(m_parameters.size()))
+        {
+            return;
+        }
+
+        m_parameters[index] = value;
+    }
+
+    float BlendTreeInstance::GetParameter(std::int32_t index) const
+    {
+        if (index < 0 || index >= static_cast<std::int32_t>(m_parameters.size()))
+        {
+            return 0.0f;
+        }
+
+        return m_parameters[index];
+    }
+
+    void BlendTreeInstance::Evaluate(float deltaTime, AnimationPose& out)
+    {
+        if (!IsValid())
+        {
+            out = m_bindPose;
+            return;
+        }
+
+        ++m_frame;
+
+        EvaluateNode(m_blendTreeData->GetRoot(), deltaTime, -1.0f, out);
+    }
+
+    void BlendTreeInstance::EvaluateNode(std::int32_t index, float deltaTime, float syncPhase, AnimationPose& out)
+    {
+        const auto& node = m_blendTreeData->GetNodes()[index];
+        auto& state = m_states[index];
+
+        const bool isFirstVisit = state.updateFrame != m_frame;
+        state.updateFrame = m_frame;
+
+        switch (node.type)
+        {
+        case BlendTreeNodeType::Clip:
+        {
+            if (state.clip == nullptr)
+            {
+                out = m_bindPose;
+                return;
+            }
+
+            const float duration = state.clip->duration;
+
+            if (syncPhase >= 0.0f)
+            {
+                state.time = syncPhase * duration;
+            }
+            else if (isFirstVisit)
+            {
+                state.time += deltaTime * node.speed;
+
+                if (node.isLoop && duration > 0.0f)
+                {
+                    state.time = std::fmod(state.time, duration);
+                    if (state.time < 0.0f)
+                    {
+                        state.time += duration;
+                    }
+                }
+                else
+                {
+                    state.time = std::clamp(state.time, 0.0f, duration);
+                }
+            }
+
+            SamplePose(*state.clip, state.time, m_bindPose, state.keyIndices, out);
+            break;
+        }
+
+        case BlendTreeNodeType::BlendSpace1D:
+        case BlendTreeNodeType::BlendSpace2D:
+        {
+            // 자식 클립은 길이가 달라도 같은 위상으로 재생 (걷기/뛰기 발 맞춤)
+            const float duration = GetNodeDuration(index);
+
+            if (syncPhase >= 0.0f)
+            {
+                state.phase = syncPhase;
+            }
+            else if (isFirstVisit && duration > 0.0f)
+            {
+                state.phase += deltaTime / duration;
+                state.phase -= std::floor(state.phase);
+            }
+
+            float accumulated = 0.0f;
+
+            for (std::size_t i = 0; i < node.children.size(); ++i)
+            {
+                const float weight = state.weights[i];
+                if (weight <= 0.0f)
+                {
+                    continue;
+                }
+
+                if (accumulated == 0.0f)
+                {
+                    EvaluateNode(node.children[i], deltaTime, state.phase, out);
+                    accumulated = weight;
+                }
+                else
+                {
+                    // 누적 평균: out = lerp(out, child, w / (지금까지의 합))
+                    EvaluateNode(node.children[i], deltaTime, state.phase, state.scratch);
+                    accumulated += weight;
+                    BlendPose(out, state.scratch, weight / accumulated, g_allBones, out);
+                }
+            }
+
+            if (accumulated == 0.0f)
+            {
+                out = m_bindPose;
+            }
+            break;
+        }
+
+        case BlendTreeNodeType::Layer:
+        {
+            EvaluateNode(node.base, deltaTime, syncPhase, out);
+
+            float weight = node.weight;
+            if (node.weightParameter != -1)
+            {
+                weight *= m_parameters[node.weightParameter];
+            }
+
+            weight = std::clamp(weight, 0.0f, 1.0f);
+            if (weight <= 0.0f)
+            {
+                return;
+            }
+
+            EvaluateNode(node.layer, deltaTime, -1.0f, state.scratch);
+
+            const auto& boneWeights = node.mask != -1 ? m_maskWeights[node.mask] : g_allBones;
+
+            if (node.isAdditive)
+            {
+                AddPose(out, state.scratch, m_referencePoses[index], weight, boneWeights, out);
+            }
+            else
+            {
+                BlendPose(out, state.scratch, weight, boneWeights, out);
+            }
+            break;
+        }
+        }
+    }
+
+    void BlendTreeInstance::UpdateWeights(std::int32_t index)
+    {
+        const auto& node = m_blendTreeData->GetNodes()[index];
+        auto& weights = m_states[index].weights;
+
+        std::fill(weights.begin(), weights.end(), 0.0f);
+
+        const auto& positions = node.positions;
+        const std::size_t count = positions.size();
+
+        if (node.type == BlendTreeNodeType::BlendSpace1D)
+        {
+            // position 순으로 정렬되어 있으므로 파라미터가 들어가는 구간의 양 끝만 섞음
+            const float x = m_parameters[node.parameterX];
+
+            if (x <= positions.front().x)
+            {
+                weights.front() = 1.0f;
+                return;
+            }
+
+            if (x >= positions.back().x)
+            {
+                weights.back() = 1.0f;
+                return;
+            }
+
+            for (std::size_t i = 0; i + 1 < count; ++i)
+            {
+                if (x < positions[i + 1].x)
+                {
+                    const float span = positions[i + 1].x - positions[i].x;
+                    const float t = span > 0.0f ? (x - positions[i].x) / span : 0.0f;
+
+                    weights[i] = 1.0f - t;
+                    weights[i + 1] = t;
+                    return;
+                }
+            }
+
+            return;
+        }
+
+        // 2D: 거리 제곱의 역수로 가중치 (샘플 위에 있으면 그 샘플만)
+        const Vector2 point{ m_parameters[node.parameterX], m_parameters[node.parameterY] };
+
+        float sum = 0.0f;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const float distanceSquared = Vector2::DistanceSquared(point, positions[i]);
+            if (distanceSquared < 1e-6f)
+            {
+                std::fill(weights.begin(), weights.end(), 0.0f);
+                weights[i] = 1.0f;
+                return;
+            }
+
+            weights[i] = 1.0f / distanceSquared;
+            sum += weights[i];
+        }
+
+        for (float& weight : weights)
+        {
+            weight /= sum;
+        }
+    }
+
+    float BlendTreeInstance::GetNodeDuration(std::int32_t index)
+    {
+        const auto& node = m_blendTreeData->GetNodes()[index];
+        const auto& state = m_states[index];
+
+        switch (node.type)
+        {
+        case BlendTreeNodeType::Clip:
+            if (state.clip == nullptr || std::abs(node.speed) < 1e-4f)
+            {
+                return 0.0f;
+            }
+
+            return state.clip->duration / std::abs(node.speed);
+
+        case BlendTreeNodeType::BlendSpace1D:
+        case BlendTreeNodeType::BlendSpace2D:
+        {
+            UpdateWeights(index);
+
+            float duration = 0.0f;
+            for (std::size_t i = 0; i < node.children.size(); ++i)
+            {
+                if (state.weights[i] > 0.0f)
+                {
+                    duration += state.weights[i] * GetNodeDuration(node.children[i]);
+                }
+            }
+
+            return duration;
+        }
+
+        case BlendTreeNodeType::Layer:
+            return GetNodeDuration(node.base);
+        }
+
+        return 0.0f;
+    }
+}
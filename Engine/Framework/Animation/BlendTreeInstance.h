@@ -0,0 +1,61 @@
+﻿#pragma once
+
+#include "Framework/Animation/AnimationPose.h"
+
+namespace engine
+{
+    struct Animation;
+    class AnimationData;
+    class BlendTreeData;
+
+    // BlendTreeData 하나를 애니메이터 하나에서 평가하기 위한 상태
+    // 노드마다 재생 시간, 키 커서, 임시 포즈를 가지고 있어서 매 프레임 할당이 없음
+    class BlendTreeInstance
+    {
+    private:
+        struct NodeState
+        {
+            const Animation* clip = nullptr;
+            float time = 0.0f;
+            float phase = 0.0f; // 블렌드 스페이스 정규화 시간 (0 ~ 1)
+            std::uint64_t updateFrame = 0; // 여러 부모가 공유하는 노드를 한 프레임에 두번 진행하지 않도록
+            std::vector<LastKeyIndex> keyIndices;
+            std::vector<float> weights; // 블렌드 스페이스 자식 가중치
+            AnimationPose scratch;
+        };
+
+        std::shared_ptr<BlendTreeData> m_blendTreeData;
+        std::shared_ptr<AnimationData> m_animationData;
+
+        AnimationPose m_bindPose;
+        std::vector<float> m_parameters;
+        std::vector<NodeState> m_states;
+        std::vector<std::vector<float>> m_maskWeights; // 마스크별 본 가중치
+        std::vector<AnimationPose> m_referencePoses; // additive 레이어 노드별 기준 포즈
+        std::uint64_t m_frame = 0;
+
+    public:
+        void Setup(
+            const std::shared_ptr<BlendTreeData>& blendTreeData,
+            const std::shared_ptr<AnimationData>& animationData,
+            const std::vector<Bone>& skeleton,
+            const AnimationPose& bindPose);
+
+        bool IsValid() const;
+
+        const std::shared_ptr<BlendTreeData>& GetBlendTreeData() const;
+
+        void SetParameter(const std::string& name, float value);
+        void SetParameter(std::int32_t index, float value);
+        float GetParameter(std::int32_t index) const;
+
+        void Evaluate(float deltaTime, AnimationPose& out);
+
+    private:
+        // syncPhase가 0 이상이면 블렌드 스페이스가 정한 위상으로 재생
+        void EvaluateNode(std::int32_t index, float deltaTime, float syncPhase, AnimationPose& out);
+        void UpdateWeights(std::int32_t index);
+        // 블렌드 스페이스는 가중치를 갱신하고 자식 길이의 가중 평균을 돌려줌
+        float GetNodeDuration(std::int32_t index);
+    };
+}
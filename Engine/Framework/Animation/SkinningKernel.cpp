@@ -0,0 +1,68 @@
+﻿#include "EnginePCH.h"
+#include "SkinningKernel.h"
+
+namespace engine
+{
+    void BuildSkinningMatrices(
+        const AnimationPose& pose,
+        std::vector<Bone>& bones,
+        const BoneMatrixArray& boneOffsets,
+        BoneMatrixArray& out)
+    {
+        using namespace DirectX;
+
+        for (std::size_t i = 0; i < bones.size(); ++i)
+        {
+            auto& bone = bones[i];
+
+            const XMVECTOR scale = XMLoadFloat3(&pose.scales[i]);
+            const XMVECTOR rotation = XMLoadFloat4(&pose.rotations[i]);
+            const XMVECTOR position = XMLoadFloat3(&pose.positions[i]);
+
+            // S * R * T
+            XMMATRIX local = XMMatrixRotationQuaternion(rotation);
+            local.r[0] = XMVectorMultiply(local.r[0], XMVectorSplatX(scale));
+            local.r[1] = XMVectorMultiply(local.r[1], XMVectorSplatY(scale));
+            local.r[2] = XMVectorMultiply(local.r[2], XMVectorSplatZ(scale));
+            local.r[3] = XMVectorSelect(g_XMIdentityR3, position, g_XMSelect1110);
+
+            XMMATRIX model = local;
+            if (bone.parentIndex != -1)
+            {
+                model = XMMatrixMultiply(local, XMLoadFloat4x4(&bones[bone.parentIndex].model));
+            }
+
+            XMStoreFloat4x4(&bone.model, model);
+
+            const XMMATRIX skinning = XMMatrixMultiply(XMLoadFloat4x4(&boneOffsets[bone.index]), model);
+            XMStoreFloat4x4(&out[bone.index], XMMatrixTranspose(skinning));
+        }
+    }
+
+    void BuildSkinningMatricesReference(
+        const AnimationPose& pose,
+        std::vector<Bone>& bones,
+        const BoneMatrixArray& boneOffsets,
+        BoneMatrixArray& out)
+    {
+        for (std::size_t i = 0; i < bones.size(); ++i)
+        {
+            auto& bone = bones[i];
+
+            const Matrix local = Matrix::CreateScale(pose.scales[i])
+                * Matrix::CreateFromQuaternion(pose.rotations[i])
+                * Matrix::CreateTranslation(pose.positions[i]);
+
+            if (bone.parentIndex != -1)
+            {
+                bone.model = local * bones[bone.parentIndex].model;
+            }
+            else
+            {
+                bone.model = local;
+            }
+
+            out[bone.index] = (boneOffsets[bone.index] * bone.model).Transpose();
+        }
+    }
+}
@@ -0,0 +1,25 @@
+﻿#pragma once
+
+#include "Framework/Animation/AnimationPose.h"
+
+namespace engine
+{
+    // 로컬 포즈 -> 모델 공간(bones[i].model) -> 스키닝 행렬 (offset * model, 전치)
+    // bones는 부모가 자식보다 앞에 있어야 함
+    //
+    // 애니메이션 캐릭터마다 매 프레임 도는 가장 안쪽 루프라서 XMVECTOR로 직접 계산
+    // - TRS는 회전 행렬의 행에 스케일을 곱하고 마지막 행에 위치를 넣어서 만듦 (행렬 곱 2번 생략)
+    // - 부모 model은 방금 저장한 것을 다시 읽기만 함
+    void BuildSkinningMatrices(
+        const AnimationPose& pose,
+        std::vector<Bone>& bones,
+        const BoneMatrixArray& boneOffsets,
+        BoneMatrixArray& out);
+
+    // 같은 결과를 SimpleMath로 계산하는 기준 구현 (비교 / 검증용)
+    void BuildSkinningMatricesReference(
+        const AnimationPose& pose,
+        std::vector<Bone>& bones,
+        const BoneMatrixArray& boneOffsets,
+        BoneMatrixArray& out);
+}
@@ -0,0 +1,372 @@
+﻿#include "EnginePCH.h"
+#include "AnimationCompression.h"
+
+#include "Framework/Asset/AnimationData.h"
+
+namespace engine
+{
+    namespace
+    {
+        constexpr float MaxFrame = 65535.0f;
+        constexpr float MaxQuantized = 65535.0f;
+
+        // smallest-three에서 나머지 세 성분은 [-1/sqrt(2), 1/sqrt(2)] 범위
+        constexpr float SmallestThreeRange = 0.70710678f;
+        constexpr float SmallestThreeMax = 32767.0f;
+
+        // frame이 들어있는 구간 [index, index + 1]의 시작 키 번호 (키는 2개 이상)
+        std::size_t FindFrameIndex(const std::vector<std::uint16_t>& times, float frame, std::size_t lastIndex)
+        {
+            const std::size_t lastSegment = times.size() - 2;
+
+            if (lastIndex <= lastSegment && times[lastIndex] <= frame)
+            {
+                if (frame < times[lastIndex + 1])
+                {
+                    return lastIndex;
+                }
+
+                if (lastIndex < lastSegment && frame < times[lastIndex + 2])
+                {
+                    return lastIndex + 1;
+                }
+            }
+
+            const auto iter = std::upper_bound(times.begin(), times.end(), frame,
+                [](float f, std::uint16_t time)
+                {
+                    return f < time;
+                });
+
+            const std::size_t upper = static_cast<std::size_t>(iter - times.begin());
+
+            return upper == 0 ? 0 : std::min(upper - 1, lastSegment);
+        }
+
+        float GetSegmentFactor(const std::vector<std::uint16_t>& times, std::size_t index, float frame)
+        {
+            const float from = times[index];
+            const float span = times[index + 1] - from;
+
+            return span > 0.0f ? std::clamp((frame - from) / span, 0.0f, 1.0f) : 1.0f;
+        }
+
+        std::uint16_t QuantizeTime(float time, float timeToFrame)
+        {
+            return static_cast<std::uint16_t>(std::lround(std::clamp(time * timeToFrame, 0.0f, MaxFrame)));
+        }
+
+        // 두 회전 사이의 각도 (acos는 1 근처에서 float 정밀도가 나빠서 차이 벡터의 길이로 계산)
+        float GetRotationError(const Quaternion& a, Quaternion b)
+        {
+            if (a.Dot(b) < 0.0f)
+            {
+                b = -b;
+            }
+
+            const Quaternion difference = a - b;
+            const float halfLength = 0.5f * std::sqrt(difference.Dot(difference));
+
+            return 4.0f * std::asin(std::min(halfLength, 1.0f));
+        }
+
+        // 남길 키 번호 (첫 키와 마지막 키는 항상 남김, 모든 키가 첫 키와 같으면 하나만 남김)
+        template <typename Key, typename Interpolate, typename GetError>
+        std::vector<std::size_t> ReduceKeys(const std::vector<Key>& keys, float tolerance, Interpolate interpolate, GetError getError)
+        {
+            std::vector<std::size_t> kept{ 0 };
+
+            const bool isConstant = std::all_of(keys.begin(), keys.end(),
+                [&](const Key& key)
+                {
+                    return getError(key.value, keys[0].value) <= tolerance;
+                });
+
+            if (isConstant)
+            {
+                return kept;
+            }
+
+            // start와 end 사이의 키가 모두 둘의 보간으로 충분하면 end를 늘려가고, 아니면 end - 1을 남김
+            std::size_t start = 0;
+            for (std::size_t end = 2; end < keys.size(); ++end)
+            {
+                const float span = keys[end].time - keys[start].time;
+
+                for (std::size_t k = start + 1; k < end; ++k)
+                {
+                    const float t = span > 0.0f ? (keys[k].time - keys[start].time) / span : 0.0f;
+
+                    if (getError(interpolate(keys[start].value, keys[end].value, t), keys[k].value) > tolerance)
+                    {
+                        kept.push_back(end - 1);
+                        start = end - 1;
+                        break;
+                    }
+                }
+            }
+
+            kept.push_back(keys.size() - 1);
+
+            return kept;
+        }
+
+        template <typename Key>
+        void CompressVector3Track(const std::vector<Key>& keys, float timeToFrame, float tolerance, CompressedVector3Track& out)
+        {
+            const std::vector<std::size_t> kept = ReduceKeys(keys, tolerance,
+                [](const Vector3& a, const Vector3& b, float t)
+                {
+                    return Vector3::Lerp(a, b, t);
+                },
+                [](const Vector3& a, const Vector3& b)
+                {
+                    return Vector3::Distance(a, b);
+                });
+
+            Vector3 minimum = keys[kept[0]].value;
+            Vector3 maximum = minimum;
+            for (std::size_t index : kept)
+            {
+                minimum = Vector3::Min(minimum, keys[index].value);
+                maximum = Vector3::Max(maximum, keys[index].value);
+            }
+
+            out.minimum = minimum;
+            out.step = (maximum - minimum) / MaxQuantized;
+
+            auto quantize = [](float value, float minimum, float step) -> std::uint16_t
+                {
+                    return step > 0.0f ? static_cast<std::uint16_t>(std::lround(std::clamp((value - minimum) / step, 0.0f, MaxQuantized))) : 0;
+                };
+
+            out.times.clear();
+            out.values.clear();
+            out.times.reserve(kept.size());
+            out.values.reserve(kept.size() * 3);
+
+            for (std::size_t index : kept)
+            {
+                const Vector3& value = keys[index].value;
+
+                out.times.push_back(QuantizeTime(keys[index].time, timeToFrame));
+                out.values.push_back(quantize(value.x, minimum.x, out.step.x));
+                out.values.push_back(quantize(value.y, minimum.y, out.step.y));
+                out.values.push_back(quantize(value.z, minimum.z, out.step.z));
+            }
+        }
+
+        void EncodeQuaternion(Quaternion rotation, std::uint16_t* out)
+        {
+            rotation.Normalize();
+
+            const float components[4]{ rotation.x, rotation.y, rotation.z, rotation.w };
+
+            std::uint32_t largest = 0;
+            for (std::uint32_t i = 1; i < 4; ++i)
+            {
+                if (std::abs(components[i]) > std::abs(components[largest]))
+                {
+                    largest = i;
+                }
+            }
+
+            // q와 -q는 같은 회전이므로 가장 큰 성분이 양수가 되도록 뒤집어서 부호를 저장하지 않음
+            const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+            std::uint64_t bits = largest;
+            for (std::uint32_t i = 0; i < 4; ++i)
+            {
+                if (i == largest)
+                {
+                    continue;
+                }
+
+                const float normalized = std::clamp(components[i] * sign / SmallestThreeRange, -1.0f, 1.0f) * 0.5f + 0.5f;
+                bits = (bits << 15) | static_cast<std::uint64_t>(std::lround(normalized * SmallestThreeMax));
+            }
+
+            out[0] = static_cast<std::uint16_t>(bits);
+            out[1] = static_cast<std::uint16_t>(bits >> 16);
+            out[2] = static_cast<std::uint16_t>(bits >> 32);
+        }
+
+        Quaternion DecodeQuaternion(const std::uint16_t* in)
+        {
+            const std::uint64_t bits =
+                static_cast<std::uint64_t>(in[0]) |
+                (static_cast<std::uint64_t>(in[1]) << 16) |
+                (static_cast<std::uint64_t>(in[2]) << 32);
+
+            const std::uint32_t largest = static_cast<std::uint32_t>(bits >> 45) & 0x3;
+
+            float components[4]{};
+            float sumSquared = 0.0f;
+            std::uint32_t shift = 30;
+
+            for (std::uint32_t i = 0; i < 4; ++i)
+            {
+                if (i == largest)
+                {
+                    continue;
+                }
+
+                const float quantized = static_cast<float>((bits >> shift) & 0x7FFF);
+                components[i] = (quantized / SmallestThreeMax * 2.0f - 1.0f) * SmallestThreeRange;
+                sumSquared += components[i] * components[i];
+                shift -= 15;
+            }
+
+            components[largest] = std::sqrt(std::max(0.0f, 1.0f - sumSquared));
+
+            return Quaternion(components[0], components[1], components[2], components[3]);
+        }
+
+        void CompressRotationTrack(const std::vector<RotationKey>& keys, float timeToFrame, float tolerance, CompressedRotationTrack& out)
+        {
+            const std::vector<std::size_t> kept = ReduceKeys(keys, tolerance,
+                [](const Quaternion& a, const Quaternion& b, float t)
+                {
+                    return Quaternion::Slerp(a, b, t);
+                },
+                GetRotationError);
+
+            out.times.clear();
+            out.values.resize(kept.size() * 3);
+            out.times.reserve(kept.size());
+
+            for (std::size_t i = 0; i < kept.size(); ++i)
+            {
+                out.times.push_back(QuantizeTime(keys[kept[i]].time, timeToFrame));
+                EncodeQuaternion(keys[kept[i]].value, &out.values[i * 3]);
+            }
+        }
+    }
+
+    Vector3 CompressedVector3Track::Sample(float frame, std::size_t& inOutLastIndex) const
+    {
+        if (times.size() == 1)
+        {
+            return Decode(0);
+        }
+
+        const std::size_t index = FindFrameIndex(times, frame, inOutLastIndex);
+        inOutLastIndex = index;
+
+        return Vector3::Lerp(Decode(index), Decode(index + 1), GetSegmentFactor(times, index, frame));
+    }
+
+    Vector3 CompressedVector3Track::Decode(std::size_t index) const
+    {
+        const std::uint16_t* value = &values[index * 3];
+
+        return Vector3(
+            minimum.x + value[0] * step.x,
+            minimum.y + value[1] * step.y,
+            minimum.z + value[2] * step.z);
+    }
+
+    std::size_t CompressedVector3Track::GetByteSize() const
+    {
+        return (times.size() + values.size()) * sizeof(std::uint16_t) + sizeof(minimum) + sizeof(step);
+    }
+
+    Quaternion CompressedRotationTrack::Sample(float frame, std::size_t& inOutLastIndex) const
+    {
+        if (times.size() == 1)
+        {
+            return Decode(0);
+        }
+
+        const std::size_t index = FindFrameIndex(times, frame, inOutLastIndex);
+        inOutLastIndex = index;
+
+        return Quaternion::Slerp(Decode(index), Decode(index + 1), GetSegmentFactor(times, index, frame));
+    }
+
+    Quaternion CompressedRotationTrack::Decode(std::size_t index) const
+    {
+        return DecodeQuaternion(&values[index * 3]);
+    }
+
+    std::size_t CompressedRotationTrack::GetByteSize() const
+    {
+        return (times.size() + values.size()) * sizeof(std::uint16_t);
+    }
+
+    void CompressedBoneAnimation::Compress(const BoneAnimation& source, float duration, const AnimationCompressionSettings& settings)
+    {
+        assert(!source.positionKeys.empty() && !source.rotationKeys.empty() && !source.scaleKeys.empty());
+
+        timeToFrame = duration > 0.0f ? MaxFrame / duration : 0.0f;
+
+        CompressVector3Track(source.positionKeys, timeToFrame, settings.positionTolerance, position);
+        CompressRotationTrack(source.rotationKeys, timeToFrame, settings.rotationTolerance, rotation);
+        CompressVector3Track(source.scaleKeys, timeToFrame, settings.scaleTolerance, scale);
+    }
+
+    void CompressedBoneAnimation::Evaluate(
+        float time,
+        LastKeyIndex& inOutLastKeyIndex,
+        Vector3& outPosition,
+        Quaternion& outRotation,
+        Vector3& outScale) const
+    {
+        const float frame = std::clamp(time * timeToFrame, 0.0f, MaxFrame);
+
+        outPosition = position.Sample(frame, inOutLastKeyIndex.position);
+        outRotation = rotation.Sample(frame, inOutLastKeyIndex.rotation);
+        outScale = scale.Sample(frame, inOutLastKeyIndex.scale);
+    }
+
+    void CompressedBoneAnimation::MeasureError(const BoneAnimation& source, AnimationCompressionStats& inOutStats) const
+    {
+        std::vector<float> times;
+
+        auto addTimes = [&times](const auto& keys)
+            {
+                for (std::size_t i = 0; i < keys.size(); ++i)
+                {
+                    times.push_back(keys[i].time);
+
+                    if (i + 1 < keys.size())
+                    {
+                        times.push_back(0.5f * (keys[i].time + keys[i + 1].time));
+                    }
+                }
+            };
+
+        addTimes(source.positionKeys);
+        addTimes(source.rotationKeys);
+        addTimes(source.scaleKeys);
+
+        std::sort(times.begin(), times.end());
+
+        LastKeyIndex sourceKeyIndex{};
+        LastKeyIndex compressedKeyIndex{};
+
+        for (float time : times)
+        {
+            Vector3 sourcePosition, compressedPosition;
+            Quaternion sourceRotation, compressedRotation;
+            Vector3 sourceScale, compressedScale;
+
+            source.Evaluate(time, sourceKeyIndex, sourcePosition, sourceRotation, sourceScale);
+            Evaluate(time, compressedKeyIndex, compressedPosition, compressedRotation, compressedScale);
+
+            inOutStats.maxPositionError = std::max(inOutStats.maxPositionError, Vector3::Distance(sourcePosition, compressedPosition));
+            inOutStats.maxRotationError = std::max(inOutStats.maxRotationError, GetRotationError(sourceRotation, compressedRotation));
+            inOutStats.maxScaleError = std::max(inOutStats.maxScaleError, Vector3::Distance(sourceScale, compressedScale));
+        }
+    }
+
+    std::size_t CompressedBoneAnimation::GetByteSize() const
+    {
+        return position.GetByteSize() + rotation.GetByteSize() + scale.GetByteSize() + sizeof(timeToFrame);
+    }
+
+    std::size_t CompressedBoneAnimation::GetKeyCount() const
+    {
+        return position.times.size() + rotation.times.size() + scale.times.size();
+    }
+}
@@ -0,0 +1,75 @@
+﻿#pragma once
+
+#include "Framework/Asset/SkeletonData.h"
+
+namespace engine
+{
+    struct BoneAnimation;
+
+    // 허용 오차 안에서 상수/선형으로 보간되는 키를 지움
+    struct AnimationCompressionSettings
+    {
+        float positionTolerance = 0.01f; // 모델 단위 거리
+        float rotationTolerance = 0.001f; // 라디안
+        float scaleTolerance = 0.001f;
+    };
+
+    struct AnimationCompressionStats
+    {
+        std::string name;
+        std::size_t rawBytes = 0;
+        std::size_t compressedBytes = 0;
+        std::size_t rawKeyCount = 0;
+        std::size_t compressedKeyCount = 0;
+        float maxPositionError = 0.0f;
+        float maxRotationError = 0.0f; // 라디안
+        float maxScaleError = 0.0f;
+    };
+
+    // 키 시간은 0 ~ 65535 (클립 길이로 정규화), 값은 min + q * step으로 16비트 양자화
+    struct CompressedVector3Track
+    {
+        std::vector<std::uint16_t> times;
+        std::vector<std::uint16_t> values; // 키당 x, y, z
+        Vector3 minimum{ 0.0f, 0.0f, 0.0f };
+        Vector3 step{ 0.0f, 0.0f, 0.0f };
+
+        Vector3 Sample(float frame, std::size_t& inOutLastIndex) const;
+        Vector3 Decode(std::size_t index) const;
+        std::size_t GetByteSize() const;
+    };
+
+    // smallest-three: 절댓값이 가장 큰 성분의 번호(2비트)와 나머지 세 성분(15비트씩)을 48비트에 담음
+    struct CompressedRotationTrack
+    {
+        std::vector<std::uint16_t> times;
+        std::vector<std::uint16_t> values; // 키당 16비트 3개
+
+        Quaternion Sample(float frame, std::size_t& inOutLastIndex) const;
+        Quaternion Decode(std::size_t index) const;
+        std::size_t GetByteSize() const;
+    };
+
+    struct CompressedBoneAnimation
+    {
+        CompressedVector3Track position;
+        CompressedRotationTrack rotation;
+        CompressedVector3Track scale;
+        float timeToFrame = 0.0f; // 65535 / duration
+
+        void Compress(const BoneAnimation& source, float duration, const AnimationCompressionSettings& settings);
+
+        void Evaluate(
+            float time,
+            LastKeyIndex& inOutLastKeyIndex,
+            Vector3& outPosition,
+            Quaternion& outRotation,
+            Vector3& outScale) const;
+
+        // 원본 키 시간과 그 중간에서 source(압축 전)와 비교해서 최대 오차를 갱신
+        void MeasureError(const BoneAnimation& source, AnimationCompressionStats& inOutStats) const;
+
+        std::size_t GetByteSize() const;
+        std::size_t GetKeyCount() const;
+    };
+}
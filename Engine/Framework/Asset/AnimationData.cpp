@@ -4,138 +4,155 @@
 #include <assimp/scene.h>
 #include <assimp/anim.h>
 
+#include "Framework/Asset/CookedAsset.h"
+
 namespace engine
 {
-    void BoneAnimation::Evaluate(
-        float time,
-        LastKeyIndex& inOutLastKeyIndex,
-        Vector3& outPosition,
-        Quaternion& outRotation,
-        Vector3& outScale) const
+    namespace
     {
-        // position
-        size_t positionKeyIndex = inOutLastKeyIndex.position;
-
-        if (positionKeys[positionKeyIndex].time >= time)
+        // time이 들어있는 구간 [index, index + 1]의 시작 키 번호 (키는 2개 이상)
+        template <typename Key>
+        std::size_t FindKeyIndex(const std::vector<Key>& keys, float time, float sampleRate, std::size_t lastIndex)
         {
-            positionKeyIndex = 0;
-        }
-
-        outPosition = positionKeys[positionKeyIndex].value;
+            const std::size_t lastSegment = keys.size() - 2;
 
-        while (true)
-        {
-            size_t nextIndex = positionKeyIndex + 1;
-            if (nextIndex >= positionKeys.size())
+            // 균일하게 리샘플된 채널은 바로 계산
+            if (sampleRate > 0.0f)
             {
-                break;
+                const float position = time * sampleRate;
+                if (position <= 0.0f)
+                {
+                    return 0;
+                }
+
+                return std::min(static_cast<std::size_t>(position), lastSegment);
             }
 
-            if (positionKeys[nextIndex].time > time)
+            // 대부분 지난 프레임과 같은 구간이거나 바로 다음 구간
+            if (lastIndex <= lastSegment && keys[lastIndex].time <= time)
             {
-                outPosition = DirectX::SimpleMath::Vector3::Lerp(
-                    positionKeys[positionKeyIndex].value,
-                    positionKeys[nextIndex].value,
-                    (time - positionKeys[positionKeyIndex].time) / (positionKeys[nextIndex].time - positionKeys[positionKeyIndex].time));
-                inOutLastKeyIndex.position = positionKeyIndex;
+                if (time < keys[lastIndex + 1].time)
+                {
+                    return lastIndex;
+                }
 
-                break;
+                if (lastIndex < lastSegment && time < keys[lastIndex + 2].time)
+                {
+                    return lastIndex + 1;
+                }
             }
 
-            positionKeyIndex = nextIndex;
-            outPosition = positionKeys[positionKeyIndex].value;
-        }
+            // 루프나 블렌딩으로 시간이 뒤로 가거나 크게 건너뛴 경우
+            const auto iter = std::upper_bound(keys.begin(), keys.end(), time,
+                [](float t, const Key& key)
+                {
+                    return t < key.time;
+                });
 
-        // rotation
-        size_t rotationKeyIndex = inOutLastKeyIndex.rotation;
+            const std::size_t upper = static_cast<std::size_t>(iter - keys.begin());
 
-        if (rotationKeys[rotationKeyIndex].time >= time)
-        {
-            rotationKeyIndex = 0;
+            return upper == 0 ? 0 : std::min(upper - 1, lastSegment);
         }
 
-        outRotation = rotationKeys[rotationKeyIndex].value;
-
-        while (true)
+        template <typename Key, typename Interpolate>
+        auto SampleKeys(const std::vector<Key>& keys, float time, float sampleRate, std::size_t& inOutLastIndex, Interpolate interpolate)
         {
-            size_t nextIndex = rotationKeyIndex + 1;
-            if (nextIndex >= rotationKeys.size())
+            if (keys.size() == 1)
             {
-                break;
+                return keys[0].value;
             }
 
-            if (rotationKeys[nextIndex].time > time)
-            {
-                outRotation = DirectX::SimpleMath::Quaternion::Slerp(
-                    rotationKeys[rotationKeyIndex].value,
-                    rotationKeys[nextIndex].value,
-                    (time - (rotationKeys[rotationKeyIndex].time)) / (rotationKeys[nextIndex].time - rotationKeys[rotationKeyIndex].time)
-                );
+            const std::size_t index = FindKeyIndex(keys, time, sampleRate, inOutLastIndex);
+            inOutLastIndex = index;
 
-                inOutLastKeyIndex.rotation = rotationKeyIndex;
+            const Key& from = keys[index];
+            const Key& to = keys[index + 1];
 
-                break;
-            }
+            const float span = to.time - from.time;
+            const float t = span > 0.0f ? std::clamp((time - from.time) / span, 0.0f, 1.0f) : 1.0f;
 
-            rotationKeyIndex = nextIndex;
-            outRotation = rotationKeys[rotationKeyIndex].value;
+            return interpolate(from.value, to.value, t);
         }
 
-        // scale
-        size_t scaleKeyIndex = inOutLastKeyIndex.scale;
-
-        if (scaleKeys[scaleKeyIndex].time >= time)
+        template <typename Key, typename Interpolate>
+        void ResampleKeys(std::vector<Key>& keys, float duration, float sampleRate, Interpolate interpolate)
         {
-            scaleKeyIndex = 0;
-        }
+            if (keys.size() <= 1)
+            {
+                return;
+            }
 
-        outScale = scaleKeys[scaleKeyIndex].value;
+            // 마지막 키는 duration에 맞춤 (마지막 구간만 간격이 짧을 수 있음)
+            const std::size_t sampleCount = static_cast<std::size_t>(std::ceil(duration * sampleRate)) + 1;
 
-        while (true)
-        {
-            size_t nextIndex = scaleKeyIndex + 1;
-            if (nextIndex >= scaleKeys.size())
+            std::vector<Key> resampled;
+            resampled.reserve(sampleCount);
+
+            std::size_t cursor = 0;
+            for (std::size_t i = 0; i < sampleCount; ++i)
             {
-                break;
+                const float time = std::min(static_cast<float>(i) / sampleRate, duration);
+                resampled.push_back(Key{ time, SampleKeys(keys, time, 0.0f, cursor, interpolate) });
             }
 
-            if (scaleKeys[nextIndex].time > time)
-            {
-                outScale = DirectX::SimpleMath::Vector3::Lerp(
-                    scaleKeys[scaleKeyIndex].value,
-                    scaleKeys[nextIndex].value,
-                    (time - (scaleKeys[scaleKeyIndex].time)) / (scaleKeys[nextIndex].time - scaleKeys[scaleKeyIndex].time)
-                );
+            keys.swap(resampled);
+        }
 
-                inOutLastKeyIndex.scale = scaleKeyIndex;
+        Vector3 LerpVector3(const Vector3& a, const Vector3& b, float t)
+        {
+            return Vector3::Lerp(a, b, t);
+        }
 
-                break;
-            }
+        Quaternion SlerpQuaternion(const Quaternion& a, const Quaternion& b, float t)
+        {
+            return Quaternion::Slerp(a, b, t);
+        }
 
-            scaleKeyIndex = nextIndex;
-            outScale = scaleKeys[scaleKeyIndex].value;
+        void CookTrack(CookedAssetWriter& writer, const CompressedVector3Track& track)
+        {
+            writer.WriteArray(track.times);
+            writer.WriteArray(track.values);
+            writer.Write(track.minimum);
+            writer.Write(track.step);
+        }
+
+        void ReadTrack(CookedAssetReader& reader, CompressedVector3Track& track)
+        {
+            reader.ReadArray(track.times);
+            reader.ReadArray(track.values);
+            reader.Read(track.minimum);
+            reader.Read(track.step);
         }
     }
 
-    void Animation::SetupBoneAnimation(std::vector<Bone>& out) const
+    void BoneAnimation::Evaluate(
+        float time,
+        LastKeyIndex& inOutLastKeyIndex,
+        Vector3& outPosition,
+        Quaternion& outRotation,
+        Vector3& outScale) const
     {
-        for (auto& bone : out)
+        if (isCompressed)
         {
-            bone.lastKeyIndex = LastKeyIndex{};
-
-            auto find = animMappingTable.find(bone.name);
-            if (find != animMappingTable.end())
-            {
-                bone.boneAnimation = &boneAnimations[find->second];
-            }
-            else
-            {
-                bone.boneAnimation = nullptr;
-            }
+            compressed.Evaluate(time, inOutLastKeyIndex, outPosition, outRotation, outScale);
+            return;
         }
+
+        outPosition = SampleKeys(positionKeys, time, sampleRate, inOutLastKeyIndex.position, LerpVector3);
+        outRotation = SampleKeys(rotationKeys, time, sampleRate, inOutLastKeyIndex.rotation, SlerpQuaternion);
+        outScale = SampleKeys(scaleKeys, time, sampleRate, inOutLastKeyIndex.scale, LerpVector3);
     }
 
-    void AnimationData::Create(const aiScene* scene, const std::shared_ptr<SkeletonData>& skeletonData)
+    const BoneAnimation* Animation::GetBoneAnimation(unsigned int boneIndex) const
+    {
+        assert(boneIndex < boneToChannel.size());
+
+        const std::int32_t channel = boneToChannel[boneIndex];
+
+        return channel != -1 ? &boneAnimations[channel] : nullptr;
+    }
+
+    void AnimationData::Create(const aiScene* scene, const std::shared_ptr<SkeletonData>& skeletonData, const AnimationImportSettings& settings)
     {
         m_animations.reserve(scene->mNumAnimations);
 
@@ -148,6 +165,7 @@ namespace engine
             animation.name = aiAnim->mName.C_Str();
             animation.duration = static_cast<float>(aiAnim->mDuration / aiAnim->mTicksPerSecond);
             animation.boneAnimations.resize(aiAnim->mNumChannels);
+            animation.boneToChannel.assign(skeletonData->GetBones().size(), -1);
 
             for (unsigned int i = 0; i < aiAnim->mNumChannels; ++i)
             {
@@ -156,6 +174,7 @@ namespace engine
 
                 animation.boneAnimations[i].boneIndex = skeletonData->GetBoneIndexByBoneName(boneName);
                 animation.animMappingTable[boneName] = i;
+                animation.boneToChannel[animation.boneAnimations[i].boneIndex] = static_cast<std::int32_t>(i);
 
                 animation.boneAnimations[i].positionKeys.reserve(anim->mNumPositionKeys);
                 animation.boneAnimations[i].rotationKeys.reserve(anim->mNumRotationKeys);
@@ -188,14 +207,179 @@ namespace engine
                             anim->mScalingKeys[j].mValue.y,
                             anim->mScalingKeys[j].mValue.z));
                 }
+
+                if (settings.sampleRate > 0.0f && !settings.compress)
+                {
+                    auto& boneAnimation = animation.boneAnimations[i];
+
+                    ResampleKeys(boneAnimation.positionKeys, animation.duration, settings.sampleRate, LerpVector3);
+                    ResampleKeys(boneAnimation.rotationKeys, animation.duration, settings.sampleRate, SlerpQuaternion);
+                    ResampleKeys(boneAnimation.scaleKeys, animation.duration, settings.sampleRate, LerpVector3);
+                    boneAnimation.sampleRate = settings.sampleRate;
+                }
             }
 
             m_animations.push_back(std::move(animation));
         }
+
+        if (settings.compress)
+        {
+            Compress(settings.compression, settings.uncompressedClips);
+        }
+    }
+
+    void AnimationData::Compress(const AnimationCompressionSettings& settings, const std::vector<std::string>& skipClips)
+    {
+        m_compressionStats.clear();
+        m_compressionStats.reserve(m_animations.size());
+
+        for (auto& animation : m_animations)
+        {
+            if (std::ranges::find(skipClips, animation.name) != skipClips.end())
+            {
+                continue;
+            }
+
+            AnimationCompressionStats stats;
+            stats.name = animation.name;
+
+            for (auto& boneAnimation : animation.boneAnimations)
+            {
+                if (boneAnimation.isCompressed)
+                {
+                    continue;
+                }
+
+                stats.rawBytes +=
+                    boneAnimation.positionKeys.size() * sizeof(PositionKey) +
+                    boneAnimation.rotationKeys.size() * sizeof(RotationKey) +
+                    boneAnimation.scaleKeys.size() * sizeof(ScaleKey);
+                stats.rawKeyCount += boneAnimation.positionKeys.size() + boneAnimation.rotationKeys.size() + boneAnimation.scaleKeys.size();
+
+                boneAnimation.compressed.Compress(boneAnimation, animation.duration, settings);
+
+                stats.compressedBytes += boneAnimation.compressed.GetByteSize();
+                stats.compressedKeyCount += boneAnimation.compressed.GetKeyCount();
+
+                boneAnimation.compressed.MeasureError(boneAnimation, stats);
+
+                boneAnimation.isCompressed = true;
+
+                std::vector<PositionKey>().swap(boneAnimation.positionKeys);
+                std::vector<RotationKey>().swap(boneAnimation.rotationKeys);
+                std::vector<ScaleKey>().swap(boneAnimation.scaleKeys);
+            }
+
+            m_compressionStats.push_back(std::move(stats));
+        }
+    }
+
+    void AnimationData::Create(CookedAssetReader& reader)
+    {
+        m_animations.resize(reader.ReadCount(sizeof(std::uint32_t) * 4 + sizeof(float)));
+        for (auto& animation : m_animations)
+        {
+            reader.ReadString(animation.name);
+            reader.Read(animation.duration);
+            reader.ReadArray(animation.boneToChannel);
+
+            animation.boneAnimations.resize(reader.ReadCount(sizeof(std::uint32_t) * 3));
+            for (auto& boneAnimation : animation.boneAnimations)
+            {
+                reader.Read(boneAnimation.boneIndex);
+                reader.Read(boneAnimation.sampleRate);
+                reader.Read(boneAnimation.isCompressed);
+
+                reader.ReadArray(boneAnimation.positionKeys);
+                reader.ReadArray(boneAnimation.rotationKeys);
+                reader.ReadArray(boneAnimation.scaleKeys);
+
+                ReadTrack(reader, boneAnimation.compressed.position);
+                reader.ReadArray(boneAnimation.compressed.rotation.times);
+                reader.ReadArray(boneAnimation.compressed.rotation.values);
+                ReadTrack(reader, boneAnimation.compressed.scale);
+                reader.Read(boneAnimation.compressed.timeToFrame);
+            }
+
+            const std::uint32_t mappingCount = reader.ReadCount(sizeof(std::uint32_t) * 2);
+            for (std::uint32_t i = 0; i < mappingCount; ++i)
+            {
+                std::string boneName;
+                reader.ReadString(boneName);
+                animation.animMappingTable[boneName] = reader.Read<Animation::BoneAnimIndex>();
+            }
+        }
+
+        m_compressionStats.resize(reader.ReadCount(sizeof(std::uint32_t)));
+        for (auto& stats : m_compressionStats)
+        {
+            reader.ReadString(stats.name);
+            reader.Read(stats.rawBytes);
+            reader.Read(stats.compressedBytes);
+            reader.Read(stats.rawKeyCount);
+            reader.Read(stats.compressedKeyCount);
+            reader.Read(stats.maxPositionError);
+            reader.Read(stats.maxRotationError);
+            reader.Read(stats.maxScaleError);
+        }
+    }
+
+    void AnimationData::Cook(CookedAssetWriter& writer) const
+    {
+        writer.Write(static_cast<std::uint32_t>(m_animations.size()));
+        for (const auto& animation : m_animations)
+        {
+            writer.WriteString(animation.name);
+            writer.Write(animation.duration);
+            writer.WriteArray(animation.boneToChannel);
+
+            writer.Write(static_cast<std::uint32_t>(animation.boneAnimations.size()));
+            for (const auto& boneAnimation : animation.boneAnimations)
+            {
+                writer.Write(boneAnimation.boneIndex);
+                writer.Write(boneAnimation.sampleRate);
+                writer.Write(boneAnimation.isCompressed);
+
+                writer.WriteArray(boneAnimation.positionKeys);
+                writer.WriteArray(boneAnimation.rotationKeys);
+                writer.WriteArray(boneAnimation.scaleKeys);
+
+                CookTrack(writer, boneAnimation.compressed.position);
+                writer.WriteArray(boneAnimation.compressed.rotation.times);
+                writer.WriteArray(boneAnimation.compressed.rotation.values);
+                CookTrack(writer, boneAnimation.compressed.scale);
+                writer.Write(boneAnimation.compressed.timeToFrame);
+            }
+
+            writer.Write(static_cast<std::uint32_t>(animation.animMappingTable.size()));
+            for (const auto& [boneName, channel] : animation.animMappingTable)
+            {
+                writer.WriteString(boneName);
+                writer.Write(channel);
+            }
+        }
+
+        writer.Write(static_cast<std::uint32_t>(m_compressionStats.size()));
+        for (const auto& stats : m_compressionStats)
+        {
+            writer.WriteString(stats.name);
+            writer.Write(stats.rawBytes);
+            writer.Write(stats.compressedBytes);
+            writer.Write(stats.rawKeyCount);
+            writer.Write(stats.compressedKeyCount);
+            writer.Write(stats.maxPositionError);
+            writer.Write(stats.maxRotationError);
+            writer.Write(stats.maxScaleError);
+        }
     }
 
     const std::vector<Animation>& AnimationData::GetAnimations() const
     {
         return m_animations;
     }
+
+    const std::vector<AnimationCompressionStats>& AnimationData::GetCompressionStats() const
+    {
+        return m_compressionStats;
+    }
 }
\ No newline at end of file
@@ -2,11 +2,15 @@
 
 #include "Framework/Asset/AssetData.h"
 #include "Framework/Asset/SkeletonData.h"
+#include "Framework/Asset/AnimationCompression.h"
 
 struct aiScene;
 
 namespace engine
 {
+    class CookedAssetWriter;
+    class CookedAssetReader;
+
     struct PositionKey
     {
         float time;
@@ -33,6 +37,11 @@ namespace engine
         std::vector<RotationKey> rotationKeys;
         std::vector<ScaleKey> scaleKeys;
         unsigned int boneIndex = 0;
+        float sampleRate = 0.0f; // 0보다 크면 키가 1 / sampleRate 간격으로 리샘플되어 있음 (O(1) 조회)
+
+        // 압축되면 위의 키 배열은 비우고 이쪽으로 평가
+        CompressedBoneAnimation compressed;
+        bool isCompressed = false;
 
         void Evaluate(
             float time,
@@ -50,9 +59,21 @@ namespace engine
         std::string name;
         std::vector<BoneAnimation> boneAnimations;
         std::unordered_map<BoneName, BoneAnimIndex> animMappingTable;
+        std::vector<std::int32_t> boneToChannel; // SkeletonData의 본 번호 -> boneAnimations 번호 (채널이 없으면 -1)
         float duration;
 
-        void SetupBoneAnimation(std::vector<Bone>& out) const;
+        const BoneAnimation* GetBoneAnimation(unsigned int boneIndex) const;
+    };
+
+    struct AnimationImportSettings
+    {
+        // 0보다 크면 모든 채널을 그 간격으로 리샘플 (0이면 원본 키 유지, 조회는 이진 탐색)
+        // 압축하면 키를 다시 줄이므로 리샘플하지 않음
+        float sampleRate = 0.0f;
+
+        bool compress = false;
+        AnimationCompressionSettings compression;
+        std::vector<std::string> uncompressedClips; // compress여도 원본 키를 유지할 클립 이름
     };
 
     class SkeletonData;
@@ -62,11 +83,19 @@ namespace engine
     {
     private:
         std::vector<Animation> m_animations;
+        std::vector<AnimationCompressionStats> m_compressionStats; // 압축한 클립별
 
     public:
-        void Create(const aiScene* scene, const std::shared_ptr<SkeletonData>& skeletonData);
+        void Create(const aiScene* scene, const std::shared_ptr<SkeletonData>& skeletonData, const AnimationImportSettings& settings = {});
+        void Create(CookedAssetReader& reader);
+
+        void Cook(CookedAssetWriter& writer) const;
+
+        // 원본 키를 압축 트랙으로 바꾸고 해제함 (skipClips에 있는 클립은 그대로 둠)
+        void Compress(const AnimationCompressionSettings& settings, const std::vector<std::string>& skipClips = {});
 
     public:
         const std::vector<Animation>& GetAnimations() const;
+        const std::vector<AnimationCompressionStats>& GetCompressionStats() const;
     };
 }
\ No newline at end of file
@@ -10,10 +10,27 @@
 #include "Framework/Asset/SimpleMeshData.h"
 #include "Framework/Asset/SpriteData.h"
 #include "Framework/Asset/SpriteAnimationData.h"
+#include "Framework/Asset/BlendTreeData.h"
 #include "Framework/Asset/GeometryData.h"
 
 namespace engine
 {
+    namespace
+    {
+        using FbxLoads = PendingFbxLoads<FBXAssetData>;
+
+        template <typename T>
+        std::shared_ptr<T> FindCached(const std::unordered_map<std::string, std::weak_ptr<T>>& cache, const std::string& filePath)
+        {
+            if (auto find = cache.find(filePath); find != cache.end())
+            {
+                return find->second.lock();
+            }
+
+            return nullptr;
+        }
+    }
+
     void AssetManager::Initialize()
     {
         m_globalCachedDatas.reserve(100);
@@ -29,8 +46,27 @@ namespace engine
         m_tempAssets.fill(nullptr);
     }
 
+    void AssetManager::PublishCompletedLoads()
+    {
+        if (m_pendingLoads.IsEmpty())
+        {
+            return;
+        }
+
+        // 콜백에서 새 요청을 걸 수 있으므로 목록에서 먼저 빼고 알림
+        std::vector<std::shared_ptr<PendingFbxLoad>> completed;
+        m_pendingLoads.TakeCompleted(completed);
+
+        for (const auto& pending : completed)
+        {
+            PublishLoad(*pending);
+        }
+    }
+
     std::shared_ptr<StaticMeshData> AssetManager::GetOrCreateStaticMeshData(const std::string& filePath, LifeScope scope)
     {
+        FinishPendingLoad(FBXAssetKind::Static, filePath, scope);
+
         if (auto find = m_staticMeshDatas.find(filePath); find != m_staticMeshDatas.end())
         {
             if (!find->second.expired())
@@ -42,19 +78,15 @@ namespace engine
         auto fbx = std::make_shared<FBXAssetData>();
         fbx->Create(FBXAssetKind::Static, filePath);
 
-        m_staticMeshDatas[filePath] = fbx->GetStaticMeshData();
-        m_materialDatas[filePath] = fbx->GetMaterialData();
-
-        CacheData(fbx->GetStaticMeshData(), scope);
-        CacheData(fbx->GetMaterialData(), scope);
-
-        m_tempAssets[m_tempAssetIndex++ % MAX_TEMP_ASSET] = fbx;
+        CacheFbx(fbx, FBXAssetKind::Static, filePath, scope);
 
         return fbx->GetStaticMeshData();
     }
 
     std::shared_ptr<MaterialData> AssetManager::GetOrCreateMaterialData(const std::string& filePath, LifeScope scope)
     {
+        FinishPendingLoad(FBXAssetKind::Static, filePath, scope);
+
         if (auto find = m_materialDatas.find(filePath); find != m_materialDatas.end())
         {
             if (!find->second.expired())
@@ -66,19 +98,15 @@ namespace engine
         auto fbx = std::make_shared<FBXAssetData>();
         fbx->Create(FBXAssetKind::Static, filePath);
 
-        m_staticMeshDatas[filePath] = fbx->GetStaticMeshData();
-        m_materialDatas[filePath] = fbx->GetMaterialData();
-
-        CacheData(fbx->GetStaticMeshData(), scope);
-        CacheData(fbx->GetMaterialData(), scope);
-
-        m_tempAssets[m_tempAssetIndex++ % MAX_TEMP_ASSET] = fbx;
+        CacheFbx(fbx, FBXAssetKind::Static, filePath, scope);
 
         return fbx->GetMaterialData();
     }
 
     std::shared_ptr<SkeletalMeshData> AssetManager::GetOrCreateSkeletalMeshData(const std::string& filePath, LifeScope scope)
     {
+        FinishPendingLoad(FBXAssetKind::Skeletal, filePath, scope);
+
         if (auto find = m_skeletalMeshDatas.find(filePath); find != m_skeletalMeshDatas.end())
         {
             if (!find->second.expired())
@@ -90,23 +118,15 @@ namespace engine
         auto fbx = std::make_shared<FBXAssetData>();
         fbx->Create(FBXAssetKind::Skeletal, filePath);
 
-        m_skeletalMeshDatas[filePath] = fbx->GetSkeletalMeshData();
-        m_materialDatas[filePath] = fbx->GetMaterialData();
-        m_animationDatas[filePath] = fbx->GetAnimationData();
-        m_skeletonDatas[filePath] = fbx->GetSkeletonData();
-
-        CacheData(fbx->GetSkeletalMeshData(), scope);
-        CacheData(fbx->GetMaterialData(), scope);
-        CacheData(fbx->GetAnimationData(), scope);
-        CacheData(fbx->GetSkeletonData(), scope);
-
-        m_tempAssets[m_tempAssetIndex++ % MAX_TEMP_ASSET] = fbx;
+        CacheFbx(fbx, FBXAssetKind::Skeletal, filePath, scope);
 
         return fbx->GetSkeletalMeshData();
     }
 
     std::shared_ptr<AnimationData> AssetManager::GetOrCreateAnimationData(const std::string& filePath, LifeScope scope)
     {
+        FinishPendingLoad(FBXAssetKind::Skeletal, filePath, scope);
+
         if (auto find = m_animationDatas.find(filePath); find != m_animationDatas.end())
         {
             if (!find->second.expired())
@@ -118,17 +138,7 @@ namespace engine
         auto fbx = std::make_shared<FBXAssetData>();
         fbx->Create(FBXAssetKind::Skeletal, filePath);
 
-        m_skeletalMeshDatas[filePath] = fbx->GetSkeletalMeshData();
-        m_materialDatas[filePath] = fbx->GetMaterialData();
-        m_animationDatas[filePath] = fbx->GetAnimationData();
-        m_skeletonDatas[filePath] = fbx->GetSkeletonData();
-
-        CacheData(fbx->GetSkeletalMeshData(), scope);
-        CacheData(fbx->GetMaterialData(), scope);
-        CacheData(fbx->GetAnimationData(), scope);
-        CacheData(fbx->GetSkeletonData(), scope);
-
-        m_tempAssets[m_tempAssetIndex++ % MAX_TEMP_ASSET] = fbx;
+        CacheFbx(fbx, FBXAssetKind::Skeletal, filePath, scope);
 
         return fbx->GetAnimationData();
     }
@@ -155,6 +165,8 @@ namespace engine
 
     std::shared_ptr<SkeletonData> AssetManager::GetOrCreateSkeletonData(const std::string& filePath, LifeScope scope)
     {
+        FinishPendingLoad(FBXAssetKind::Skeletal, filePath, scope);
+
         if (auto find = m_skeletonDatas.find(filePath); find != m_skeletonDatas.end())
         {
             if (!find->second.expired())
@@ -166,17 +178,7 @@ namespace engine
         auto fbx = std::make_shared<FBXAssetData>();
         fbx->Create(FBXAssetKind::Skeletal, filePath);
 
-        m_skeletalMeshDatas[filePath] = fbx->GetSkeletalMeshData();
-        m_materialDatas[filePath] = fbx->GetMaterialData();
-        m_animationDatas[filePath] = fbx->GetAnimationData();
-        m_skeletonDatas[filePath] = fbx->GetSkeletonData();
-
-        CacheData(fbx->GetSkeletalMeshData(), scope);
-        CacheData(fbx->GetMaterialData(), scope);
-        CacheData(fbx->GetAnimationData(), scope);
-        CacheData(fbx->GetSkeletonData(), scope);
-
-        m_tempAssets[m_tempAssetIndex++ % MAX_TEMP_ASSET] = fbx;
+        CacheFbx(fbx, FBXAssetKind::Skeletal, filePath, scope);
 
         return fbx->GetSkeletonData();
     }
@@ -221,6 +223,86 @@ namespace engine
         return spriteAnimationData;
     }
 
+    std::shared_ptr<BlendTreeData> AssetManager::GetOrCreateBlendTreeData(const std::string& filePath, LifeScope scope)
+    {
+        if (auto find = m_blendTreeDatas.find(filePath); find != m_blendTreeDatas.end())
+        {
+            if (!find->second.expired())
+            {
+                return find->second.lock();
+            }
+        }
+
+        auto blendTreeData = std::make_shared<BlendTreeData>();
+        blendTreeData->Create(filePath);
+
+        m_blendTreeDatas[filePath] = blendTreeData;
+
+        CacheData(blendTreeData, scope);
+
+        return blendTreeData;
+    }
+
+    AssetRequest<StaticMeshData> AssetManager::RequestStaticMeshData(const std::string& filePath, LifeScope scope)
+    {
+        if (auto data = FindCached(m_staticMeshDatas, filePath))
+        {
+            return AssetRequest<StaticMeshData>::FromData(std::move(data));
+        }
+
+        return FbxLoads::Join<StaticMeshData>(m_pendingLoads.GetOrStart(FBXAssetKind::Static, filePath, scope).staticMesh);
+    }
+
+    AssetRequest<StaticMeshData> AssetManager::RequestCompactStaticMeshData(const std::string& filePath, LifeScope scope)
+    {
+        if (auto data = FindCached(m_compactStaticMeshDatas, filePath))
+        {
+            return AssetRequest<StaticMeshData>::FromData(std::move(data));
+        }
+
+        return FbxLoads::Join<StaticMeshData>(m_pendingLoads.GetOrStart(FBXAssetKind::CompactStatic, filePath, scope).staticMesh);
+    }
+
+    AssetRequest<MaterialData> AssetManager::RequestMaterialData(const std::string& filePath, LifeScope scope)
+    {
+        if (auto data = FindCached(m_materialDatas, filePath))
+        {
+            return AssetRequest<MaterialData>::FromData(std::move(data));
+        }
+
+        return FbxLoads::Join<MaterialData>(m_pendingLoads.GetOrStart(FBXAssetKind::Static, filePath, scope).material);
+    }
+
+    AssetRequest<SkeletalMeshData> AssetManager::RequestSkeletalMeshData(const std::string& filePath, LifeScope scope)
+    {
+        if (auto data = FindCached(m_skeletalMeshDatas, filePath))
+        {
+            return AssetRequest<SkeletalMeshData>::FromData(std::move(data));
+        }
+
+        return FbxLoads::Join<SkeletalMeshData>(m_pendingLoads.GetOrStart(FBXAssetKind::Skeletal, filePath, scope).skeletalMesh);
+    }
+
+    AssetRequest<SkeletonData> AssetManager::RequestSkeletonData(const std::string& filePath, LifeScope scope)
+    {
+        if (auto data = FindCached(m_skeletonDatas, filePath))
+        {
+            return AssetRequest<SkeletonData>::FromData(std::move(data));
+        }
+
+        return FbxLoads::Join<SkeletonData>(m_pendingLoads.GetOrStart(FBXAssetKind::Skeletal, filePath, scope).skeleton);
+    }
+
+    AssetRequest<AnimationData> AssetManager::RequestAnimationData(const std::string& filePath, LifeScope scope)
+    {
+        if (auto data = FindCached(m_animationDatas, filePath))
+        {
+            return AssetRequest<AnimationData>::FromData(std::move(data));
+        }
+
+        return FbxLoads::Join<AnimationData>(m_pendingLoads.GetOrStart(FBXAssetKind::Skeletal, filePath, scope).animation);
+    }
+
     std::shared_ptr<GeometryData> AssetManager::GetGeometryData(const std::string& name)
     {
         if (auto find = m_geometryDatas.find(name); find != m_geometryDatas.end())
@@ -290,4 +372,55 @@ namespace engine
             break;
         }
     }
+
+    void AssetManager::CacheFbx(const std::shared_ptr<FBXAssetData>& fbx, FBXAssetKind kind, const std::string& filePath, LifeScope scope)
+    {
+        switch (kind)
+        {
+        case FBXAssetKind::Static:
+            m_staticMeshDatas[filePath] = fbx->GetStaticMeshData();
+            m_materialDatas[filePath] = fbx->GetMaterialData();
+
+            CacheData(fbx->GetStaticMeshData(), scope);
+            CacheData(fbx->GetMaterialData(), scope);
+            break;
+
+        case FBXAssetKind::Skeletal:
+            m_skeletalMeshDatas[filePath] = fbx->GetSkeletalMeshData();
+            m_materialDatas[filePath] = fbx->GetMaterialData();
+            m_animationDatas[filePath] = fbx->GetAnimationData();
+            m_skeletonDatas[filePath] = fbx->GetSkeletonData();
+
+            CacheData(fbx->GetSkeletalMeshData(), scope);
+            CacheData(fbx->GetMaterialData(), scope);
+            CacheData(fbx->GetAnimationData(), scope);
+            CacheData(fbx->GetSkeletonData(), scope);
+            break;
+
+        case FBXAssetKind::CompactStatic:
+            m_compactStaticMeshDatas[filePath] = fbx->GetStaticMeshData();
+            m_materialDatas[filePath] = fbx->GetMaterialData();
+
+            CacheData(fbx->GetStaticMeshData(), scope);
+            CacheData(fbx->GetMaterialData(), scope);
+            break;
+        }
+
+        m_tempAssets[m_tempAssetIndex++ % MAX_TEMP_ASSET] = fbx;
+    }
+
+    void AssetManager::FinishPendingLoad(FBXAssetKind kind, const std::string& filePath, LifeScope scope)
+    {
+        if (const std::shared_ptr<PendingFbxLoad> pending = m_pendingLoads.Finish(kind, filePath, scope))
+        {
+            PublishLoad(*pending);
+        }
+    }
+
+    void AssetManager::PublishLoad(PendingFbxLoad& pending)
+    {
+        CacheFbx(pending.fbx, pending.kind, pending.filePath, pending.scope);
+
+        FbxLoads::Complete(pending);
+    }
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "Common/Utility/Singleton.h"
 #include "Common/Utility/CommonTypes.h"
+#include "Framework/Asset/AssetRequest.h"
+#include "Framework/Asset/PendingFbxLoads.h"
 
 namespace engine
 {
@@ -14,6 +16,7 @@ namespace engine
     class SimpleMeshData;
     class SpriteData;
     class SpriteAnimationData;
+    class BlendTreeData;
     class GeometryData;
 
     class AssetManager :
@@ -28,6 +31,7 @@ namespace engine
         size_t m_tempAssetIndex = 0;
 
         std::unordered_map<std::string, std::weak_ptr<StaticMeshData>> m_staticMeshDatas;
+        std::unordered_map<std::string, std::weak_ptr<StaticMeshData>> m_compactStaticMeshDatas;
         std::unordered_map<std::string, std::weak_ptr<MaterialData>> m_materialDatas;
         std::unordered_map<std::string, std::weak_ptr<SkeletonData>> m_skeletonDatas;
         std::unordered_map<std::string, std::weak_ptr<SkeletalMeshData>> m_skeletalMeshDatas;
@@ -35,11 +39,16 @@ namespace engine
         std::unordered_map<std::string, std::weak_ptr<SimpleMeshData>> m_simpleMeshDatas;
         std::unordered_map<std::string, std::weak_ptr<SpriteData>> m_spriteDatas;
         std::unordered_map<std::string, std::weak_ptr<SpriteAnimationData>> m_spriteAnimationDatas;
+        std::unordered_map<std::string, std::weak_ptr<BlendTreeData>> m_blendTreeDatas;
         std::unordered_map<std::string, std::weak_ptr<GeometryData>> m_geometryDatas;
 
         std::vector<std::shared_ptr<AssetData>> m_globalCachedDatas;
         std::vector<std::shared_ptr<AssetData>> m_sceneCachedDatas;
 
+        // 워커에서 임포트 중인 FBX (메인 스레드에서만 접근)
+        using PendingFbxLoad = PendingFbxLoads<FBXAssetData>::Load;
+        PendingFbxLoads<FBXAssetData> m_pendingLoads;
+
     private:
         AssetManager() = default;
         ~AssetManager() = default;
@@ -49,6 +58,9 @@ namespace engine
 
         void CleanupSceneScope();
 
+        // 프레임 시작에 메인 스레드에서 호출, 임포트가 끝난 FBX를 캐시에 넣고 요청한 쪽에 알림
+        void PublishCompletedLoads();
+
     public:
         std::shared_ptr<StaticMeshData> GetOrCreateStaticMeshData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
         std::shared_ptr<MaterialData> GetOrCreateMaterialData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
@@ -58,12 +70,28 @@ namespace engine
         std::shared_ptr<SkeletalMeshData> GetOrCreateSkeletalMeshData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
         std::shared_ptr<SpriteData> GetOrCreateSpriteData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
         std::shared_ptr<SpriteAnimationData> GetOrCreateSpriteAnimationData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
+        std::shared_ptr<BlendTreeData> GetOrCreateBlendTreeData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
         std::shared_ptr<GeometryData> GetGeometryData(const std::string& name);
 
+        // 비동기 로드 (FBX 임포트는 워커 스레드에서, 같은 파일을 여러 번 요청해도 임포트는 한 번)
+        // 임포트 중인 파일을 GetOrCreateXXX로 요청하면 끝날 때까지 기다림
+        AssetRequest<StaticMeshData> RequestStaticMeshData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
+        // CompactVertex만 가진 메시 (원본 정밀도 정점이 없으므로 Compact 전용 VS로만 그림)
+        AssetRequest<StaticMeshData> RequestCompactStaticMeshData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
+        AssetRequest<MaterialData> RequestMaterialData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
+        AssetRequest<SkeletalMeshData> RequestSkeletalMeshData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
+        AssetRequest<SkeletonData> RequestSkeletonData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
+        AssetRequest<AnimationData> RequestAnimationData(const std::string& filePath, LifeScope scope = LifeScope::Owning);
+
     private:
         void CreateGeometryData();
         void CacheData(const std::shared_ptr<AssetData>& data, LifeScope scope);
 
+        void CacheFbx(const std::shared_ptr<FBXAssetData>& fbx, FBXAssetKind kind, const std::string& filePath, LifeScope scope);
+
+        void FinishPendingLoad(FBXAssetKind kind, const std::string& filePath, LifeScope scope);
+        void PublishLoad(PendingFbxLoad& pending);
+
     private:
         friend class Singleton<AssetManager>;
     };
@@ -0,0 +1,91 @@
+﻿#pragma once
+
+#include <functional>
+
+namespace engine
+{
+    // AssetManager / ResourceManager의 RequestXXX가 돌려주는 핸들
+    // - 파싱 / 디코드는 워커 스레드에서, 결과는 프레임 시작의 PublishCompletedLoads (메인 스레드)에서 채워짐
+    // - 상태는 메인 스레드에서만 읽고 쓰므로 동기화하지 않음
+    // - 텍스처는 요청 직후부터 Get이 자리 표시자를 돌려주고, 로드가 끝나면 같은 객체가 실제 텍스처로 바뀜
+    template <typename T>
+    class AssetRequest
+    {
+    public:
+        using Callback = std::function<void(const std::shared_ptr<T>&)>;
+
+        struct State
+        {
+            std::shared_ptr<T> data;
+            bool isDone = false;
+            std::vector<Callback> callbacks;
+
+            void Complete(std::shared_ptr<T> result)
+            {
+                data = std::move(result);
+                isDone = true;
+
+                // 콜백 안에서 다른 요청을 걸 수 있으므로 목록을 옮긴 뒤 호출
+                std::vector<Callback> pendingCallbacks = std::move(callbacks);
+                for (const auto& callback : pendingCallbacks)
+                {
+                    callback(data);
+                }
+            }
+        };
+
+    private:
+        std::shared_ptr<State> m_state;
+
+    public:
+        AssetRequest() = default;
+        explicit AssetRequest(std::shared_ptr<State> state) :
+            m_state{ std::move(state) }
+        {
+        }
+
+        // 이미 캐시에 있던 데이터
+        static AssetRequest FromData(std::shared_ptr<T> data)
+        {
+            auto state = std::make_shared<State>();
+            state->data = std::move(data);
+            state->isDone = true;
+
+            return AssetRequest{ std::move(state) };
+        }
+
+    public:
+        bool IsValid() const
+        {
+            return m_state != nullptr;
+        }
+
+        bool IsReady() const
+        {
+            return m_state != nullptr && m_state->isDone;
+        }
+
+        std::shared_ptr<T> Get() const
+        {
+            return m_state != nullptr ? m_state->data : nullptr;
+        }
+
+        // 로드가 끝나면 메인 스레드에서 호출 (이미 끝났으면 바로 호출)
+        // 요청한 객체가 먼저 지워질 수 있으므로 this 대신 핸들을 캡처해야 함
+        void Then(Callback callback) const
+        {
+            if (m_state == nullptr)
+            {
+                return;
+            }
+
+            if (m_state->isDone)
+            {
+                callback(m_state->data);
+                return;
+            }
+
+            m_state->callbacks.push_back(std::move(callback));
+        }
+    };
+}
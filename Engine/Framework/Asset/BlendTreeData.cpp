@@ -0,0 +1,275 @@
+﻿#include "EnginePCH.h"
+#include "BlendTreeData.h"
+
+#include <fstream>
+#include <numeric>
+
+namespace engine
+{
+    namespace
+    {
+        std::int32_t FindName(const std::vector<std::string>& names, const std::string& name)
+        {
+            for (std::size_t i = 0; i < names.size(); ++i)
+            {
+                if (names[i] == name)
+                {
+                    return static_cast<std::int32_t>(i);
+                }
+            }
+
+            return -1;
+        }
+    }
+
+    void BlendTreeData::Create(const std::string& filePath)
+    {
+        std::ifstream i{ filePath };
+        if (!i.is_open())
+        {
+            LOG_INFO("{} 파일 열기 실패", filePath);
+
+            return;
+        }
+
+        json j;
+        i >> j;
+        i.close();
+
+        if (j.contains("parameters"))
+        {
+            for (const auto& [name, value] : j["parameters"].items())
+            {
+                m_parameterNames.push_back(name);
+                m_defaultParameters.push_back(value.get<float>());
+            }
+        }
+
+        if (j.contains("masks"))
+        {
+            for (const auto& [name, bones] : j["masks"].items())
+            {
+                BlendTreeMask mask;
+                mask.name = name;
+
+                for (const auto& bone : bones)
+                {
+                    mask.bones.emplace_back(bone["bone"].get<std::string>(), bone.value("weight", 1.0f));
+                }
+
+                m_masks.push_back(std::move(mask));
+            }
+        }
+
+        // 노드끼리 이름으로 참조하므로 이름부터 모아둠
+        std::vector<std::string> nodeNames;
+        for (const auto& [name, node] : j["nodes"].items())
+        {
+            nodeNames.push_back(name);
+        }
+
+        std::vector<std::string> maskNames;
+        for (const auto& mask : m_masks)
+        {
+            maskNames.push_back(mask.name);
+        }
+
+        auto findNode = [&nodeNames](const json& node, const char* key)
+            {
+                return node.contains(key) ? FindName(nodeNames, node[key].get<std::string>()) : -1;
+            };
+
+        auto findParameter = [this](const json& node, const char* key)
+            {
+                return node.contains(key) ? FindName(m_parameterNames, node[key].get<std::string>()) : -1;
+            };
+
+        m_nodes.reserve(nodeNames.size());
+
+        for (const auto& [name, jj] : j["nodes"].items())
+        {
+            BlendTreeNode node;
+            node.name = name;
+
+            const std::string type = jj["type"];
+
+            if (type == "Clip")
+            {
+                node.type = BlendTreeNodeType::Clip;
+
+                if (jj["clip"].is_string())
+                {
+                    node.clipName = jj["clip"];
+                }
+                else
+                {
+                    node.clipIndex = jj["clip"];
+                }
+
+                node.speed = jj.value("speed", 1.0f);
+                node.isLoop = jj.value("loop", true);
+            }
+            else if (type == "BlendSpace1D" || type == "BlendSpace2D")
+            {
+                const bool is2D = type == "BlendSpace2D";
+
+                node.type = is2D ? BlendTreeNodeType::BlendSpace2D : BlendTreeNodeType::BlendSpace1D;
+                node.parameterX = findParameter(jj, is2D ? "parameterX" : "parameter");
+                node.parameterY = is2D ? findParameter(jj, "parameterY") : -1;
+
+                for (const auto& child : jj["children"])
+                {
+                    node.children.push_back(findNode(child, "node"));
+
+                    if (is2D)
+                    {
+                        node.positions.emplace_back(child["position"][0].get<float>(), child["position"][1].get<float>());
+                    }
+                    else
+                    {
+                        node.positions.emplace_back(child["position"].get<float>(), 0.0f);
+                    }
+                }
+
+                // 1D는 구간 탐색을 위해 position 순으로 정렬
+                if (!is2D)
+                {
+                    std::vector<std::size_t> order(node.children.size());
+                    std::iota(order.begin(), order.end(), 0);
+                    std::sort(order.begin(), order.end(),
+                        [&node](std::size_t a, std::size_t b)
+                        {
+                            return node.positions[a].x < node.positions[b].x;
+                        });
+
+                    std::vector<std::int32_t> children;
+                    std::vector<Vector2> positions;
+                    for (std::size_t index : order)
+                    {
+                        children.push_back(node.children[index]);
+                        positions.push_back(node.positions[index]);
+                    }
+
+                    node.children.swap(children);
+                    node.positions.swap(positions);
+                }
+            }
+            else if (type == "Layer")
+            {
+                node.type = BlendTreeNodeType::Layer;
+                node.base = findNode(jj, "base");
+                node.layer = findNode(jj, "layer");
+                node.reference = findNode(jj, "reference");
+                node.mask = jj.contains("mask") ? FindName(maskNames, jj["mask"].get<std::string>()) : -1;
+                node.weightParameter = findParameter(jj, "weightParameter");
+                node.weight = jj.value("weight", 1.0f);
+                node.isAdditive = jj.value("additive", false);
+            }
+            else
+            {
+                LOG_INFO("{}: 알 수 없는 노드 타입 {}", filePath, type);
+            }
+
+            m_nodes.push_back(std::move(node));
+        }
+
+        m_root = findNode(j, "root");
+
+        if (!IsValid())
+        {
+            LOG_INFO("{}: 잘못된 블렌드 트리", filePath);
+
+            m_root = -1;
+        }
+    }
+
+    const std::vector<std::string>& BlendTreeData::GetParameterNames() const
+    {
+        return m_parameterNames;
+    }
+
+    const std::vector<float>& BlendTreeData::GetDefaultParameters() const
+    {
+        return m_defaultParameters;
+    }
+
+    std::int32_t BlendTreeData::GetParameterIndex(const std::string& name) const
+    {
+        return FindName(m_parameterNames, name);
+    }
+
+    const std::vector<BlendTreeMask>& BlendTreeData::GetMasks() const
+    {
+        return m_masks;
+    }
+
+    const std::vector<BlendTreeNode>& BlendTreeData::GetNodes() const
+    {
+        return m_nodes;
+    }
+
+    std::int32_t BlendTreeData::GetRoot() const
+    {
+        return m_root;
+    }
+
+    bool BlendTreeData::IsValid() const
+    {
+        const std::int32_t nodeCount = static_cast<std::int32_t>(m_nodes.size());
+
+        if (m_root < 0 || m_root >= nodeCount)
+        {
+            return false;
+        }
+
+        // 0: 방문 전, 1: 방문 중, 2: 완료 (방문 중인 노드를 다시 만나면 순환)
+        std::vector<std::uint8_t> states(nodeCount, 0);
+
+        auto visit = [&](auto&& self, std::int32_t index) -> bool
+            {
+                if (index < 0 || index >= nodeCount || states[index] == 1)
+                {
+                    return false;
+                }
+
+                if (states[index] == 2)
+                {
+                    return true;
+                }
+
+                states[index] = 1;
+
+                const auto& node = m_nodes[index];
+                bool isValid = true;
+
+                switch (node.type)
+                {
+                case BlendTreeNodeType::Clip:
+                    isValid = !node.clipName.empty() || node.clipIndex >= 0;
+                    break;
+
+                case BlendTreeNodeType::BlendSpace1D:
+                case BlendTreeNodeType::BlendSpace2D:
+                    isValid = !node.children.empty() && node.parameterX != -1 &&
+                        (node.type == BlendTreeNodeType::BlendSpace1D || node.parameterY != -1);
+
+                    for (std::int32_t child : node.children)
+                    {
+                        isValid = isValid && self(self, child);
+                    }
+                    break;
+
+                case BlendTreeNodeType::Layer:
+                    isValid = self(self, node.base) && self(self, node.layer) &&
+                        (node.reference == -1 || m_nodes[node.reference].type == BlendTreeNodeType::Clip);
+                    break;
+                }
+
+                states[index] = 2;
+
+                return isValid;
+            };
+
+        return visit(visit, m_root);
+    }
+}
@@ -0,0 +1,94 @@
+﻿#pragma once
+
+#include "Framework/Asset/AssetData.h"
+
+namespace engine
+{
+    // JSON 형식
+    // {
+    //     "parameters": { "Speed": 0.0, "Aim": 1.0 },
+    //     "masks": { "UpperBody": [ { "bone": "mixamorig:Spine", "weight": 1.0 } ] }, // 지정한 본과 그 자식들
+    //     "root": "Layered",
+    //     "nodes": {
+    //         "Idle": { "type": "Clip", "clip": "Idle", "speed": 1.0, "loop": true }, // clip은 이름 또는 번호
+    //         "Walk": { "type": "Clip", "clip": 1 },
+    //         "Locomotion": { "type": "BlendSpace1D", "parameter": "Speed",
+    //             "children": [ { "node": "Idle", "position": 0.0 }, { "node": "Walk", "position": 1.0 } ] },
+    //         "Strafe": { "type": "BlendSpace2D", "parameterX": "X", "parameterY": "Y",
+    //             "children": [ { "node": "Walk", "position": [ 0.0, 1.0 ] }, ... ] },
+    //         "Layered": { "type": "Layer", "base": "Locomotion", "layer": "Wave", "mask": "UpperBody",
+    //             "weight": 1.0, "weightParameter": "Aim", "additive": false, "reference": "Idle" } // reference는 additive일 때 기준 Clip (없으면 바인드 포즈)
+    //     }
+    // }
+    enum class BlendTreeNodeType
+    {
+        Clip,
+        BlendSpace1D,
+        BlendSpace2D,
+        Layer
+    };
+
+    struct BlendTreeNode
+    {
+        std::string name;
+        BlendTreeNodeType type = BlendTreeNodeType::Clip;
+
+        // Clip
+        std::string clipName;
+        std::int32_t clipIndex = -1; // clipName이 비어있으면 사용
+        float speed = 1.0f;
+        bool isLoop = true;
+
+        // BlendSpace1D / BlendSpace2D (1D는 x만 사용, position 순으로 정렬됨)
+        std::int32_t parameterX = -1;
+        std::int32_t parameterY = -1;
+        std::vector<std::int32_t> children;
+        std::vector<Vector2> positions;
+
+        // Layer
+        std::int32_t base = -1;
+        std::int32_t layer = -1;
+        std::int32_t mask = -1;
+        std::int32_t weightParameter = -1;
+        std::int32_t reference = -1;
+        float weight = 1.0f;
+        bool isAdditive = false;
+    };
+
+    struct BlendTreeMaskBone
+    {
+        std::string boneName;
+        float weight = 1.0f;
+    };
+
+    struct BlendTreeMask
+    {
+        std::string name;
+        std::vector<BlendTreeMaskBone> bones;
+    };
+
+    class BlendTreeData :
+        public AssetData
+    {
+    private:
+        std::vector<std::string> m_parameterNames;
+        std::vector<float> m_defaultParameters;
+        std::vector<BlendTreeMask> m_masks;
+        std::vector<BlendTreeNode> m_nodes;
+        std::int32_t m_root = -1;
+
+    public:
+        void Create(const std::string& filePath);
+
+    public:
+        const std::vector<std::string>& GetParameterNames() const;
+        const std::vector<float>& GetDefaultParameters() const;
+        std::int32_t GetParameterIndex(const std::string& name) const;
+        const std::vector<BlendTreeMask>& GetMasks() const;
+        const std::vector<BlendTreeNode>& GetNodes() const;
+        std::int32_t GetRoot() const;
+
+    private:
+        bool IsValid() const;
+    };
+}
@@ -0,0 +1,107 @@
+﻿#include "EnginePCH.h"
+#include "CookedAsset.h"
+
+namespace engine
+{
+    std::uint64_t ComputeCookedSourceHash(std::span<const std::byte> bytes)
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+
+        for (const std::byte b : bytes)
+        {
+            hash ^= static_cast<std::uint64_t>(b);
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    void CookedAssetWriter::WriteString(const std::string& value)
+    {
+        Write(static_cast<std::uint32_t>(value.size()));
+        WriteBytes(value.data(), value.size());
+    }
+
+    const std::vector<std::byte>& CookedAssetWriter::GetData() const
+    {
+        return m_data;
+    }
+
+    void CookedAssetWriter::WriteBytes(const void* data, std::size_t size)
+    {
+        if (size == 0)
+        {
+            return;
+        }
+
+        const std::size_t offset = m_data.size();
+        m_data.resize(offset + size);
+        std::memcpy(m_data.data() + offset, data, size);
+    }
+
+    CookedAssetReader::CookedAssetReader(std::span<const std::byte> data) :
+        m_data{ data }
+    {
+    }
+
+    void CookedAssetReader::ReadString(std::string& outValue)
+    {
+        const std::uint32_t size = Read<std::uint32_t>();
+        if (!CanRead(size))
+        {
+            outValue.clear();
+            return;
+        }
+
+        outValue.assign(reinterpret_cast<const char*>(m_data.data() + m_offset), size);
+        m_offset += size;
+    }
+
+    std::uint32_t CookedAssetReader::ReadCount(std::size_t minElementSize)
+    {
+        const std::uint32_t count = Read<std::uint32_t>();
+        if (!CanRead(static_cast<std::size_t>(count) * minElementSize))
+        {
+            return 0;
+        }
+
+        return count;
+    }
+
+    bool CookedAssetReader::IsValid() const
+    {
+        return m_isValid;
+    }
+
+    bool CookedAssetReader::IsAtEnd() const
+    {
+        return m_offset == m_data.size();
+    }
+
+    bool CookedAssetReader::CanRead(std::size_t size)
+    {
+        if (!m_isValid || size > m_data.size() - m_offset)
+        {
+            m_isValid = false;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CookedAssetReader::ReadBytes(void* outData, std::size_t size)
+    {
+        if (!CanRead(size))
+        {
+            return false;
+        }
+
+        if (size > 0)
+        {
+            std::memcpy(outData, m_data.data() + m_offset, size);
+            m_offset += size;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,123 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace engine
+{
+    // 쿠킹된 FBX 캐시 (.cooked)
+    // - Assimp로 임포트한 결과 (메시 / 스켈레톤 / 애니메이션 / 머티리얼)를 그대로 직렬화
+    // - 원본 파일의 크기와 수정 시각이 헤더와 같으면 해시 없이 바로 읽음 (임포트 설정이 바뀌었으면 다시 임포트)
+    //   시각만 다르면 (체크아웃 / 복사) 내용을 해시해서 같을 때 시각만 고쳐 씀, 다르면 다시 임포트하고 덮어씀
+    // - 같은 머신에서 쓰고 읽는 캐시이므로 엔디언 / 패딩은 신경 쓰지 않음 (배포용 포맷 아님)
+    // [헤더][각 AssetData의 Cook 결과를 순서대로]
+    constexpr std::uint32_t CookedAssetMagic = 0x4B4F4F43; // "COOK"
+    constexpr std::uint32_t CookedAssetVersion = 4; // 임포트 옵션이나 AssetData 멤버가 바뀌면 올림
+
+    struct CookedAssetHeader
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t kind; // FBXAssetKind
+        std::uint32_t importSettingsHash; // FBXImportSettings::GetHash
+        std::uint64_t sourceSize;
+        std::uint64_t sourceHash;
+        std::int64_t sourceWriteTime; // std::filesystem::file_time_type의 tick
+    };
+
+    // 원본 파일 내용의 64비트 FNV-1a
+    std::uint64_t ComputeCookedSourceHash(std::span<const std::byte> bytes);
+
+    class CookedAssetWriter
+    {
+    private:
+        std::vector<std::byte> m_data;
+
+    public:
+        template <typename T>
+        void Write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            WriteBytes(&value, sizeof(T));
+        }
+
+        // 개수 + 내용
+        template <typename T>
+        void WriteArray(const std::vector<T>& values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            Write(static_cast<std::uint32_t>(values.size()));
+            WriteBytes(values.data(), values.size() * sizeof(T));
+        }
+
+        void WriteString(const std::string& value);
+
+        const std::vector<std::byte>& GetData() const;
+
+    private:
+        void WriteBytes(const void* data, std::size_t size);
+    };
+
+    // 범위를 벗어나면 그 뒤로는 기본값만 돌려주고 IsValid가 false (잘린 파일)
+    class CookedAssetReader
+    {
+    private:
+        std::span<const std::byte> m_data;
+        std::size_t m_offset = 0;
+        bool m_isValid = true;
+
+    public:
+        explicit CookedAssetReader(std::span<const std::byte> data);
+
+    public:
+        template <typename T>
+        void Read(T& outValue)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            if (!ReadBytes(&outValue, sizeof(T)))
+            {
+                outValue = T{};
+            }
+        }
+
+        template <typename T>
+        T Read()
+        {
+            T value;
+            Read(value);
+            return value;
+        }
+
+        template <typename T>
+        void ReadArray(std::vector<T>& outValues)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            const std::uint32_t count = Read<std::uint32_t>();
+            if (!CanRead(static_cast<std::size_t>(count) * sizeof(T)))
+            {
+                outValues.clear();
+                return;
+            }
+
+            outValues.resize(count);
+            ReadBytes(outValues.data(), outValues.size() * sizeof(T));
+        }
+
+        void ReadString(std::string& outValue);
+
+        // 직접 순회하는 배열의 개수 (요소 하나가 최소 minElementSize바이트라고 보고 남은 크기로 검사)
+        std::uint32_t ReadCount(std::size_t minElementSize);
+
+        bool IsValid() const;
+        bool IsAtEnd() const;
+
+    private:
+        bool CanRead(std::size_t size);
+        bool ReadBytes(void* outData, std::size_t size);
+    };
+}
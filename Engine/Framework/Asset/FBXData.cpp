@@ -5,6 +5,11 @@
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
+#include <fstream>
+
+#include "Common/Utility/MappedFile.h"
+#include "Common/Utility/JsonHelper.h"
+#include "Framework/Asset/CookedAsset.h"
 #include "Framework/Asset/StaticMeshData.h"
 #include "Framework/Asset/MaterialData.h"
 #include "Framework/Asset/SkeletalMeshData.h"
@@ -13,8 +18,115 @@
 
 namespace engine
 {
+    namespace
+    {
+        // 원본 파일이 없으면 false (캐시만 있는 배포본은 지원하지 않음)
+        bool GetSourceStamp(const std::string& filePath, std::uint64_t& outSize, std::int64_t& outWriteTime)
+        {
+            std::error_code ec;
+
+            outSize = std::filesystem::file_size(filePath, ec);
+            if (ec)
+            {
+                return false;
+            }
+
+            const auto writeTime = std::filesystem::last_write_time(filePath, ec);
+            if (ec)
+            {
+                return false;
+            }
+
+            outWriteTime = writeTime.time_since_epoch().count();
+
+            return true;
+        }
+
+        // 파일 전체를 읽으므로 쿠킹할 때와 수정 시각이 바뀐 경우에만 부름
+        bool GetSourceHash(const std::string& filePath, std::uint64_t& outHash)
+        {
+            MappedFile source;
+            if (!source.Open(filePath))
+            {
+                return false;
+            }
+
+            outHash = ComputeCookedSourceHash(source.GetBytes());
+
+            return true;
+        }
+
+        // 실패해도 다음 로드에서 다시 해시할 뿐이므로 무시
+        void UpdateCookedWriteTime(const std::filesystem::path& cookedPath, std::int64_t writeTime)
+        {
+            std::fstream f(cookedPath, std::ios::binary | std::ios::in | std::ios::out);
+            if (!f.is_open())
+            {
+                return;
+            }
+
+            f.seekp(offsetof(CookedAssetHeader, sourceWriteTime));
+            f.write(reinterpret_cast<const char*>(&writeTime), sizeof(writeTime));
+        }
+    }
+
+    FBXImportSettings FBXImportSettings::Load(const std::string& filePath)
+    {
+        FBXImportSettings settings;
+
+        std::ifstream i{ filePath + ".import.json" };
+        if (!i.is_open())
+        {
+            return settings;
+        }
+
+        const json root = json::parse(i, nullptr, false);
+        if (root.is_discarded())
+        {
+            LOG_ERROR("FBXImportSettings - 읽을 수 없는 설정 파일: {}.import.json", filePath);
+            return settings;
+        }
+
+        JsonGet(root, "CompressAnimation", settings.compressAnimation);
+        JsonGet(root, "UncompressedClips", settings.uncompressedClips);
+
+        return settings;
+    }
+
+    std::uint32_t FBXImportSettings::GetHash() const
+    {
+        std::string text = compressAnimation ? "compress;" : "raw;";
+        for (const auto& clip : uncompressedClips)
+        {
+            text += clip;
+            text += ';';
+        }
+
+        const std::uint64_t hash = ComputeCookedSourceHash(std::as_bytes(std::span{ text }));
+
+        return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+    }
+
     void FBXAssetData::Create(FBXAssetKind kind, const std::string& filePath)
     {
+        if (LoadCooked(kind, filePath))
+        {
+            return;
+        }
+
+        Import(kind, filePath);
+
+        if (!SaveCooked(filePath))
+        {
+            LOG_ERROR("FBXAssetData - 쿠킹 실패: {}", filePath);
+        }
+    }
+
+    void FBXAssetData::Import(FBXAssetKind kind, const std::string& filePath)
+    {
+        m_kind = kind;
+        m_importSettings = FBXImportSettings::Load(filePath);
+
         switch (kind)
         {
         case FBXAssetKind::Static:
@@ -24,9 +136,196 @@ namespace engine
         case FBXAssetKind::Skeletal:
             LoadSkeletalMesh(filePath);
             break;
+
+        case FBXAssetKind::CompactStatic:
+            LoadStaticMesh(filePath);
+            m_staticMesh->Compact();
+            break;
         }
     }
 
+    bool FBXAssetData::LoadCooked(FBXAssetKind kind, const std::string& filePath)
+    {
+        const std::filesystem::path cookedPath = GetCookedPath(kind, filePath);
+
+        MappedFile file;
+        if (!file.Open(cookedPath))
+        {
+            return false;
+        }
+
+        const std::span<const std::byte> bytes = file.GetBytes();
+        if (bytes.size() < sizeof(CookedAssetHeader))
+        {
+            return false;
+        }
+
+        CookedAssetHeader header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+
+        FBXImportSettings importSettings = FBXImportSettings::Load(filePath);
+
+        if (header.magic != CookedAssetMagic ||
+            header.version != CookedAssetVersion ||
+            header.kind != static_cast<std::uint32_t>(kind) ||
+            header.importSettingsHash != importSettings.GetHash())
+        {
+            return false;
+        }
+
+        std::uint64_t sourceSize = 0;
+        std::int64_t sourceWriteTime = 0;
+        if (!GetSourceStamp(filePath, sourceSize, sourceWriteTime) || header.sourceSize != sourceSize)
+        {
+            return false;
+        }
+
+        const bool isWriteTimeChanged = header.sourceWriteTime != sourceWriteTime;
+        if (isWriteTimeChanged)
+        {
+            std::uint64_t sourceHash = 0;
+            if (!GetSourceHash(filePath, sourceHash) || header.sourceHash != sourceHash)
+            {
+                return false;
+            }
+        }
+
+        CookedAssetReader reader{ bytes.subspan(sizeof(CookedAssetHeader)) };
+
+        auto material = std::make_shared<MaterialData>();
+
+        switch (kind)
+        {
+        case FBXAssetKind::Static:
+        case FBXAssetKind::CompactStatic:
+        {
+            auto staticMesh = std::make_shared<StaticMeshData>();
+            staticMesh->Create(reader);
+            material->Create(reader);
+
+            if (!reader.IsValid() || !reader.IsAtEnd())
+            {
+                return false;
+            }
+
+            m_staticMesh = std::move(staticMesh);
+            break;
+        }
+
+        case FBXAssetKind::Skeletal:
+        {
+            auto skeleton = std::make_shared<SkeletonData>();
+            auto skeletalMesh = std::make_shared<SkeletalMeshData>();
+            auto animation = std::make_shared<AnimationData>();
+
+            skeleton->Create(reader);
+            skeletalMesh->Create(reader);
+            material->Create(reader);
+            animation->Create(reader);
+
+            if (!reader.IsValid() || !reader.IsAtEnd())
+            {
+                return false;
+            }
+
+            m_skeleton = std::move(skeleton);
+            m_skeletalMesh = std::move(skeletalMesh);
+            m_animation = std::move(animation);
+            break;
+        }
+        }
+
+        m_kind = kind;
+        m_importSettings = std::move(importSettings);
+        m_material = std::move(material);
+
+        // 내용은 같으므로 다음부터는 해시하지 않도록 (맵을 닫아야 쓸 수 있음)
+        if (isWriteTimeChanged)
+        {
+            file.Close();
+            UpdateCookedWriteTime(cookedPath, sourceWriteTime);
+        }
+
+        return true;
+    }
+
+    bool FBXAssetData::SaveCooked(const std::string& filePath) const
+    {
+        CookedAssetHeader header{};
+        header.magic = CookedAssetMagic;
+        header.version = CookedAssetVersion;
+        header.kind = static_cast<std::uint32_t>(m_kind);
+        header.importSettingsHash = m_importSettings.GetHash();
+
+        if (!GetSourceStamp(filePath, header.sourceSize, header.sourceWriteTime) ||
+            !GetSourceHash(filePath, header.sourceHash))
+        {
+            return false;
+        }
+
+        CookedAssetWriter writer;
+
+        switch (m_kind)
+        {
+        case FBXAssetKind::Static:
+        case FBXAssetKind::CompactStatic:
+            if (!m_staticMesh || !m_material)
+            {
+                return false;
+            }
+
+            m_staticMesh->Cook(writer);
+            m_material->Cook(writer);
+            break;
+
+        case FBXAssetKind::Skeletal:
+            if (!m_skeleton || !m_skeletalMesh || !m_material || !m_animation)
+            {
+                return false;
+            }
+
+            m_skeleton->Cook(writer);
+            m_skeletalMesh->Cook(writer);
+            m_material->Cook(writer);
+            m_animation->Cook(writer);
+            break;
+        }
+
+        std::ofstream o(GetCookedPath(m_kind, filePath), std::ios::binary);
+        if (!o.is_open())
+        {
+            return false;
+        }
+
+        o.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        o.write(reinterpret_cast<const char*>(writer.GetData().data()), static_cast<std::streamsize>(writer.GetData().size()));
+
+        return o.good();
+    }
+
+    std::filesystem::path FBXAssetData::GetCookedPath(FBXAssetKind kind, const std::string& filePath)
+    {
+        // 같은 FBX를 종류별로 따로 임포트하므로 파일을 나눔
+        std::filesystem::path path{ filePath };
+
+        switch (kind)
+        {
+        case FBXAssetKind::Static:
+            path.replace_extension(".static.cooked");
+            break;
+
+        case FBXAssetKind::Skeletal:
+            path.replace_extension(".skeletal.cooked");
+            break;
+
+        case FBXAssetKind::CompactStatic:
+            path.replace_extension(".compact.cooked");
+            break;
+        }
+
+        return path;
+    }
+
     std::shared_ptr<StaticMeshData> FBXAssetData::GetStaticMeshData() const
     {
         return m_staticMesh;
@@ -103,7 +402,12 @@ namespace engine
         m_material->Create(scene);
 
         // animation 생성
+        // 압축은 .import.json에서 켠 경우에만
+        AnimationImportSettings animationSettings;
+        animationSettings.compress = m_importSettings.compressAnimation;
+        animationSettings.uncompressedClips = m_importSettings.uncompressedClips;
+
         m_animation = std::make_shared<AnimationData>();
-        m_animation->Create(scene, m_skeleton);
+        m_animation->Create(scene, m_skeleton, animationSettings);
     }
 }
\ No newline at end of file
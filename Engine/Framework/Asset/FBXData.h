@@ -13,7 +13,21 @@ namespace engine
     enum class FBXAssetKind
     {
         Static,
-        Skeletal
+        Skeletal,
+        CompactStatic // Static과 같지만 메시를 CompactVertex로만 보관 (원본 정밀도 정점은 버림)
+    };
+
+    // FBX 옆의 <파일>.import.json에서 읽는 임포트 설정, 파일이 없으면 기본값
+    // { "CompressAnimation": true, "UncompressedClips": [ "Idle" ] }
+    struct FBXImportSettings
+    {
+        bool compressAnimation = false; // 상수/선형 구간 키를 지우고 양자화 (오차가 생기므로 기본은 끔)
+        std::vector<std::string> uncompressedClips; // compressAnimation이어도 원본 키를 유지할 클립
+
+        static FBXImportSettings Load(const std::string& filePath);
+
+        // .cooked 헤더에 넣어서 설정이 바뀌면 다시 임포트
+        std::uint32_t GetHash() const;
     };
 
     class FBXAssetData :
@@ -21,6 +35,7 @@ namespace engine
     {
     private:
         FBXAssetKind m_kind = FBXAssetKind::Static;
+        FBXImportSettings m_importSettings;
         std::shared_ptr<StaticMeshData> m_staticMesh;
         std::shared_ptr<MaterialData> m_material;
         std::shared_ptr<SkeletalMeshData> m_skeletalMesh;
@@ -28,8 +43,18 @@ namespace engine
         std::shared_ptr<AnimationData> m_animation;
 
     public:
+        // 원본과 맞는 .cooked 파일이 있으면 그것을 읽고, 없으면 Assimp로 임포트한 뒤 .cooked를 씀
         void Create(FBXAssetKind kind, const std::string& filePath);
 
+        // 캐시를 보지 않고 Assimp로 임포트 (벤치마크 / 다시 쿠킹용)
+        void Import(FBXAssetKind kind, const std::string& filePath);
+
+        // 원본 해시나 임포트 설정이 다르거나 파일이 깨졌으면 false
+        bool LoadCooked(FBXAssetKind kind, const std::string& filePath);
+        bool SaveCooked(const std::string& filePath) const;
+
+        static std::filesystem::path GetCookedPath(FBXAssetKind kind, const std::string& filePath);
+
         std::shared_ptr<StaticMeshData> GetStaticMeshData() const;
         std::shared_ptr<MaterialData> GetMaterialData() const;
         std::shared_ptr<SkeletalMeshData> GetSkeletalMeshData() const;
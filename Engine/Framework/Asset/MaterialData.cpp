@@ -7,6 +7,8 @@
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 
+#include "Framework/Asset/CookedAsset.h"
+
 namespace engine
 {
     namespace
@@ -106,6 +108,40 @@ namespace engine
         }
     }
     
+    void MaterialData::Create(CookedAssetReader& reader)
+    {
+        m_materials.resize(reader.ReadCount(sizeof(std::uint32_t) * 2 + sizeof(std::uint64_t)));
+        for (auto& material : m_materials)
+        {
+            const std::uint32_t textureCount = reader.ReadCount(sizeof(std::uint64_t) + sizeof(std::uint32_t));
+            for (std::uint32_t i = 0; i < textureCount; ++i)
+            {
+                const MaterialKey key = reader.Read<MaterialKey>();
+                reader.ReadString(material.texturePaths[key]);
+            }
+
+            reader.Read(material.materialFlags);
+            reader.Read(material.renderType);
+        }
+    }
+
+    void MaterialData::Cook(CookedAssetWriter& writer) const
+    {
+        writer.Write(static_cast<std::uint32_t>(m_materials.size()));
+        for (const auto& material : m_materials)
+        {
+            writer.Write(static_cast<std::uint32_t>(material.texturePaths.size()));
+            for (const auto& [key, path] : material.texturePaths)
+            {
+                writer.Write(key);
+                writer.WriteString(path);
+            }
+
+            writer.Write(material.materialFlags);
+            writer.Write(material.renderType);
+        }
+    }
+
     const std::vector<Material>& MaterialData::GetMaterials() const
     {
         return m_materials;
@@ -6,6 +6,9 @@ struct aiScene;
 
 namespace engine
 {
+    class CookedAssetWriter;
+    class CookedAssetReader;
+
     enum class MaterialKey : std::uint64_t
     {
         BASE_COLOR_TEXTURE         = 1ULL << 0,
@@ -40,6 +43,9 @@ namespace engine
         void Create();
         void Create(const std::string& filePath);
         void Create(const aiScene* scene);
+        void Create(CookedAssetReader& reader);
+
+        void Cook(CookedAssetWriter& writer) const;
 
     public:
         const std::vector<Material>& GetMaterials() const;
@@ -0,0 +1,147 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Common/Utility/CommonTypes.h"
+#include "Common/Utility/JobSystem.h"
+#include "Framework/Asset/AssetRequest.h"
+#include "Framework/Asset/FBXData.h"
+#include "Framework/Asset/PendingLoadMap.h"
+
+namespace engine
+{
+    // 워커에서 임포트 중인 FBX 목록 (AssetManager가 씀)
+    // - 종류(FBXAssetKind)가 다르면 같은 파일이라도 따로 임포트하므로 목록을 나눔
+    // - 같은 파일을 다시 요청하면 진행 중인 로드에 합류하고, 수명은 가장 긴 쪽으로 합침
+    // - TFbx는 Create(kind, filePath)와 GetXXXData()를 가진 타입 (엔진에서는 FBXAssetData)
+    // - 메인 스레드에서만 호출
+    template <typename TFbx>
+    class PendingFbxLoads
+    {
+    public:
+        struct Load
+        {
+            FBXAssetKind kind = FBXAssetKind::Static;
+            std::string filePath;
+            LifeScope scope = LifeScope::Owning; // 여러 번 요청되면 가장 긴 수명
+
+            std::shared_ptr<TFbx> fbx; // 워커에서 채움 (counter가 0이 된 뒤에만 읽음)
+            JobCounter counter;
+
+            // 요청된 것만 만듦
+            std::shared_ptr<typename AssetRequest<StaticMeshData>::State> staticMesh;
+            std::shared_ptr<typename AssetRequest<MaterialData>::State> material;
+            std::shared_ptr<typename AssetRequest<SkeletalMeshData>::State> skeletalMesh;
+            std::shared_ptr<typename AssetRequest<SkeletonData>::State> skeleton;
+            std::shared_ptr<typename AssetRequest<AnimationData>::State> animation;
+        };
+
+    private:
+        static constexpr size_t KindCount = 3;
+        std::array<PendingLoadMap<Load>, KindCount> m_loads; // FBXAssetKind 순서
+
+    public:
+        bool IsEmpty() const
+        {
+            return std::ranges::all_of(m_loads, [](const PendingLoadMap<Load>& loads) { return loads.IsEmpty(); });
+        }
+
+        // 진행 중인 로드를 찾아 수명을 합치고, 없으면 새로 만들어 백그라운드 잡으로 시작
+        Load& GetOrStart(FBXAssetKind kind, const std::string& filePath, LifeScope scope)
+        {
+            auto& loads = GetLoads(kind);
+
+            if (auto load = loads.Find(filePath))
+            {
+                // LifeScope는 Global < Scene < Owning 순서
+                load->scope = std::min(load->scope, scope);
+
+                return *load;
+            }
+
+            auto load = std::make_shared<Load>();
+            load->kind = kind;
+            load->filePath = filePath;
+            load->scope = scope;
+            load->fbx = std::make_shared<TFbx>();
+
+            // .cooked가 있으면 그것을 읽고, 없으면 Assimp로 임포트 (매니저 상태는 건드리지 않음)
+            loads.Start(filePath, load, [](Load& pending)
+                {
+                    pending.fbx->Create(pending.kind, pending.filePath);
+                });
+
+            return *load;
+        }
+
+        // 동기 로드용: 진행 중인 로드를 목록에서 빼고 끝날 때까지 기다림 (없으면 nullptr)
+        // 게시(Complete)는 호출한 쪽이 캐시에 넣은 뒤에 함
+        std::shared_ptr<Load> Finish(FBXAssetKind kind, const std::string& filePath, LifeScope scope)
+        {
+            std::shared_ptr<Load> load = GetLoads(kind).Take(filePath);
+            if (!load)
+            {
+                return nullptr;
+            }
+
+            load->scope = std::min(load->scope, scope);
+
+            // 메인 스레드도 다른 잡을 실행하면서 기다림
+            JobSystem::Get().Wait(load->counter);
+
+            return load;
+        }
+
+        // 임포트가 끝난 로드를 목록에서 빼서 completed 뒤에 붙임
+        void TakeCompleted(std::vector<std::shared_ptr<Load>>& completed)
+        {
+            for (auto& loads : m_loads)
+            {
+                loads.TakeCompleted(completed);
+            }
+        }
+
+    public:
+        template <typename T>
+        static AssetRequest<T> Join(std::shared_ptr<typename AssetRequest<T>::State>& state)
+        {
+            if (!state)
+            {
+                state = std::make_shared<typename AssetRequest<T>::State>();
+            }
+
+            return AssetRequest<T>{ state };
+        }
+
+        // 요청된 것에만 임포트 결과를 넘기고 콜백을 부름
+        static void Complete(Load& load)
+        {
+            const auto& fbx = load.fbx;
+
+            CompleteRequest(load.staticMesh, fbx->GetStaticMeshData());
+            CompleteRequest(load.material, fbx->GetMaterialData());
+            CompleteRequest(load.skeletalMesh, fbx->GetSkeletalMeshData());
+            CompleteRequest(load.skeleton, fbx->GetSkeletonData());
+            CompleteRequest(load.animation, fbx->GetAnimationData());
+        }
+
+    private:
+        PendingLoadMap<Load>& GetLoads(FBXAssetKind kind)
+        {
+            return m_loads[static_cast<size_t>(kind)];
+        }
+
+        template <typename T>
+        static void CompleteRequest(const std::shared_ptr<typename AssetRequest<T>::State>& state, std::shared_ptr<T> data)
+        {
+            if (state)
+            {
+                state->Complete(std::move(data));
+            }
+        }
+    };
+}
@@ -0,0 +1,93 @@
+﻿#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Common/Utility/JobSystem.h"
+
+namespace engine
+{
+    // 경로별로 진행 중인 비동기 로드 목록 (AssetManager / ResourceManager가 같이 씀)
+    // - 같은 경로의 요청은 Find로 진행 중인 로드에 합류시켜 워커 작업이 한 번만 돌게 함
+    // - 목록은 메인 스레드에서만 만지고, 워커는 Start로 넘긴 로드 객체만 채움
+    // - TLoad는 JobCounter counter 멤버를 가져야 함
+    template <typename TLoad>
+    class PendingLoadMap
+    {
+    private:
+        std::unordered_map<std::string, std::shared_ptr<TLoad>> m_loads;
+
+    public:
+        bool IsEmpty() const
+        {
+            return m_loads.empty();
+        }
+
+        std::shared_ptr<TLoad> Find(const std::string& filePath) const
+        {
+            if (auto find = m_loads.find(filePath); find != m_loads.end())
+            {
+                return find->second;
+            }
+
+            return nullptr;
+        }
+
+        // load를 목록에 올리고 work(load)를 백그라운드 잡으로 넘김 (같은 경로가 진행 중이 아닐 때만 호출)
+        // 메인 스레드의 Wait / ParallelFor가 임포트를 대신 실행하지 않음
+        template <typename Work>
+        void Start(const std::string& filePath, std::shared_ptr<TLoad> load, Work work)
+        {
+            JobCounter* counter = &load->counter;
+
+            JobSystem::Get().RunInBackground([load, work = std::move(work)]()
+                {
+                    work(*load);
+                },
+                counter);
+
+            m_loads.emplace(filePath, std::move(load));
+        }
+
+        // 목록에서 빼서 돌려줌 (동기 로드가 기다렸다가 직접 게시할 때)
+        std::shared_ptr<TLoad> Take(const std::string& filePath)
+        {
+            auto find = m_loads.find(filePath);
+            if (find == m_loads.end())
+            {
+                return nullptr;
+            }
+
+            std::shared_ptr<TLoad> load = std::move(find->second);
+            m_loads.erase(find);
+
+            return load;
+        }
+
+        // 워커 작업이 끝난 로드를 목록에서 빼서 completed 뒤에 붙임
+        // 콜백에서 새 요청을 걸 수 있으므로 게시는 뺀 다음에 해야 함
+        void TakeCompleted(std::vector<std::shared_ptr<TLoad>>& completed)
+        {
+            for (auto iter = m_loads.begin(); iter != m_loads.end();)
+            {
+                if (iter->second->counter.IsDone())
+                {
+                    completed.push_back(std::move(iter->second));
+                    iter = m_loads.erase(iter);
+                }
+                else
+                {
+                    ++iter;
+                }
+            }
+        }
+
+        void Clear()
+        {
+            m_loads.clear();
+        }
+    };
+}
@@ -6,6 +6,8 @@
 #include <assimp/postprocess.h>
 
 #include "Framework/Asset/SkeletonData.h"
+#include "Framework/Asset/CookedAsset.h"
+#include "Core/Graphics/Data/VertexCompression.h"
 
 namespace engine
 {
@@ -121,6 +123,53 @@ namespace engine
                 }
             }
         }
+
+        CalculateBounds(skeletonData);
+        ShrinkIndices();
+    }
+
+    void SkeletalMeshData::Create(CookedAssetReader& reader)
+    {
+        reader.Read(m_isRigid);
+        reader.ReadArray(m_boneWeightVertices);
+        reader.ReadArray(m_vertices);
+        reader.ReadArray(m_indices);
+        reader.ReadArray(m_shortIndices);
+
+        m_meshSections.resize(reader.ReadCount(sizeof(std::uint32_t) * 6));
+        for (auto& section : m_meshSections)
+        {
+            reader.ReadString(section.name);
+            reader.Read(section.boneIndex);
+            reader.Read(section.materialIndex);
+            reader.Read(section.vertexOffset);
+            reader.Read(section.indexOffset);
+            reader.Read(section.indexCount);
+        }
+
+        reader.Read(m_bounds);
+    }
+
+    void SkeletalMeshData::Cook(CookedAssetWriter& writer) const
+    {
+        writer.Write(m_isRigid);
+        writer.WriteArray(m_boneWeightVertices);
+        writer.WriteArray(m_vertices);
+        writer.WriteArray(m_indices);
+        writer.WriteArray(m_shortIndices);
+
+        writer.Write(static_cast<std::uint32_t>(m_meshSections.size()));
+        for (const auto& section : m_meshSections)
+        {
+            writer.WriteString(section.name);
+            writer.Write(section.boneIndex);
+            writer.Write(section.materialIndex);
+            writer.Write(section.vertexOffset);
+            writer.Write(section.indexOffset);
+            writer.Write(section.indexCount);
+        }
+
+        writer.Write(m_bounds);
     }
 
     const std::vector<BoneWeightVertex>& SkeletalMeshData::GetBoneWeightVertices() const
@@ -138,13 +187,93 @@ namespace engine
         return m_indices;
     }
 
+    const std::vector<WORD>& SkeletalMeshData::GetShortIndices() const
+    {
+        return m_shortIndices;
+    }
+
+    size_t SkeletalMeshData::GetIndexCount() const
+    {
+        return m_indices.size() + m_shortIndices.size();
+    }
+
     const std::vector<SkeletalMeshSection>& SkeletalMeshData::GetMeshSections() const
     {
         return m_meshSections;
     }
 
+    const DirectX::BoundingBox& SkeletalMeshData::GetBounds() const
+    {
+        return m_bounds;
+    }
+
     bool SkeletalMeshData::IsRigid() const
     {
         return m_isRigid;
     }
+
+    void SkeletalMeshData::CalculateBounds(const std::shared_ptr<SkeletonData>& skeletonData)
+    {
+        // 애니메이션으로 바인드 포즈 밖으로 나가는 부분을 감안한 여유 배율
+        constexpr float animationMargin = 1.5f;
+
+        Vector3 minPoint{ FLT_MAX, FLT_MAX, FLT_MAX };
+        Vector3 maxPoint{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+        if (m_isRigid)
+        {
+            // rigid 버텍스는 노드 로컬 공간이므로 바인드 포즈의 노드 model 행렬로 옮겨서 계산
+            // bone은 부모가 먼저 오도록 정렬되어 있음
+            const auto& bones = skeletonData->GetBones();
+            std::vector<Matrix> bindModels(bones.size());
+
+            for (const auto& bone : bones)
+            {
+                bindModels[bone.index] = bone.parentIndex != -1 ?
+                    bone.relative * bindModels[bone.parentIndex] :
+                    bone.relative;
+            }
+
+            for (const auto& section : m_meshSections)
+            {
+                const Matrix& model = bindModels[section.boneIndex];
+                const size_t begin = static_cast<size_t>(section.vertexOffset);
+                const size_t end = (&section != &m_meshSections.back()) ?
+                    static_cast<size_t>((&section + 1)->vertexOffset) :
+                    m_vertices.size();
+
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const Vector3 position = Vector3::Transform(m_vertices[i].position, model);
+                    minPoint = Vector3::Min(minPoint, position);
+                    maxPoint = Vector3::Max(maxPoint, position);
+                }
+            }
+        }
+        else
+        {
+            for (const auto& vertex : m_boneWeightVertices)
+            {
+                minPoint = Vector3::Min(minPoint, vertex.position);
+                maxPoint = Vector3::Max(maxPoint, vertex.position);
+            }
+        }
+
+        if (minPoint.x > maxPoint.x)
+        {
+            m_bounds = DirectX::BoundingBox({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f });
+            return;
+        }
+
+        m_bounds.Center = (minPoint + maxPoint) * 0.5f;
+        m_bounds.Extents = (maxPoint - minPoint) * 0.5f * animationMargin;
+    }
+
+    void SkeletalMeshData::ShrinkIndices()
+    {
+        if (TryConvertToShortIndices(m_indices, m_shortIndices))
+        {
+            std::vector<DWORD>{}.swap(m_indices);
+        }
+    }
 }
\ No newline at end of file
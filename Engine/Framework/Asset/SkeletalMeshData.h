@@ -8,6 +8,8 @@ struct aiScene;
 namespace engine
 {
     class SkeletonData;
+    class CookedAssetWriter;
+    class CookedAssetReader;
 
     struct SkeletalMeshSection
     {
@@ -27,16 +29,32 @@ namespace engine
         std::vector<CommonVertex> m_vertices; // rigid 용 버텍스
         std::vector<DWORD> m_indices;
         std::vector<SkeletalMeshSection> m_meshSections;
+        DirectX::BoundingBox m_bounds; // 바인드 포즈 기준 모델 공간 AABB
         bool m_isRigid = false;
 
+        std::vector<WORD> m_shortIndices; // 인덱스가 16비트에 들어가면 import 시 옮김 (m_indices는 비움)
+
     public:
         void Create(const aiScene* scene, const std::shared_ptr<SkeletonData>& skeletonData, bool isRigid);
+        void Create(CookedAssetReader& reader);
+
+        void Cook(CookedAssetWriter& writer) const;
 
     public:
         const std::vector<BoneWeightVertex>& GetBoneWeightVertices() const;
         const std::vector<CommonVertex>& GetVertices() const;
+
+        // 16비트에 들어가면 GetShortIndices만 채워져 있음
         const std::vector<DWORD>& GetIndices() const;
+        const std::vector<WORD>& GetShortIndices() const;
+        size_t GetIndexCount() const;
+
         const std::vector<SkeletalMeshSection>& GetMeshSections() const;
+        const DirectX::BoundingBox& GetBounds() const;
         bool IsRigid() const;
+
+    private:
+        void CalculateBounds(const std::shared_ptr<SkeletonData>& skeletonData);
+        void ShrinkIndices();
     };
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include <assimp/mesh.h>
 #include <queue>
 
+#include "Framework/Asset/CookedAsset.h"
+
 namespace engine
 {
     namespace
@@ -77,6 +79,52 @@ namespace engine
         }
     }
 
+    void SkeletonData::Create(CookedAssetReader& reader)
+    {
+        m_bones.resize(reader.ReadCount(sizeof(std::uint32_t) + sizeof(Matrix)));
+        for (auto& bone : m_bones)
+        {
+            reader.ReadString(bone.name);
+            reader.Read(bone.relative);
+            reader.Read(bone.index);
+            reader.Read(bone.parentIndex);
+
+            // 임포트 때와 같이 앞에서부터 채움 (이름이 겹치면 뒤의 것)
+            m_boneMappingTable[bone.name] = bone.index;
+        }
+
+        const std::uint32_t meshCount = reader.ReadCount(sizeof(std::uint32_t) * 2);
+        for (std::uint32_t i = 0; i < meshCount; ++i)
+        {
+            std::string meshName;
+            reader.ReadString(meshName);
+            m_meshMappingTable[meshName] = reader.Read<BoneIndex>();
+        }
+
+        reader.Read(m_boneOffsets);
+    }
+
+    void SkeletonData::Cook(CookedAssetWriter& writer) const
+    {
+        writer.Write(static_cast<std::uint32_t>(m_bones.size()));
+        for (const auto& bone : m_bones)
+        {
+            writer.WriteString(bone.name);
+            writer.Write(bone.relative);
+            writer.Write(bone.index);
+            writer.Write(bone.parentIndex);
+        }
+
+        writer.Write(static_cast<std::uint32_t>(m_meshMappingTable.size()));
+        for (const auto& [meshName, boneIndex] : m_meshMappingTable)
+        {
+            writer.WriteString(meshName);
+            writer.Write(boneIndex);
+        }
+
+        writer.Write(m_boneOffsets);
+    }
+
     const std::vector<BoneInfo>& SkeletonData::GetBones() const
     {
         return m_bones;
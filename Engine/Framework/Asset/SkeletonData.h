@@ -6,6 +6,9 @@ struct aiScene;
 
 namespace engine
 {
+    class CookedAssetWriter;
+    class CookedAssetReader;
+
     constexpr size_t MAX_BONE_NUM = 128;
     using BoneMatrixArray = std::array<DirectX::SimpleMath::Matrix, MAX_BONE_NUM>;
 
@@ -24,8 +27,6 @@ namespace engine
         size_t scale;
     };
 
-    struct BoneAnimation;
-
     struct Bone
     {
         std::string name;
@@ -33,8 +34,6 @@ namespace engine
         Matrix model;
         int parentIndex;
         unsigned int index;
-        const BoneAnimation* boneAnimation = nullptr;
-        LastKeyIndex lastKeyIndex{};
 
         Bone(const std::string& name, int parentIndex, unsigned int index, const Matrix& local)
             : name{ name }, parentIndex{ parentIndex }, index{ index }, local{ local }
@@ -59,6 +58,9 @@ namespace engine
     public:
         void Create(const std::string& filePath);
         void Create(const aiScene* scene);
+        void Create(CookedAssetReader& reader);
+
+        void Cook(CookedAssetWriter& writer) const;
 
     public:
         const std::vector<BoneInfo>& GetBones() const;
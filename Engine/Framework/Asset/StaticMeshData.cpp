@@ -5,6 +5,9 @@
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
+#include "Framework/Asset/CookedAsset.h"
+#include "Core/Graphics/Data/VertexCompression.h"
+
 namespace engine
 {
     void StaticMeshData::Create(const std::string& filePath)
@@ -71,6 +74,9 @@ namespace engine
                 m_indices.push_back(mesh->mFaces[j].mIndices[2]);
             }
         }
+
+        CalculateBounds();
+        ShrinkIndices();
     }
 
     void StaticMeshData::Create(std::vector<CommonVertex>&& vertices, std::vector<DWORD>&& indices)
@@ -78,6 +84,62 @@ namespace engine
         m_vertices = std::move(vertices);
         m_indices = std::move(indices);
         m_meshSections.push_back({ .indexCount = static_cast<UINT>(m_indices.size()) });
+
+        CalculateBounds();
+        ShrinkIndices();
+    }
+
+    void StaticMeshData::Create(CookedAssetReader& reader)
+    {
+        reader.ReadArray(m_vertices);
+        reader.ReadArray(m_compactVertices);
+        reader.ReadArray(m_indices);
+        reader.ReadArray(m_shortIndices);
+
+        m_meshSections.resize(reader.ReadCount(sizeof(std::uint32_t) * 5));
+        for (auto& section : m_meshSections)
+        {
+            reader.ReadString(section.name);
+            reader.Read(section.materialIndex);
+            reader.Read(section.vertexOffset);
+            reader.Read(section.indexOffset);
+            reader.Read(section.indexCount);
+        }
+
+        reader.Read(m_bounds);
+    }
+
+    void StaticMeshData::Cook(CookedAssetWriter& writer) const
+    {
+        writer.WriteArray(m_vertices);
+        writer.WriteArray(m_compactVertices);
+        writer.WriteArray(m_indices);
+        writer.WriteArray(m_shortIndices);
+
+        writer.Write(static_cast<std::uint32_t>(m_meshSections.size()));
+        for (const auto& section : m_meshSections)
+        {
+            writer.WriteString(section.name);
+            writer.Write(section.materialIndex);
+            writer.Write(section.vertexOffset);
+            writer.Write(section.indexOffset);
+            writer.Write(section.indexCount);
+        }
+
+        writer.Write(m_bounds);
+    }
+
+    void StaticMeshData::Compact()
+    {
+        if (m_vertices.empty())
+        {
+            return;
+        }
+
+        m_compactVertices = EncodeCompactVertices(m_vertices);
+
+        // clear는 용량을 남기므로 바꿔서 해제
+        std::vector<CommonVertex>{}.swap(m_vertices);
     }
 
     const std::vector<CommonVertex>& StaticMeshData::GetVertices() const
@@ -85,13 +147,61 @@ namespace engine
         return m_vertices;
     }
 
+    const std::vector<CompactVertex>& StaticMeshData::GetCompactVertices() const
+    {
+        return m_compactVertices;
+    }
+
+    bool StaticMeshData::IsCompact() const
+    {
+        return !m_compactVertices.empty();
+    }
+
     const std::vector<DWORD>& StaticMeshData::GetIndices() const
     {
         return m_indices;
     }
 
+    const std::vector<WORD>& StaticMeshData::GetShortIndices() const
+    {
+        return m_shortIndices;
+    }
+
+    size_t StaticMeshData::GetIndexCount() const
+    {
+        return m_indices.size() + m_shortIndices.size();
+    }
+
     const std::vector<StaticMeshSection>& StaticMeshData::GetMeshSections() const
     {
         return m_meshSections;
     }
+
+    const DirectX::BoundingBox& StaticMeshData::GetBounds() const
+    {
+        return m_bounds;
+    }
+
+    void StaticMeshData::CalculateBounds()
+    {
+        if (m_vertices.empty())
+        {
+            m_bounds = DirectX::BoundingBox({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f });
+            return;
+        }
+
+        DirectX::BoundingBox::CreateFromPoints(
+            m_bounds,
+            m_vertices.size(),
+            &m_vertices[0].position,
+            sizeof(CommonVertex));
+    }
+
+    void StaticMeshData::ShrinkIndices()
+    {
+        if (TryConvertToShortIndices(m_indices, m_shortIndices))
+        {
+            std::vector<DWORD>{}.swap(m_indices);
+        }
+    }
 }
\ No newline at end of file
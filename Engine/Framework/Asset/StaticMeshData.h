@@ -7,6 +7,9 @@ struct aiScene;
 
 namespace engine
 {
+    class CookedAssetWriter;
+    class CookedAssetReader;
+
     struct StaticMeshSection
     {
         std::string name;
@@ -23,15 +26,39 @@ namespace engine
         std::vector<CommonVertex> m_vertices;
         std::vector<DWORD> m_indices;
         std::vector<StaticMeshSection> m_meshSections;
+        DirectX::BoundingBox m_bounds; // 로컬 공간 AABB, import 시 한번 계산
+
+        // import 시 정해짐, 둘 중 하나만 채워짐
+        std::vector<CompactVertex> m_compactVertices; // Compact()를 부른 경우
+        std::vector<WORD> m_shortIndices; // 인덱스가 16비트에 들어가는 경우 (m_indices는 비움)
 
     public:
         void Create(const std::string& filePath);
         void Create(const aiScene* scene);
         void Create(std::vector<CommonVertex>&& vertices, std::vector<DWORD>&& indices);
+        void Create(CookedAssetReader& reader);
+
+        void Cook(CookedAssetWriter& writer) const;
+
+        // 정점을 CompactVertex로 바꾸고 원본을 버림 (import 시, 바운드를 계산한 뒤에)
+        void Compact();
 
     public:
+        // IsCompact면 비어 있음
         const std::vector<CommonVertex>& GetVertices() const;
+        const std::vector<CompactVertex>& GetCompactVertices() const;
+        bool IsCompact() const;
+
+        // 16비트에 들어가면 GetShortIndices만 채워져 있음
         const std::vector<DWORD>& GetIndices() const;
+        const std::vector<WORD>& GetShortIndices() const;
+        size_t GetIndexCount() const;
+
         const std::vector<StaticMeshSection>& GetMeshSections() const;
+        const DirectX::BoundingBox& GetBounds() const;
+
+    private:
+        void CalculateBounds();
+        void ShrinkIndices();
     };
 }
\ No newline at end of file
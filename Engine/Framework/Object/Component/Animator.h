@@ -13,5 +13,8 @@ namespace engine
     public:
         void Initialize() override;
         virtual void Update() = 0;
+
+        // true면 AnimatorSystem이 워커 스레드에서 Update를 호출함 (자기 상태와 읽기 전용 에셋만 건드려야 함)
+        virtual bool CanUpdateInParallel() const { return false; }
     };
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "BoxCollider.h"
 
 #include "Framework/Physics/PhysicsUtility.h"
+#include "Framework/Scene/SceneBinary.h"
 
 namespace engine
 {
@@ -69,4 +70,10 @@ namespace engine
             m_size = Vector3(s[0].get<float>(), s[1].get<float>(), s[2].get<float>());
         }
     }
+
+    void BoxCollider::LoadBinary(const SceneBinaryCollider& record)
+    {
+        Collider::LoadBinary(record);
+        m_size = record.size;
+    }
 }
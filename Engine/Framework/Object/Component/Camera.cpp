@@ -5,93 +5,76 @@
 #include "Framework/Object/Component/Transform.h"
 #include "Framework/System/SystemManager.h"
 #include "Framework/System/CameraSystem.h"
+#include "Framework/Scene/SceneBinary.h"
 
 namespace engine
 {
-    Camera::~Camera()
+    namespace
     {
-        SystemManager::Get().GetCameraSystem().Unregister(this);
+        CameraSystem& GetCameraSystem()
+        {
+            return SystemManager::Get().GetCameraSystem();
+        }
     }
 
-    void Camera::Initialize()
+    Camera::Camera()
     {
-        SystemManager::Get().GetCameraSystem().Register(this);
+        m_slot = GetCameraSystem().CreateSlot(this);
     }
 
-    void Camera::Update()
+    Camera::~Camera()
     {
-        auto transform = GetTransform();
-
-        //if (bool isDirtyThisFrame = transform->IsDirtyThisFrame(); m_isDirty || isDirtyThisFrame)
-        //{
-        //    if (isDirtyThisFrame)
-        //    {
-                Matrix world = transform->GetWorld();
-
-                Vector3 scale;
-                Quaternion rotation;
-                Vector3 translation;
-                world.Decompose(scale, rotation, translation);
-
-                const Vector3 forward = Vector3::Transform(Vector3::UnitZ, rotation);
-                const Vector3 up = Vector3::Transform(Vector3::UnitY, rotation);
-
-                m_world = Matrix::CreateWorld(translation, forward, up);
-            //}
+        auto& cameraSystem = GetCameraSystem();
 
-            // view
-            {
-                m_view = DirectX::XMMatrixLookToLH(translation, forward, up);
-            }
-
-            // projection
-            {
-                if (m_projectionType == ProjectionType::Perspective)
-                {
-                    m_projection = DirectX::XMMatrixPerspectiveFovLH(ToRadian(m_fov), m_width / m_height, m_near, m_far);
-                }
-                else
-                {
-                    const float width = m_width * m_scale;
-                    const float height = m_height * m_scale;
-
-                    m_projection = DirectX::XMMatrixOrthographicLH(width, height, m_near, m_far);
-                }
-            }
-
-            // frustum
-            {
-                m_frustum = DirectX::BoundingFrustum(m_projection);
-                m_frustum.Transform(m_frustum, m_world);
-            }
+        cameraSystem.Unregister(this);
+        cameraSystem.DestroySlot(m_slot);
+    }
 
-        //    m_isDirty = false;
-        //}
+    void Camera::Initialize()
+    {
+        GetCameraSystem().Register(this);
     }
 
     void Camera::OnGui()
     {
-        ImGui::DragFloat("Near", &m_near, 0.1f, 0.01f, 10.0f, "%.3f", ImGuiSliderFlags_AlwaysClamp);
-        ImGui::DragFloat("Far", &m_far, 0.1f, 100.0f, 100000.0f, "%.3f", ImGuiSliderFlags_AlwaysClamp);
-        ImGui::DragFloat("FOV", &m_fov, 0.1f, 1.0f, 179.0f, "%.1f", ImGuiSliderFlags_AlwaysClamp);
+        auto& cameras = GetCameraSystem().m_cameras;
+
+        ImGui::DragFloat("Near", &cameras.Get<CameraSystem::NearColumn>(m_slot), 0.1f, 0.01f, 10.0f, "%.3f", ImGuiSliderFlags_AlwaysClamp);
+        ImGui::DragFloat("Far", &cameras.Get<CameraSystem::FarColumn>(m_slot), 0.1f, 100.0f, 100000.0f, "%.3f", ImGuiSliderFlags_AlwaysClamp);
+        ImGui::DragFloat("FOV", &cameras.Get<CameraSystem::FovColumn>(m_slot), 0.1f, 1.0f, 179.0f, "%.1f", ImGuiSliderFlags_AlwaysClamp);
     }
 
     void Camera::Save(json& j) const
     {
         Object::Save(j);
 
-        j["Near"] = m_near;
-        j["Far"] = m_far;
-        j["FOV"] = m_fov;
+        const auto& cameras = GetCameraSystem().m_cameras;
+
+        j["Near"] = cameras.Get<CameraSystem::NearColumn>(m_slot);
+        j["Far"] = cameras.Get<CameraSystem::FarColumn>(m_slot);
+        j["FOV"] = cameras.Get<CameraSystem::FovColumn>(m_slot);
     }
 
     void Camera::Load(const json& j)
     {
         Object::Load(j);
 
-        JsonGet(j, "Near", m_near);
-        JsonGet(j, "Far", m_far);
-        JsonGet(j, "FOV", m_fov);
+        auto& cameras = GetCameraSystem().m_cameras;
+
+        JsonGet(j, "Near", cameras.Get<CameraSystem::NearColumn>(m_slot));
+        JsonGet(j, "Far", cameras.Get<CameraSystem::FarColumn>(m_slot));
+        JsonGet(j, "FOV", cameras.Get<CameraSystem::FovColumn>(m_slot));
+    }
+
+    void Camera::LoadBinary(const SceneBinaryCamera& record)
+    {
+        m_active = record.active != 0;
+
+        auto& cameras = GetCameraSystem().m_cameras;
+
+        cameras.Get<CameraSystem::NearColumn>(m_slot) = record.nearPlane;
+        cameras.Get<CameraSystem::FarColumn>(m_slot) = record.farPlane;
+        cameras.Get<CameraSystem::FovColumn>(m_slot) = record.fov;
     }
 
     std::string Camera::GetType() const
@@ -101,78 +84,90 @@ namespace engine
 
     void Camera::SetProjectionType(ProjectionType type)
     {
-        m_projectionType = type;
+        GetCameraSystem().m_cameras.Get<CameraSystem::ProjectionTypeColumn>(m_slot) = type;
     }
 
     const Matrix& Camera::GetWorld() const
     {
-        return m_world;
+        return GetCameraSystem().m_cameras.Get<CameraSystem::WorldColumn>(m_slot);
     }
 
     const Matrix& Camera::GetView() const
     {
-        return m_view;
+        return GetCameraSystem().m_cameras.Get<CameraSystem::ViewColumn>(m_slot);
     }
 
     const Matrix& Camera::GetProjection() const
     {
-        return m_projection;
+        return GetCameraSystem().m_cameras.Get<CameraSystem::ProjectionColumn>(m_slot);
     }
 
     const DirectX::BoundingFrustum& Camera::GetFrustum() const
     {
-        return m_frustum;
+        return GetCameraSystem().m_cameras.Get<CameraSystem::FrustumColumn>(m_slot);
     }
 
     Vector3 Camera::GetForward() const
     {
-        return engine::GetForward(m_world);
+        return engine::GetForward(GetWorld());
     }
 
     Vector3 Camera::GetPosition() const
     {
-        return engine::GetTranslation(m_world);
+        return engine::GetTranslation(GetWorld());
     }
 
     void Camera::SetNear(float value)
     {
-        m_near = value;
+        auto& cameras = GetCameraSystem().m_cameras;
 
-        m_isDirty = true;
+        cameras.Get<CameraSystem::NearColumn>(m_slot) = value;
+
+        cameras.Get<CameraSystem::DirtyColumn>(m_slot) = 1;
     }
 
     void Camera::SetFar(float value)
     {
-        m_far = value;
+        auto& cameras = GetCameraSystem().m_cameras;
+
+        cameras.Get<CameraSystem::FarColumn>(m_slot) = value;
 
-        m_isDirty = true;
+        cameras.Get<CameraSystem::DirtyColumn>(m_slot) = 1;
     }
 
     void Camera::SetFov(float degree)
     {
-        m_fov = degree;
+        auto& cameras = GetCameraSystem().m_cameras;
+
+        cameras.Get<CameraSystem::FovColumn>(m_slot) = degree;
 
-        m_isDirty = true;
+        cameras.Get<CameraSystem::DirtyColumn>(m_slot) = 1;
     }
 
     void Camera::SetScale(float scale)
     {
-        m_scale = scale;
+        auto& cameras = GetCameraSystem().m_cameras;
 
-        m_isDirty = true;
+        cameras.Get<CameraSystem::ScaleColumn>(m_slot) = scale;
+
+        cameras.Get<CameraSystem::DirtyColumn>(m_slot) = 1;
     }
 
     void Camera::SetWidth(float width)
     {
-        m_width = width;
+        auto& cameras = GetCameraSystem().m_cameras;
+
+        cameras.Get<CameraSystem::WidthColumn>(m_slot) = width;
 
-        m_isDirty = true;
+        cameras.Get<CameraSystem::DirtyColumn>(m_slot) = 1;
     }
 
     void Camera::SetHeight(float height)
     {
-        m_height = height;
+        auto& cameras = GetCameraSystem().m_cameras;
+
+        cameras.Get<CameraSystem::HeightColumn>(m_slot) = height;
 
-        m_isDirty = true;
+        cameras.Get<CameraSystem::DirtyColumn>(m_slot) = 1;
     }
 }
\ No newline at end of file
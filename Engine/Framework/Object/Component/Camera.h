@@ -4,6 +4,8 @@
 
 namespace engine
 {
+    struct SceneBinaryCamera;
+
     enum class ProjectionType
     {
         Perspective,
@@ -15,34 +17,20 @@ namespace engine
     {
         REGISTER_COMPONENT(Camera)
     private:
-        ProjectionType m_projectionType = ProjectionType::Perspective;
-
-        Matrix m_world; // scale이 제거된 world 행렬
-        Matrix m_view;
-        Matrix m_projection;
-        DirectX::BoundingFrustum m_frustum;
-
-        float m_near = 1.0f;
-        float m_far = 5000.0f;
-        float m_fov = 50.0f;
-        float m_scale = 1.0f; // Orthographic용
-        float m_width = 1.0f;
-        float m_height = 1.0f;
-
-        bool m_isDirty = true;
+        std::int32_t m_slot = -1; // CameraSystem의 데이터 행
 
     public:
-        Camera() = default;
+        Camera();
         ~Camera();
 
     public:
         void Initialize() override;
-        void Update();
 
     public:
         void OnGui() override;
         void Save(json& j) const override;
         void Load(const json& j) override;
+        void LoadBinary(const SceneBinaryCamera& record); // Scene::LoadFromBinary
         std::string GetType() const override;
 
     public:
@@ -61,5 +49,8 @@ namespace engine
         void SetScale(float scale);
         void SetWidth(float width);
         void SetHeight(float height);
+
+    private:
+        friend class CameraSystem;
     };
 }
\ No newline at end of file
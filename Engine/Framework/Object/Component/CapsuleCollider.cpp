@@ -2,6 +2,7 @@
 #include "CapsuleCollider.h"
 
 #include "Framework/Physics/PhysicsUtility.h"
+#include "Framework/Scene/SceneBinary.h"
 
 namespace engine
 {
@@ -109,4 +110,11 @@ namespace engine
             m_height = j["height"].get<float>();
         }
     }
+
+    void CapsuleCollider::LoadBinary(const SceneBinaryCollider& record)
+    {
+        Collider::LoadBinary(record);
+        m_radius = record.radius;
+        m_height = record.height;
+    }
 }
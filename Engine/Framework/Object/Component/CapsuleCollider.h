@@ -49,6 +49,7 @@ namespace engine
         void OnGui() override;
         void Save(json& j) const override;
         void Load(const json& j) override;
+        void LoadBinary(const SceneBinaryCollider& record) override;
         std::string GetType() const override { return "CapsuleCollider"; }
     };
 }
@@ -41,13 +41,18 @@ namespace engine
         PhysicsSystem::Get().UnregisterController(this);
 
         // Controller 해제
+        ReleasePxController();
+
+        Component::OnDestroy();
+    }
+
+    void CharacterController::ReleasePxController()
+    {
         if (m_controller)
         {
             m_controller->release();
             m_controller = nullptr;
         }
-
-        Component::OnDestroy();
     }
 
     // ═══════════════════════════════════════════════════════════════
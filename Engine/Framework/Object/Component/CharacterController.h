@@ -136,6 +136,9 @@ namespace engine
 
         physx::PxController* GetPxController() const { return m_controller; }
 
+        // ControllerManager (물리 씬)를 해제하기 전에 호출 (다음 Awake에서 다시 만듦)
+        void ReleasePxController();
+
         // ═══════════════════════════════════════
         // 직렬화
         // ═══════════════════════════════════════
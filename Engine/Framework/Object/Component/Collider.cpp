@@ -8,6 +8,7 @@
 #include "Framework/Physics/PhysicsUtility.h"
 #include "Framework/Physics/CollisionSystem.h"
 #include "Framework/Scene/SceneManager.h"
+#include "Framework/Scene/SceneBinary.h"
 
 namespace engine
 {
@@ -266,6 +267,15 @@ namespace engine
         }
     }
 
+    void Collider::LoadBinary(const SceneBinaryCollider& record)
+    {
+        m_center = record.center;
+        m_rotation = record.rotation;
+        m_isTrigger = record.isTrigger != 0;
+        m_layer = record.layer;
+        m_collisionMask = record.collisionMask;
+    }
+
     // ═══════════════════════════════════════════════════════════════
     // Protected 헬퍼
     // ═══════════════════════════════════════════════════════════════
@@ -9,6 +9,7 @@ namespace engine
 {
     class Rigidbody;
     class PhysicsMaterial;
+    struct SceneBinaryCollider;
 
     // ═══════════════════════════════════════════════════════════════
     // Collider 기반 클래스
@@ -108,6 +109,8 @@ namespace engine
         void OnGui() override;
         void Save(json& j) const override;
         void Load(const json& j) override;
+        // Scene::LoadFromBinary, 파생 클래스는 자기 모양 값 (size / radius / height)을 더 읽음
+        virtual void LoadBinary(const SceneBinaryCollider& record);
 
     protected:
         // 파생 클래스에서 구현
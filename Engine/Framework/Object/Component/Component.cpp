@@ -1,6 +1,8 @@
 ﻿#include "EnginePCH.h"
 #include "Component.h"
 
+#include <atomic>
+
 #include "Framework/Object/GameObject/GameObject.h"
 #include "Framework/Scene/SceneManager.h"
 #include "Framework/Scene/Scene.h"
@@ -8,6 +10,19 @@
 
 namespace engine
 {
+    namespace
+    {
+        std::atomic<std::uint32_t> g_nextComponentTypeId = 0;
+    }
+
+    std::uint32_t AllocateComponentTypeId()
+    {
+        const std::uint32_t id = g_nextComponentTypeId.fetch_add(1, std::memory_order_relaxed);
+        FATAL_CHECK(id < MAX_COMPONENT_TYPE_NUM, "컴포넌트 타입 수 초과 (ComponentTypeMask 확장 필요)");
+
+        return id;
+    }
+
     GameObject* Component::GetGameObject() const
     {
         return m_owner;
@@ -18,6 +33,11 @@ namespace engine
         return m_owner->GetTransform();
     }
 
+    bool Component::IsActiveSelf() const
+    {
+        return m_active;
+    }
+
     bool Component::IsActive() const
     {
         if (!m_active)
@@ -74,6 +94,11 @@ namespace engine
         m_hasAwoken = true;
     }
 
+    void Component::ResetAwoken()
+    {
+        m_hasAwoken = false;
+    }
+
     bool Component::HasAwoken() const
     {
         return m_hasAwoken;
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Framework/Object/Object.h"
+#include "Framework/Object/Component/ComponentType.h"
 
 namespace engine
 {
@@ -22,10 +23,15 @@ namespace engine
         GameObject* GetGameObject() const;
         Transform* GetTransform() const;
 
+        bool IsActiveSelf() const;
         bool IsActive() const override;
         void SetActive(bool active) override;
         void MarkAsAwoken();
+        // 에디터 Play를 끝낼 때 (다음 Play에서 Awake를 다시 부름)
+        void ResetAwoken();
         bool HasAwoken() const;
+        // ResetAwoken 직후 호출 (Save에 없는 런타임 상태를 Load 직후로 되돌림)
+        virtual void ResetRuntimeState() {}
 
         virtual void Initialize() {}
         virtual void Awake() {} // Initialize 직후 호출
@@ -33,9 +39,21 @@ namespace engine
         virtual void OnDestroy() {};
         bool IsPendingKill() const;
 
+        // REGISTER_COMPONENT / COMPONENT_TYPE가 재정의 (0이면 GetComponent로 못 찾음)
+        virtual ComponentTypeMask GetTypeMask() const { return 0; }
+
     private:
         template <typename T>
         friend class System;
         friend class GameObject;
     };
+
+    // dynamic_cast 대신 타입 마스크로 확인
+    template <LookupComponent T>
+    T* ComponentCast(Component* component)
+    {
+        const ComponentTypeMask bit = ComponentTypeMask{ 1 } << GetComponentTypeId<T>();
+
+        return (component->GetTypeMask() & bit) != 0 ? static_cast<T*>(component) : nullptr;
+    }
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include "Common/Utility/Singleton.h"
+#include "Framework/Object/Component/ComponentType.h"
 
 namespace engine
 {
@@ -32,6 +33,7 @@ namespace engine
     };
 
 #define REGISTER_COMPONENT(type)                                        \
+    COMPONENT_TYPE(type)                                                \
     private:                                                            \
         struct Registrar                                                \
         {                                                               \
@@ -0,0 +1,112 @@
+﻿#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+namespace engine
+{
+    class Transform;
+    class Renderer;
+    class Collider;
+    class Animator;
+    class UIElement;
+    class ScriptBase;
+
+    // 컴포넌트 타입 번호 (0 ~ 63)와 타입 마스크
+    // 마스크는 자기 타입 비트 + 아래 베이스 타입 중 상속한 것들의 비트
+    // GetComponent<T>가 dynamic_cast 없이 비트 검사 + 표 조회로 끝남
+    using ComponentTypeMask = std::uint64_t;
+    constexpr std::uint32_t MAX_COMPONENT_TYPE_NUM = 64;
+
+    template <typename... Types>
+    struct ComponentTypeList {};
+
+    // GetComponent<Base>로 파생 컴포넌트를 찾을 수 있는 베이스 타입들
+    using ComponentBaseTypes = ComponentTypeList<Transform, Renderer, Collider, Animator, UIElement, ScriptBase>;
+
+    // 처음 요청된 순서대로 번호를 줌 (실행마다 달라질 수 있으므로 저장하면 안 됨)
+    std::uint32_t AllocateComponentTypeId();
+
+    template <typename T>
+    std::uint32_t GetComponentTypeId()
+    {
+        static const std::uint32_t id = AllocateComponentTypeId();
+        return id;
+    }
+
+    template <typename T, typename... Bases>
+    ComponentTypeMask MakeComponentTypeMask(ComponentTypeList<Bases...>)
+    {
+        ComponentTypeMask mask = ComponentTypeMask{ 1 } << GetComponentTypeId<T>();
+        ((mask |= std::is_base_of_v<Bases, T> ? ComponentTypeMask{ 1 } << GetComponentTypeId<Bases>() : 0), ...);
+
+        return mask;
+    }
+
+    template <typename T>
+    ComponentTypeMask GetComponentTypeMask()
+    {
+        static const ComponentTypeMask mask = MakeComponentTypeMask<T>(ComponentBaseTypes{});
+        return mask;
+    }
+
+    template <typename T, typename... Bases>
+    consteval bool IsComponentBaseType(ComponentTypeList<Bases...>)
+    {
+        return (std::is_same_v<T, Bases> || ...);
+    }
+
+    // REGISTER_COMPONENT / COMPONENT_TYPE를 선언한 타입이거나 베이스 타입이어야 조회 가능
+    template <typename T>
+    concept LookupComponent = IsComponentBaseType<T>(ComponentBaseTypes{}) ||
+        requires { requires std::is_same_v<typename T::ComponentTypeTag, T>; };
+
+    // GameObject 하나의 타입 번호 -> m_components 인덱스 표
+    // 같은 타입이 여러 개면 앞쪽 컴포넌트 (dynamic_cast로 순회하던 때와 같은 결과)
+    class ComponentLookup
+    {
+    private:
+        ComponentTypeMask m_mask = 0;
+        std::array<std::uint8_t, MAX_COMPONENT_TYPE_NUM> m_indices{};
+
+    public:
+        void Add(ComponentTypeMask typeMask, std::size_t index)
+        {
+            ComponentTypeMask newTypes = typeMask & ~m_mask;
+            m_mask |= newTypes;
+
+            while (newTypes != 0)
+            {
+                m_indices[std::countr_zero(newTypes)] = static_cast<std::uint8_t>(index);
+                newTypes &= newTypes - 1;
+            }
+        }
+
+        void Clear()
+        {
+            m_mask = 0;
+        }
+
+        bool Has(std::uint32_t typeId) const
+        {
+            return (m_mask & (ComponentTypeMask{ 1 } << typeId)) != 0;
+        }
+
+        // Has가 true일 때만 유효
+        std::size_t Find(std::uint32_t typeId) const
+        {
+            return m_indices[typeId];
+        }
+    };
+
+    // 팩토리에 등록하지 않는 컴포넌트(Transform 등)는 이것만 선언
+#define COMPONENT_TYPE(type)                                            \
+    public:                                                             \
+        using ComponentTypeTag = type;                                  \
+        engine::ComponentTypeMask GetTypeMask() const override          \
+        {                                                               \
+            return engine::GetComponentTypeMask<type>();                \
+        }
+}
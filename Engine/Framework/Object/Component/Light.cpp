@@ -3,6 +3,7 @@
 
 #include "Framework/System/SystemManager.h"
 #include "Framework/System/LightSystem.h"
+#include "Framework/Scene/SceneBinary.h"
 
 void to_json(nlohmann::ordered_json& j, engine::LightType type)
 {
@@ -16,136 +17,164 @@ void from_json(const nlohmann::ordered_json& j, engine::LightType& type)
 
 namespace engine
 {
+	namespace
+	{
+		LightSystem& GetLightSystem()
+		{
+			return SystemManager::Get().GetLightSystem();
+		}
+	}
+
+	Light::Light()
+	{
+		m_slot = GetLightSystem().CreateSlot(this);
+	}
+
 	Light::~Light()
 	{
-		SystemManager::Get().GetLightSystem().Unregister(this);
+		auto& lightSystem = GetLightSystem();
+
+		lightSystem.Unregister(this);
+		lightSystem.DestroySlot(m_slot);
 	}
 
 	void Light::Initialize()
 	{
-		SystemManager::Get().GetLightSystem().Register(this);
+		GetLightSystem().Register(this);
 	}
 
 	void Light::SetLightType(LightType lightType)
 	{
-		m_lightType = lightType;
+		GetLightSystem().m_lights.Get<LightSystem::TypeColumn>(m_slot) = lightType;
 	}
 
 	void Light::SetColor(const Vector3& color)
 	{
-		m_color = color;
+		GetLightSystem().m_lights.Get<LightSystem::ColorColumn>(m_slot) = color;
 	}
 
 	void Light::SetIntensity(float intensity)
 	{
-		m_intensity = intensity;
+		GetLightSystem().m_lights.Get<LightSystem::IntensityColumn>(m_slot) = intensity;
 	}
 
 	void Light::SetRange(float range)
 	{
-		m_range = range;
+		GetLightSystem().m_lights.Get<LightSystem::RangeColumn>(m_slot) = range;
 	}
 
 	void Light::SetAngle(float angle)
 	{
-		m_angle = angle;
+		GetLightSystem().m_lights.Get<LightSystem::AngleColumn>(m_slot) = angle;
 	}
 
 	void Light::SetLightNear(float lightNear)
 	{
-		m_lightNear = lightNear;
+		GetLightSystem().m_lights.Get<LightSystem::NearColumn>(m_slot) = lightNear;
 	}
 
 	void Light::SetLightFar(float lightFar)
 	{
-		m_lightFar = lightFar;
+		GetLightSystem().m_lights.Get<LightSystem::FarColumn>(m_slot) = lightFar;
 	}
 
 	void Light::SetForwardDist(float forwardDist)
 	{
-		m_lightForwardDist = forwardDist;
+		GetLightSystem().m_lights.Get<LightSystem::ForwardDistColumn>(m_slot) = forwardDist;
 	}
 
 	void Light::SetHeightRatio(float heightRatio)
 	{
-		m_lightHeightRatio = heightRatio;
+		GetLightSystem().m_lights.Get<LightSystem::HeightRatioColumn>(m_slot) = heightRatio;
 	}
 
 	LightType Light::GetLightType() const
 	{
-		return m_lightType;
+		return GetLightSystem().m_lights.Get<LightSystem::TypeColumn>(m_slot);
 	}
 
 	const Vector3& Light::GetColor() const
 	{
-		return m_color;
+		return GetLightSystem().m_lights.Get<LightSystem::ColorColumn>(m_slot);
 	}
 
 	float Light::GetIntensity() const
 	{
-		return m_intensity;
+		return GetLightSystem().m_lights.Get<LightSystem::IntensityColumn>(m_slot);
 	}
 
 	float Light::GetRange() const
 	{
-		return m_range;
+		return GetLightSystem().m_lights.Get<LightSystem::RangeColumn>(m_slot);
 	}
 
 	float Light::GetAngle() const
 	{
-		return m_angle;
+		return GetLightSystem().m_lights.Get<LightSystem::AngleColumn>(m_slot);
 	}
 
 	float Light::GetLightNear() const
 	{
-		return m_lightNear;
+		return GetLightSystem().m_lights.Get<LightSystem::NearColumn>(m_slot);
 	}
 
 	float Light::GetLightFar() const
 	{
-		return m_lightFar;
+		return GetLightSystem().m_lights.Get<LightSystem::FarColumn>(m_slot);
 	}
 
 	float Light::GetForwardDist() const
 	{
-		return m_lightForwardDist;
+		return GetLightSystem().m_lights.Get<LightSystem::ForwardDistColumn>(m_slot);
 	}
 
 	float Light::GetHeightRatio() const
 	{
-		return m_lightHeightRatio;
+		return GetLightSystem().m_lights.Get<LightSystem::HeightRatioColumn>(m_slot);
 	}
 
 	void Light::OnGui()
 	{
+		auto& lights = GetLightSystem().m_lights;
+
+		auto& lightType = lights.Get<LightSystem::TypeColumn>(m_slot);
+		auto& color = lights.Get<LightSystem::ColorColumn>(m_slot);
+		auto& intensity = lights.Get<LightSystem::IntensityColumn>(m_slot);
+		auto& range = lights.Get<LightSystem::RangeColumn>(m_slot);
+		auto& angle = lights.Get<LightSystem::AngleColumn>(m_slot);
+		auto& lightNear = lights.Get<LightSystem::NearColumn>(m_slot);
+		auto& lightFar = lights.Get<LightSystem::FarColumn>(m_slot);
+		auto& forwardDist = lights.Get<LightSystem::ForwardDistColumn>(m_slot);
+		auto& heightRatio = lights.Get<LightSystem::HeightRatioColumn>(m_slot);
+
 		// Light Type
 		static const char* lightTypes[] = { "Directional", "Point", "Spot" };
-		int currentType = static_cast<int>(m_lightType);
+		int currentType = static_cast<int>(lightType);
 		if (ImGui::Combo("Type", &currentType, lightTypes, IM_ARRAYSIZE(lightTypes)))
 		{
-			m_lightType = static_cast<LightType>(currentType);
+			lightType = static_cast<LightType>(currentType);
 		}
 		// Common Properties
-		ImGui::ColorEdit3("Color", &m_color.x);
-		ImGui::DragFloat("Intensity", &m_intensity, 0.1f, 0.0f, 100.0f, "%.1f", ImGuiSliderFlags_AlwaysClamp);
+		ImGui::ColorEdit3("Color", &color.x);
+		ImGui::DragFloat("Intensity", &intensity, 0.1f, 0.0f, 100.0f, "%.1f", ImGuiSliderFlags_AlwaysClamp);
 		// Type Specific Properties
-		if (m_lightType == LightType::Directional)
+		if (lightType == LightType::Directional)
 		{
 			ImGui::SeparatorText("Shadow Frustum Setting");
-			ImGui::DragFloat("Near", &m_lightNear, 1.0f, 1.0f, m_lightFar - 10.0f, "%.0f", ImGuiSliderFlags_AlwaysClamp);
-			ImGui::DragFloat("Far", &m_lightFar, 1.0f, m_lightNear + 10.0f, FLT_MAX, "%.0f", ImGuiSliderFlags_AlwaysClamp);
-			ImGui::DragFloat("FOV", &m_angle, 0.1f, 0.1f, 189.0f, "%.1f", ImGuiSliderFlags_AlwaysClamp);
-			ImGui::DragFloat("Forward Distance", &m_lightForwardDist);
-			ImGui::DragFloat("Height Ratio", &m_lightHeightRatio, 0.01f, 0.01f, 1.0f, "%.2f", ImGuiSliderFlags_AlwaysClamp);
+			ImGui::DragFloat("Near", &lightNear, 1.0f, 1.0f, lightFar - 10.0f, "%.0f", ImGuiSliderFlags_AlwaysClamp);
+			ImGui::DragFloat("Far", &lightFar, 1.0f, lightNear + 10.0f, FLT_MAX, "%.0f", ImGuiSliderFlags_AlwaysClamp);
+			ImGui::DragFloat("FOV", &angle, 0.1f, 0.1f, 189.0f, "%.1f", ImGuiSliderFlags_AlwaysClamp);
+			ImGui::DragFloat("Forward Distance", &forwardDist);
+			ImGui::DragFloat("Height Ratio", &heightRatio, 0.01f, 0.01f, 1.0f, "%.2f", ImGuiSliderFlags_AlwaysClamp);
 		}
 
-		if (m_lightType == LightType::Point || m_lightType == LightType::Spot)
+		if (lightType == LightType::Point || lightType == LightType::Spot)
 		{
-			ImGui::DragFloat("Range", &m_range, 0.1f, 0.0f, FLT_MAX, "%.1f", ImGuiSliderFlags_AlwaysClamp);
+			ImGui::DragFloat("Range", &range, 0.1f, 0.0f, FLT_MAX, "%.1f", ImGuiSliderFlags_AlwaysClamp);
 		}
-		if (m_lightType == LightType::Spot)
+		if (lightType == LightType::Spot)
 		{
-			ImGui::DragFloat("Spot Angle", &m_angle, 0.01f, 0.1f, 189.0f, "%.2f", ImGuiSliderFlags_AlwaysClamp);
+			ImGui::DragFloat("Spot Angle", &angle, 0.01f, 0.1f, 189.0f, "%.2f", ImGuiSliderFlags_AlwaysClamp);
 		}
 	}
 
@@ -153,30 +182,49 @@ namespace engine
 	{
 		Object::Save(j);
 
-		j["LightType"] = m_lightType;
-		j["Color"] = m_color;
-		j["Intensity"] = m_intensity;
-		j["Range"] = m_range;
-		j["Angle"] = m_angle;
-		j["Near"] = m_lightNear;
-		j["Far"] = m_lightFar;
-		j["ForwardDistance"] = m_lightForwardDist;
-		j["HeightRatio"] = m_lightHeightRatio;
+		j["LightType"] = GetLightType();
+		j["Color"] = GetColor();
+		j["Intensity"] = GetIntensity();
+		j["Range"] = GetRange();
+		j["Angle"] = GetAngle();
+		j["Near"] = GetLightNear();
+		j["Far"] = GetLightFar();
+		j["ForwardDistance"] = GetForwardDist();
+		j["HeightRatio"] = GetHeightRatio();
 	}
 
 	void Light::Load(const json& j)
 	{
 		Object::Load(j);
 
-		JsonGet(j, "LightType", m_lightType);
-		JsonGet(j, "Color", m_color);
-		JsonGet(j, "Intensity", m_intensity);
-		JsonGet(j, "Range", m_range);
-		JsonGet(j, "Angle", m_angle);
-		JsonGet(j, "Near", m_lightNear);
-		JsonGet(j, "Far", m_lightFar);
-		JsonGet(j, "ForwardDistance", m_lightForwardDist);
-		JsonGet(j, "HeightRatio", m_lightHeightRatio);
+		auto& lights = GetLightSystem().m_lights;
+
+		JsonGet(j, "LightType", lights.Get<LightSystem::TypeColumn>(m_slot));
+		JsonGet(j, "Color", lights.Get<LightSystem::ColorColumn>(m_slot));
+		JsonGet(j, "Intensity", lights.Get<LightSystem::IntensityColumn>(m_slot));
+		JsonGet(j, "Range", lights.Get<LightSystem::RangeColumn>(m_slot));
+		JsonGet(j, "Angle", lights.Get<LightSystem::AngleColumn>(m_slot));
+		JsonGet(j, "Near", lights.Get<LightSystem::NearColumn>(m_slot));
+		JsonGet(j, "Far", lights.Get<LightSystem::FarColumn>(m_slot));
+		JsonGet(j, "ForwardDistance", lights.Get<LightSystem::ForwardDistColumn>(m_slot));
+		JsonGet(j, "HeightRatio", lights.Get<LightSystem::HeightRatioColumn>(m_slot));
+	}
+
+	void Light::LoadBinary(const SceneBinaryLight& record)
+	{
+		m_active = record.active != 0;
+
+		auto& lights = GetLightSystem().m_lights;
+
+		lights.Get<LightSystem::TypeColumn>(m_slot) = static_cast<LightType>(record.lightType);
+		lights.Get<LightSystem::ColorColumn>(m_slot) = record.color;
+		lights.Get<LightSystem::IntensityColumn>(m_slot) = record.intensity;
+		lights.Get<LightSystem::RangeColumn>(m_slot) = record.range;
+		lights.Get<LightSystem::AngleColumn>(m_slot) = record.angle;
+		lights.Get<LightSystem::NearColumn>(m_slot) = record.nearPlane;
+		lights.Get<LightSystem::FarColumn>(m_slot) = record.farPlane;
+		lights.Get<LightSystem::ForwardDistColumn>(m_slot) = record.forwardDistance;
+		lights.Get<LightSystem::HeightRatioColumn>(m_slot) = record.heightRatio;
 	}
 
 	std::string Light::GetType() const
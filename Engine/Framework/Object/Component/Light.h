@@ -4,6 +4,8 @@
 
 namespace engine
 {
+    struct SceneBinaryLight;
+
     enum class LightType
     {
         Directional,
@@ -17,17 +19,10 @@ namespace engine
         REGISTER_COMPONENT(Light)
 
     private:
-        LightType m_lightType = LightType::Directional;
-        Vector3 m_color{ 1.0f, 1.0f, 1.0f };
-        float m_intensity = 1.0f;
-        float m_lightNear = 90000.0f;
-        float m_lightFar = 100000.0f;
-        float m_lightForwardDist = 1000.0f;
-        float m_lightHeightRatio = 0.9f;
-        float m_range = 10.0f;
-        float m_angle = 45.0f;
+        std::int32_t m_slot = -1; // LightSystem의 데이터 행
 
     public:
+        Light();
         ~Light();
 
         void Initialize() override;
@@ -57,6 +52,10 @@ namespace engine
         void OnGui() override;
         void Save(json& j) const override;
         void Load(const json& j) override;
+        void LoadBinary(const SceneBinaryLight& record); // Scene::LoadFromBinary
         std::string GetType() const override;
+
+    private:
+        friend class LightSystem;
     };
 }
\ No newline at end of file
@@ -5,17 +5,34 @@
 #include <algorithm>
 
 #include "Common/Utility/JsonHelper.h"
+#include "Common/Utility/SlabMemoryPool.h"
 
 #include "Framework/Object/GameObject/GameObject.h"
 #include "Framework/Object/Component/Transform.h"
 
 namespace engine
 {
+    namespace
+    {
+        // Transform 풀과 크기가 달라서 따로 둠
+        SlabMemoryPool<RectTransform, 128> g_rectTransformPool{ "RectTransform" };
+    }
+
     static Vector2 ClampVec2(const Vector2& v, float min, float max)
     {
         return { std::clamp(v.x, min, max), std::clamp(v.y, min, max) };
     }
 
+    void* RectTransform::operator new(size_t size)
+    {
+        return g_rectTransformPool.Allocate(size);
+    }
+
+    void RectTransform::operator delete(void* ptr, size_t size)
+    {
+        g_rectTransformPool.Deallocate(ptr, size);
+    }
+
     const Vector2& RectTransform::GetAnchoredPosition()
     {
         return m_anchoredPosition;
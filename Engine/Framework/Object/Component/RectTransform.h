@@ -18,6 +18,8 @@ namespace engine
 	class RectTransform :
 		public Transform
 	{
+		COMPONENT_TYPE(RectTransform)
+
 	private:
 		Vector2 m_anchoredPosition{ 0.0f, 0.0f };
 		
@@ -36,6 +38,9 @@ namespace engine
 		RectTransform() = default;
 		~RectTransform() override = default;
 
+		static void* operator new(size_t size);
+		static void operator delete(void* ptr, size_t size);
+
 	public:
 		// Getter
 		const Vector2& GetAnchoredPosition();
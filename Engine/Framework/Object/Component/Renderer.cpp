@@ -3,6 +3,8 @@
 
 #include "Framework/System/SystemManager.h"
 #include "Framework/System/RenderSystem.h"
+#include "Framework/System/RenderQueue.h"
+#include "Framework/Object/Component/Transform.h"
 
 namespace engine
 {
@@ -20,4 +22,37 @@ namespace engine
 	{
 		SystemManager::Get().GetRenderSystem().Register(this);
 	}
+
+	const DirectX::BoundingBox& Renderer::GetWorldBounds()
+	{
+		Transform* transform = GetTransform();
+		const Matrix world = transform->GetWorld();
+
+		if (m_isBoundsDirty || m_boundsWorldVersion != transform->GetWorldVersion())
+		{
+			GetBounds().Transform(m_worldBounds, world);
+
+			m_boundsWorldVersion = transform->GetWorldVersion();
+			m_isBoundsDirty = false;
+		}
+
+		return m_worldBounds;
+	}
+
+	void Renderer::MarkBoundsDirty()
+	{
+		m_isBoundsDirty = true;
+
+		SystemManager::Get().GetRenderSystem().QueueBoundsUpdate(this);
+	}
+
+	void Renderer::CollectDrawPackets(RenderType type, RenderQueue& queue) const
+	{
+		DrawPacket packet;
+		packet.renderer = this;
+		packet.type = type;
+		packet.usesRendererDraw = true;
+
+		queue.Add(packet, GetTransform()->GetWorld().Translation());
+	}
 }
\ No newline at end of file
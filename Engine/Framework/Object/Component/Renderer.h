@@ -5,6 +5,10 @@
 
 namespace engine
 {
+	class RenderQueue;
+	class SpriteBatch;
+	class CommandContext;
+
 	enum class RenderType
 	{
 		Shadow,
@@ -21,6 +25,13 @@ namespace engine
 	private:
 		std::array<std::int32_t, static_cast<size_t>(RenderType::Count)> m_systemIndices;
 
+		DirectX::BoundingBox m_worldBounds;
+		std::uint32_t m_boundsWorldVersion = 0;
+		bool m_isBoundsDirty = true;
+
+		std::int32_t m_boundsProxy = -1; // RenderSystem BVH 리프
+		bool m_isBoundsQueued = false; // BVH 갱신 대기 중
+
 	public:
 		Renderer();
 		~Renderer();
@@ -32,11 +43,30 @@ namespace engine
 	public:
 		virtual bool HasRenderType(RenderType type) const = 0;
 		virtual void Draw(RenderType type) const = 0;
-		virtual DirectX::BoundingBox GetBounds() const = 0;
+		virtual DirectX::BoundingBox GetBounds() const = 0; // 로컬 공간 AABB
+
+		// Transform이 바뀐 경우에만 로컬 AABB를 다시 변환함
+		const DirectX::BoundingBox& GetWorldBounds();
+
+		// 로컬 AABB나 Transform이 바뀌면 호출, RenderSystem BVH 갱신 대기열에 들어감
+		void MarkBoundsDirty();
 
 		virtual void DrawMask() const {}
 		virtual void DrawPickingID() const {}
 
+		// RenderQueue용: 그릴 섹션마다 DrawPacket을 추가 (기본은 Draw를 그대로 부르는 packet 하나)
+		virtual void CollectDrawPackets(RenderType type, RenderQueue& queue) const;
+
+		// RenderQueue::Submit에서 packet의 렌더러가 바뀔 때 객체 / 머티리얼 (/ 본) 상수 버퍼를 올림
+		// 워커 스레드의 deferred context나 null 백엔드로도 불리므로 전역 context를 쓰지 말고 렌더러 상태는 읽기만 해야 함
+		virtual void BindConstants(CommandContext& context, RenderType type, std::int32_t boneIndex) const {}
+
+		// 같은 렌더러의 섹션끼리 본 번호만 다를 때 (rigid 스켈레탈 메시)
+		virtual void BindBoneIndex(CommandContext& context, std::int32_t boneIndex) const {}
+
+		// SpriteBatch로 묶을 수 있으면 추가하고 true (CollectDrawPackets / Draw 대신), 아니면 false
+		virtual bool CollectSprite(RenderType type, SpriteBatch& batch) const { return false; }
+
 	private:
 		friend class RenderSystem;
 	};
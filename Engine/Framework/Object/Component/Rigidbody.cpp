@@ -6,6 +6,7 @@
 #include "Framework/Object/GameObject/GameObject.h"
 #include "Framework/Physics/PhysicsSystem.h"
 #include "Framework/Physics/PhysicsUtility.h"
+#include "Framework/Scene/SceneBinary.h"
 
 namespace engine
 {
@@ -358,6 +359,24 @@ namespace engine
         m_hasPendingTeleport = false;
     }
 
+    void Rigidbody::ResetPxActorState()
+    {
+        if (!m_actor)
+        {
+            return;
+        }
+
+        m_actor->setGlobalPose(PhysicsUtility::ToPxTransform(GetTransform()));
+        m_hasPendingTeleport = false;
+
+        physx::PxRigidDynamic* dynamic = m_actor->is<physx::PxRigidDynamic>();
+        if (dynamic && !IsKinematic())
+        {
+            dynamic->setLinearVelocity(physx::PxVec3(0));
+            dynamic->setAngularVelocity(physx::PxVec3(0));
+        }
+    }
+
     // ═══════════════════════════════════════════════════════════════
     // Sleep
     // ═══════════════════════════════════════════════════════════════
@@ -459,6 +478,17 @@ namespace engine
         }
     }
 
+    void Rigidbody::LoadBinary(const SceneBinaryRigidbody& record)
+    {
+        m_type = static_cast<RigidbodyType>(record.type);
+        m_mass = record.mass;
+        m_linearDamping = record.linearDamping;
+        m_angularDamping = record.angularDamping;
+        m_useGravity = record.useGravity != 0;
+        m_constraints = static_cast<RigidbodyConstraints>(record.constraints);
+        m_layer = record.layer;
+    }
+
     // ═══════════════════════════════════════════════════════════════
     // Private
     // ═══════════════════════════════════════════════════════════════
@@ -8,6 +8,7 @@
 namespace engine
 {
     class Collider;
+    struct SceneBinaryRigidbody;
 
     // ═══════════════════════════════════════════════════════════════
     // Rigidbody 타입
@@ -184,6 +185,10 @@ namespace engine
         
         physx::PxRigidActor* GetPxActor() const { return m_actor; }
 
+        // 에디터 Play를 다시 시작할 때 이전 Play의 Actor를 재사용 (Scene에 추가한 뒤 호출)
+        // Transform 위치로 옮기고 남은 속도를 지움
+        void ResetPxActorState();
+
         // ═══════════════════════════════════════
         // 직렬화
         // ═══════════════════════════════════════
@@ -191,6 +196,7 @@ namespace engine
         void OnGui() override;
         void Save(json& j) const override;
         void Load(const json& j) override;
+        void LoadBinary(const SceneBinaryRigidbody& record); // Scene::LoadFromBinary
         std::string GetType() const override { return "Rigidbody"; }
 
     private:
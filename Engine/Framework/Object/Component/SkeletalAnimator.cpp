@@ -3,6 +3,8 @@
 
 #include "Framework/Asset/AssetManager.h"
 #include "Framework/Asset/AnimationData.h"
+#include "Framework/Asset/BlendTreeData.h"
+#include "Framework/Animation/SkinningKernel.h"
 #include "Framework/Object/GameObject/GameObject.h"
 #include "Framework/Object/Component/SkeletalMeshRenderer.h"
 
@@ -18,16 +20,73 @@ namespace engine
         if (auto renderer = GetGameObject()->GetComponent<SkeletalMeshRenderer>())
         {
             SetAnimationData(renderer->GetMeshPath());
-            m_skeletonData = renderer->GetSkeletonData(); // 캐싱
-            m_skeletonData->SetupSkeletonInstance(m_skeleton);
+            SetSkeletonData(renderer->GetSkeletonData()); // 캐싱
         }
     }
 
+    void SkeletalAnimator::ResetRuntimeState()
+    {
+        // Awake가 m_animationData로 초기화 여부를 판단하므로 Load가 채우지 않는 것은 전부 비움
+        m_animationData.reset();
+        m_skeletonData.reset();
+        m_animationPath.clear();
+
+        m_currentAnimIndex = -1;
+        m_nextAnimIndex = -1;
+
+        m_animationProgressTime = 0.0f;
+        m_transitionDuration = 0.0f;
+        m_transitionProgressTime = 0.0f;
+        m_playSpeed = 1.0f;
+
+        m_isPlaying = false;
+        m_isLoop = true;
+
+        m_finalBoneMatrices.fill(Matrix::Identity);
+        m_skeleton.clear();
+
+        m_bindPose = {};
+        m_pose = {};
+        m_nextPose = {};
+        m_keyIndices.clear();
+        m_nextKeyIndices.clear();
+
+        m_blendTree = {};
+    }
+
     void SkeletalAnimator::SetAnimationData(const std::string& path)
     {
         m_animationPath = path;
 
         m_animationData = AssetManager::Get().GetOrCreateAnimationData(path);
+
+        SetupBlendTree(); // 클립 포인터를 다시 잡아야 함
+    }
+
+    void SkeletalAnimator::SetSkeletonData(const std::shared_ptr<SkeletonData>& skeletonData)
+    {
+        m_skeletonData = skeletonData;
+        m_skeletonData->SetupSkeletonInstance(m_skeleton);
+
+        CreateBindPose(m_skeleton, m_bindPose);
+        m_pose = m_bindPose;
+        m_nextPose = m_bindPose;
+        m_keyIndices.assign(m_skeleton.size(), LastKeyIndex{});
+        m_nextKeyIndices.assign(m_skeleton.size(), LastKeyIndex{});
+
+        SetupBlendTree();
+    }
+
+    void SkeletalAnimator::SetBlendTree(const std::string& path)
+    {
+        m_blendTreePath = path;
+
+        SetupBlendTree();
+    }
+
+    void SkeletalAnimator::SetParameter(const std::string& name, float value)
+    {
+        m_blendTree.SetParameter(name, value);
     }
 
     void SkeletalAnimator::Play(int index, bool loop)
@@ -50,7 +109,7 @@ namespace engine
         m_isPlaying = true;
 
         m_nextAnimIndex = -1;
-        animations[index].SetupBoneAnimation(m_skeleton);
+        std::fill(m_keyIndices.begin(), m_keyIndices.end(), LastKeyIndex{});
     }
 
     void SkeletalAnimator::Play(const std::string& animationName, bool loop)
@@ -90,7 +149,8 @@ namespace engine
         m_isLoop = loop;
         m_isPlaying = true;
 
-        animations[index].SetupBoneAnimation(m_skeleton);
+        // 현재 클립은 그대로 두고 다음 클립은 따로 샘플링
+        std::fill(m_nextKeyIndices.begin(), m_nextKeyIndices.end(), LastKeyIndex{});
     }
 
     void SkeletalAnimator::PlayCrossFade(const std::string& animationName, float transitionDuration, bool loop)
@@ -112,6 +172,14 @@ namespace engine
 
     void SkeletalAnimator::Update()
     {
+        if (m_blendTree.IsValid())
+        {
+            m_blendTree.Evaluate(m_playSpeed * Time::DeltaTime(), m_pose);
+            BuildSkinningMatrices(m_pose, m_skeleton, m_skeletonData->GetBoneOffsets(), m_finalBoneMatrices);
+
+            return;
+        }
+
         if (!m_isPlaying || !m_animationData || m_currentAnimIndex == -1)
         {
             return;
@@ -120,8 +188,6 @@ namespace engine
         const float dt = m_playSpeed * Time::DeltaTime();
 
         const auto& animations = m_animationData->GetAnimations();
-        const auto& currentAnim = animations[m_currentAnimIndex];
-        const float duration = currentAnim.duration;
 
         if (m_nextAnimIndex != -1)
         {
@@ -131,9 +197,14 @@ namespace engine
                 m_currentAnimIndex = m_nextAnimIndex;
                 m_nextAnimIndex = -1;
                 m_animationProgressTime = 0.0f;
+
+                m_keyIndices.swap(m_nextKeyIndices);
             }
         }
 
+        const auto& currentAnim = animations[m_currentAnimIndex];
+        const float duration = currentAnim.duration;
+
         m_animationProgressTime += dt;
 
         if (m_animationProgressTime >= duration)
@@ -153,70 +224,26 @@ namespace engine
             return;
         }
 
-        const auto& boneOffsets = m_skeletonData->GetBoneOffsets();
-        for (auto& bone : m_skeleton)
+        SamplePose(currentAnim, m_animationProgressTime, m_bindPose, m_keyIndices, m_pose);
+
+        // Blending (Next Animation이 존재하고 과도기일 때)
+        if (m_nextAnimIndex != -1)
         {
-            Matrix nodeTransform = bone.local;
-            if (m_animationData && m_currentAnimIndex != -1)
-            {
-                Vector3 curPos;
-                Quaternion curRot;
-                Vector3 curScale;
-
-                bool hasCurrent = false;
-                if (bone.boneAnimation) // Play 시점에 캐싱된 채널
-                {
-                    bone.boneAnimation->Evaluate(m_animationProgressTime, bone.lastKeyIndex, curPos, curRot, curScale);
-                    hasCurrent = true;
-                }
-
-                // Blending (Next Animation이 존재하고 과도기일 때)
-                if (m_nextAnimIndex != -1 && hasCurrent)
-                {
-                    const auto& nextAnim = m_animationData->GetAnimations()[m_nextAnimIndex];
-
-                    // Next Animation 채널 찾기 (Map Lookup)
-                    // 최적화를 위해 Bone 구조체에 nextBoneAnimation 포인터를 추가하거나
-                    // 별도 캐시를 쓸 수 있지만 여기선 기본 조회 사용
-                    
-                    if (auto iter = nextAnim.animMappingTable.find(bone.name); iter != nextAnim.animMappingTable.end())
-                    {
-                        const auto& nextChannel = nextAnim.boneAnimations[iter->second];
-
-                        Vector3 nextPos;
-                        Quaternion nextRot;
-                        Vector3 nextScale;
-                        LastKeyIndex tempKeyIndex{}; // Next는 상태 저장 없이 매번 검색 (혹은 별도 관리 필요)
-
-                        nextChannel.Evaluate(m_transitionProgressTime, tempKeyIndex, nextPos, nextRot, nextScale);
-                        // 블렌딩 비율 (0.0 ~ 1.0)
-                        float t = std::clamp(m_transitionProgressTime / m_transitionDuration, 0.0f, 1.0f);
-
-                        curPos = Vector3::Lerp(curPos, nextPos, t);
-                        curRot = Quaternion::Slerp(curRot, nextRot, t);
-                        curScale = Vector3::Lerp(curScale, nextScale, t);
-                    }
-                }
-
-                if (hasCurrent)
-                {
-                    nodeTransform = Matrix::CreateScale(curScale)
-                        * Matrix::CreateFromQuaternion(curRot)
-                        * Matrix::CreateTranslation(curPos);
-                }
-            }
-            
-            if (bone.parentIndex != -1)
-            {
-                bone.model = nodeTransform * m_skeleton[bone.parentIndex].model;
-            }
-            else
-            {
-                bone.model = nodeTransform;
-            }
+            SamplePose(animations[m_nextAnimIndex], m_transitionProgressTime, m_bindPose, m_nextKeyIndices, m_nextPose);
 
-            m_finalBoneMatrices[bone.index] = (boneOffsets[bone.index] * bone.model).Transpose();
+            // 블렌딩 비율 (0.0 ~ 1.0)
+            const float t = std::clamp(m_transitionProgressTime / m_transitionDuration, 0.0f, 1.0f);
+
+            BlendPose(m_pose, m_nextPose, t, {}, m_pose);
         }
+
+        BuildSkinningMatrices(m_pose, m_skeleton, m_skeletonData->GetBoneOffsets(), m_finalBoneMatrices);
+    }
+
+    bool SkeletalAnimator::CanUpdateInParallel() const
+    {
+        // 자기 스켈레톤과 본 행렬만 쓰고 AnimationData / SkeletonData는 읽기만 함
+        return true;
     }
 
     const BoneMatrixArray& SkeletalAnimator::GetFinalBoneMatrices() const
@@ -226,16 +253,44 @@ namespace engine
 
     void SkeletalAnimator::OnGui()
     {
+        ImGui::Text("BlendTree: %s", std::filesystem::path(m_blendTreePath).filename().string().c_str());
+
+        std::string selectedBlendTree;
+        if (DrawFileSelector("Select BlendTree", "Resource/Data", ".json", selectedBlendTree))
+        {
+            SetBlendTree(selectedBlendTree);
+        }
+
+        if (!m_blendTree.IsValid())
+        {
+            return;
+        }
+
+        const auto& parameterNames = m_blendTree.GetBlendTreeData()->GetParameterNames();
+        for (size_t i = 0; i < parameterNames.size(); ++i)
+        {
+            const std::int32_t index = static_cast<std::int32_t>(i);
+
+            float value = m_blendTree.GetParameter(index);
+            if (ImGui::DragFloat(parameterNames[i].c_str(), &value, 0.01f))
+            {
+                m_blendTree.SetParameter(index, value);
+            }
+        }
     }
 
     void SkeletalAnimator::Save(json& j) const
     {
         Object::Save(j);
+
+        j["BlendTreePath"] = m_blendTreePath;
     }
 
     void SkeletalAnimator::Load(const json& j)
     {
         Object::Load(j);
+
+        JsonGet(j, "BlendTreePath", m_blendTreePath);
     }
 
     std::string SkeletalAnimator::GetType() const
@@ -262,4 +317,15 @@ namespace engine
 
         return -1;
     }
+
+    void SkeletalAnimator::SetupBlendTree()
+    {
+        // 스켈레톤이 있어야 바인드 포즈와 마스크를 만들 수 있음
+        if (m_blendTreePath.empty() || m_skeleton.empty())
+        {
+            return;
+        }
+
+        m_blendTree.Setup(AssetManager::Get().GetOrCreateBlendTreeData(m_blendTreePath), m_animationData, m_skeleton, m_bindPose);
+    }
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "Framework/Object/Component/Animator.h"
 #include "Framework/Asset/SkeletonData.h"
+#include "Framework/Animation/AnimationPose.h"
+#include "Framework/Animation/BlendTreeInstance.h"
 
 namespace engine
 {
@@ -16,6 +18,7 @@ namespace engine
         std::shared_ptr<AnimationData> m_animationData;
         std::shared_ptr<SkeletonData> m_skeletonData;
         std::string m_animationPath;
+        std::string m_blendTreePath;
 
         int m_currentAnimIndex = -1;
         int m_nextAnimIndex = -1;
@@ -31,16 +34,31 @@ namespace engine
         BoneMatrixArray m_finalBoneMatrices;
         std::vector<Bone> m_skeleton;
 
+        // 클립 샘플링 -> 블렌딩 -> 스키닝 행렬 순으로 로컬 포즈 버퍼를 거침
+        AnimationPose m_bindPose;
+        AnimationPose m_pose;
+        AnimationPose m_nextPose;
+        std::vector<LastKeyIndex> m_keyIndices;
+        std::vector<LastKeyIndex> m_nextKeyIndices;
+
+        // 설정되어 있으면 Play 대신 블렌드 트리로 포즈를 만듦
+        BlendTreeInstance m_blendTree;
+
     public:
         void Awake() override;
+        void ResetRuntimeState() override;
 
         void SetAnimationData(const std::string& path);
+        void SetSkeletonData(const std::shared_ptr<SkeletonData>& skeletonData);
+        void SetBlendTree(const std::string& path);
+        void SetParameter(const std::string& name, float value);
 
         void Play(int index, bool loop = true);
         void Play(const std::string& animationName, bool loop = true);
         void PlayCrossFade(int index, float transitionDuration, bool loop = true);
         void PlayCrossFade(const std::string& animationName, float transitionDuration, bool loop = true);
         void Update() override;
+        bool CanUpdateInParallel() const override;
 
         const BoneMatrixArray& GetFinalBoneMatrices() const;
 
@@ -51,5 +69,6 @@ namespace engine
 
     private:
         int GetAnimationIndex(const std::string& name);
+        void SetupBlendTree();
     };
 }
\ No newline at end of file
@@ -10,6 +10,8 @@
 #include "Core/Graphics/Resource/VertexBuffer.h"
 #include "Core/Graphics/Resource/IndexBuffer.h"
 #include "Core/Graphics/Resource/ConstantBuffer.h"
+#include "Core/Graphics/Device/CommandContext.h"
+#include "Core/Graphics/Device/D3D11Handles.h"
 #include "Core/Graphics/Resource/VertexShader.h"
 #include "Core/Graphics/Resource/PixelShader.h"
 #include "Core/Graphics/Resource/InputLayout.h"
@@ -17,17 +19,19 @@
 #include "Core/Graphics/Resource/MaterialHelper.h"
 #include "Framework/System/SystemManager.h"
 #include "Framework/System/RenderSystem.h"
+#include "Framework/System/RenderQueue.h"
 #include "Framework/Object/GameObject/GameObject.h"
 #include "Framework/Object/Component/Transform.h"
 #include "Framework/Object/Component/SkeletalAnimator.h"
 #include "Core/Graphics/Data/ShaderSlotTypes.h"
-#include "Common/Utility/StaticMemoryPool.h"
+#include "Common/Utility/SlabMemoryPool.h"
+#include "Framework/Scene/SceneBinary.h"
 
 namespace engine
 {
     namespace
     {
-        StaticMemoryPool<SkeletalMeshRenderer, 1024> g_skeletalMeshRendererPool;
+        SlabMemoryPool<SkeletalMeshRenderer, 64> g_skeletalMeshRendererPool{ "SkeletalMeshRenderer" };
     }
 
     SkeletalMeshRenderer::SkeletalMeshRenderer() = default;
@@ -42,9 +46,9 @@ namespace engine
         return g_skeletalMeshRendererPool.Allocate(size);
     }
 
-    void SkeletalMeshRenderer::operator delete(void* ptr)
+    void SkeletalMeshRenderer::operator delete(void* ptr, size_t size)
     {
-        g_skeletalMeshRendererPool.Deallocate(ptr);
+        g_skeletalMeshRendererPool.Deallocate(ptr, size);
     }
 
     void SkeletalMeshRenderer::Initialize()
@@ -124,7 +128,15 @@ namespace engine
                  m_inputLayout = m_vs->GetOrCreateInputLayout<BoneWeightVertex>();
             }
 
-            m_indexBuffer = ResourceManager::Get().GetOrCreateIndexBuffer(m_meshFilePath, m_meshData->GetIndices());
+            // 16비트에 들어가면 import 시 옮겨 두었으므로 인덱스 버퍼가 절반 크기
+            if (const auto& shortIndices = m_meshData->GetShortIndices(); !shortIndices.empty())
+            {
+                m_indexBuffer = ResourceManager::Get().GetOrCreateIndexBuffer(m_meshFilePath, FBXAssetKind::Skeletal, shortIndices);
+            }
+            else
+            {
+                m_indexBuffer = ResourceManager::Get().GetOrCreateIndexBuffer(m_meshFilePath, FBXAssetKind::Skeletal, m_meshData->GetIndices());
+            }
         }
 
         // 텍스처 로드
@@ -242,7 +254,7 @@ namespace engine
 
         deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
         deviceContext->IASetVertexBuffers(0, 1, m_vertexBuffer->GetBuffer().GetAddressOf(), &s_vertexBufferStride, &s_vertexBufferOffset);
-        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), DXGI_FORMAT_R32_UINT, 0);
+        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), m_indexBuffer->GetIndexFormat(), 0);
         deviceContext->IASetInputLayout(m_inputLayout->GetRawInputLayout());
 
         // Sampler
@@ -352,9 +364,132 @@ namespace engine
         }
     }
 
+    void SkeletalMeshRenderer::CollectDrawPackets(RenderType type, RenderQueue& queue) const
+    {
+        if (!m_meshData)
+        {
+            return;
+        }
+
+        DrawPacket packet;
+        packet.renderer = this;
+        packet.type = type;
+        packet.vertexShader = ToHandle(type == RenderType::Shadow ? m_shadowVS->GetRawShader() : m_vs->GetRawShader());
+        packet.inputLayout = ToHandle(m_inputLayout->GetRawInputLayout());
+        packet.vertexBuffer = ToHandle(m_vertexBuffer->GetRawBuffer());
+        packet.vertexStride = m_vertexBuffer->GetBufferStride();
+        packet.indexBuffer = ToHandle(m_indexBuffer->GetRawBuffer());
+        packet.indexFormat = ToIndexFormat(m_indexBuffer->GetIndexFormat());
+        packet.samplerState = ToHandle(m_samplerState->GetRawSamplerState());
+
+        const Vector3 position = GetTransform()->GetWorld().Translation();
+        const auto& materials = m_materialData->GetMaterials();
+
+        for (const auto& section : m_meshData->GetMeshSections())
+        {
+            const MaterialRenderType matType = materials[section.materialIndex].renderType;
+
+            switch (type)
+            {
+            case RenderType::Shadow:
+                if (matType == MaterialRenderType::Opaque)
+                {
+                    packet.pixelShader = {};
+                    packet.textureCount = 0;
+                }
+                else if (matType == MaterialRenderType::Cutout)
+                {
+                    packet.pixelShader = ToHandle(m_maskCutoutPS->GetRawShader());
+                    packet.textureCount = 1;
+                }
+                else
+                {
+                    continue;
+                }
+                break;
+
+            case RenderType::Opaque:
+                if (matType != MaterialRenderType::Opaque)
+                {
+                    continue;
+                }
+                packet.pixelShader = ToHandle(m_opaquePS->GetRawShader());
+                packet.textureCount = Textures::Count;
+                break;
+
+            case RenderType::Cutout:
+                if (matType != MaterialRenderType::Cutout)
+                {
+                    continue;
+                }
+                packet.pixelShader = ToHandle(m_cutoutPS->GetRawShader());
+                packet.textureCount = Textures::Count;
+                break;
+
+            case RenderType::Transparent:
+                if (matType != MaterialRenderType::Transparent)
+                {
+                    continue;
+                }
+                packet.pixelShader = ToHandle(m_transparentPS->GetRawShader());
+                packet.textureCount = Textures::Count;
+                break;
+
+            default:
+                return;
+            }
+
+            packet.boneIndex = m_meshData->IsRigid() ? static_cast<std::int32_t>(section.boneIndex) : -1;
+            packet.textures = m_textures[section.materialIndex].AsHandles();
+            packet.indexCount = section.indexCount;
+            packet.startIndex = section.indexOffset;
+            packet.baseVertex = section.vertexOffset;
+
+            queue.Add(packet, position);
+        }
+    }
+
+    void SkeletalMeshRenderer::BindConstants(CommandContext& context, RenderType type, std::int32_t boneIndex) const
+    {
+        context.SetVSConstantBuffer(static_cast<UINT>(ConstantBufferSlot::Bone), ToHandle(m_boneConstantBuffer->GetRawBuffer()));
+        context.UpdateBuffer(ToHandle(m_boneConstantBuffer->GetRawBuffer()), &m_boneTransformData, sizeof(m_boneTransformData));
+
+        if (type != RenderType::Shadow)
+        {
+            CbMaterial cbMaterial{};
+            cbMaterial.materialBaseColor = m_materialBaseColor;
+            cbMaterial.materialEmissive = m_materialEmissive;
+            cbMaterial.materialRoughness = m_materialRoughness;
+            cbMaterial.materialMetalness = m_materialMetalness;
+            cbMaterial.materialAmbientOcclusion = m_materialAmbientOcclusion;
+            cbMaterial.overrideMaterial = m_overrideMaterial ? 1 : 0;
+
+            context.SetPSConstantBuffer(static_cast<UINT>(ConstantBufferSlot::Material), ToHandle(m_materialConstantBuffer->GetRawBuffer()));
+            context.UpdateBuffer(ToHandle(m_materialConstantBuffer->GetRawBuffer()), &cbMaterial, sizeof(cbMaterial));
+        }
+
+        BindBoneIndex(context, boneIndex);
+    }
+
+    void SkeletalMeshRenderer::BindBoneIndex(CommandContext& context, std::int32_t boneIndex) const
+    {
+        CbObject cbObject{};
+        cbObject.world = GetTransform()->GetWorld().Transpose();
+        cbObject.worldInverseTranspose = GetTransform()->GetWorld().Invert();
+        cbObject.boneIndex = boneIndex;
+
+        context.UpdateBuffer(ToHandle(m_objectConstantBuffer->GetRawBuffer()), &cbObject, sizeof(cbObject));
+        context.SetVSConstantBuffer(static_cast<UINT>(ConstantBufferSlot::Object), ToHandle(m_objectConstantBuffer->GetRawBuffer()));
+    }
+
     DirectX::BoundingBox SkeletalMeshRenderer::GetBounds() const
     {
-        return DirectX::BoundingBox(); // TODO: 계산 필요
+        if (!m_meshData)
+        {
+            return DirectX::BoundingBox({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f });
+        }
+
+        return m_meshData->GetBounds();
     }
 
     void SkeletalMeshRenderer::DrawMask() const
@@ -371,7 +506,7 @@ namespace engine
 
         deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
         deviceContext->IASetVertexBuffers(0, 1, m_vertexBuffer->GetBuffer().GetAddressOf(), &s_vertexBufferStride, &s_vertexBufferOffset);
-        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), DXGI_FORMAT_R32_UINT, 0);
+        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), m_indexBuffer->GetIndexFormat(), 0);
         deviceContext->IASetInputLayout(m_inputLayout->GetRawInputLayout());
 
         // Sampler
@@ -437,7 +572,7 @@ namespace engine
 
         deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
         deviceContext->IASetVertexBuffers(0, 1, m_vertexBuffer->GetBuffer().GetAddressOf(), &s_vertexBufferStride, &s_vertexBufferOffset);
-        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), DXGI_FORMAT_R32_UINT, 0);
+        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), m_indexBuffer->GetIndexFormat(), 0);
         deviceContext->IASetInputLayout(m_inputLayout->GetRawInputLayout());
 
         // Sampler
@@ -525,6 +660,25 @@ namespace engine
         Refresh();
     }
 
+    void SkeletalMeshRenderer::LoadBinary(const SceneBinaryMeshRenderer& record, const SceneBinaryReader& reader)
+    {
+        m_active = record.active != 0;
+
+        m_meshFilePath = reader.GetString(record.meshFilePath);
+        m_vsFilePath = reader.GetString(record.vsFilePath);
+        m_opaquePSFilePath = reader.GetString(record.opaquePSFilePath);
+        m_cutoutPSFilePath = reader.GetString(record.cutoutPSFilePath);
+        m_transparentPSFilePath = reader.GetString(record.transparentPSFilePath);
+        m_materialBaseColor = record.materialBaseColor;
+        m_materialEmissive = record.materialEmissive;
+        m_materialRoughness = record.materialRoughness;
+        m_materialMetalness = record.materialMetalness;
+        m_materialAmbientOcclusion = record.materialAmbientOcclusion;
+        m_overrideMaterial = record.overrideMaterial != 0;
+
+        Refresh();
+    }
+
     void SkeletalMeshRenderer::OnGui()
     {
         // 1. Mesh Selector
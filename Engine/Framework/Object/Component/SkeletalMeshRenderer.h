@@ -19,6 +19,8 @@ namespace engine
     class Texture;
     class InputLayout;
     class SamplerState;
+    struct SceneBinaryMeshRenderer;
+    class SceneBinaryReader;
 
     class SkeletalMeshRenderer :
         public Renderer
@@ -72,7 +74,7 @@ namespace engine
         ~SkeletalMeshRenderer();
 
         static void* operator new(size_t size);
-        static void operator delete(void* ptr);
+        static void operator delete(void* ptr, size_t size);
 
         void Initialize() override;
         void Awake() override;
@@ -90,6 +92,7 @@ namespace engine
         void OnGui() override;
         void Save(json& j) const override;
         void Load(const json& j) override;
+        void LoadBinary(const SceneBinaryMeshRenderer& record, const SceneBinaryReader& reader); // Scene::LoadFromBinary
         std::string GetType() const override;
 
         bool HasRenderType(RenderType type) const override;
@@ -98,6 +101,10 @@ namespace engine
         void DrawMask() const override;
         void DrawPickingID() const override;
 
+        void CollectDrawPackets(RenderType type, RenderQueue& queue) const override;
+        void BindConstants(CommandContext& context, RenderType type, std::int32_t boneIndex) const override;
+        void BindBoneIndex(CommandContext& context, std::int32_t boneIndex) const override;
+
     private:
         void Refresh();
     };
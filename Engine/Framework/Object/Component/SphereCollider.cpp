@@ -1,5 +1,6 @@
 #include "EnginePCH.h"
 #include "SphereCollider.h"
+#include "Framework/Scene/SceneBinary.h"
 
 namespace engine
 {
@@ -53,4 +54,10 @@ namespace engine
             m_radius = j["radius"].get<float>();
         }
     }
+
+    void SphereCollider::LoadBinary(const SceneBinaryCollider& record)
+    {
+        Collider::LoadBinary(record);
+        m_radius = record.radius;
+    }
 }
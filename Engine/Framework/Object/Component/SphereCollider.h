@@ -35,6 +35,7 @@ namespace engine
         void OnGui() override;
         void Save(json& j) const override;
         void Load(const json& j) override;
+        void LoadBinary(const SceneBinaryCollider& record) override;
         std::string GetType() const override { return "SphereCollider"; }
     };
 }
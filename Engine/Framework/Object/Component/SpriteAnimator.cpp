@@ -66,6 +66,21 @@ namespace engine
 		}
 	}
 
+	void SpriteAnimator::ResetRuntimeState()
+	{
+		// 경로와 에셋은 Initialize에서 읽은 그대로 두고 재생 상태만 되돌림
+		m_spriteRenderer = nullptr;
+
+		m_animationProgressTime = 0.0f;
+		m_playSpeed = 1.0f;
+		m_frameCounter = 0;
+		m_eventCounter = 0;
+		m_currentAnimIndex = -1;
+
+		m_isLoop = false;
+		m_finished = true;
+	}
+
 	void SpriteAnimator::SetSpriteData(const std::string& path)
 	{
 		m_spriteDataPath = path;
@@ -34,6 +34,7 @@ namespace engine
 	public:
 		void Initialize() override;
 		void Awake() override;
+		void ResetRuntimeState() override;
 
 		void SetSpriteData(const std::string& path);
 		void AddAnimationData(const std::string& path);
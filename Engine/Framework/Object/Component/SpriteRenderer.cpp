@@ -15,15 +15,17 @@
 #include "Core/Graphics/Resource/RasterizerState.h"
 #include "Core/Graphics/Data/ConstantBufferTypes.h"
 #include "Core/Graphics/Data/ShaderSlotTypes.h"
+#include "Core/Graphics/Device/D3D11Handles.h"
 #include "Framework/Asset/AssetManager.h"
 #include "Framework/Asset/SimpleMeshData.h"
 #include "Framework/Scene/SceneManager.h"
 #include "Framework/Scene/Scene.h"
 #include "Framework/System/SystemManager.h"
 #include "Framework/System/RenderSystem.h"
+#include "Framework/System/SpriteBatch.h"
 #include "Framework/Object/Component/Transform.h"
 #include "Framework/Object/Component/Camera.h"
-#include "Common/Utility/StaticMemoryPool.h"
+#include "Common/Utility/SlabMemoryPool.h"
 
 void to_json(nlohmann::ordered_json& j, engine::MaterialRenderType type)
 {
@@ -59,7 +61,12 @@ namespace engine
 {
     namespace
     {
-        StaticMemoryPool<SpriteRenderer, 1024> g_spriteRendererPool;
+        SlabMemoryPool<SpriteRenderer, 128> g_spriteRendererPool{ "SpriteRenderer" };
+
+        const char* g_defaultVSFilePath = "Resource/Shader/Vertex/Quad_VS.hlsl";
+        const char* g_defaultOpaquePSFilePath = "Resource/Shader/Pixel/Sprite_Unlit_PS.hlsl";
+        const char* g_defaultCutoutPSFilePath = "Resource/Shader/Pixel/Sprite_Unlit_Cutout_PS.hlsl";
+        const char* g_defaultTransparentPSFilePath = "Resource/Shader/Pixel/Sprite_Unlit_Transparent_PS.hlsl";
     }
 
     SpriteRenderer::~SpriteRenderer()
@@ -72,9 +79,9 @@ namespace engine
         return g_spriteRendererPool.Allocate(size);
     }
 
-    void SpriteRenderer::operator delete(void* ptr)
+    void SpriteRenderer::operator delete(void* ptr, size_t size)
     {
-        g_spriteRendererPool.Deallocate(ptr);
+        g_spriteRendererPool.Deallocate(ptr, size);
     }
 
     void SpriteRenderer::Initialize()
@@ -87,10 +94,10 @@ namespace engine
 
         if (!m_isLoaded)
         {
-            m_vsFilePath = "Resource/Shader/Vertex/Quad_VS.hlsl";
-            m_opaquePSFilePath = "Resource/Shader/Pixel/Sprite_Unlit_PS.hlsl";
-            m_cutoutPSFilePath = "Resource/Shader/Pixel/Sprite_Unlit_Cutout_PS.hlsl";
-            m_transparentPSFilePath = "Resource/Shader/Pixel/Sprite_Unlit_Transparent_PS.hlsl";
+            m_vsFilePath = g_defaultVSFilePath;
+            m_opaquePSFilePath = g_defaultOpaquePSFilePath;
+            m_cutoutPSFilePath = g_defaultCutoutPSFilePath;
+            m_transparentPSFilePath = g_defaultTransparentPSFilePath;
 
             m_vs = ResourceManager::Get().GetOrCreateVertexShader(m_vsFilePath);
             m_opaquePS = ResourceManager::Get().GetOrCreatePixelShader(m_opaquePSFilePath);
@@ -106,6 +113,10 @@ namespace engine
         m_maskCutoutPS = ResourceManager::Get().GetOrCreatePixelShader("Resource/Shader/Pixel/Mask_Cutout_PS.hlsl");
         m_pickingPS = ResourceManager::Get().GetOrCreatePixelShader("Resource/Shader/Pixel/Picking_PS.hlsl");
 
+        m_batchOpaquePS = ResourceManager::Get().GetOrCreatePixelShader("Resource/Shader/Pixel/Sprite_Batch_PS.hlsl");
+        m_batchCutoutPS = ResourceManager::Get().GetOrCreatePixelShader("Resource/Shader/Pixel/Sprite_Batch_Cutout_PS.hlsl");
+        m_batchTransparentPS = ResourceManager::Get().GetOrCreatePixelShader("Resource/Shader/Pixel/Sprite_Batch_Transparent_PS.hlsl");
+
         m_inputLayout = m_vs->GetOrCreateInputLayout<PositionTexCoordVertex>();
         m_samplerState = ResourceManager::Get().GetDefaultSamplerState(DefaultSamplerType::Linear);
 
@@ -127,9 +138,25 @@ namespace engine
 
         m_textureFilePath = textureFilePath;
 
-        m_texture = ResourceManager::Get().GetOrCreateTexture(textureFilePath);
-        m_width = m_texture->GetWidth();
-        m_height = m_texture->GetHeight();
+        // 디코드가 끝날 때까지는 흰 텍스처로 그리고 크기는 이전 값을 유지
+        const auto request = ResourceManager::Get().RequestTexture(textureFilePath);
+        m_texture = request.Get();
+
+        request.Then([handle = GetHandle(), textureFilePath](const std::shared_ptr<Texture>& texture)
+            {
+                auto* renderer = static_cast<SpriteRenderer*>(Object::GetObjectFromHandle(handle));
+
+                // 기다리는 동안 지워졌거나 다른 텍스처로 바뀜
+                if (renderer == nullptr || renderer->IsPendingKill() || renderer->m_textureFilePath != textureFilePath)
+                {
+                    return;
+                }
+
+                renderer->m_width = texture->GetWidth();
+                renderer->m_height = texture->GetHeight();
+
+                renderer->MarkBoundsDirty();
+            });
     }
 
     void SpriteRenderer::SetVertexShader(const std::string& shaderFilePath)
@@ -186,11 +213,15 @@ namespace engine
         m_uvOffset = offset;
         m_uvScale = scale;
         m_pivot = pivot;
+
+        MarkBoundsDirty();
     }
 
     void SpriteRenderer::SetBillboardType(BillboardType type)
     {
         m_billboardType = type;
+
+        MarkBoundsDirty();
     }
 
     void SpriteRenderer::OnGui()
@@ -237,7 +268,7 @@ namespace engine
         int currentBillboard = static_cast<int>(m_billboardType);
         if (ImGui::Combo("Billboard", &currentBillboard, billboardTypes, IM_ARRAYSIZE(billboardTypes)))
         {
-            m_billboardType = static_cast<BillboardType>(currentBillboard);
+            SetBillboardType(static_cast<BillboardType>(currentBillboard));
         }
 
         ImGui::Spacing();
@@ -377,161 +408,7 @@ namespace engine
         deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), m_indexBuffer->GetIndexFormat(), 0);
         deviceContext->IASetInputLayout(m_inputLayout->GetRawInputLayout()); // PositionTexCoordVertex 레이아웃
 
-        // 100 픽셀 = 1 유닛 (프로젝트 정책에 따라 상수화 추천)
-        constexpr float ppu = 100.0f;
-
-        // 이미지 원본 비율에 맞춰 스케일 적용
-        const Vector3 imageScale(m_width / ppu * m_uvScale.x, m_height / ppu * m_uvScale.y, 1.0f);
-
-        // (Local Quad 1x1) * (ImageRatio) * (Transform)
-        const Matrix scaleMatrix = Matrix::CreateScale(imageScale);
-        //const Matrix finalWorld = scaleMatrix * GetTransform()->GetWorld();
-
-        Matrix finalWorld;
-
-        if (m_billboardType == BillboardType::None)
-        {
-            // 기본: Transform의 World 행렬 그대로 사용
-            finalWorld = scaleMatrix * GetTransform()->GetWorld();
-        }
-        else
-        {
-            // 빌보드 처리
-            auto transform = GetTransform();
-            Vector3 worldPos = transform->GetWorldPosition();
-            Vector3 worldScale = transform->GetLocalScale(); // 부모 스케일 무시하고 로컬 스케일만 적용? 혹은 GetWorldScale() 필요
-            // 카메라 정보 가져오기
-            // SceneManager를 통해 현재 활성 씬의 카메라를 가져옵니다.
-            auto scene = SceneManager::Get().GetScene();
-            auto camera = scene ? scene->GetMainCamera() : nullptr;
-            if (camera)
-            {
-                Vector3 cameraPos = camera->GetTransform()->GetWorldPosition();
-                Vector3 forward = cameraPos - worldPos; // Sprite -> Camera 방향
-
-                if (m_billboardType == BillboardType::Spherical)
-                {
-                    // 모든 축에서 바라봄
-                    // forward 벡터를 정규화
-                    forward.Normalize();
-
-                    // Up 벡터는 카메라의 Up 벡터를 쓰거나, 월드 Up(0,1,0)과 forward를 이용해 계산
-                    // 여기서는 간단하게 Matrix::CreateBillboard 사용
-                    // 주의: CreateBillboard는 "Camera Position"과 "Object Position"을 인자로 받습니다.
-                    // (DirectXMath 문서 확인 필요: CreateBillboard(object, cameraPos, cameraUp, cameraForward)
-
-                    // Matrix::CreateBillboard:
-                    // Builds a transformation matrix where the object is positioned at "objectPosition" 
-                    // and faces "cameraPosition".
-
-                    Vector3 cameraUp = camera->GetTransform()->GetUp();
-
-                    Matrix billboard = Matrix::CreateBillboard(worldPos, cameraPos, cameraUp);
-
-                    // Scale 적용 (이미지 비율 * 오브젝트 스케일)
-                    // CreateBillboard는 회전/이동만 포함하므로 스케일링은 별도로 곱해줘야 함
-                    // 순서: Scale -> Billboard
-
-                    // 전체 스케일 (이미지 보정 * 오브젝트 스케일)
-                    Matrix totalScale = Matrix::CreateScale(imageScale * worldScale);
-                    finalWorld = totalScale * billboard;
-                }
-                else if (m_billboardType == BillboardType::Cylindrical)
-                {
-                    // Y축 회전만 (수직 빌보드)
-                    // Project forward vector to XZ plane
-                    forward.y = 0.0f;
-                    if (forward.LengthSquared() > 0.0001f) // 0 벡터 방지
-                    {
-                        forward.Normalize();
-
-                        // Y축 회전 행렬 생성 (At, Eye, Up)
-                        // LookAt은 View Matrix를 만드므로, World Matrix를 만들려면 CreateWorld나 LookTo 등을 써야 함.
-                        // Matrix::CreateConstrainedBillboard 사용 가능
-                        // Builds a transformation matrix where the object faces the camera but is constrained to rotate only around a specified axis.
-
-                        Vector3 rotateAxis(0, 1, 0); // Y축
-
-                        // CreateConstrainedBillboard(objPos, camPos, rotateAxis, camForward, objForward)
-                        // 보통 objForward는 (0,0,1)
-
-                        Matrix billboard = Matrix::CreateConstrainedBillboard(worldPos, cameraPos, rotateAxis);
-
-                        Matrix totalScale = Matrix::CreateScale(imageScale * worldScale);
-                        finalWorld = totalScale * billboard;
-                    }
-                    else
-                    {
-                        // 바로 위/아래에 있어서 방향을 알 수 없는 경우 회전 안함
-                        finalWorld = scaleMatrix * transform->GetWorld();
-                    }
-                }
-                else if (m_billboardType == BillboardType::ViewPlaneAligned)
-                {
-                    // [NEW] 카메라 평면과 평행
-                    // 카메라의 회전 행렬을 그대로 가져오면 됨
-                    // (스프라이트의 Forward(-Z)가 카메라의 Forward(Z)와 반대가 되도록? 
-                    //  보통 쿼드는 Z-가 앞인데 카메라는 Z+를 봄 (RH/LH 따름). 
-                    //  단순하게는 카메라의 Rotation Matrix를 그대로 쓰면 됨)
-
-                    // Camera World Matrix에서 Rotation 부분만 추출
-                    Matrix camWorld = camera->GetWorld();
-
-                    // Translation 제거
-                    camWorld._41 = 0; camWorld._42 = 0; camWorld._43 = 0;
-
-                    // Scale 제거 (카메라에 스케일이 있다면 문제될 수 있으니 정규화 필요)
-                    Vector3 right = Vector3(camWorld._11, camWorld._12, camWorld._13);
-                    Vector3 up = Vector3(camWorld._21, camWorld._22, camWorld._23);
-                    Vector3 fwd = Vector3(camWorld._31, camWorld._32, camWorld._33);
-
-                    right.Normalize();
-                    up.Normalize();
-                    fwd.Normalize();
-
-                    Matrix billboard = Matrix::Identity;
-                    billboard.Right(right);
-                    billboard.Up(up);
-                    billboard.Forward(fwd);
-
-                    // 최종 행렬: Scale * Rotation(Camera) * Translation(Object)
-                    Matrix totalScale = Matrix::CreateScale(imageScale * worldScale);
-                    Matrix translation = Matrix::CreateTranslation(worldPos);
-
-                    finalWorld = totalScale * billboard * translation;
-                }
-                else if (m_billboardType == BillboardType::ViewPlaneVertical)
-                {
-                    // [NEW] View Plane Vertical
-                    // 카메라의 Forward를 가져와서 Y축 성분을 제거하고 정규화
-                    Vector3 cameraForward = camera->GetForward();
-                    cameraForward.y = 0.0f;
-
-                    if (cameraForward.LengthSquared() > 0.0001f)
-                    {
-                        cameraForward.Normalize();
-
-                        // CreateWorld(pos, forward, up) - Y축은 (0,1,0) 고정
-                        // Sprite의 Forward를 Camera의 ProjectOnXZ(Forward)와 일치시킴
-                        Matrix bb = Matrix::CreateWorld(worldPos, -cameraForward, Vector3::UnitY);
-
-                        Matrix totalScale = Matrix::CreateScale(imageScale * worldScale);
-                        finalWorld = totalScale * bb;
-                    }
-                    else
-                    {
-                        // 카메라가 완전히 위/아래를 볼 때는 회전하지 않음 (기존 transform 유지)
-                        const Matrix scaleOriginal = Matrix::CreateScale(imageScale);
-                        finalWorld = scaleOriginal * transform->GetWorld();
-                    }
-                }
-            }
-            else
-            {
-                // 카메라가 없으면 일반 렌더링
-                finalWorld = scaleMatrix * transform->GetWorld();
-            }
-        }
+        const Matrix finalWorld = ComputeWorld();
 
         CbObject cbObject{};
         cbObject.world = finalWorld.Transpose();
@@ -609,7 +486,24 @@ namespace engine
 
     DirectX::BoundingBox SpriteRenderer::GetBounds() const
     {
-        return DirectX::BoundingBox();
+        // Draw와 같은 기준 (100 픽셀 = 1 유닛)
+        constexpr float ppu = 100.0f;
+
+        const float width = m_width / ppu * m_uvScale.x;
+        const float height = m_height / ppu * m_uvScale.y;
+
+        // Quad_VS의 pivot 이동과 동일
+        const Vector3 center(-(m_pivot.x - 0.5f) * width, (m_pivot.y - 0.5f) * height, 0.0f);
+
+        if (m_billboardType == BillboardType::None)
+        {
+            return DirectX::BoundingBox(center, Vector3(width * 0.5f, height * 0.5f, 0.0f));
+        }
+
+        // 빌보드는 카메라에 따라 회전하므로 어느 방향이든 덮을 수 있게 잡음
+        const float radius = center.Length() + Vector2(width, height).Length() * 0.5f;
+
+        return DirectX::BoundingBox(Vector3::Zero, Vector3(radius, radius, radius));
     }
 
     void SpriteRenderer::DrawMask() const
@@ -630,161 +524,57 @@ namespace engine
         deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), m_indexBuffer->GetIndexFormat(), 0);
         deviceContext->IASetInputLayout(m_inputLayout->GetRawInputLayout()); // PositionTexCoordVertex 레이아웃
 
-        // 100 픽셀 = 1 유닛 (프로젝트 정책에 따라 상수화 추천)
-        constexpr float ppu = 100.0f;
-
-        // 이미지 원본 비율에 맞춰 스케일 적용
-        const Vector3 imageScale(m_width / ppu * m_uvScale.x, m_height / ppu * m_uvScale.y, 1.0f);
-
-        // (Local Quad 1x1) * (ImageRatio) * (Transform)
-        const Matrix scaleMatrix = Matrix::CreateScale(imageScale);
-        //const Matrix finalWorld = scaleMatrix * GetTransform()->GetWorld();
-
-        Matrix finalWorld;
-
-        if (m_billboardType == BillboardType::None)
-        {
-            // 기본: Transform의 World 행렬 그대로 사용
-            finalWorld = scaleMatrix * GetTransform()->GetWorld();
-        }
-        else
-        {
-            // 빌보드 처리
-            auto transform = GetTransform();
-            Vector3 worldPos = transform->GetWorldPosition();
-            Vector3 worldScale = transform->GetLocalScale(); // 부모 스케일 무시하고 로컬 스케일만 적용? 혹은 GetWorldScale() 필요
-            // 카메라 정보 가져오기
-            // SceneManager를 통해 현재 활성 씬의 카메라를 가져옵니다.
-            auto scene = SceneManager::Get().GetScene();
-            auto camera = scene ? scene->GetMainCamera() : nullptr;
-            if (camera)
-            {
-                Vector3 cameraPos = camera->GetTransform()->GetWorldPosition();
-                Vector3 forward = cameraPos - worldPos; // Sprite -> Camera 방향
+        const Matrix finalWorld = ComputeWorld();
 
-                if (m_billboardType == BillboardType::Spherical)
-                {
-                    // 모든 축에서 바라봄
-                    // forward 벡터를 정규화
-                    forward.Normalize();
-
-                    // Up 벡터는 카메라의 Up 벡터를 쓰거나, 월드 Up(0,1,0)과 forward를 이용해 계산
-                    // 여기서는 간단하게 Matrix::CreateBillboard 사용
-                    // 주의: CreateBillboard는 "Camera Position"과 "Object Position"을 인자로 받습니다.
-                    // (DirectXMath 문서 확인 필요: CreateBillboard(object, cameraPos, cameraUp, cameraForward)
-
-                    // Matrix::CreateBillboard:
-                    // Builds a transformation matrix where the object is positioned at "objectPosition" 
-                    // and faces "cameraPosition".
-
-                    Vector3 cameraUp = camera->GetTransform()->GetUp();
-
-                    Matrix billboard = Matrix::CreateBillboard(worldPos, cameraPos, cameraUp);
-
-                    // Scale 적용 (이미지 비율 * 오브젝트 스케일)
-                    // CreateBillboard는 회전/이동만 포함하므로 스케일링은 별도로 곱해줘야 함
-                    // 순서: Scale -> Billboard
-
-                    // 전체 스케일 (이미지 보정 * 오브젝트 스케일)
-                    Matrix totalScale = Matrix::CreateScale(imageScale * worldScale);
-                    finalWorld = totalScale * billboard;
-                }
-                else if (m_billboardType == BillboardType::Cylindrical)
-                {
-                    // Y축 회전만 (수직 빌보드)
-                    // Project forward vector to XZ plane
-                    forward.y = 0.0f;
-                    if (forward.LengthSquared() > 0.0001f) // 0 벡터 방지
-                    {
-                        forward.Normalize();
-
-                        // Y축 회전 행렬 생성 (At, Eye, Up)
-                        // LookAt은 View Matrix를 만드므로, World Matrix를 만들려면 CreateWorld나 LookTo 등을 써야 함.
-                        // Matrix::CreateConstrainedBillboard 사용 가능
-                        // Builds a transformation matrix where the object faces the camera but is constrained to rotate only around a specified axis.
-
-                        Vector3 rotateAxis(0, 1, 0); // Y축
-
-                        // CreateConstrainedBillboard(objPos, camPos, rotateAxis, camForward, objForward)
-                        // 보통 objForward는 (0,0,1)
+        CbObject cbObject{};
+        cbObject.world = finalWorld.Transpose();
+        cbObject.worldInverseTranspose = finalWorld.Invert(); // Normal 계산용
+        cbObject.boneIndex = -1;
 
-                        Matrix billboard = Matrix::CreateConstrainedBillboard(worldPos, cameraPos, rotateAxis);
+        deviceContext->UpdateSubresource(m_objectConstantBuffer->GetRawBuffer(), 0, nullptr, &cbObject, 0, 0);
+        deviceContext->VSSetConstantBuffers(static_cast<UINT>(ConstantBufferSlot::Object), 1, m_objectConstantBuffer->GetBuffer().GetAddressOf());
 
-                        Matrix totalScale = Matrix::CreateScale(imageScale * worldScale);
-                        finalWorld = totalScale * billboard;
-                    }
-                    else
-                    {
-                        // 바로 위/아래에 있어서 방향을 알 수 없는 경우 회전 안함
-                        finalWorld = scaleMatrix * transform->GetWorld();
-                    }
-                }
-                else if (m_billboardType == BillboardType::ViewPlaneAligned)
-                {
-                    // [NEW] 카메라 평면과 평행
-                    // 카메라의 회전 행렬을 그대로 가져오면 됨
-                    // (스프라이트의 Forward(-Z)가 카메라의 Forward(Z)와 반대가 되도록? 
-                    //  보통 쿼드는 Z-가 앞인데 카메라는 Z+를 봄 (RH/LH 따름). 
-                    //  단순하게는 카메라의 Rotation Matrix를 그대로 쓰면 됨)
+        CbSprite cbSprite{};
+        cbSprite.uvOffset = m_uvOffset;
+        cbSprite.uvScale = m_uvScale;
+        cbSprite.pivot = m_pivot;
 
-                    // Camera World Matrix에서 Rotation 부분만 추출
-                    Matrix camWorld = camera->GetWorld();
+        deviceContext->UpdateSubresource(m_spriteConstantBuffer->GetRawBuffer(), 0, nullptr, &cbSprite, 0, 0);
+        deviceContext->VSSetConstantBuffers(static_cast<UINT>(ConstantBufferSlot::Sprite), 1, m_spriteConstantBuffer->GetBuffer().GetAddressOf());
 
-                    // Translation 제거
-                    camWorld._41 = 0; camWorld._42 = 0; camWorld._43 = 0;
+        // Sampler (Point or Linear 확인하여 바인딩)
+        // 여기선 m_samplerState가 이미 Initialize 혹은 OnGui에서 설정되었다고 가정
+        deviceContext->PSSetSamplers(static_cast<UINT>(SamplerSlot::Linear), 1, m_samplerState->GetSamplerState().GetAddressOf());
 
-                    // Scale 제거 (카메라에 스케일이 있다면 문제될 수 있으니 정규화 필요)
-                    Vector3 right = Vector3(camWorld._11, camWorld._12, camWorld._13);
-                    Vector3 up = Vector3(camWorld._21, camWorld._22, camWorld._23);
-                    Vector3 fwd = Vector3(camWorld._31, camWorld._32, camWorld._33);
+        deviceContext->RSSetState(m_rasterizerState->GetRawRasterizerState());
 
-                    right.Normalize();
-                    up.Normalize();
-                    fwd.Normalize();
+        deviceContext->VSSetShader(m_shadowVS->GetRawShader(), nullptr, 0);
+        deviceContext->PSSetShader(m_maskCutoutPS->GetRawShader(), nullptr, 0);
+        ID3D11ShaderResourceView* srv = m_texture->GetRawSRV();
+        deviceContext->PSSetShaderResources(static_cast<UINT>(TextureSlot::BaseColor), 1, &srv);
 
-                    Matrix billboard = Matrix::Identity;
-                    billboard.Right(right);
-                    billboard.Up(up);
-                    billboard.Forward(fwd);
+        deviceContext->DrawIndexed(m_indexBuffer->GetIndexCount(), 0, 0);
+    }
 
-                    // 최종 행렬: Scale * Rotation(Camera) * Translation(Object)
-                    Matrix totalScale = Matrix::CreateScale(imageScale * worldScale);
-                    Matrix translation = Matrix::CreateTranslation(worldPos);
+    void SpriteRenderer::DrawPickingID() const
+    {
+        if (!m_texture)
+        {
+            return;
+        }
 
-                    finalWorld = totalScale * billboard * translation;
-                }
-                else if (m_billboardType == BillboardType::ViewPlaneVertical)
-                {
-                    // [NEW] View Plane Vertical
-                    // 카메라의 Forward를 가져와서 Y축 성분을 제거하고 정규화
-                    Vector3 cameraForward = camera->GetForward();
-                    cameraForward.y = 0.0f;
+        const auto& deviceContext = GraphicsDevice::Get().GetDeviceContext();
 
-                    if (cameraForward.LengthSquared() > 0.0001f)
-                    {
-                        cameraForward.Normalize();
+        // 1. 공통 State 설정 (IA)
+        static const UINT stride = m_vertexBuffer->GetBufferStride();
+        static const UINT offset = 0;
 
-                        // CreateWorld(pos, forward, up) - Y축은 (0,1,0) 고정
-                        // Sprite의 Forward를 Camera의 ProjectOnXZ(Forward)와 일치시킴
-                        Matrix bb = Matrix::CreateWorld(worldPos, -cameraForward, Vector3::UnitY);
+        deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        deviceContext->IASetVertexBuffers(0, 1, m_vertexBuffer->GetBuffer().GetAddressOf(), &stride, &offset);
+        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), m_indexBuffer->GetIndexFormat(), 0);
+        deviceContext->IASetInputLayout(m_inputLayout->GetRawInputLayout()); // PositionTexCoordVertex 레이아웃
 
-                        Matrix totalScale = Matrix::CreateScale(imageScale * worldScale);
-                        finalWorld = totalScale * bb;
-                    }
-                    else
-                    {
-                        // 카메라가 완전히 위/아래를 볼 때는 회전하지 않음 (기존 transform 유지)
-                        const Matrix scaleOriginal = Matrix::CreateScale(imageScale);
-                        finalWorld = scaleOriginal * transform->GetWorld();
-                    }
-                }
-            }
-            else
-            {
-                // 카메라가 없으면 일반 렌더링
-                finalWorld = scaleMatrix * transform->GetWorld();
-            }
-        }
+        const Matrix finalWorld = ComputeWorld();
 
         CbObject cbObject{};
         cbObject.world = finalWorld.Transpose();
@@ -809,31 +599,64 @@ namespace engine
         deviceContext->RSSetState(m_rasterizerState->GetRawRasterizerState());
 
         deviceContext->VSSetShader(m_shadowVS->GetRawShader(), nullptr, 0);
-        deviceContext->PSSetShader(m_maskCutoutPS->GetRawShader(), nullptr, 0);
+        deviceContext->PSSetShader(m_pickingPS->GetRawShader(), nullptr, 0);
         ID3D11ShaderResourceView* srv = m_texture->GetRawSRV();
         deviceContext->PSSetShaderResources(static_cast<UINT>(TextureSlot::BaseColor), 1, &srv);
 
         deviceContext->DrawIndexed(m_indexBuffer->GetIndexCount(), 0, 0);
     }
 
-    void SpriteRenderer::DrawPickingID() const
+    bool SpriteRenderer::CollectSprite(RenderType type, SpriteBatch& batch) const
     {
-        if (!m_texture)
+        if (!m_texture || !IsBatchable())
         {
-            return;
+            return false;
         }
 
-        const auto& deviceContext = GraphicsDevice::Get().GetDeviceContext();
+        SpriteDrawItem item;
 
-        // 1. 공통 State 설정 (IA)
-        static const UINT stride = m_vertexBuffer->GetBufferStride();
-        static const UINT offset = 0;
+        switch (type)
+        {
+        case RenderType::Shadow:
+            // Draw와 같이 그릴 것이 없으면 추가하지 않고 처리한 것으로 봄
+            if (!m_castShadow || m_renderType == MaterialRenderType::Transparent)
+            {
+                return true;
+            }
+            item.pixelShader = m_renderType == MaterialRenderType::Cutout ? ToHandle(m_maskCutoutPS->GetRawShader()) : PixelShaderHandle{};
+            break;
 
-        deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        deviceContext->IASetVertexBuffers(0, 1, m_vertexBuffer->GetBuffer().GetAddressOf(), &stride, &offset);
-        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), m_indexBuffer->GetIndexFormat(), 0);
-        deviceContext->IASetInputLayout(m_inputLayout->GetRawInputLayout()); // PositionTexCoordVertex 레이아웃
+        case RenderType::Opaque:
+            item.pixelShader = ToHandle(m_batchOpaquePS->GetRawShader());
+            break;
+
+        case RenderType::Cutout:
+            item.pixelShader = ToHandle(m_batchCutoutPS->GetRawShader());
+            break;
+
+        case RenderType::Transparent:
+            item.pixelShader = ToHandle(m_batchTransparentPS->GetRawShader());
+            break;
 
+        default:
+            return false;
+        }
+
+        item.texture = ToHandle(m_texture->GetRawSRV());
+        item.rasterizerState = ToHandle(m_rasterizerState->GetRawRasterizerState());
+        item.world = ComputeWorld();
+        item.uvOffset = m_uvOffset;
+        item.uvScale = m_uvScale;
+        item.pivot = m_pivot;
+        item.color = m_color;
+
+        batch.Add(item);
+
+        return true;
+    }
+
+    Matrix SpriteRenderer::ComputeWorld() const
+    {
         // 100 픽셀 = 1 유닛 (프로젝트 정책에 따라 상수화 추천)
         constexpr float ppu = 100.0f;
 
@@ -990,34 +813,7 @@ namespace engine
             }
         }
 
-        CbObject cbObject{};
-        cbObject.world = finalWorld.Transpose();
-        cbObject.worldInverseTranspose = finalWorld.Invert(); // Normal 계산용
-        cbObject.boneIndex = -1;
-
-        deviceContext->UpdateSubresource(m_objectConstantBuffer->GetRawBuffer(), 0, nullptr, &cbObject, 0, 0);
-        deviceContext->VSSetConstantBuffers(static_cast<UINT>(ConstantBufferSlot::Object), 1, m_objectConstantBuffer->GetBuffer().GetAddressOf());
-
-        CbSprite cbSprite{};
-        cbSprite.uvOffset = m_uvOffset;
-        cbSprite.uvScale = m_uvScale;
-        cbSprite.pivot = m_pivot;
-
-        deviceContext->UpdateSubresource(m_spriteConstantBuffer->GetRawBuffer(), 0, nullptr, &cbSprite, 0, 0);
-        deviceContext->VSSetConstantBuffers(static_cast<UINT>(ConstantBufferSlot::Sprite), 1, m_spriteConstantBuffer->GetBuffer().GetAddressOf());
-
-        // Sampler (Point or Linear 확인하여 바인딩)
-        // 여기선 m_samplerState가 이미 Initialize 혹은 OnGui에서 설정되었다고 가정
-        deviceContext->PSSetSamplers(static_cast<UINT>(SamplerSlot::Linear), 1, m_samplerState->GetSamplerState().GetAddressOf());
-
-        deviceContext->RSSetState(m_rasterizerState->GetRawRasterizerState());
-
-        deviceContext->VSSetShader(m_shadowVS->GetRawShader(), nullptr, 0);
-        deviceContext->PSSetShader(m_pickingPS->GetRawShader(), nullptr, 0);
-        ID3D11ShaderResourceView* srv = m_texture->GetRawSRV();
-        deviceContext->PSSetShaderResources(static_cast<UINT>(TextureSlot::BaseColor), 1, &srv);
-
-        deviceContext->DrawIndexed(m_indexBuffer->GetIndexCount(), 0, 0);
+        return finalWorld;
     }
 
     void SpriteRenderer::Refresh()
@@ -1031,6 +827,15 @@ namespace engine
         m_transparentPS = ResourceManager::Get().GetOrCreatePixelShader(m_transparentPSFilePath);
     }
 
+    bool SpriteRenderer::IsBatchable() const
+    {
+        // 사용자 셰이더는 상수 버퍼로 받는 값이 무엇인지 모르므로 따로 그림
+        return m_vsFilePath == g_defaultVSFilePath &&
+            m_opaquePSFilePath == g_defaultOpaquePSFilePath &&
+            m_cutoutPSFilePath == g_defaultCutoutPSFilePath &&
+            m_transparentPSFilePath == g_defaultTransparentPSFilePath;
+    }
+
     void SpriteRenderer::ReplaceRenderSystem()
     {
         SystemManager::Get().GetRenderSystem().Unregister(this);
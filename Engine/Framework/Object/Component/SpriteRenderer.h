@@ -60,6 +60,11 @@ namespace engine
         std::shared_ptr<PixelShader> m_maskCutoutPS;
         std::shared_ptr<PixelShader> m_pickingPS;
 
+        // SpriteBatch용 (색을 정점에서 받음), 기본 셰이더를 쓸 때만 배칭
+        std::shared_ptr<PixelShader> m_batchOpaquePS;
+        std::shared_ptr<PixelShader> m_batchCutoutPS;
+        std::shared_ptr<PixelShader> m_batchTransparentPS;
+
         std::shared_ptr<Texture> m_texture;
         std::shared_ptr<InputLayout> m_inputLayout;
         std::shared_ptr<SamplerState> m_samplerState;
@@ -82,7 +87,7 @@ namespace engine
         ~SpriteRenderer();
 
         static void* operator new(size_t size);
-        static void operator delete(void* ptr);
+        static void operator delete(void* ptr, size_t size);
 
     public:
         void Initialize() override;
@@ -110,8 +115,12 @@ namespace engine
         void DrawMask() const override;
         void DrawPickingID() const override;
 
+        bool CollectSprite(RenderType type, SpriteBatch& batch) const override;
+
     private:
         void Refresh();
+        Matrix ComputeWorld() const; // 1x1 쿼드 -> 월드 (이미지 크기 / 빌보드 포함)
+        bool IsBatchable() const;
         void ReplaceRenderSystem();
     };
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "Core/Graphics/Resource/VertexBuffer.h"
 #include "Core/Graphics/Resource/IndexBuffer.h"
 #include "Core/Graphics/Resource/ConstantBuffer.h"
+#include "Core/Graphics/Device/CommandContext.h"
+#include "Core/Graphics/Device/D3D11Handles.h"
 #include "Core/Graphics/Resource/VertexShader.h"
 #include "Core/Graphics/Resource/PixelShader.h"
 #include "Core/Graphics/Resource/InputLayout.h"
@@ -19,14 +21,35 @@
 #include "Framework/Asset/MaterialData.h"
 #include "Framework/System/SystemManager.h"
 #include "Framework/System/RenderSystem.h"
+#include "Framework/System/RenderQueue.h"
 #include "Framework/Object/Component/Transform.h"
-#include "Common/Utility/StaticMemoryPool.h"
+#include "Common/Utility/SlabMemoryPool.h"
+#include "Framework/Scene/SceneBinary.h"
 
 namespace engine
 {
     namespace
     {
-        StaticMemoryPool<StaticMeshRenderer, 1024> g_staticMeshRendererPool;
+        SlabMemoryPool<StaticMeshRenderer, 128> g_staticMeshRendererPool{ "StaticMeshRenderer" };
+
+        const char* g_defaultVSFilePath = "Resource/Shader/Vertex/Static_VS.hlsl";
+
+        // 그림자 패스는 머티리얼 상수 버퍼를 쓰지 않으므로 모두 같은 키
+        constexpr std::uint64_t ShadowInstanceKey = 1;
+
+        // 머티리얼 상수 버퍼 내용의 64비트 FNV-1a (DrawPacket::instanceKey, 0은 인스턴싱하지 않는다는 뜻이므로 피함)
+        std::uint64_t MakeInstanceKey(const CbMaterial& cbMaterial)
+        {
+            std::uint64_t hash = 14695981039346656037ULL;
+
+            for (const std::byte b : std::as_bytes(std::span{ &cbMaterial, 1 }))
+            {
+                hash ^= static_cast<std::uint64_t>(b);
+                hash *= 1099511628211ULL;
+            }
+
+            return hash != 0 ? hash : 1;
+        }
     }
 
     StaticMeshRenderer::~StaticMeshRenderer()
@@ -39,21 +62,19 @@ namespace engine
         return g_staticMeshRendererPool.Allocate(size);
     }
 
-    void StaticMeshRenderer::operator delete(void* ptr)
+    void StaticMeshRenderer::operator delete(void* ptr, size_t size)
     {
-        g_staticMeshRendererPool.Deallocate(ptr);
+        g_staticMeshRendererPool.Deallocate(ptr, size);
     }
 
     void StaticMeshRenderer::Initialize()
     {
-        m_vsFilePath = "Resource/Shader/Vertex/Static_VS.hlsl";
+        m_vsFilePath = g_defaultVSFilePath;
         m_opaquePSFilePath = "Resource/Shader/Pixel/GBuffer_PS.hlsl";
         m_cutoutPSFilePath = "Resource/Shader/Pixel/GBuffer_Cutout_PS.hlsl";
         m_transparentPSFilePath = "Resource/Shader/Pixel/LightTransparent_PS.hlsl";
 
-        m_vs = ResourceManager::Get().GetOrCreateVertexShader(m_vsFilePath);
-        m_shadowVS = ResourceManager::Get().GetOrCreateVertexShader("Resource/Shader/Vertex/Shadow_Static_VS.hlsl");
-        m_simpleVS = ResourceManager::Get().GetOrCreateVertexShader("Resource/Shader/Vertex/Simple_Static_VS.hlsl");
+        SetupVertexShaders();
 
         m_opaquePS = ResourceManager::Get().GetOrCreatePixelShader(m_opaquePSFilePath);
         m_cutoutPS = ResourceManager::Get().GetOrCreatePixelShader(m_cutoutPSFilePath);
@@ -61,7 +82,6 @@ namespace engine
         m_maskCutoutPS = ResourceManager::Get().GetOrCreatePixelShader("Resource/Shader/Pixel/Mask_Cutout_PS.hlsl");
         m_pickingPS = ResourceManager::Get().GetOrCreatePixelShader("Resource/Shader/Pixel/Picking_PS.hlsl");
 
-        m_inputLayout = m_vs->GetOrCreateInputLayout<CommonVertex>();
         m_samplerState = ResourceManager::Get().GetDefaultSamplerState(DefaultSamplerType::Linear);
 
         m_objectConstantBuffer = ResourceManager::Get().GetOrCreateConstantBuffer("Object", sizeof(CbObject));
@@ -70,25 +90,16 @@ namespace engine
 
     void StaticMeshRenderer::SetMesh(const std::string& meshFilePath)
     {
-        SystemManager::Get().GetRenderSystem().Unregister(this);
-
         m_meshFilePath = meshFilePath;
 
-        m_staticMeshData = AssetManager::Get().GetOrCreateStaticMeshData(m_meshFilePath);
-        m_materialData = AssetManager::Get().GetOrCreateMaterialData(m_meshFilePath);
-
-        m_vertexBuffer = ResourceManager::Get().GetOrCreateVertexBuffer<CommonVertex>(m_meshFilePath, m_staticMeshData->GetVertices());
-        m_indexBuffer = ResourceManager::Get().GetOrCreateIndexBuffer(m_meshFilePath, m_staticMeshData->GetIndices());
-
-        SetupTextures(m_materialData, m_textures);
-
-        SystemManager::Get().GetRenderSystem().Register(this);
+        RequestMesh();
     }
 
     void StaticMeshRenderer::SetVertexShader(const std::string& shaderFilePath)
     {
         m_vsFilePath = shaderFilePath;
-        m_vs = ResourceManager::Get().GetOrCreateVertexShader(m_vsFilePath);
+
+        SetupVertexShaders();
     }
 
     void StaticMeshRenderer::SetOpaquePixelShader(const std::string& shaderFilePath)
@@ -109,6 +120,30 @@ namespace engine
         m_transparentPS = ResourceManager::Get().GetOrCreatePixelShader(m_transparentPSFilePath);
     }
 
+    void StaticMeshRenderer::SetCompactVertex(bool useCompactVertex)
+    {
+        if (m_useCompactVertex == useCompactVertex)
+        {
+            return;
+        }
+
+        m_useCompactVertex = useCompactVertex;
+
+        SetupVertexShaders();
+
+        // 압축 메시는 따로 임포트되므로 새로 받을 때까지 이전 메시를 그리지 않음 (정점 형식이 셰이더와 다름)
+        if (m_staticMeshData)
+        {
+            SystemManager::Get().GetRenderSystem().Unregister(this);
+
+            m_staticMeshData.reset();
+            m_vertexBuffer.reset();
+            m_indexBuffer.reset();
+        }
+
+        RequestMesh();
+    }
+
     void StaticMeshRenderer::OnGui()
     {
         ImGui::Text("Mesh: %s", m_meshFilePath.c_str());
@@ -133,6 +168,12 @@ namespace engine
         // (Shader 폴더 경로가 Resource/Shader인지 Shader인지 확인 필요)
         static const std::string pixelShaderPath = "Resource/Shader/Pixel";
         static const std::string vertexShaderPath = "Resource/Shader/Vertex";
+        bool useCompactVertex = m_useCompactVertex;
+        if (ImGui::Checkbox("Compact Vertex", &useCompactVertex))
+        {
+            SetCompactVertex(useCompactVertex);
+        }
+
         ImGui::Text("Shaders:");
         std::string selectedShader;
         // Opaque
@@ -201,6 +242,7 @@ namespace engine
         j["MaterialMetalness"] = m_materialMetalness;
         j["MaterialAmbientOcclusion"] = m_materialAmbientOcclusion;
         j["OverrideMaterial"] = m_overrideMaterial;
+        j["CompactVertex"] = m_useCompactVertex;
     }
 
     void StaticMeshRenderer::Load(const json& j)
@@ -218,6 +260,27 @@ namespace engine
         JsonGet(j, "MaterialMetalness", m_materialMetalness);
         JsonGet(j, "MaterialAmbientOcclusion", m_materialAmbientOcclusion);
         JsonGet(j, "OverrideMaterial", m_overrideMaterial);
+        JsonGet(j, "CompactVertex", m_useCompactVertex);
+
+        Refresh();
+    }
+
+    void StaticMeshRenderer::LoadBinary(const SceneBinaryMeshRenderer& record, const SceneBinaryReader& reader)
+    {
+        m_active = record.active != 0;
+
+        m_meshFilePath = reader.GetString(record.meshFilePath);
+        m_vsFilePath = reader.GetString(record.vsFilePath);
+        m_opaquePSFilePath = reader.GetString(record.opaquePSFilePath);
+        m_cutoutPSFilePath = reader.GetString(record.cutoutPSFilePath);
+        m_transparentPSFilePath = reader.GetString(record.transparentPSFilePath);
+        m_materialBaseColor = record.materialBaseColor;
+        m_materialEmissive = record.materialEmissive;
+        m_materialRoughness = record.materialRoughness;
+        m_materialMetalness = record.materialMetalness;
+        m_materialAmbientOcclusion = record.materialAmbientOcclusion;
+        m_overrideMaterial = record.overrideMaterial != 0;
+        m_useCompactVertex = record.compactVertex != 0;
 
         Refresh();
     }
@@ -288,31 +351,11 @@ namespace engine
 
         deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
         deviceContext->IASetVertexBuffers(0, 1, m_vertexBuffer->GetBuffer().GetAddressOf(), &s_vertexBufferStride, &s_vertexBufferOffset);
-        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), DXGI_FORMAT_R32_UINT, 0);
+        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), m_indexBuffer->GetIndexFormat(), 0);
         deviceContext->IASetInputLayout(m_inputLayout->GetRawInputLayout());
-
-        CbObject cbObject{};
-        cbObject.world = GetTransform()->GetWorld().Transpose();
-        cbObject.worldInverseTranspose = GetTransform()->GetWorld().Invert();
-
-        deviceContext->VSSetConstantBuffers(static_cast<UINT>(ConstantBufferSlot::Object),
-            1, m_objectConstantBuffer->GetBuffer().GetAddressOf());
-        deviceContext->UpdateSubresource(m_objectConstantBuffer->GetRawBuffer(), 0, nullptr, &cbObject, 0, 0);
         deviceContext->PSSetSamplers(static_cast<UINT>(SamplerSlot::Linear), 1, m_samplerState->GetSamplerState().GetAddressOf());
 
-        if (type != RenderType::Shadow)
-        {
-            CbMaterial cbMaterial{};
-            cbMaterial.materialBaseColor = m_materialBaseColor;
-            cbMaterial.materialEmissive = m_materialEmissive;
-            cbMaterial.materialRoughness = m_materialRoughness;
-            cbMaterial.materialMetalness = m_materialMetalness;
-            cbMaterial.materialAmbientOcclusion = m_materialAmbientOcclusion;
-            cbMaterial.overrideMaterial = m_overrideMaterial ? 1 : 0;
-
-            deviceContext->PSSetConstantBuffers(static_cast<UINT>(ConstantBufferSlot::Material), 1, m_materialConstantBuffer->GetBuffer().GetAddressOf());
-            deviceContext->UpdateSubresource(m_materialConstantBuffer->GetRawBuffer(), 0, nullptr, &cbMaterial, 0, 0);
-        }
+        BindConstants(GraphicsDevice::Get().GetCommandContext(), type, -1);
 
         switch (type)
         {
@@ -438,7 +481,12 @@ namespace engine
 
     DirectX::BoundingBox StaticMeshRenderer::GetBounds() const
     {
-        return DirectX::BoundingBox();
+        if (!m_staticMeshData)
+        {
+            return DirectX::BoundingBox({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f });
+        }
+
+        return m_staticMeshData->GetBounds();
     }
 
     void StaticMeshRenderer::DrawMask() const
@@ -455,7 +503,7 @@ namespace engine
 
         deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
         deviceContext->IASetVertexBuffers(0, 1, m_vertexBuffer->GetBuffer().GetAddressOf(), &s_vertexBufferStride, &s_vertexBufferOffset);
-        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), DXGI_FORMAT_R32_UINT, 0);
+        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), m_indexBuffer->GetIndexFormat(), 0);
         deviceContext->IASetInputLayout(m_inputLayout->GetRawInputLayout());
 
         CbObject cbObject{};
@@ -494,7 +542,7 @@ namespace engine
 
         deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
         deviceContext->IASetVertexBuffers(0, 1, m_vertexBuffer->GetBuffer().GetAddressOf(), &s_vertexBufferStride, &s_vertexBufferOffset);
-        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), DXGI_FORMAT_R32_UINT, 0);
+        deviceContext->IASetIndexBuffer(m_indexBuffer->GetRawBuffer(), m_indexBuffer->GetIndexFormat(), 0);
         deviceContext->IASetInputLayout(m_inputLayout->GetRawInputLayout());
 
         CbObject cbObject{};
@@ -519,19 +567,122 @@ namespace engine
         }
     }
 
-    void StaticMeshRenderer::Refresh()
+    void StaticMeshRenderer::CollectDrawPackets(RenderType type, RenderQueue& queue) const
     {
-        SystemManager::Get().GetRenderSystem().Unregister(this);
+        if (!m_staticMeshData)
+        {
+            return;
+        }
 
-        m_staticMeshData = AssetManager::Get().GetOrCreateStaticMeshData(m_meshFilePath);
-        m_materialData = AssetManager::Get().GetOrCreateMaterialData(m_meshFilePath);
+        DrawPacket packet;
+        packet.renderer = this;
+        packet.type = type;
+        packet.vertexShader = ToHandle(type == RenderType::Shadow ? m_shadowVS->GetRawShader() : m_vs->GetRawShader());
+        packet.inputLayout = ToHandle(m_inputLayout->GetRawInputLayout());
+        packet.vertexBuffer = ToHandle(m_vertexBuffer->GetRawBuffer());
+        packet.vertexStride = m_vertexBuffer->GetBufferStride();
+        packet.indexBuffer = ToHandle(m_indexBuffer->GetRawBuffer());
+        packet.indexFormat = ToIndexFormat(m_indexBuffer->GetIndexFormat());
+        packet.samplerState = ToHandle(m_samplerState->GetRawSamplerState());
+
+        const Matrix world = GetTransform()->GetWorld();
+        const Vector3 position = world.Translation();
+
+        if (m_instancedVS)
+        {
+            packet.world = world;
+            packet.instancedVertexShader = ToHandle(type == RenderType::Shadow ? m_shadowInstancedVS->GetRawShader() : m_instancedVS->GetRawShader());
+            packet.instancedInputLayout = ToHandle(m_instancedInputLayout->GetRawInputLayout());
+            packet.instanceKey = type == RenderType::Shadow ? ShadowInstanceKey : MakeInstanceKey(MakeMaterialConstants());
+        }
+        const auto& materials = m_materialData->GetMaterials();
 
-        m_vertexBuffer = ResourceManager::Get().GetOrCreateVertexBuffer<CommonVertex>(m_meshFilePath, m_staticMeshData->GetVertices());
-        m_indexBuffer = ResourceManager::Get().GetOrCreateIndexBuffer(m_meshFilePath, m_staticMeshData->GetIndices());
+        for (const auto& meshSection : m_staticMeshData->GetMeshSections())
+        {
+            const MaterialRenderType materialType = materials[meshSection.materialIndex].renderType;
 
-        SetupTextures(m_materialData, m_textures);
+            switch (type)
+            {
+            case RenderType::Shadow:
+                if (materialType == MaterialRenderType::Opaque)
+                {
+                    packet.pixelShader = {};
+                    packet.textureCount = 0;
+                }
+                else if (materialType == MaterialRenderType::Cutout)
+                {
+                    packet.pixelShader = ToHandle(m_maskCutoutPS->GetRawShader());
+                    packet.textureCount = 1;
+                }
+                else
+                {
+                    continue;
+                }
+                break;
 
-        m_vs = ResourceManager::Get().GetOrCreateVertexShader(m_vsFilePath);
+            case RenderType::Opaque:
+                if (materialType != MaterialRenderType::Opaque)
+                {
+                    continue;
+                }
+                packet.pixelShader = ToHandle(m_opaquePS->GetRawShader());
+                packet.textureCount = Textures::Count;
+                break;
+
+            case RenderType::Cutout:
+                if (materialType != MaterialRenderType::Cutout)
+                {
+                    continue;
+                }
+                packet.pixelShader = ToHandle(m_cutoutPS->GetRawShader());
+                packet.textureCount = Textures::Count;
+                break;
+
+            case RenderType::Transparent:
+                if (materialType != MaterialRenderType::Transparent)
+                {
+                    continue;
+                }
+                packet.pixelShader = ToHandle(m_transparentPS->GetRawShader());
+                packet.textureCount = Textures::Count;
+                break;
+
+            default:
+                return;
+            }
+
+            packet.textures = m_textures[meshSection.materialIndex].AsHandles();
+            packet.indexCount = meshSection.indexCount;
+            packet.startIndex = meshSection.indexOffset;
+            packet.baseVertex = meshSection.vertexOffset;
+
+            queue.Add(packet, position);
+        }
+    }
+
+    void StaticMeshRenderer::BindConstants(CommandContext& context, RenderType type, std::int32_t boneIndex) const
+    {
+        // world는 CollectDrawPackets에서 이미 계산했으므로 여기서는 읽기만 함 (워커 스레드에서 불릴 수 있음)
+        CbObject cbObject{};
+        cbObject.world = GetTransform()->GetWorld().Transpose();
+        cbObject.worldInverseTranspose = GetTransform()->GetWorld().Invert();
+        cbObject.boneIndex = boneIndex;
+
+        context.SetVSConstantBuffer(static_cast<UINT>(ConstantBufferSlot::Object), ToHandle(m_objectConstantBuffer->GetRawBuffer()));
+        context.UpdateBuffer(ToHandle(m_objectConstantBuffer->GetRawBuffer()), &cbObject, sizeof(cbObject));
+
+        if (type != RenderType::Shadow)
+        {
+            const CbMaterial cbMaterial = MakeMaterialConstants();
+
+            context.SetPSConstantBuffer(static_cast<UINT>(ConstantBufferSlot::Material), ToHandle(m_materialConstantBuffer->GetRawBuffer()));
+            context.UpdateBuffer(ToHandle(m_materialConstantBuffer->GetRawBuffer()), &cbMaterial, sizeof(cbMaterial));
+        }
+    }
+
+    void StaticMeshRenderer::Refresh()
+    {
+        SetupVertexShaders();
 
         m_opaquePS = ResourceManager::Get().GetOrCreatePixelShader(m_opaquePSFilePath);
 
@@ -539,6 +690,115 @@ namespace engine
 
         m_transparentPS = ResourceManager::Get().GetOrCreatePixelShader(m_transparentPSFilePath);
 
+        RequestMesh();
+    }
+
+    void StaticMeshRenderer::SetupVertexShaders()
+    {
+        // 압축 정점은 전용 셰이더에서만 풀 수 있음
+        if (m_useCompactVertex)
+        {
+            m_vs = ResourceManager::Get().GetOrCreateVertexShader("Resource/Shader/Vertex/Static_Compact_VS.hlsl");
+            m_shadowVS = ResourceManager::Get().GetOrCreateVertexShader("Resource/Shader/Vertex/Shadow_Static_Compact_VS.hlsl");
+            m_simpleVS = ResourceManager::Get().GetOrCreateVertexShader("Resource/Shader/Vertex/Simple_Static_Compact_VS.hlsl");
+
+            m_inputLayout = m_vs->GetOrCreateInputLayout<CompactVertex>();
+        }
+        else
+        {
+            m_vs = ResourceManager::Get().GetOrCreateVertexShader(m_vsFilePath);
+            m_shadowVS = ResourceManager::Get().GetOrCreateVertexShader("Resource/Shader/Vertex/Shadow_Static_VS.hlsl");
+            m_simpleVS = ResourceManager::Get().GetOrCreateVertexShader("Resource/Shader/Vertex/Simple_Static_VS.hlsl");
+
+            m_inputLayout = m_vs->GetOrCreateInputLayout<CommonVertex>();
+        }
+
+        // 인스턴싱 버전은 기본 VS에만 있음
+        if (m_useCompactVertex || m_vsFilePath != g_defaultVSFilePath)
+        {
+            m_instancedVS.reset();
+            m_shadowInstancedVS.reset();
+            m_instancedInputLayout.reset();
+            return;
+        }
+
+        m_instancedVS = ResourceManager::Get().GetOrCreateVertexShader("Resource/Shader/Vertex/Static_Instanced_VS.hlsl");
+        m_shadowInstancedVS = ResourceManager::Get().GetOrCreateVertexShader("Resource/Shader/Vertex/Shadow_Static_Instanced_VS.hlsl");
+
+        m_instancedInputLayout = m_instancedVS->GetOrCreateInputLayout<InstancedCommonVertex>();
+    }
+
+    CbMaterial StaticMeshRenderer::MakeMaterialConstants() const
+    {
+        CbMaterial cbMaterial{};
+        cbMaterial.materialBaseColor = m_materialBaseColor;
+        cbMaterial.materialEmissive = m_materialEmissive;
+        cbMaterial.materialRoughness = m_materialRoughness;
+        cbMaterial.materialMetalness = m_materialMetalness;
+        cbMaterial.materialAmbientOcclusion = m_materialAmbientOcclusion;
+        cbMaterial.overrideMaterial = m_overrideMaterial ? 1 : 0;
+
+        return cbMaterial;
+    }
+
+    void StaticMeshRenderer::RequestMesh()
+    {
+        if (m_meshFilePath.empty())
+        {
+            return;
+        }
+
+        const AssetRequest<StaticMeshData> request = m_useCompactVertex ?
+            AssetManager::Get().RequestCompactStaticMeshData(m_meshFilePath) :
+            AssetManager::Get().RequestStaticMeshData(m_meshFilePath);
+
+        request.Then(
+            [handle = GetHandle(), meshFilePath = m_meshFilePath, useCompactVertex = m_useCompactVertex](const std::shared_ptr<StaticMeshData>& staticMeshData)
+            {
+                auto* renderer = static_cast<StaticMeshRenderer*>(Object::GetObjectFromHandle(handle));
+
+                // 기다리는 동안 지워졌거나 다른 메시 / 정점 형식으로 바뀜
+                if (renderer == nullptr || renderer->IsPendingKill() ||
+                    renderer->m_meshFilePath != meshFilePath || renderer->m_useCompactVertex != useCompactVertex)
+                {
+                    return;
+                }
+
+                renderer->ApplyMesh(staticMeshData);
+            });
+    }
+
+    void StaticMeshRenderer::ApplyMesh(const std::shared_ptr<StaticMeshData>& staticMeshData)
+    {
+        SystemManager::Get().GetRenderSystem().Unregister(this);
+
+        m_staticMeshData = staticMeshData;
+
+        // 같은 FBX에서 같이 캐시에 들어오므로 기다리지 않음
+        m_materialData = AssetManager::Get().GetOrCreateMaterialData(m_meshFilePath);
+
+        if (m_useCompactVertex)
+        {
+            m_vertexBuffer = ResourceManager::Get().GetOrCreateVertexBuffer<CompactVertex>(m_meshFilePath, m_staticMeshData->GetCompactVertices());
+        }
+        else
+        {
+            m_vertexBuffer = ResourceManager::Get().GetOrCreateVertexBuffer<CommonVertex>(m_meshFilePath, m_staticMeshData->GetVertices());
+        }
+
+        // 16비트에 들어가면 import 시 옮겨 두었으므로 인덱스 버퍼가 절반 크기
+        // 압축 메시도 인덱스는 같으므로 Static 버퍼를 같이 씀
+        if (const auto& shortIndices = m_staticMeshData->GetShortIndices(); !shortIndices.empty())
+        {
+            m_indexBuffer = ResourceManager::Get().GetOrCreateIndexBuffer(m_meshFilePath, FBXAssetKind::Static, shortIndices);
+        }
+        else
+        {
+            m_indexBuffer = ResourceManager::Get().GetOrCreateIndexBuffer(m_meshFilePath, FBXAssetKind::Static, m_staticMeshData->GetIndices());
+        }
+
+        SetupTextures(m_materialData, m_textures);
+
         SystemManager::Get().GetRenderSystem().Register(this);
     }
 }
\ No newline at end of file
@@ -16,6 +16,9 @@ namespace engine
     class Texture;
     class InputLayout;
     class SamplerState;
+    struct CbMaterial;
+    struct SceneBinaryMeshRenderer;
+    class SceneBinaryReader;
 
     class StaticMeshRenderer :
         public Renderer
@@ -36,6 +39,11 @@ namespace engine
         std::shared_ptr<VertexShader> m_shadowVS;
         std::shared_ptr<VertexShader> m_simpleVS;
 
+        // 기본 VS일 때만 (압축 정점 / 사용자 VS는 인스턴싱하지 않음)
+        std::shared_ptr<VertexShader> m_instancedVS;
+        std::shared_ptr<VertexShader> m_shadowInstancedVS;
+        std::shared_ptr<InputLayout> m_instancedInputLayout;
+
         std::shared_ptr<PixelShader> m_opaquePS;
         std::shared_ptr<PixelShader> m_cutoutPS;
         std::shared_ptr<PixelShader> m_transparentPS;
@@ -59,11 +67,14 @@ namespace engine
         float m_materialAmbientOcclusion = 1.0f;
         bool m_overrideMaterial = false;
 
+        // 압축 정점 (CompactVertex) 사용, 켜면 전용 VS를 쓰므로 VSFilePath는 무시
+        bool m_useCompactVertex = false;
+
     public:
         ~StaticMeshRenderer();
 
         static void* operator new(size_t size);
-        static void operator delete(void* ptr);
+        static void operator delete(void* ptr, size_t size);
 
     public:
         void Initialize() override;
@@ -73,11 +84,13 @@ namespace engine
         void SetOpaquePixelShader(const std::string& shaderFilePath);
         void SetCutoutPixelShader(const std::string& shaderFilePath);
         void SetTransparentPixelShader(const std::string& shaderFilePath);
+        void SetCompactVertex(bool useCompactVertex);
 
     public:
         void OnGui() override;
         void Save(json& j) const override;
         void Load(const json& j) override;
+        void LoadBinary(const SceneBinaryMeshRenderer& record, const SceneBinaryReader& reader); // Scene::LoadFromBinary
         std::string GetType() const override;
 
     public:
@@ -87,7 +100,16 @@ namespace engine
         void DrawMask() const override;
         void DrawPickingID() const override;
 
+        void CollectDrawPackets(RenderType type, RenderQueue& queue) const override;
+        void BindConstants(CommandContext& context, RenderType type, std::int32_t boneIndex) const override;
+
     private:
         void Refresh();
+        void SetupVertexShaders();
+        CbMaterial MakeMaterialConstants() const;
+
+        // 메시는 워커에서 로드하고, 끝날 때까지는 이전 메시를 그림 (처음이면 그리지 않음)
+        void RequestMesh();
+        void ApplyMesh(const std::shared_ptr<StaticMeshData>& staticMeshData);
     };
 }
\ No newline at end of file
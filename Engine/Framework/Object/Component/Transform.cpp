@@ -5,17 +5,28 @@
 
 #include "Common/Math/MathUtility.h"
 #include "Common/Utility/JsonHelper.h"
-#include "Common/Utility/StaticMemoryPool.h"
+#include "Common/Utility/SlabMemoryPool.h"
 #include "Framework/System/SystemManager.h"
 #include "Framework/System/TransformSystem.h"
 #include "Framework/Object/GameObject/GameObject.h"
 #include "Framework/Object/Component/RectTransform.h"
+#include "Framework/Object/Component/Renderer.h"
 
 namespace engine
 {
     namespace
     {
-        StaticMemoryPool<Transform, 4096> g_transformPool;
+        SlabMemoryPool<Transform, 256, true> g_transformPool{ "Transform" };
+
+        TransformSystem& GetTransformSystem()
+        {
+            return SystemManager::Get().GetTransformSystem();
+        }
+    }
+
+    Transform::Transform()
+    {
+        m_slot = GetTransformSystem().CreateSlot(this);
     }
 
     Transform::~Transform()
@@ -25,13 +36,17 @@ namespace engine
             m_parent->RemoveChild(this);
         }
 
+        auto& transformSystem = GetTransformSystem();
+
         for (Transform* child : m_children)
         {
             child->m_parent = nullptr;
+            transformSystem.SetParentSlot(child->m_slot, -1);
             child->MarkDirty();
         }
 
-        SystemManager::Get().GetTransformSystem().Unregister(this);
+        transformSystem.Unregister(this);
+        transformSystem.DestroySlot(m_slot);
     }
 
     void* Transform::operator new(size_t size)
@@ -39,9 +54,9 @@ namespace engine
         return g_transformPool.Allocate(size);
     }
 
-    void Transform::operator delete(void* ptr)
+    void Transform::operator delete(void* ptr, size_t size)
     {
-        g_transformPool.Deallocate(ptr);
+        g_transformPool.Deallocate(ptr, size);
     }
 
     void Transform::Initialize()
@@ -49,19 +64,19 @@ namespace engine
         SystemManager::Get().GetTransformSystem().Register(this);
     }
 
-    const Vector3& Transform::GetLocalPosition() const
+    Vector3 Transform::GetLocalPosition() const
     {
-        return m_localPosition;
+        return GetTransformSystem().m_localPositions[m_slot];
     }
 
-    const Quaternion& Transform::GetLocalRotation() const
+    Quaternion Transform::GetLocalRotation() const
     {
-        return m_localRotation;
+        return GetTransformSystem().m_localRotations[m_slot];
     }
 
-    const Vector3& Transform::GetLocalScale() const
+    Vector3 Transform::GetLocalScale() const
     {
-        return m_localScale;
+        return GetTransformSystem().m_localScales[m_slot];
     }
 
     Vector3 Transform::GetWorldPosition()
@@ -74,14 +89,14 @@ namespace engine
         return m_localEulerRotation;
     }
 
-    const Matrix& Transform::GetWorld()
+    Matrix Transform::GetWorld()
     {
-        if (m_isDirty)
-        {
-            RecalculateWorldMatrix();
-        }
+        return GetTransformSystem().GetWorld(m_slot);
+    }
 
-        return m_world;
+    std::uint32_t Transform::GetWorldVersion() const
+    {
+        return GetTransformSystem().m_worldVersions[m_slot];
     }
 
     Vector3 Transform::GetForward()
@@ -106,14 +121,14 @@ namespace engine
 
     void Transform::SetLocalPosition(const Vector3& position)
     {
-        m_localPosition = position;
+        GetTransformSystem().m_localPositions[m_slot] = position;
 
         MarkDirty();
     }
 
     void Transform::SetLocalRotation(const Quaternion& rotation)
     {
-        m_localRotation = rotation;
+        GetTransformSystem().m_localRotations[m_slot] = rotation;
 
         Vector3 euler = rotation.ToEuler();
         m_localEulerRotation.x = ToDegree(euler.x);
@@ -125,7 +140,7 @@ namespace engine
 
     void Transform::SetLocalRotation(const Vector3& euler)
     {
-        m_localRotation = Quaternion::CreateFromYawPitchRoll(
+        GetTransformSystem().m_localRotations[m_slot] = Quaternion::CreateFromYawPitchRoll(
             ToRadian(euler.y),
             ToRadian(euler.x),
             ToRadian(euler.z));
@@ -137,16 +152,14 @@ namespace engine
 
     void Transform::SetLocalScale(const Vector3& scale)
     {
-        m_localScale = scale;
+        GetTransformSystem().m_localScales[m_slot] = scale;
 
         MarkDirty();
     }
 
     void Transform::SetLocalScale(float scale)
     {
-        m_localScale.x = scale;
-        m_localScale.y = scale;
-        m_localScale.z = scale;
+        GetTransformSystem().m_localScales[m_slot] = Vector3(scale, scale, scale);
 
         MarkDirty();
     }
@@ -159,6 +172,8 @@ namespace engine
         }
 
         m_parent = parent;
+        GetTransformSystem().SetParentSlot(m_slot, m_parent != nullptr ? m_parent->m_slot : -1);
+
         bool parentActive = true;
 
         if (m_parent != nullptr)
@@ -172,6 +187,34 @@ namespace engine
         MarkDirty();
     }
 
+    void Transform::SetSiblingIndex(std::size_t index)
+    {
+        if (m_parent == nullptr)
+        {
+            return;
+        }
+
+        auto& siblings = m_parent->m_children;
+
+        const auto iter = std::ranges::find(siblings, this);
+        if (iter == siblings.end())
+        {
+            return;
+        }
+
+        const std::size_t current = static_cast<std::size_t>(iter - siblings.begin());
+        index = std::min(index, siblings.size() - 1);
+
+        if (current < index)
+        {
+            std::rotate(iter, iter + 1, siblings.begin() + index + 1);
+        }
+        else if (index < current)
+        {
+            std::rotate(siblings.begin() + index, iter, iter + 1);
+        }
+    }
+
     const std::vector<Transform*>& Transform::GetChildren() const
     {
         return m_children;
@@ -232,31 +275,34 @@ namespace engine
 
         Quaternion deltaRotation = Quaternion::CreateFromAxisAngle(normalizedAxis, radian);
 
+        Quaternion& localRotation = GetTransformSystem().m_localRotations[m_slot];
         if (isLocal)
         {
-            m_localRotation = m_localRotation * deltaRotation;
+            localRotation = localRotation * deltaRotation;
         }
         else
         {
-            m_localRotation = deltaRotation * m_localRotation;
+            localRotation = deltaRotation * localRotation;
         }
 
-        m_localRotation.Normalize();
+        localRotation.Normalize();
 
         MarkDirty();
     }
 
     void Transform::Translate(const Vector3& translation, bool isLocal)
     {
+        auto& transformSystem = GetTransformSystem();
+
         if (isLocal)
         {
-            Vector3 localTranslation = Vector3::Transform(translation, m_localRotation);
+            Vector3 localTranslation = Vector3::Transform(translation, transformSystem.m_localRotations[m_slot]);
 
-            m_localPosition += localTranslation;
+            transformSystem.m_localPositions[m_slot] += localTranslation;
         }
         else
         {
-            m_localPosition += translation;
+            transformSystem.m_localPositions[m_slot] += translation;
         }
 
         MarkDirty();
@@ -264,9 +310,9 @@ namespace engine
 
     void Transform::OnGui()
     {
-        if (ImGui::DragFloat3("Position", &m_localPosition.x, 0.1f))
+        if (auto position = GetLocalPosition(); ImGui::DragFloat3("Position", &position.x, 0.1f))
         {
-            MarkDirty();
+            SetLocalPosition(position);
         }
 
         if (auto euler = GetLocalEulerAngles(); ImGui::DragFloat3("Rotation", &euler.x, 0.1f))
@@ -274,9 +320,9 @@ namespace engine
             SetLocalRotation(euler);
         }
 
-        if (ImGui::DragFloat3("Scale", &m_localScale.x, 0.1f))
+        if (auto scale = GetLocalScale(); ImGui::DragFloat3("Scale", &scale.x, 0.1f))
         {
-            MarkDirty();
+            SetLocalScale(scale);
         }
     }
 
@@ -284,19 +330,26 @@ namespace engine
     {
         Object::Save(j);
 
-        j["Position"] = m_localPosition;
-        j["Rotation"] = m_localRotation;
-        j["Scale"] = m_localScale;
+        j["Position"] = GetLocalPosition();
+        j["Rotation"] = GetLocalRotation();
+        j["Scale"] = GetLocalScale();
     }
 
     void Transform::Load(const json& j)
     {
         Object::Load(j);
 
-        JsonGet(j, "Position", m_localPosition);
-        JsonGet(j, "Rotation", m_localRotation);
-        SetLocalRotation(m_localRotation);
-        JsonGet(j, "Scale", m_localScale);
+        Vector3 position = GetLocalPosition();
+        Quaternion rotation = GetLocalRotation();
+        Vector3 scale = GetLocalScale();
+
+        JsonGet(j, "Position", position);
+        JsonGet(j, "Rotation", rotation);
+        JsonGet(j, "Scale", scale);
+
+        SetLocalPosition(position);
+        SetLocalRotation(rotation);
+        SetLocalScale(scale);
     }
 
     std::string Transform::GetType() const
@@ -304,32 +357,13 @@ namespace engine
         return "Transform";
     }
 
-    void Transform::RecalculateWorldMatrix()
-    {
-        const Matrix local = Matrix::CreateScale(m_localScale) *
-            Matrix::CreateFromQuaternion(m_localRotation) *
-            Matrix::CreateTranslation(m_localPosition);
-
-        if (m_parent != nullptr)
-        {
-            m_world = local * m_parent->GetWorld();
-        }
-        else
-        {
-            m_world = local;
-        }
-
-        m_isDirty = false;
-    }
-
     void Transform::MarkDirty()
     {
-        if (m_isDirty)
+        if (!GetTransformSystem().MarkDirty(m_slot))
         {
             return;
         }
-        
-        m_isDirty = true;
+
         m_isDirtyThisFrame = true;
         
         for (auto child : m_children)
@@ -337,7 +371,21 @@ namespace engine
             child->MarkDirty();
         }
 
-        if (auto* rt = GetGameObject()->GetComponent<RectTransform>())
+        GameObject* gameObject = GetGameObject();
+
+        // RenderSystem BVH 리프 갱신 (Renderer가 없으면 타입 마스크만 보고 넘어감)
+        if (gameObject->HasComponent<Renderer>())
+        {
+            for (const auto& component : gameObject->GetComponents())
+            {
+                if (auto* renderer = ComponentCast<Renderer>(component.get()))
+                {
+                    renderer->MarkBoundsDirty();
+                }
+            }
+        }
+
+        if (auto* rt = gameObject->GetComponent<RectTransform>())
             rt->MarkUIDirty();
     }
 
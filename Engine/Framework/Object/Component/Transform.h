@@ -7,40 +7,41 @@ namespace engine
     class Transform :
         public Component
     {
+        COMPONENT_TYPE(Transform)
+
     private:
-        Vector3 m_localPosition{ 0.0f, 0.0f, 0.0f };
-        Quaternion m_localRotation = Quaternion::Identity;
-        Vector3 m_localScale{ 1.0f, 1.0f, 1.0f };
-        Vector3 m_localEulerRotation{ 0.0f, 0.0f, 0.0f };
+        // local TRS, world 행렬, dirty 플래그는 TransformSystem의 SoA 배열에 있음
+        std::int32_t m_slot = -1;
 
-        Matrix m_world{ Matrix::Identity };
+        Vector3 m_localEulerRotation{ 0.0f, 0.0f, 0.0f };
 
         Transform* m_parent = nullptr;
         std::vector<Transform*> m_children;
 
-        bool m_isDirty = true;
         bool m_isDirtyThisFrame = true;
 
     public:
-        Transform() = default;
+        Transform();
         ~Transform();
 
         static void* operator new(size_t size);
-        static void operator delete(void* ptr);
+        static void operator delete(void* ptr, size_t size);
 
     public:
         void Initialize() override;
 
     public:
-        const Vector3& GetLocalPosition() const;
-        const Quaternion& GetLocalRotation() const;
-        const Vector3& GetLocalScale() const;
+        // TransformSystem의 배열은 새 Transform이 등록되면 재할당되므로 값으로 돌려줌
+        Vector3 GetLocalPosition() const;
+        Quaternion GetLocalRotation() const;
+        Vector3 GetLocalScale() const;
 
         Vector3 GetWorldPosition();
 
         Vector3 GetLocalEulerAngles() const;
 
-        const Matrix& GetWorld();
+        Matrix GetWorld();
+        std::uint32_t GetWorldVersion() const; // world 행렬이 다시 계산될 때마다 증가
 
         Vector3 GetForward();
         Vector3 GetUp();
@@ -58,6 +59,8 @@ namespace engine
         void SetLocalScale(float scale);
 
         void SetParent(Transform* parent);
+        // 부모의 자식 목록에서 위치를 옮김 (부모가 없으면 무시)
+        void SetSiblingIndex(std::size_t index);
 
         void UnmarkDirtyThisFrame();
         bool IsAncestorOf(Transform* other) const;
@@ -73,9 +76,11 @@ namespace engine
         std::string GetType() const override;
 
     private:
-        void RecalculateWorldMatrix();
         void MarkDirty();
         void AddChild(Transform* child);
         void RemoveChild(Transform* child);
+
+    private:
+        friend class TransformSystem;
     };
 }
\ No newline at end of file
@@ -168,7 +168,9 @@ namespace engine
 		}
 
 		m_textureFilePath = textureFilePath;
-		m_texture = ResourceManager::Get().GetOrCreateTexture(textureFilePath);
+
+		// 디코드가 끝날 때까지는 흰 텍스처로 그림 (끝나면 같은 Texture가 바뀜)
+		m_texture = ResourceManager::Get().RequestTexture(textureFilePath).Get();
 	}
 
 	const std::string& UIImage::GetTexturePath() const
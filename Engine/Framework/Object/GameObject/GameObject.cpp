@@ -2,7 +2,7 @@
 #include "GameObject.h"
 
 #include "Common/Utility/JsonHelper.h"
-#include "Common/Utility/StaticMemoryPool.h"
+#include "Common/Utility/SlabMemoryPool.h"
 #include "Framework/Object/Component/Component.h"
 #include "Framework/Object/Component/Transform.h"
 #include "Framework/Object/Component/RectTransform.h"
@@ -14,7 +14,7 @@ namespace engine
 {
     namespace
     {
-        StaticMemoryPool<GameObject, 4096> g_gameObjectPool;
+        SlabMemoryPool<GameObject, 256, true> g_gameObjectPool{ "GameObject" };
     }
 
     GameObject::GameObject()
@@ -29,9 +29,9 @@ namespace engine
         return g_gameObjectPool.Allocate(size);
     }
 
-    void GameObject::operator delete(void* ptr)
+    void GameObject::operator delete(void* ptr, size_t size)
     {
-        g_gameObjectPool.Deallocate(ptr);
+        g_gameObjectPool.Deallocate(ptr, size);
     }
 
     Transform* GameObject::GetTransform() const
@@ -103,6 +103,8 @@ namespace engine
         }
 
         m_components.pop_back();
+
+        RebuildComponentLookup();
     }
 
     void GameObject::BroadcastOnDestroy()
@@ -146,6 +148,49 @@ namespace engine
         SceneManager::Get().GetScene()->RegisterPendingAdd(component);
     }
 
+    void GameObject::AddComponentLookup(Component* component)
+    {
+        assert(component->m_gameObjectIndex < UINT8_MAX);
+
+        m_componentLookup.Add(component->GetTypeMask(), component->m_gameObjectIndex);
+    }
+
+    void GameObject::RebuildComponentLookup()
+    {
+        m_componentLookup.Clear();
+
+        for (const auto& component : m_components)
+        {
+            AddComponentLookup(component.get());
+        }
+    }
+
+    void GameObject::ReorderComponents(std::span<Component* const> order)
+    {
+        std::size_t next = 0;
+
+        for (Component* component : order)
+        {
+            const std::int32_t index = component->m_gameObjectIndex;
+            if (index < static_cast<std::int32_t>(next) || index >= m_components.size() || m_components[index].get() != component)
+            {
+                continue;
+            }
+
+            // [next, index] 구간을 한 칸씩 밀어서 나머지의 상대 순서를 유지
+            std::rotate(m_components.begin() + next, m_components.begin() + index, m_components.begin() + index + 1);
+
+            for (std::size_t i = next; i <= static_cast<std::size_t>(index); ++i)
+            {
+                m_components[i]->m_gameObjectIndex = static_cast<std::int32_t>(i);
+            }
+
+            ++next;
+        }
+
+        RebuildComponentLookup();
+    }
+
     void GameObject::UpdateActiveInHierarchy(bool parentActive)
     {
         bool newActiveInHierarchy = parentActive && m_active;
@@ -210,6 +255,7 @@ namespace engine
 
         ptr->m_owner = this;
         ptr->m_gameObjectIndex = static_cast<std::int32_t>(m_components.size() - 1);
+        AddComponentLookup(ptr);
 
         SceneManager::Get().GetScene()->RegisterPendingAdd(ptr);
 
@@ -237,6 +283,8 @@ namespace engine
         {
             m_components[i]->m_gameObjectIndex = static_cast<int32_t>(i);
         }
+
+        RebuildComponentLookup();
     }
 
     RectTransform* GameObject::ReplaceTransformWithRectTransform()
@@ -1,6 +1,9 @@
 ﻿#pragma once
 
+#include <span>
+
 #include "Framework/Object/Object.h"
+#include "Framework/Object/Component/ComponentType.h"
 #include "Framework/Scene/SceneManager.h"
 
 namespace engine
@@ -15,6 +18,7 @@ namespace engine
     private:
         std::string m_name = "GameObject";
         std::vector<std::unique_ptr<Component>> m_components;
+        ComponentLookup m_componentLookup; // 타입 번호 -> m_components 인덱스
         Transform* m_transform;
         std::int32_t m_sceneIndex = -1;
 
@@ -27,7 +31,7 @@ namespace engine
         ~GameObject() = default;
 
         static void* operator new(size_t size);
-        static void operator delete(void* ptr);
+        static void operator delete(void* ptr, size_t size);
 
     public:
         Transform* GetTransform() const;
@@ -50,6 +54,11 @@ namespace engine
 
     private:
         void RegisterComponentPendingAdd(Component* component);
+        void AddComponentLookup(Component* component);
+        void RebuildComponentLookup();
+
+        // order의 컴포넌트를 그 순서대로 앞에 두고 나머지는 원래 순서대로 뒤에 둠 (SceneSnapshot::Restore)
+        void ReorderComponents(std::span<Component* const> order);
 
     public:
         template <std::derived_from<Component> T, typename... Args>
@@ -62,6 +71,7 @@ namespace engine
 
             ptr->m_owner = this;
             ptr->m_gameObjectIndex = static_cast<std::int32_t>(m_components.size() - 1);
+            AddComponentLookup(ptr);
             RegisterComponentPendingAdd(ptr);
 
             return ptr;
@@ -69,18 +79,27 @@ namespace engine
 
         Component* AddComponent(std::unique_ptr<Component>&& component);
 
+        // T는 REGISTER_COMPONENT / COMPONENT_TYPE를 선언했거나 ComponentBaseTypes 중 하나
         template <std::derived_from<Component> T>
         T* GetComponent()
         {
-            for (const auto& component : m_components)
+            static_assert(LookupComponent<T>, "GetComponent<T>: T must declare REGISTER_COMPONENT or COMPONENT_TYPE");
+
+            const std::uint32_t typeId = GetComponentTypeId<T>();
+            if (!m_componentLookup.Has(typeId))
             {
-                if (T* casted = dynamic_cast<T*>(component.get()); casted != nullptr)
-                {
-                    return casted;
-                }
+                return nullptr;
             }
 
-            return nullptr;
+            return static_cast<T*>(m_components[m_componentLookup.Find(typeId)].get());
+        }
+
+        template <std::derived_from<Component> T>
+        bool HasComponent() const
+        {
+            static_assert(LookupComponent<T>, "HasComponent<T>: T must declare REGISTER_COMPONENT or COMPONENT_TYPE");
+
+            return m_componentLookup.Has(GetComponentTypeId<T>());
         }
 
         const std::vector<std::unique_ptr<Component>>& GetComponents() const;
@@ -96,5 +115,6 @@ namespace engine
 
     private:
         friend class Scene;
+        friend class SceneSnapshot;
     };
 }
\ No newline at end of file
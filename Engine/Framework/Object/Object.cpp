@@ -1,21 +1,116 @@
 ﻿#include "EnginePCH.h"
 #include "Object.h"
 
-#include <queue>
+#include <atomic>
 
 namespace engine
 {
     namespace
     {
+        // 고정 크기 청크를 한번 할당하면 해제하지 않으므로 엔트리 주소가 바뀌지 않음
+        // -> 어느 스레드에서든 잠금 없이 핸들을 풀 수 있음
+        constexpr std::uint32_t CHUNK_SIZE = 1024;
+        constexpr std::uint32_t MAX_CHUNK_COUNT = 1024;
+        constexpr std::uint32_t INVALID_INDEX = UINT32_MAX;
+
         struct ObjectEntry
         {
-            Object* object = nullptr;
-            std::uint32_t generation = 0;
-            bool active = false;
+            std::atomic<Object*> object = nullptr;
+            std::atomic<std::uint32_t> generation = 1; // 해제될 때 증가 (이전 핸들 무효화)
+            std::atomic<std::uint32_t> nextFree = INVALID_INDEX;
+        };
+
+        struct ObjectChunk
+        {
+            std::array<ObjectEntry, CHUNK_SIZE> entries;
         };
 
-        std::vector<ObjectEntry> g_objects;
-        std::queue<std::uint32_t> g_freeIndices;
+        class ObjectRegistry
+        {
+        private:
+            std::array<std::atomic<ObjectChunk*>, MAX_CHUNK_COUNT> m_chunks{};
+            std::atomic<std::uint32_t> m_entryCount = 0;
+
+            // 하위 32비트: 빈 인덱스, 상위 32비트: ABA 방지용 태그
+            std::atomic<std::uint64_t> m_freeHead = INVALID_INDEX;
+
+        public:
+            ~ObjectRegistry()
+            {
+                for (auto& chunk : m_chunks)
+                {
+                    delete chunk.load(std::memory_order_relaxed);
+                }
+            }
+
+            ObjectEntry* Find(std::uint32_t index) const
+            {
+                const std::uint32_t chunkIndex = index / CHUNK_SIZE;
+                if (chunkIndex >= MAX_CHUNK_COUNT)
+                {
+                    return nullptr;
+                }
+
+                ObjectChunk* chunk = m_chunks[chunkIndex].load(std::memory_order_acquire);
+                if (chunk == nullptr)
+                {
+                    return nullptr;
+                }
+
+                return &chunk->entries[index % CHUNK_SIZE];
+            }
+
+            std::uint32_t Allocate()
+            {
+                // 1. 빈 목록에서 꺼냄
+                std::uint64_t head = m_freeHead.load(std::memory_order_acquire);
+                while (static_cast<std::uint32_t>(head) != INVALID_INDEX)
+                {
+                    const std::uint32_t index = static_cast<std::uint32_t>(head);
+                    const std::uint32_t next = Find(index)->nextFree.load(std::memory_order_relaxed);
+                    const std::uint64_t newHead = ((head >> 32) + 1) << 32 | next;
+
+                    if (m_freeHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire))
+                    {
+                        return index;
+                    }
+                }
+
+                // 2. 새 엔트리 (청크가 없으면 만들고, 경쟁에서 지면 버림)
+                const std::uint32_t index = m_entryCount.fetch_add(1, std::memory_order_relaxed);
+                const std::uint32_t chunkIndex = index / CHUNK_SIZE;
+
+                FATAL_CHECK(chunkIndex < MAX_CHUNK_COUNT, "Object 개수 초과");
+
+                if (m_chunks[chunkIndex].load(std::memory_order_acquire) == nullptr)
+                {
+                    auto* chunk = new ObjectChunk();
+                    ObjectChunk* expected = nullptr;
+
+                    if (!m_chunks[chunkIndex].compare_exchange_strong(expected, chunk, std::memory_order_acq_rel))
+                    {
+                        delete chunk;
+                    }
+                }
+
+                return index;
+            }
+
+            void Free(std::uint32_t index)
+            {
+                ObjectEntry* entry = Find(index);
+
+                std::uint64_t head = m_freeHead.load(std::memory_order_relaxed);
+                std::uint64_t newHead = 0;
+                do
+                {
+                    entry->nextFree.store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+                    newHead = ((head >> 32) + 1) << 32 | index;
+                } while (!m_freeHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+            }
+        };
+
+        ObjectRegistry g_objects;
     }
 
     Object::Object()
@@ -35,18 +130,21 @@ namespace engine
 
     Object* Object::GetObjectFromHandle(Handle handle)
     {
-        if (handle.index >= g_objects.size())
+        const ObjectEntry* entry = g_objects.Find(handle.index);
+        if (entry == nullptr || entry->generation.load(std::memory_order_acquire) != handle.generation)
         {
             return nullptr;
         }
 
-        if (const auto& entry = g_objects[handle.index];
-            (entry.generation == handle.generation) && entry.active)
+        Object* object = entry->object.load(std::memory_order_acquire);
+
+        // 읽는 사이에 해제 후 재사용되었으면 다른 객체이므로 버림
+        if (entry->generation.load(std::memory_order_acquire) != handle.generation)
         {
-            return entry.object;
+            return nullptr;
         }
 
-        return nullptr; // 이미 삭제되었거나 재사용된 객체임
+        return object; // 이미 삭제되었으면 nullptr
     }
 
     bool Object::IsActive() const
@@ -86,42 +184,27 @@ namespace engine
 
     void Object::RegisterObject(Object* object)
     {
-        std::uint32_t index = 0;
-        std::uint32_t generation = 0;
-
-        if (!g_freeIndices.empty())
-        {
-            index = g_freeIndices.front();
-            g_freeIndices.pop();
-
-            generation = g_objects[index].generation + 1;
-        }
-        else
-        {
-            index = static_cast<std::uint32_t>(g_objects.size());
-            generation = 1;
-            g_objects.push_back({});
-        }
+        const std::uint32_t index = g_objects.Allocate();
+        ObjectEntry* entry = g_objects.Find(index);
 
-        g_objects[index].object = object;
-        g_objects[index].generation = generation;
-        g_objects[index].active = true;
+        m_handle = { index, entry->generation.load(std::memory_order_relaxed) };
 
-        m_handle = { index, generation };
+        entry->object.store(object, std::memory_order_release);
     }
 
     void Object::UnregisterObject(Object* object)
     {
-        std::uint32_t index = object->m_handle.index;
+        ObjectEntry* entry = g_objects.Find(object->m_handle.index);
 
         // Handle에 임의 값 할당 되었음. 일어나면 안되는 상황
-        assert(object->m_handle.index < g_objects.size());
-        assert(g_objects[index].object == object);
+        assert(entry != nullptr);
+        assert(entry->object.load(std::memory_order_relaxed) == object);
 
-        g_objects[index].object = nullptr;
-        g_objects[index].active = false;
+        // 세대를 먼저 올려서 이 핸들로 들어오는 조회를 막은 뒤 비움
+        entry->generation.fetch_add(1, std::memory_order_acq_rel);
+        entry->object.store(nullptr, std::memory_order_release);
 
-        g_freeIndices.push(index);
+        g_objects.Free(object->m_handle.index);
     }
 
 }
\ No newline at end of file
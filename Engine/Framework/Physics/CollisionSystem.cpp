@@ -282,12 +282,20 @@ namespace engine
         m_pendingTriggerEvents.clear();
     }
 
+    void CollisionSystem::Reset()
+    {
+        ClearPendingEvents();
+
+        m_activeTriggerPairs.clear();
+        m_activeAttacks.clear();
+    }
+
     // ═══════════════════════════════════════════════════════════════
     // 콜백 디스패치
     // ═══════════════════════════════════════════════════════════════
 
     void CollisionSystem::DispatchCollisionEnter(
-        Ptr<Collider> a, Ptr<Collider> b, const std::vector<ContactPoint>& contacts)
+        Ptr<Collider> a, Ptr<Collider> b, const FrameVector<ContactPoint>& contacts)
     {
         // 디스패치 시점에 다시 유효성 검사
         if (!a || !b) return;
@@ -323,7 +331,7 @@ namespace engine
     }
 
     void CollisionSystem::DispatchCollisionStay(
-        Ptr<Collider> a, Ptr<Collider> b, const std::vector<ContactPoint>& contacts)
+        Ptr<Collider> a, Ptr<Collider> b, const FrameVector<ContactPoint>& contacts)
     {
         // Enter와 유사하게 구현
         if (!a || !b) return;
@@ -377,10 +385,10 @@ namespace engine
         // TODO: 구현
     }
 
-    std::vector<ContactPoint> CollisionSystem::FlipContactNormals(
-        const std::vector<ContactPoint>& contacts)
+    FrameVector<ContactPoint> CollisionSystem::FlipContactNormals(
+        const FrameVector<ContactPoint>& contacts)
     {
-        std::vector<ContactPoint> flipped = contacts;
+        FrameVector<ContactPoint> flipped = contacts;
         for (ContactPoint& cp : flipped)
         {
             cp.normal = -cp.normal;
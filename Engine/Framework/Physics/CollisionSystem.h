@@ -129,12 +129,15 @@ namespace engine
         // ═══════════════════════════════════════
         void ClearPendingEvents();
 
+        // 이벤트 큐와 진행 중인 트리거 / 공격 상태를 모두 비움 (에디터 Stop)
+        void Reset();
+
     private:
         void ProcessCollisionEvents();
         void ProcessTriggerEvents();
 
-        void DispatchCollisionEnter(Ptr<Collider> a, Ptr<Collider> b, const std::vector<ContactPoint>& contacts);
-        void DispatchCollisionStay(Ptr<Collider> a, Ptr<Collider> b, const std::vector<ContactPoint>& contacts);
+        void DispatchCollisionEnter(Ptr<Collider> a, Ptr<Collider> b, const FrameVector<ContactPoint>& contacts);
+        void DispatchCollisionStay(Ptr<Collider> a, Ptr<Collider> b, const FrameVector<ContactPoint>& contacts);
         void DispatchCollisionExit(Ptr<Collider> a, Ptr<Collider> b);
 
         void DispatchTriggerEnter(Ptr<Collider> trigger, Ptr<Collider> other);
@@ -142,7 +145,7 @@ namespace engine
         void DispatchTriggerExit(Ptr<Collider> trigger, Ptr<Collider> other);
 
         // 접촉점 노말 반전 (상대방에게 전달할 때)
-        std::vector<ContactPoint> FlipContactNormals(const std::vector<ContactPoint>& contacts);
+        FrameVector<ContactPoint> FlipContactNormals(const FrameVector<ContactPoint>& contacts);
 
         // Handle로부터 TriggerPair 생성
         TriggerPair MakeTriggerPair(Collider* trigger, Collider* other);
@@ -3,6 +3,7 @@
 #include <vector>
 #include <cstdint>
 
+#include "Common/Utility/FrameArena.h"
 #include "Framework/Object/Ptr.h"
 
 namespace engine
@@ -32,7 +33,7 @@ namespace engine
         Ptr<Collider> collider;             // 충돌한 상대 콜라이더
         Ptr<Rigidbody> rigidbody;           // 상대 리지드바디 (있으면)
         Ptr<GameObject> gameObject;         // 상대 게임오브젝트
-        std::vector<ContactPoint> contacts; // 접촉점들
+        FrameVector<ContactPoint> contacts; // 접촉점들 (프레임 아레나, 저장하려면 복사)
         Vector3 relativeVelocity;           // 상대 속도
         float totalImpulse = 0.0f;          // 총 충격량
     };
@@ -88,7 +89,7 @@ namespace engine
         CollisionEventType type;
         Ptr<Collider> colliderA;
         Ptr<Collider> colliderB;
-        std::vector<ContactPoint> contacts;
+        FrameVector<ContactPoint> contacts; // 같은 프레임에 처리하므로 프레임 아레나에 둠
         
         // 우선순위 시스템용
         CollisionPriority priority = CollisionPriority::Default;
@@ -163,7 +163,7 @@ namespace engine
 
     void PhysicsEventCallback::ExtractContactPoints(
         const physx::PxContactPair& pair,
-        std::vector<ContactPoint>& outContacts)
+        FrameVector<ContactPoint>& outContacts)
     {
         const physx::PxU32 maxContacts = 16;
         physx::PxContactPairPoint contactPoints[maxContacts];
@@ -64,7 +64,7 @@ namespace engine
         // 접촉점 추출
         void ExtractContactPoints(
             const physx::PxContactPair& pair,
-            std::vector<ContactPoint>& outContacts
+            FrameVector<ContactPoint>& outContacts
         );
     };
 
@@ -1,6 +1,7 @@
 ﻿#include "EnginePCH.h"
 #include "PhysicsDebugRenderer.h"
 
+#include "Common/Utility/FrameArena.h"
 #include "Framework/Physics/PhysicsSystem.h"
 #include "Framework/Object/Component/Collider.h"
 #include "Framework/Object/Component/BoxCollider.h"
@@ -164,13 +165,13 @@ namespace engine
     void PhysicsDebugRenderer::RenderColliders()
     {
         // 에디터 모드에서도 작동하도록 씬에서 직접 콜라이더를 찾음
-        std::vector<Collider*> colliders;
+        FrameVector<Collider*> colliders;
         
         // PhysicsSystem에 등록된 콜라이더 (Play 모드)
         const auto& registeredColliders = PhysicsSystem::Get().GetRegisteredColliders();
         if (!registeredColliders.empty())
         {
-            colliders = registeredColliders;
+            colliders.assign(registeredColliders.begin(), registeredColliders.end());
         }
         else
         {
@@ -178,6 +179,8 @@ namespace engine
             Scene* scene = SceneManager::Get().GetScene();
             if (scene)
             {
+                colliders.reserve(scene->GetGameObjects().size());
+
                 for (const auto& go : scene->GetGameObjects())
                 {
                     if (!go) continue;
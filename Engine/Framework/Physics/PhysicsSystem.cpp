@@ -239,14 +239,23 @@ namespace engine
         {
             if (!go) continue;
 
+            // Awake를 여기서 부르므로 Scene::BeginPlay에서 다시 부르지 않도록 MarkAsAwoken
+
             // Rigidbody 등록 및 초기화
             if (Rigidbody* rb = go->GetComponent<Rigidbody>())
             {
-                if (!rb->GetPxActor())
+                const bool isReused = rb->GetPxActor() != nullptr;
+                if (!isReused)
                 {
                     rb->Awake();  // Actor 생성
                 }
                 RegisterRigidbody(rb);
+
+                if (isReused)
+                {
+                    rb->ResetPxActorState();
+                }
+                rb->MarkAsAwoken();
             }
 
             // Collider 등록 및 초기화
@@ -256,7 +265,24 @@ namespace engine
                 {
                     collider->Awake();  // Shape 생성
                 }
+                else if (physx::PxRigidStatic* staticActor = collider->GetOwnedStaticActor(); staticActor && !staticActor->getScene())
+                {
+                    // 이전 Play의 독립 Actor를 새 Scene에 다시 넣음 (위치는 CreateOwnedStaticActor와 같은 방식)
+                    if (collider->IgnoresWorldRotation())
+                    {
+                        staticActor->setGlobalPose(physx::PxTransform(PhysicsUtility::ToPxVec3(collider->GetTransform()->GetWorldPosition())));
+                    }
+                    else
+                    {
+                        staticActor->setGlobalPose(PhysicsUtility::ToPxTransform(collider->GetTransform()));
+                    }
+                    if (physx::PxScene* pxScene = GetActivePxScene())
+                    {
+                        pxScene->addActor(*staticActor);
+                    }
+                }
                 RegisterCollider(collider);
+                collider->MarkAsAwoken();
             }
 
             // CharacterController 등록 및 초기화
@@ -267,6 +293,7 @@ namespace engine
                     controller->Awake();  // Controller 생성
                 }
                 RegisterController(controller);
+                controller->MarkAsAwoken();
             }
         }
     }
@@ -281,6 +308,16 @@ namespace engine
 
         PxSceneData& data = it->second;
 
+        // 컨트롤러는 ControllerManager와 같이 해제되므로 컴포넌트가 들고 있는 포인터를 먼저 정리
+        // (Rigidbody / Collider의 Actor는 컴포넌트가 계속 들고 있다가 다음 Play에서 다시 씀)
+        for (CharacterController* controller : data.controllers)
+        {
+            if (controller)
+            {
+                controller->ReleasePxController();
+            }
+        }
+
         // 컴포넌트 정리
         data.rigidbodies.clear();
         data.colliders.clear();
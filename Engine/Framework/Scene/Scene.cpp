@@ -5,16 +5,62 @@
 #include <fstream>
 
 #include "Common/Utility/JsonHelper.h"
+#include "Common/Utility/MappedFile.h"
+#include "Common/Utility/SlabMemoryPool.h"
 #include "Framework/Object/GameObject/GameObject.h"
 #include "Framework/Object/Component/Component.h"
+#include "Framework/Object/Component/ComponentFactory.h"
 #include "Framework/Object/Component/Camera.h"
+#include "Framework/Object/Component/Light.h"
+#include "Framework/Object/Component/StaticMeshRenderer.h"
+#include "Framework/Object/Component/SkeletalMeshRenderer.h"
+#include "Framework/Object/Component/BoxCollider.h"
+#include "Framework/Object/Component/SphereCollider.h"
+#include "Framework/Object/Component/CapsuleCollider.h"
+#include "Framework/Object/Component/Rigidbody.h"
 #include "Framework/Object/Component/Transform.h"
 #include <Framework/Object/Component/RectTransform.h>
+#include "Framework/Object/Component/Script.h"
 #include "Framework/System/SystemManager.h"
 #include "Framework/System/CameraSystem.h"
+#include "Framework/System/ScriptSystem.h"
+#include "Framework/Scene/SceneBinary.h"
 
 namespace engine
 {
+    namespace
+    {
+        // JSON을 직접 고친 경우 바이너리가 더 오래되었으므로 JSON을 읽음
+        bool IsBinarySceneUpToDate(const std::filesystem::path& jsonPath, const std::filesystem::path& binaryPath)
+        {
+            std::error_code ec;
+
+            const auto binaryTime = std::filesystem::last_write_time(binaryPath, ec);
+            if (ec)
+            {
+                return false;
+            }
+
+            const auto jsonTime = std::filesystem::last_write_time(jsonPath, ec);
+            if (ec)
+            {
+                return true;
+            }
+
+            return binaryTime >= jsonTime;
+        }
+
+        // 타입별 블록의 레코드로 컴포넌트를 만듦 (JSON 없이)
+        template <typename T, typename Record, typename... Args>
+        std::unique_ptr<Component> CreateFromRecord(const Record& record, const Args&... args)
+        {
+            auto component = std::make_unique<T>();
+            component->LoadBinary(record, args...);
+
+            return component;
+        }
+    }
+
     GameObject* Scene::CreateGameObject(const std::string& name)
     {
         //m_incubator.push_back(std::make_unique<GameObject>());
@@ -137,22 +183,7 @@ namespace engine
                 break;
             }
 
-            if (!m_incubator.empty())
-            {
-                size_t neededCapacity = m_gameObjects.size() + m_incubator.size();
-                if (m_gameObjects.capacity() < neededCapacity)
-                {
-                    m_gameObjects.reserve(neededCapacity * 2);
-                }
-
-                for (auto& gameObject : m_incubator)
-                {
-                    m_gameObjects.push_back(std::move(gameObject));
-                    m_gameObjects.back()->m_sceneIndex = static_cast<std::int32_t>(m_gameObjects.size() - 1);
-                    m_gameObjects.back()->Awake();
-                }
-                m_incubator.clear();
-            }
+            MoveIncubatorToScene();
 
             if (!m_componentAddList.empty())
             {
@@ -202,6 +233,28 @@ namespace engine
         m_gameObjectAddList.clear();
     }
 
+    void Scene::MoveIncubatorToScene()
+    {
+        if (m_incubator.empty())
+        {
+            return;
+        }
+
+        size_t neededCapacity = m_gameObjects.size() + m_incubator.size();
+        if (m_gameObjects.capacity() < neededCapacity)
+        {
+            m_gameObjects.reserve(neededCapacity * 2);
+        }
+
+        for (auto& gameObject : m_incubator)
+        {
+            m_gameObjects.push_back(std::move(gameObject));
+            m_gameObjects.back()->m_sceneIndex = static_cast<std::int32_t>(m_gameObjects.size() - 1);
+            m_gameObjects.back()->Awake();
+        }
+        m_incubator.clear();
+    }
+
     void Scene::RegisterPendingKill(GameObject* gameObject)
     {
         m_gameObjectKillList.push_back(gameObject);
@@ -280,6 +333,108 @@ namespace engine
         }
     }
 
+    void Scene::ReorderGameObjects(std::span<GameObject* const> order)
+    {
+        MoveIncubatorToScene();
+
+        std::size_t next = 0;
+
+        for (GameObject* gameObject : order)
+        {
+            const std::int32_t index = gameObject->m_sceneIndex;
+            if (index < static_cast<std::int32_t>(next) || index >= m_gameObjects.size() || m_gameObjects[index].get() != gameObject)
+            {
+                continue;
+            }
+
+            std::rotate(m_gameObjects.begin() + next, m_gameObjects.begin() + index, m_gameObjects.begin() + index + 1);
+
+            for (std::size_t i = next; i <= static_cast<std::size_t>(index); ++i)
+            {
+                m_gameObjects[i]->m_sceneIndex = static_cast<std::int32_t>(i);
+            }
+
+            ++next;
+        }
+    }
+
+    void Scene::BeginPlay()
+    {
+        // Awake / OnEnable 중에 생성된 오브젝트는 다음 ProcessPendingAdds(true)에서 처리되므로 처음 개수만 순회
+        const size_t gameObjectCount = m_gameObjects.size();
+
+        for (size_t i = 0; i < gameObjectCount; ++i)
+        {
+            GameObject* gameObject = m_gameObjects[i].get();
+            if (gameObject->IsPendingKill())
+            {
+                continue;
+            }
+
+            const size_t componentCount = gameObject->m_components.size();
+            for (size_t j = 0; j < componentCount; ++j)
+            {
+                Component* component = gameObject->m_components[j].get();
+
+                // 물리 컴포넌트는 CreateScenePhysics에서 이미 Awake
+                if (component->HasAwoken() || component->IsPendingKill())
+                {
+                    continue;
+                }
+
+                component->Awake();
+                component->MarkAsAwoken();
+            }
+        }
+
+        for (size_t i = 0; i < gameObjectCount; ++i)
+        {
+            GameObject* gameObject = m_gameObjects[i].get();
+            if (gameObject->IsPendingKill())
+            {
+                continue;
+            }
+
+            const size_t componentCount = gameObject->m_components.size();
+            for (size_t j = 0; j < componentCount; ++j)
+            {
+                Component* component = gameObject->m_components[j].get();
+                if (!component->IsPendingKill() && component->IsActive())
+                {
+                    component->OnEnable();
+                }
+            }
+        }
+    }
+
+    void Scene::EndPlay()
+    {
+        ProcessPendingAdds(false);
+        ProcessPendingKills();
+
+        auto& scriptSystem = SystemManager::Get().GetScriptSystem();
+
+        for (const auto& gameObject : m_gameObjects)
+        {
+            for (const auto& component : gameObject->m_components)
+            {
+                if (component->HasAwoken() && component->IsActive())
+                {
+                    component->OnDisable();
+                }
+
+                component->ResetAwoken();
+                component->ResetRuntimeState();
+
+                // Start는 한 번 부르면 목록에서 빠지므로 다음 Play를 위해 다시 넣음
+                if (auto script = ComponentCast<ScriptBase>(component.get()))
+                {
+                    scriptSystem.ScheduleStart(script);
+                }
+            }
+        }
+    }
+
     void Scene::Save()
     {
         json root;
@@ -349,6 +504,19 @@ namespace engine
         {
             o << std::setw(4) << root << std::endl;
         }
+
+        std::vector<std::byte> binary;
+        if (SceneBinary::ConvertFromJson(root, binary))
+        {
+            std::filesystem::path binaryPath = path;
+            binaryPath.replace_extension(".scenebin");
+
+            std::ofstream b(binaryPath, std::ios::binary);
+            if (b.is_open())
+            {
+                b.write(reinterpret_cast<const char*>(binary.data()), static_cast<std::streamsize>(binary.size()));
+            }
+        }
     }
 
     void Scene::SaveToJson(json& outJson)
@@ -408,6 +576,28 @@ namespace engine
         std::filesystem::path path{ "Resource/Scene" };
         path /= (m_name + ".json");
 
+        std::filesystem::path binaryPath = path;
+        binaryPath.replace_extension(".scenebin");
+
+        if (IsBinarySceneUpToDate(path, binaryPath))
+        {
+            MappedFile file;
+            if (file.Open(binaryPath))
+            {
+                const SceneBinaryReader reader{ file.GetBytes() };
+                if (reader.IsValid())
+                {
+                    Clear();
+                    ReleaseEmptyMemoryPoolPages();
+
+                    LoadFromBinary(reader);
+                    return;
+                }
+            }
+
+            LOG_ERROR("Scene::Load - 바이너리 씬을 읽지 못해서 JSON을 읽음: {}", binaryPath.string());
+        }
+
         std::ifstream i(path);
         if (!i.is_open())
         {
@@ -420,6 +610,9 @@ namespace engine
 
         Clear();
 
+        // 이전 씬의 객체가 모두 해제되었으므로 비어있는 풀 페이지를 돌려줌
+        ReleaseEmptyMemoryPoolPages();
+
         JsonGet(root, "Name", m_name);
         size_t numGameObjects;
         JsonGet(root, "NumGameObjects", numGameObjects);
@@ -533,4 +726,204 @@ namespace engine
             }
         }
     }
+
+    void Scene::LoadFromBinary(const SceneBinaryReader& reader)
+    {
+        assert(reader.IsValid());
+
+        Clear();
+
+        m_name = reader.GetName();
+
+        const auto records = reader.GetGameObjects();
+
+        std::vector<GameObject*> gameObjects;
+        gameObjects.reserve(records.size());
+
+        for (const auto& record : records)
+        {
+            GameObject* go = CreateGameObject(std::string{ reader.GetString(record.name) });
+            go->m_active = record.active != 0;
+
+            gameObjects.push_back(go);
+        }
+
+        const auto& registry = ComponentFactory::Get().GetRegistry();
+
+        // 나머지 컴포넌트는 블록을 다 훑은 뒤 GameObject / componentIndex 순서로 만듦
+        // (블록 순서대로 만들면 m_components와 Initialize 순서가 JSON 로드와 달라짐)
+        struct PendingComponent
+        {
+            std::uint32_t gameObject;
+            std::uint32_t componentIndex;
+            const SceneBinaryBlock* block;
+            std::uint32_t record; // 블록 안의 레코드 번호
+            decltype(registry.end()) creator; // MessagePack 블록만
+        };
+
+        std::vector<PendingComponent> pendingComponents;
+
+        const auto addPendingComponents = [&](const SceneBinaryBlock& block, const auto& records, decltype(registry.end()) creator)
+            {
+                for (std::uint32_t i = 0; i < records.size(); ++i)
+                {
+                    pendingComponents.push_back(PendingComponent{ records[i].gameObject, records[i].componentIndex, &block, i, creator });
+                }
+            };
+
+        // Transform / RectTransform 블록이 앞에 있으므로 JSON 로드처럼 교체가 먼저 끝남
+        for (const auto& block : reader.GetBlocks())
+        {
+            if (block.encoding == SceneBinaryEncoding::Transform)
+            {
+                for (const auto& record : reader.GetTransforms(block))
+                {
+                    Transform* transform = gameObjects[record.gameObject]->GetTransform();
+                    transform->SetActive(record.active != 0);
+                    transform->SetLocalPosition(record.position);
+                    transform->SetLocalRotation(record.rotation);
+                    transform->SetLocalScale(record.scale);
+                }
+
+                continue;
+            }
+
+            const std::string_view type = reader.GetString(block.type);
+
+            if (type == "RectTransform" && block.encoding == SceneBinaryEncoding::MessagePack)
+            {
+                for (const auto& record : reader.GetComponents(block))
+                {
+                    const auto data = reader.GetComponentData(record);
+
+                    const json compJson = json::from_msgpack(data.begin(), data.end(), true, false);
+                    if (compJson.is_discarded())
+                    {
+                        LOG_ERROR("Scene::LoadFromBinary - 컴포넌트 데이터가 깨짐: {}", type);
+                        continue;
+                    }
+
+                    if (RectTransform* rt = gameObjects[record.gameObject]->ReplaceTransformWithRectTransform())
+                    {
+                        rt->Load(compJson);
+                    }
+                }
+
+                continue;
+            }
+
+            switch (block.encoding)
+            {
+            case SceneBinaryEncoding::MessagePack:
+            {
+                // 블록마다 한 번만 찾음
+                const auto creator = registry.find(std::string{ type });
+                if (creator == registry.end())
+                {
+                    LOG_ERROR("Scene::LoadFromBinary - 등록되지 않은 컴포넌트: {}", type);
+                    break;
+                }
+
+                addPendingComponents(block, reader.GetComponents(block), creator);
+                break;
+            }
+            case SceneBinaryEncoding::StaticMeshRenderer:
+            case SceneBinaryEncoding::SkeletalMeshRenderer:
+                addPendingComponents(block, reader.GetMeshRenderers(block), registry.end());
+                break;
+            case SceneBinaryEncoding::Light:
+                addPendingComponents(block, reader.GetLights(block), registry.end());
+                break;
+            case SceneBinaryEncoding::Camera:
+                addPendingComponents(block, reader.GetCameras(block), registry.end());
+                break;
+            case SceneBinaryEncoding::BoxCollider:
+            case SceneBinaryEncoding::SphereCollider:
+            case SceneBinaryEncoding::CapsuleCollider:
+                addPendingComponents(block, reader.GetColliders(block), registry.end());
+                break;
+            case SceneBinaryEncoding::Rigidbody:
+                addPendingComponents(block, reader.GetRigidbodies(block), registry.end());
+                break;
+            default:
+                break;
+            }
+        }
+
+        std::sort(pendingComponents.begin(), pendingComponents.end(), [](const PendingComponent& a, const PendingComponent& b)
+            {
+                return a.gameObject != b.gameObject ? a.gameObject < b.gameObject : a.componentIndex < b.componentIndex;
+            });
+
+        for (const auto& pending : pendingComponents)
+        {
+            const SceneBinaryBlock& block = *pending.block;
+
+            std::unique_ptr<Component> component;
+
+            switch (block.encoding)
+            {
+            case SceneBinaryEncoding::MessagePack:
+            {
+                const auto data = reader.GetComponentData(reader.GetComponents(block)[pending.record]);
+
+                // 타입별 블록이 없는 컴포넌트 (스크립트 등)는 MessagePack을 JSON DOM으로 풀어서 각자의 Load(json)에 넘김
+                const json compJson = json::from_msgpack(data.begin(), data.end(), true, false);
+                if (compJson.is_discarded())
+                {
+                    LOG_ERROR("Scene::LoadFromBinary - 컴포넌트 데이터가 깨짐: {}", reader.GetString(block.type));
+                    continue;
+                }
+
+                component = std::invoke(pending.creator->second);
+                component->Load(compJson);
+                break;
+            }
+            case SceneBinaryEncoding::StaticMeshRenderer:
+                component = CreateFromRecord<StaticMeshRenderer>(reader.GetMeshRenderers(block)[pending.record], reader);
+                break;
+            case SceneBinaryEncoding::SkeletalMeshRenderer:
+                component = CreateFromRecord<SkeletalMeshRenderer>(reader.GetMeshRenderers(block)[pending.record], reader);
+                break;
+            case SceneBinaryEncoding::Light:
+                component = CreateFromRecord<Light>(reader.GetLights(block)[pending.record]);
+                break;
+            case SceneBinaryEncoding::Camera:
+                component = CreateFromRecord<Camera>(reader.GetCameras(block)[pending.record]);
+                break;
+            case SceneBinaryEncoding::BoxCollider:
+                component = CreateFromRecord<BoxCollider>(reader.GetColliders(block)[pending.record]);
+                break;
+            case SceneBinaryEncoding::SphereCollider:
+                component = CreateFromRecord<SphereCollider>(reader.GetColliders(block)[pending.record]);
+                break;
+            case SceneBinaryEncoding::CapsuleCollider:
+                component = CreateFromRecord<CapsuleCollider>(reader.GetColliders(block)[pending.record]);
+                break;
+            case SceneBinaryEncoding::Rigidbody:
+                component = CreateFromRecord<Rigidbody>(reader.GetRigidbodies(block)[pending.record]);
+                break;
+            default:
+                continue;
+            }
+
+            gameObjects[pending.gameObject]->AddComponent(std::move(component));
+        }
+
+        for (std::size_t i = 0; i < records.size(); ++i)
+        {
+            if (records[i].parent != SceneBinaryNoParent)
+            {
+                gameObjects[i]->GetTransform()->SetParent(gameObjects[records[i].parent]->GetTransform());
+            }
+        }
+
+        for (auto go : m_gameObjectAddList)
+        {
+            if (go->GetTransform()->GetParent() == nullptr)
+            {
+                go->UpdateActiveInHierarchy(go->IsActiveSelf());
+            }
+        }
+    }
 }
\ No newline at end of file
@@ -15,6 +15,7 @@ namespace engine
     class Camera;
     class GameObject;
     class Component;
+    class SceneBinaryReader;
 
     class Scene
     {
@@ -57,11 +58,24 @@ namespace engine
 
         void RemoveGameObjectEditor(GameObject* gameObject);
 
+        // 대기열의 GameObject도 옮긴 뒤 order를 그 순서대로 앞에 둠 (컴포넌트는 대기열에 남음)
+        void ReorderGameObjects(std::span<GameObject* const> order);
+
+        // 에디터 Play / Stop (오브젝트를 다시 만들지 않으므로 Awake / OnEnable / OnDisable을 여기서 부름)
+        void BeginPlay();
+        void EndPlay();
+
     public:
+        // JSON과 같은 이름의 .scenebin도 같이 씀
         void Save();
         void SaveToJson(json& outJson);
 
+        // .scenebin이 JSON보다 새 것이면 메모리 맵해서 읽고, 아니면 JSON을 읽음
         void Load();
         void LoadFromJson(const json& inJson);
+        void LoadFromBinary(const SceneBinaryReader& reader);
+
+    private:
+        void MoveIncubatorToScene();
     };
 }
@@ -0,0 +1,951 @@
+﻿#include "EnginePCH.h"
+#include "SceneBinary.h"
+
+#include <unordered_map>
+
+namespace engine
+{
+    namespace
+    {
+        std::uint32_t AlignTo4(std::size_t size)
+        {
+            return static_cast<std::uint32_t>((size + 3) & ~static_cast<std::size_t>(3));
+        }
+
+        bool IsTransformType(std::string_view type)
+        {
+            return type == "Transform" || type == "RectTransform";
+        }
+
+        class StringTableBuilder
+        {
+        private:
+            std::unordered_map<std::string, std::uint32_t> m_indices;
+            std::vector<std::uint32_t> m_offsets;
+            std::string m_data;
+
+        public:
+            std::uint32_t Add(const std::string& value)
+            {
+                if (auto iter = m_indices.find(value); iter != m_indices.end())
+                {
+                    return iter->second;
+                }
+
+                const std::uint32_t index = static_cast<std::uint32_t>(m_offsets.size());
+                m_indices.emplace(value, index);
+                m_offsets.push_back(static_cast<std::uint32_t>(m_data.size()));
+
+                m_data += value;
+                m_data += '\0';
+
+                return index;
+            }
+
+            const std::vector<std::uint32_t>& GetOffsets() const
+            {
+                return m_offsets;
+            }
+
+            const std::string& GetData() const
+            {
+                return m_data;
+            }
+        };
+
+        struct BlockBuilder
+        {
+            std::string type;
+            SceneBinaryEncoding encoding;
+            std::uint32_t count = 0;
+            std::vector<std::byte> records;
+        };
+
+        // 타입마다 인코딩은 하나지만 키가 빠진 컴포넌트는 같은 타입의 MessagePack 블록으로 감
+        struct TypeBlocks
+        {
+            SceneBinaryEncoding encoding;
+            std::size_t typedBlock = SIZE_MAX;
+            std::size_t messagePackBlock = SIZE_MAX;
+        };
+
+        template <typename T>
+        void Write(std::vector<std::byte>& data, std::uint32_t offset, const T* values, std::size_t count)
+        {
+            if (count > 0)
+            {
+                std::memcpy(data.data() + offset, values, sizeof(T) * count);
+            }
+        }
+
+        template <typename T>
+        void AppendRecord(std::vector<std::byte>& records, const T& record)
+        {
+            const std::size_t offset = records.size();
+            records.resize(offset + sizeof(T));
+            std::memcpy(records.data() + offset, &record, sizeof(T));
+        }
+
+        std::uint32_t GetRecordSize(SceneBinaryEncoding encoding)
+        {
+            switch (encoding)
+            {
+            case SceneBinaryEncoding::Transform:
+                return sizeof(SceneBinaryTransform);
+            case SceneBinaryEncoding::MessagePack:
+                return sizeof(SceneBinaryComponent);
+            case SceneBinaryEncoding::StaticMeshRenderer:
+            case SceneBinaryEncoding::SkeletalMeshRenderer:
+                return sizeof(SceneBinaryMeshRenderer);
+            case SceneBinaryEncoding::Light:
+                return sizeof(SceneBinaryLight);
+            case SceneBinaryEncoding::Camera:
+                return sizeof(SceneBinaryCamera);
+            case SceneBinaryEncoding::BoxCollider:
+            case SceneBinaryEncoding::SphereCollider:
+            case SceneBinaryEncoding::CapsuleCollider:
+                return sizeof(SceneBinaryCollider);
+            case SceneBinaryEncoding::Rigidbody:
+                return sizeof(SceneBinaryRigidbody);
+            }
+
+            return 0;
+        }
+
+        SceneBinaryEncoding GetEncoding(std::string_view type)
+        {
+            static const std::unordered_map<std::string_view, SceneBinaryEncoding> encodings
+            {
+                { "Transform", SceneBinaryEncoding::Transform },
+                { "StaticMeshRenderer", SceneBinaryEncoding::StaticMeshRenderer },
+                { "SkeletalMeshRenderer", SceneBinaryEncoding::SkeletalMeshRenderer },
+                { "Light", SceneBinaryEncoding::Light },
+                { "Camera", SceneBinaryEncoding::Camera },
+                { "BoxCollider", SceneBinaryEncoding::BoxCollider },
+                { "SphereCollider", SceneBinaryEncoding::SphereCollider },
+                { "CapsuleCollider", SceneBinaryEncoding::CapsuleCollider },
+                { "Rigidbody", SceneBinaryEncoding::Rigidbody },
+            };
+
+            const auto iter = encodings.find(type);
+            return iter != encodings.end() ? iter->second : SceneBinaryEncoding::MessagePack;
+        }
+
+        bool HasKeys(const json& j, std::initializer_list<const char*> keys)
+        {
+            return std::all_of(keys.begin(), keys.end(), [&j](const char* key)
+                {
+                    return j.contains(key);
+                });
+        }
+
+        // Collider는 Vector3를 [x, y, z] 배열로 저장함
+        Vector3 GetArrayVector3(const json& j)
+        {
+            return Vector3(j[0].get<float>(), j[1].get<float>(), j[2].get<float>());
+        }
+
+        // 타입별 레코드의 값을 컴포넌트 JSON (각 컴포넌트의 Save)에서 채움
+        // Save가 쓰는 키가 하나라도 없으면 false를 돌려주고 그 컴포넌트는 MessagePack으로 감 (기본값은 컴포넌트가 정하므로)
+        bool FillRecord(const json& j, SceneBinaryEncoding, StringTableBuilder&, SceneBinaryTransform& record)
+        {
+            // Transform은 키가 없으면 기본값으로 채움
+            record.position = Vector3::Zero;
+            record.rotation = Quaternion::Identity;
+            record.scale = Vector3::One;
+
+            JsonGet(j, "Position", record.position);
+            JsonGet(j, "Rotation", record.rotation);
+            JsonGet(j, "Scale", record.scale);
+
+            return true;
+        }
+
+        bool FillRecord(const json& j, SceneBinaryEncoding encoding, StringTableBuilder& strings, SceneBinaryMeshRenderer& record)
+        {
+            const bool isStatic = encoding == SceneBinaryEncoding::StaticMeshRenderer;
+
+            if (!HasKeys(j, { "MeshFilePath", "VSFilePath", "OpaquePSFilePath", "CutoutPSFilePath", "TransparentPSFilePath",
+                "MaterialBaseColor", "MaterialEmissive", "MaterialRoughness", "MaterialMetalness", "MaterialAmbientOcclusion", "OverrideMaterial" }) ||
+                (isStatic && !j.contains("CompactVertex")))
+            {
+                return false;
+            }
+
+            record.meshFilePath = strings.Add(j.at("MeshFilePath").get<std::string>());
+            record.vsFilePath = strings.Add(j.at("VSFilePath").get<std::string>());
+            record.opaquePSFilePath = strings.Add(j.at("OpaquePSFilePath").get<std::string>());
+            record.cutoutPSFilePath = strings.Add(j.at("CutoutPSFilePath").get<std::string>());
+            record.transparentPSFilePath = strings.Add(j.at("TransparentPSFilePath").get<std::string>());
+            record.materialBaseColor = j.at("MaterialBaseColor").get<Vector4>();
+            record.materialEmissive = j.at("MaterialEmissive").get<Vector3>();
+            record.materialRoughness = j.at("MaterialRoughness").get<float>();
+            record.materialMetalness = j.at("MaterialMetalness").get<float>();
+            record.materialAmbientOcclusion = j.at("MaterialAmbientOcclusion").get<float>();
+            record.overrideMaterial = j.at("OverrideMaterial").get<bool>() ? 1 : 0;
+            record.compactVertex = isStatic && j.at("CompactVertex").get<bool>() ? 1 : 0;
+
+            return true;
+        }
+
+        bool FillRecord(const json& j, SceneBinaryEncoding, StringTableBuilder&, SceneBinaryLight& record)
+        {
+            if (!HasKeys(j, { "LightType", "Color", "Intensity", "Range", "Angle", "Near", "Far", "ForwardDistance", "HeightRatio" }))
+            {
+                return false;
+            }
+
+            record.lightType = j.at("LightType").get<std::int32_t>();
+            record.color = j.at("Color").get<Vector3>();
+            record.intensity = j.at("Intensity").get<float>();
+            record.range = j.at("Range").get<float>();
+            record.angle = j.at("Angle").get<float>();
+            record.nearPlane = j.at("Near").get<float>();
+            record.farPlane = j.at("Far").get<float>();
+            record.forwardDistance = j.at("ForwardDistance").get<float>();
+            record.heightRatio = j.at("HeightRatio").get<float>();
+
+            return true;
+        }
+
+        bool FillRecord(const json& j, SceneBinaryEncoding, StringTableBuilder&, SceneBinaryCamera& record)
+        {
+            if (!HasKeys(j, { "Near", "Far", "FOV" }))
+            {
+                return false;
+            }
+
+            record.nearPlane = j.at("Near").get<float>();
+            record.farPlane = j.at("Far").get<float>();
+            record.fov = j.at("FOV").get<float>();
+
+            return true;
+        }
+
+        bool FillRecord(const json& j, SceneBinaryEncoding encoding, StringTableBuilder&, SceneBinaryCollider& record)
+        {
+            if (!HasKeys(j, { "center", "rotation", "isTrigger", "layer", "collisionMask" }) ||
+                (encoding == SceneBinaryEncoding::BoxCollider && !j.contains("size")) ||
+                (encoding != SceneBinaryEncoding::BoxCollider && !j.contains("radius")) ||
+                (encoding == SceneBinaryEncoding::CapsuleCollider && !j.contains("height")))
+            {
+                return false;
+            }
+
+            record.center = GetArrayVector3(j.at("center"));
+            record.rotation = GetArrayVector3(j.at("rotation"));
+            record.isTrigger = j.at("isTrigger").get<bool>() ? 1 : 0;
+            record.layer = j.at("layer").get<std::uint32_t>();
+            record.collisionMask = j.at("collisionMask").get<std::uint32_t>();
+
+            if (encoding == SceneBinaryEncoding::BoxCollider)
+            {
+                record.size = GetArrayVector3(j.at("size"));
+            }
+            else
+            {
+                record.radius = j.at("radius").get<float>();
+            }
+
+            if (encoding == SceneBinaryEncoding::CapsuleCollider)
+            {
+                record.height = j.at("height").get<float>();
+            }
+
+            return true;
+        }
+
+        bool FillRecord(const json& j, SceneBinaryEncoding, StringTableBuilder&, SceneBinaryRigidbody& record)
+        {
+            if (!HasKeys(j, { "type", "mass", "linearDamping", "angularDamping", "useGravity", "constraints", "layer" }))
+            {
+                return false;
+            }
+
+            record.type = j.at("type").get<std::int32_t>();
+            record.mass = j.at("mass").get<float>();
+            record.linearDamping = j.at("linearDamping").get<float>();
+            record.angularDamping = j.at("angularDamping").get<float>();
+            record.useGravity = j.at("useGravity").get<bool>() ? 1 : 0;
+            record.constraints = j.at("constraints").get<std::uint32_t>();
+            record.layer = j.at("layer").get<std::uint32_t>();
+
+            return true;
+        }
+
+        template <typename T>
+        bool AppendTypedRecord(std::vector<std::byte>& records, const json& compJson, SceneBinaryEncoding encoding,
+            std::uint32_t gameObject, std::uint32_t componentIndex, StringTableBuilder& strings)
+        {
+            T record{};
+            record.gameObject = gameObject;
+            record.componentIndex = componentIndex;
+            record.active = compJson.value("Active", true) ? 1 : 0;
+
+            if (!FillRecord(compJson, encoding, strings, record))
+            {
+                return false;
+            }
+
+            AppendRecord(records, record);
+            return true;
+        }
+
+        bool AppendTypedRecord(std::vector<std::byte>& records, const json& compJson, SceneBinaryEncoding encoding,
+            std::uint32_t gameObject, std::uint32_t componentIndex, StringTableBuilder& strings)
+        {
+            switch (encoding)
+            {
+            case SceneBinaryEncoding::Transform:
+                return AppendTypedRecord<SceneBinaryTransform>(records, compJson, encoding, gameObject, componentIndex, strings);
+            case SceneBinaryEncoding::StaticMeshRenderer:
+            case SceneBinaryEncoding::SkeletalMeshRenderer:
+                return AppendTypedRecord<SceneBinaryMeshRenderer>(records, compJson, encoding, gameObject, componentIndex, strings);
+            case SceneBinaryEncoding::Light:
+                return AppendTypedRecord<SceneBinaryLight>(records, compJson, encoding, gameObject, componentIndex, strings);
+            case SceneBinaryEncoding::Camera:
+                return AppendTypedRecord<SceneBinaryCamera>(records, compJson, encoding, gameObject, componentIndex, strings);
+            case SceneBinaryEncoding::BoxCollider:
+            case SceneBinaryEncoding::SphereCollider:
+            case SceneBinaryEncoding::CapsuleCollider:
+                return AppendTypedRecord<SceneBinaryCollider>(records, compJson, encoding, gameObject, componentIndex, strings);
+            case SceneBinaryEncoding::Rigidbody:
+                return AppendTypedRecord<SceneBinaryRigidbody>(records, compJson, encoding, gameObject, componentIndex, strings);
+            default:
+                return false;
+            }
+        }
+
+        // 타입별 레코드 -> 각 컴포넌트의 Save와 같은 키 순서의 JSON
+        json MakeComponentJson(const SceneBinaryReader& reader, const SceneBinaryBlock& block, std::uint32_t active)
+        {
+            json compJson;
+            compJson["Type"] = reader.GetString(block.type);
+            compJson["Active"] = active != 0;
+
+            return compJson;
+        }
+
+        json ToJson(const SceneBinaryReader& reader, const SceneBinaryBlock& block, const SceneBinaryTransform& record)
+        {
+            json compJson = MakeComponentJson(reader, block, record.active);
+            compJson["Position"] = record.position;
+            compJson["Rotation"] = record.rotation;
+            compJson["Scale"] = record.scale;
+
+            return compJson;
+        }
+
+        json ToJson(const SceneBinaryReader& reader, const SceneBinaryBlock& block, const SceneBinaryMeshRenderer& record)
+        {
+            json compJson = MakeComponentJson(reader, block, record.active);
+            compJson["MeshFilePath"] = reader.GetString(record.meshFilePath);
+            compJson["VSFilePath"] = reader.GetString(record.vsFilePath);
+            compJson["OpaquePSFilePath"] = reader.GetString(record.opaquePSFilePath);
+            compJson["CutoutPSFilePath"] = reader.GetString(record.cutoutPSFilePath);
+            compJson["TransparentPSFilePath"] = reader.GetString(record.transparentPSFilePath);
+            compJson["MaterialBaseColor"] = record.materialBaseColor;
+            compJson["MaterialEmissive"] = record.materialEmissive;
+            compJson["MaterialRoughness"] = record.materialRoughness;
+            compJson["MaterialMetalness"] = record.materialMetalness;
+            compJson["MaterialAmbientOcclusion"] = record.materialAmbientOcclusion;
+            compJson["OverrideMaterial"] = record.overrideMaterial != 0;
+
+            if (block.encoding == SceneBinaryEncoding::StaticMeshRenderer)
+            {
+                compJson["CompactVertex"] = record.compactVertex != 0;
+            }
+
+            return compJson;
+        }
+
+        json ToJson(const SceneBinaryReader& reader, const SceneBinaryBlock& block, const SceneBinaryLight& record)
+        {
+            json compJson = MakeComponentJson(reader, block, record.active);
+            compJson["LightType"] = record.lightType;
+            compJson["Color"] = record.color;
+            compJson["Intensity"] = record.intensity;
+            compJson["Range"] = record.range;
+            compJson["Angle"] = record.angle;
+            compJson["Near"] = record.nearPlane;
+            compJson["Far"] = record.farPlane;
+            compJson["ForwardDistance"] = record.forwardDistance;
+            compJson["HeightRatio"] = record.heightRatio;
+
+            return compJson;
+        }
+
+        json ToJson(const SceneBinaryReader& reader, const SceneBinaryBlock& block, const SceneBinaryCamera& record)
+        {
+            json compJson = MakeComponentJson(reader, block, record.active);
+            compJson["Near"] = record.nearPlane;
+            compJson["Far"] = record.farPlane;
+            compJson["FOV"] = record.fov;
+
+            return compJson;
+        }
+
+        json ToJson(const SceneBinaryReader& reader, const SceneBinaryBlock& block, const SceneBinaryCollider& record)
+        {
+            json compJson = MakeComponentJson(reader, block, record.active);
+            compJson["center"] = { record.center.x, record.center.y, record.center.z };
+            compJson["rotation"] = { record.rotation.x, record.rotation.y, record.rotation.z };
+            compJson["isTrigger"] = record.isTrigger != 0;
+            compJson["layer"] = record.layer;
+            compJson["collisionMask"] = record.collisionMask;
+
+            if (block.encoding == SceneBinaryEncoding::BoxCollider)
+            {
+                compJson["size"] = { record.size.x, record.size.y, record.size.z };
+            }
+            else
+            {
+                compJson["radius"] = record.radius;
+            }
+
+            if (block.encoding == SceneBinaryEncoding::CapsuleCollider)
+            {
+                compJson["height"] = record.height;
+            }
+
+            return compJson;
+        }
+
+        json ToJson(const SceneBinaryReader& reader, const SceneBinaryBlock& block, const SceneBinaryRigidbody& record)
+        {
+            json compJson = MakeComponentJson(reader, block, record.active);
+            compJson["type"] = record.type;
+            compJson["mass"] = record.mass;
+            compJson["linearDamping"] = record.linearDamping;
+            compJson["angularDamping"] = record.angularDamping;
+            compJson["useGravity"] = record.useGravity != 0;
+            compJson["constraints"] = record.constraints;
+            compJson["layer"] = record.layer;
+
+            return compJson;
+        }
+
+        template <typename T>
+        void CollectComponents(const SceneBinaryReader& reader, const SceneBinaryBlock& block, std::span<const T> records,
+            std::vector<std::vector<std::pair<std::uint32_t, json>>>& outComponents)
+        {
+            for (const auto& record : records)
+            {
+                outComponents[record.gameObject].emplace_back(record.componentIndex, ToJson(reader, block, record));
+            }
+        }
+
+        template <typename T>
+        bool IsEveryGameObjectInRange(std::span<const T> records, std::uint32_t gameObjectCount)
+        {
+            return std::all_of(records.begin(), records.end(), [gameObjectCount](const T& record)
+                {
+                    return record.gameObject < gameObjectCount;
+                });
+        }
+    }
+
+    SceneBinaryReader::SceneBinaryReader(std::span<const std::byte> data) :
+        m_data{ data }
+    {
+        if (m_data.size() >= sizeof(SceneBinaryHeader))
+        {
+            m_header = reinterpret_cast<const SceneBinaryHeader*>(m_data.data());
+
+            if (!Validate())
+            {
+                m_header = nullptr;
+            }
+        }
+    }
+
+    bool SceneBinaryReader::IsValid() const
+    {
+        return m_header != nullptr;
+    }
+
+    std::string_view SceneBinaryReader::GetName() const
+    {
+        return GetString(m_header->name);
+    }
+
+    std::string_view SceneBinaryReader::GetString(std::uint32_t index) const
+    {
+        const std::uint32_t offset = GetArray<std::uint32_t>(m_header->stringOffsetsOffset, m_header->stringCount)[index];
+
+        return reinterpret_cast<const char*>(m_data.data() + m_header->stringDataOffset + offset);
+    }
+
+    std::span<const SceneBinaryGameObject> SceneBinaryReader::GetGameObjects() const
+    {
+        return GetArray<SceneBinaryGameObject>(m_header->gameObjectOffset, m_header->gameObjectCount);
+    }
+
+    std::span<const SceneBinaryBlock> SceneBinaryReader::GetBlocks() const
+    {
+        return GetArray<SceneBinaryBlock>(m_header->blockOffset, m_header->blockCount);
+    }
+
+    std::span<const SceneBinaryTransform> SceneBinaryReader::GetTransforms(const SceneBinaryBlock& block) const
+    {
+        assert(block.encoding == SceneBinaryEncoding::Transform);
+
+        return GetArray<SceneBinaryTransform>(block.recordOffset, block.count);
+    }
+
+    std::span<const SceneBinaryComponent> SceneBinaryReader::GetComponents(const SceneBinaryBlock& block) const
+    {
+        assert(block.encoding == SceneBinaryEncoding::MessagePack);
+
+        return GetArray<SceneBinaryComponent>(block.recordOffset, block.count);
+    }
+
+    std::span<const std::uint8_t> SceneBinaryReader::GetComponentData(const SceneBinaryComponent& record) const
+    {
+        return GetArray<std::uint8_t>(m_header->dataOffset + record.dataOffset, record.dataSize);
+    }
+
+    std::span<const SceneBinaryMeshRenderer> SceneBinaryReader::GetMeshRenderers(const SceneBinaryBlock& block) const
+    {
+        assert(block.encoding == SceneBinaryEncoding::StaticMeshRenderer || block.encoding == SceneBinaryEncoding::SkeletalMeshRenderer);
+
+        return GetArray<SceneBinaryMeshRenderer>(block.recordOffset, block.count);
+    }
+
+    std::span<const SceneBinaryLight> SceneBinaryReader::GetLights(const SceneBinaryBlock& block) const
+    {
+        assert(block.encoding == SceneBinaryEncoding::Light);
+
+        return GetArray<SceneBinaryLight>(block.recordOffset, block.count);
+    }
+
+    std::span<const SceneBinaryCamera> SceneBinaryReader::GetCameras(const SceneBinaryBlock& block) const
+    {
+        assert(block.encoding == SceneBinaryEncoding::Camera);
+
+        return GetArray<SceneBinaryCamera>(block.recordOffset, block.count);
+    }
+
+    std::span<const SceneBinaryCollider> SceneBinaryReader::GetColliders(const SceneBinaryBlock& block) const
+    {
+        assert(block.encoding == SceneBinaryEncoding::BoxCollider || block.encoding == SceneBinaryEncoding::SphereCollider ||
+            block.encoding == SceneBinaryEncoding::CapsuleCollider);
+
+        return GetArray<SceneBinaryCollider>(block.recordOffset, block.count);
+    }
+
+    std::span<const SceneBinaryRigidbody> SceneBinaryReader::GetRigidbodies(const SceneBinaryBlock& block) const
+    {
+        assert(block.encoding == SceneBinaryEncoding::Rigidbody);
+
+        return GetArray<SceneBinaryRigidbody>(block.recordOffset, block.count);
+    }
+
+    bool SceneBinaryReader::Validate() const
+    {
+        const SceneBinaryHeader& header = *m_header;
+
+        if (header.magic != SceneBinaryMagic || header.version != SceneBinaryVersion || header.fileSize != m_data.size())
+        {
+            return false;
+        }
+
+        if (!IsInRange(header.stringOffsetsOffset, std::uint64_t{ header.stringCount } * sizeof(std::uint32_t)) ||
+            !IsInRange(header.stringDataOffset, header.stringDataSize) ||
+            !IsInRange(header.gameObjectOffset, std::uint64_t{ header.gameObjectCount } * sizeof(SceneBinaryGameObject)) ||
+            !IsInRange(header.blockOffset, std::uint64_t{ header.blockCount } * sizeof(SceneBinaryBlock)) ||
+            !IsInRange(header.dataOffset, header.dataSize))
+        {
+            return false;
+        }
+
+        if (header.stringDataSize == 0 || m_data[header.stringDataOffset + header.stringDataSize - 1] != std::byte{ 0 })
+        {
+            return false;
+        }
+
+        // 마지막 바이트가 0이므로 오프셋이 범위 안이면 문자열이 데이터 밖으로 넘어가지 않음
+        for (const std::uint32_t offset : GetArray<std::uint32_t>(header.stringOffsetsOffset, header.stringCount))
+        {
+            if (offset >= header.stringDataSize)
+            {
+                return false;
+            }
+        }
+
+        if (header.name >= header.stringCount)
+        {
+            return false;
+        }
+
+        const auto gameObjects = GetArray<SceneBinaryGameObject>(header.gameObjectOffset, header.gameObjectCount);
+        for (std::uint32_t i = 0; i < header.gameObjectCount; ++i)
+        {
+            const std::uint32_t parent = gameObjects[i].parent;
+
+            if (gameObjects[i].name >= header.stringCount ||
+                (parent != SceneBinaryNoParent && parent >= header.gameObjectCount))
+            {
+                return false;
+            }
+        }
+
+        // 부모 사슬에 순환이 있으면 (A -> B -> A, 자기 자신 포함) SetParent / TransformSystem::GetDepth가 끝나지 않음
+        // 0: 아직 안 봄, 1: 지금 따라가는 사슬 위, 2: 루트까지 이어짐이 확인됨
+        std::vector<std::uint8_t> states(header.gameObjectCount, 0);
+        for (std::uint32_t i = 0; i < header.gameObjectCount; ++i)
+        {
+            std::uint32_t current = i;
+            while (current != SceneBinaryNoParent && states[current] == 0)
+            {
+                states[current] = 1;
+                current = gameObjects[current].parent;
+            }
+
+            if (current != SceneBinaryNoParent && states[current] == 1)
+            {
+                return false;
+            }
+
+            for (current = i; current != SceneBinaryNoParent && states[current] == 1; current = gameObjects[current].parent)
+            {
+                states[current] = 2;
+            }
+        }
+
+        for (const auto& block : GetArray<SceneBinaryBlock>(header.blockOffset, header.blockCount))
+        {
+            if (!ValidateBlock(block))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool SceneBinaryReader::ValidateBlock(const SceneBinaryBlock& block) const
+    {
+        const SceneBinaryHeader& header = *m_header;
+
+        const std::uint32_t recordSize = GetRecordSize(block.encoding);
+        if (block.type >= header.stringCount || recordSize == 0 ||
+            !IsInRange(block.recordOffset, std::uint64_t{ block.count } * recordSize))
+        {
+            return false;
+        }
+
+        switch (block.encoding)
+        {
+        case SceneBinaryEncoding::Transform:
+            return IsEveryGameObjectInRange(GetTransforms(block), header.gameObjectCount);
+        case SceneBinaryEncoding::MessagePack:
+        {
+            const auto records = GetComponents(block);
+            return IsEveryGameObjectInRange(records, header.gameObjectCount) &&
+                std::all_of(records.begin(), records.end(), [&header](const SceneBinaryComponent& record)
+                    {
+                        return std::uint64_t{ record.dataOffset } + record.dataSize <= header.dataSize;
+                    });
+        }
+        case SceneBinaryEncoding::StaticMeshRenderer:
+        case SceneBinaryEncoding::SkeletalMeshRenderer:
+        {
+            const auto records = GetMeshRenderers(block);
+            return IsEveryGameObjectInRange(records, header.gameObjectCount) &&
+                std::all_of(records.begin(), records.end(), [&header](const SceneBinaryMeshRenderer& record)
+                    {
+                        return record.meshFilePath < header.stringCount && record.vsFilePath < header.stringCount &&
+                            record.opaquePSFilePath < header.stringCount && record.cutoutPSFilePath < header.stringCount &&
+                            record.transparentPSFilePath < header.stringCount;
+                    });
+        }
+        case SceneBinaryEncoding::Light:
+            return IsEveryGameObjectInRange(GetLights(block), header.gameObjectCount);
+        case SceneBinaryEncoding::Camera:
+            return IsEveryGameObjectInRange(GetCameras(block), header.gameObjectCount);
+        case SceneBinaryEncoding::BoxCollider:
+        case SceneBinaryEncoding::SphereCollider:
+        case SceneBinaryEncoding::CapsuleCollider:
+            return IsEveryGameObjectInRange(GetColliders(block), header.gameObjectCount);
+        case SceneBinaryEncoding::Rigidbody:
+            return IsEveryGameObjectInRange(GetRigidbodies(block), header.gameObjectCount);
+        }
+
+        return false;
+    }
+
+    bool SceneBinaryReader::IsInRange(std::uint64_t offset, std::uint64_t size) const
+    {
+        // 구조체를 그대로 읽으므로 정렬도 확인
+        return offset % 4 == 0 && offset + size <= m_data.size();
+    }
+
+    bool SceneBinary::ConvertFromJson(const json& scene, std::vector<std::byte>& outData)
+    {
+        StringTableBuilder strings;
+        const std::uint32_t name = strings.Add(scene.value("Name", ""));
+
+        const auto gameObjectsIter = scene.find("GameObjects");
+        if (gameObjectsIter == scene.end() || !gameObjectsIter->is_array())
+        {
+            LOG_ERROR("SceneBinary::ConvertFromJson - GameObjects가 없음");
+            return false;
+        }
+
+        const json& gameObjectsJson = *gameObjectsIter;
+
+        // JSON의 ID -> GameObject 표 번호
+        std::unordered_map<int, std::uint32_t> idToIndex;
+        for (std::uint32_t i = 0; i < gameObjectsJson.size(); ++i)
+        {
+            idToIndex[gameObjectsJson[i].value("ID", -1)] = i;
+        }
+
+        std::vector<SceneBinaryGameObject> gameObjects;
+        gameObjects.reserve(gameObjectsJson.size());
+
+        std::vector<BlockBuilder> blocks;
+        std::unordered_map<std::string, TypeBlocks> typeToBlocks;
+        std::vector<std::uint8_t> componentData;
+        std::vector<std::byte> typedRecord;
+
+        for (std::uint32_t i = 0; i < gameObjectsJson.size(); ++i)
+        {
+            const json& goJson = gameObjectsJson[i];
+
+            SceneBinaryGameObject gameObject{};
+            gameObject.name = strings.Add(goJson.value("Name", "GameObject"));
+            gameObject.parent = SceneBinaryNoParent;
+            gameObject.active = goJson.value("Active", true) ? 1 : 0;
+
+            int parentId = -1;
+            JsonGet(goJson, "ParentID", parentId);
+            if (parentId != -1)
+            {
+                if (auto iter = idToIndex.find(parentId); iter != idToIndex.end() && iter->second != i)
+                {
+                    gameObject.parent = iter->second;
+                }
+            }
+
+            gameObjects.push_back(gameObject);
+
+            std::uint32_t componentIndex = 0;
+            JsonArrayForEach(goJson, "Components", [&](const json& compJson)
+                {
+                    const std::string type = compJson.value("Type", "");
+                    if (type.empty())
+                    {
+                        return;
+                    }
+
+                    TypeBlocks& typeBlocks = typeToBlocks.try_emplace(type, TypeBlocks{ GetEncoding(type) }).first->second;
+
+                    const auto getBlock = [&](std::size_t& blockIndex, SceneBinaryEncoding encoding) -> BlockBuilder&
+                        {
+                            if (blockIndex == SIZE_MAX)
+                            {
+                                blockIndex = blocks.size();
+                                blocks.push_back(BlockBuilder{ type, encoding });
+                            }
+
+                            return blocks[blockIndex];
+                        };
+
+                    typedRecord.clear();
+                    if (AppendTypedRecord(typedRecord, compJson, typeBlocks.encoding, i, componentIndex, strings))
+                    {
+                        BlockBuilder& block = getBlock(typeBlocks.typedBlock, typeBlocks.encoding);
+                        block.records.insert(block.records.end(), typedRecord.begin(), typedRecord.end());
+                        ++block.count;
+                    }
+                    else
+                    {
+                        const std::vector<std::uint8_t> encoded = json::to_msgpack(compJson);
+
+                        SceneBinaryComponent record{};
+                        record.gameObject = i;
+                        record.componentIndex = componentIndex;
+                        record.dataOffset = static_cast<std::uint32_t>(componentData.size());
+                        record.dataSize = static_cast<std::uint32_t>(encoded.size());
+
+                        componentData.insert(componentData.end(), encoded.begin(), encoded.end());
+                        componentData.resize(AlignTo4(componentData.size()));
+
+                        BlockBuilder& block = getBlock(typeBlocks.messagePackBlock, SceneBinaryEncoding::MessagePack);
+                        AppendRecord(block.records, record);
+                        ++block.count;
+                    }
+
+                    ++componentIndex;
+                });
+        }
+
+        // 다른 컴포넌트가 로드될 때 RectTransform으로 교체가 끝나 있어야 함
+        std::stable_partition(blocks.begin(), blocks.end(), [](const BlockBuilder& block)
+            {
+                return IsTransformType(block.type);
+            });
+
+        std::vector<SceneBinaryBlock> blockTable;
+        blockTable.reserve(blocks.size());
+        for (const auto& block : blocks)
+        {
+            SceneBinaryBlock entry{};
+            entry.type = strings.Add(block.type);
+            entry.encoding = block.encoding;
+            entry.count = block.count;
+            blockTable.push_back(entry);
+        }
+
+        // 배치
+        SceneBinaryHeader header{};
+        header.magic = SceneBinaryMagic;
+        header.version = SceneBinaryVersion;
+        header.name = name;
+
+        std::uint32_t offset = AlignTo4(sizeof(SceneBinaryHeader));
+
+        header.stringCount = static_cast<std::uint32_t>(strings.GetOffsets().size());
+        header.stringOffsetsOffset = offset;
+        offset += AlignTo4(header.stringCount * sizeof(std::uint32_t));
+
+        header.stringDataOffset = offset;
+        header.stringDataSize = static_cast<std::uint32_t>(strings.GetData().size());
+        offset += AlignTo4(header.stringDataSize);
+
+        header.gameObjectCount = static_cast<std::uint32_t>(gameObjects.size());
+        header.gameObjectOffset = offset;
+        offset += AlignTo4(gameObjects.size() * sizeof(SceneBinaryGameObject));
+
+        header.blockCount = static_cast<std::uint32_t>(blockTable.size());
+        header.blockOffset = offset;
+        offset += AlignTo4(blockTable.size() * sizeof(SceneBinaryBlock));
+
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+        {
+            blockTable[i].recordOffset = offset;
+            offset += AlignTo4(blocks[i].records.size());
+        }
+
+        header.dataOffset = offset;
+        header.dataSize = static_cast<std::uint32_t>(componentData.size());
+        offset += header.dataSize;
+
+        header.fileSize = offset;
+
+        // 쓰기
+        outData.assign(offset, std::byte{ 0 });
+
+        Write(outData, 0, &header, 1);
+        Write(outData, header.stringOffsetsOffset, strings.GetOffsets().data(), strings.GetOffsets().size());
+        Write(outData, header.stringDataOffset, strings.GetData().data(), strings.GetData().size());
+        Write(outData, header.gameObjectOffset, gameObjects.data(), gameObjects.size());
+        Write(outData, header.blockOffset, blockTable.data(), blockTable.size());
+
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+        {
+            Write(outData, blockTable[i].recordOffset, blocks[i].records.data(), blocks[i].records.size());
+        }
+
+        Write(outData, header.dataOffset, componentData.data(), componentData.size());
+
+        return true;
+    }
+
+    bool SceneBinary::ConvertToJson(std::span<const std::byte> data, json& outScene)
+    {
+        const SceneBinaryReader reader{ data };
+        if (!reader.IsValid())
+        {
+            return false;
+        }
+
+        const auto gameObjects = reader.GetGameObjects();
+
+        outScene = json::object();
+        outScene["Name"] = reader.GetName();
+        outScene["NumGameObjects"] = gameObjects.size();
+        outScene["GameObjects"] = json::array();
+
+        // GameObject별 (componentIndex, 컴포넌트 JSON), 블록을 다 읽은 뒤 원래 순서로 정렬
+        std::vector<std::vector<std::pair<std::uint32_t, json>>> components(gameObjects.size());
+
+        json& gameObjectsJson = outScene["GameObjects"];
+        for (std::uint32_t i = 0; i < gameObjects.size(); ++i)
+        {
+            json goJson;
+            goJson["ID"] = i;
+
+            if (gameObjects[i].parent != SceneBinaryNoParent)
+            {
+                goJson["ParentID"] = gameObjects[i].parent;
+            }
+
+            goJson["Name"] = reader.GetString(gameObjects[i].name);
+            goJson["Active"] = gameObjects[i].active != 0;
+
+            gameObjectsJson.push_back(std::move(goJson));
+        }
+
+        for (const auto& block : reader.GetBlocks())
+        {
+            switch (block.encoding)
+            {
+            case SceneBinaryEncoding::Transform:
+                CollectComponents(reader, block, reader.GetTransforms(block), components);
+                break;
+            case SceneBinaryEncoding::MessagePack:
+                for (const auto& record : reader.GetComponents(block))
+                {
+                    const auto componentData = reader.GetComponentData(record);
+
+                    json compJson = json::from_msgpack(componentData.begin(), componentData.end(), true, false);
+                    if (compJson.is_discarded())
+                    {
+                        return false;
+                    }
+
+                    components[record.gameObject].emplace_back(record.componentIndex, std::move(compJson));
+                }
+                break;
+            case SceneBinaryEncoding::StaticMeshRenderer:
+            case SceneBinaryEncoding::SkeletalMeshRenderer:
+                CollectComponents(reader, block, reader.GetMeshRenderers(block), components);
+                break;
+            case SceneBinaryEncoding::Light:
+                CollectComponents(reader, block, reader.GetLights(block), components);
+                break;
+            case SceneBinaryEncoding::Camera:
+                CollectComponents(reader, block, reader.GetCameras(block), components);
+                break;
+            case SceneBinaryEncoding::BoxCollider:
+            case SceneBinaryEncoding::SphereCollider:
+            case SceneBinaryEncoding::CapsuleCollider:
+                CollectComponents(reader, block, reader.GetColliders(block), components);
+                break;
+            case SceneBinaryEncoding::Rigidbody:
+                CollectComponents(reader, block, reader.GetRigidbodies(block), components);
+                break;
+            }
+        }
+
+        for (std::size_t i = 0; i < components.size(); ++i)
+        {
+            std::sort(components[i].begin(), components[i].end(), [](const auto& a, const auto& b)
+                {
+                    return a.first < b.first;
+                });
+
+            json& componentsJson = gameObjectsJson[i]["Components"];
+            componentsJson = json::array();
+            for (auto& [componentIndex, compJson] : components[i])
+            {
+                componentsJson.push_back(std::move(compJson));
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,224 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace engine
+{
+    // 바이너리 씬 (.scenebin)
+    // - 원본은 JSON이고 SceneBinary::ConvertFromJson으로 만듦 (Scene::Save가 JSON과 같이 씀)
+    // - 포인터 없이 파일 시작 기준 오프셋만 쓰므로 메모리 맵한 그대로 읽음 (재배치 없음)
+    // - 모든 구조체와 구역은 4바이트 정렬
+    // [헤더][문자열 오프셋 표][문자열 데이터][GameObject 표][블록 표][블록별 레코드][MessagePack 데이터]
+    constexpr std::uint32_t SceneBinaryMagic = 0x4E43534D; // "MSCN"
+    constexpr std::uint32_t SceneBinaryVersion = 2;
+    constexpr std::uint32_t SceneBinaryNoParent = UINT32_MAX;
+
+    // MessagePack 외의 인코딩은 레코드를 JSON 없이 바로 컴포넌트에 넣음 (각 컴포넌트의 LoadBinary)
+    // 타입별 인코딩은 Save가 쓰는 키가 모두 있을 때만 쓰고, 아니면 같은 타입이라도 MessagePack 블록으로 감
+    enum class SceneBinaryEncoding : std::uint32_t
+    {
+        Transform,            // SceneBinaryTransform
+        MessagePack,          // SceneBinaryComponent 레코드 + 컴포넌트 JSON을 MessagePack으로 인코딩한 데이터 (스크립트 등)
+        StaticMeshRenderer,   // SceneBinaryMeshRenderer
+        SkeletalMeshRenderer, // SceneBinaryMeshRenderer (compactVertex는 안 씀)
+        Light,                // SceneBinaryLight
+        Camera,               // SceneBinaryCamera
+        BoxCollider,          // SceneBinaryCollider (size)
+        SphereCollider,       // SceneBinaryCollider (radius)
+        CapsuleCollider,      // SceneBinaryCollider (radius, height)
+        Rigidbody,            // SceneBinaryRigidbody
+    };
+
+    struct SceneBinaryHeader
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t fileSize;
+        std::uint32_t name; // 문자열 번호
+
+        std::uint32_t stringCount;
+        std::uint32_t stringOffsetsOffset; // uint32[stringCount], 문자열 데이터 기준 오프셋
+        std::uint32_t stringDataOffset;
+        std::uint32_t stringDataSize;
+
+        std::uint32_t gameObjectCount;
+        std::uint32_t gameObjectOffset;
+
+        std::uint32_t blockCount;
+        std::uint32_t blockOffset;
+
+        std::uint32_t dataOffset;
+        std::uint32_t dataSize;
+    };
+
+    struct SceneBinaryGameObject
+    {
+        std::uint32_t name;
+        std::uint32_t parent; // GameObject 표 번호, 없으면 SceneBinaryNoParent
+        std::uint32_t active;
+    };
+
+    // 같은 타입 컴포넌트의 레코드를 모은 구역 (Transform / RectTransform 블록이 항상 앞)
+    // 로드는 블록 순서대로 읽지만 Scene::LoadFromBinary와 JSON 변환 모두 componentIndex 순서로 컴포넌트를 다시 만듦
+    struct SceneBinaryBlock
+    {
+        std::uint32_t type; // 문자열 번호
+        SceneBinaryEncoding encoding;
+        std::uint32_t count;
+        std::uint32_t recordOffset;
+    };
+
+    struct SceneBinaryTransform
+    {
+        std::uint32_t gameObject;
+        std::uint32_t componentIndex; // JSON Components 배열 안의 위치
+        std::uint32_t active;
+        Vector3 position;
+        Quaternion rotation;
+        Vector3 scale;
+    };
+
+    struct SceneBinaryComponent
+    {
+        std::uint32_t gameObject;
+        std::uint32_t componentIndex;
+        std::uint32_t dataOffset; // MessagePack 데이터 구역 기준
+        std::uint32_t dataSize;
+    };
+
+    struct SceneBinaryMeshRenderer
+    {
+        std::uint32_t gameObject;
+        std::uint32_t componentIndex;
+        std::uint32_t active;
+        std::uint32_t meshFilePath; // 문자열 번호
+        std::uint32_t vsFilePath;
+        std::uint32_t opaquePSFilePath;
+        std::uint32_t cutoutPSFilePath;
+        std::uint32_t transparentPSFilePath;
+        Vector4 materialBaseColor;
+        Vector3 materialEmissive;
+        float materialRoughness;
+        float materialMetalness;
+        float materialAmbientOcclusion;
+        std::uint32_t overrideMaterial;
+        std::uint32_t compactVertex;
+    };
+
+    struct SceneBinaryLight
+    {
+        std::uint32_t gameObject;
+        std::uint32_t componentIndex;
+        std::uint32_t active;
+        std::int32_t lightType;
+        Vector3 color;
+        float intensity;
+        float range;
+        float angle;
+        float nearPlane;
+        float farPlane;
+        float forwardDistance;
+        float heightRatio;
+    };
+
+    struct SceneBinaryCamera
+    {
+        std::uint32_t gameObject;
+        std::uint32_t componentIndex;
+        std::uint32_t active;
+        float nearPlane;
+        float farPlane;
+        float fov;
+    };
+
+    struct SceneBinaryCollider
+    {
+        std::uint32_t gameObject;
+        std::uint32_t componentIndex;
+        std::uint32_t active;
+        Vector3 center;
+        Vector3 rotation;
+        std::uint32_t isTrigger;
+        std::uint32_t layer;
+        std::uint32_t collisionMask;
+        Vector3 size;
+        float radius;
+        float height;
+    };
+
+    struct SceneBinaryRigidbody
+    {
+        std::uint32_t gameObject;
+        std::uint32_t componentIndex;
+        std::uint32_t active;
+        std::int32_t type;
+        float mass;
+        float linearDamping;
+        float angularDamping;
+        std::uint32_t useGravity;
+        std::uint32_t constraints;
+        std::uint32_t layer;
+    };
+
+    static_assert(sizeof(SceneBinaryTransform) == 52);
+    static_assert(sizeof(SceneBinaryMeshRenderer) == 80);
+    static_assert(sizeof(SceneBinaryLight) == 56);
+    static_assert(sizeof(SceneBinaryCamera) == 24);
+    static_assert(sizeof(SceneBinaryCollider) == 68);
+    static_assert(sizeof(SceneBinaryRigidbody) == 40);
+
+    // 생성할 때 모든 오프셋과 번호의 범위를 검사하므로 IsValid면 Get 함수들은 검사 없이 읽음
+    class SceneBinaryReader
+    {
+    private:
+        std::span<const std::byte> m_data;
+        const SceneBinaryHeader* m_header = nullptr;
+
+    public:
+        // data는 reader를 쓰는 동안 유효해야 함 (메모리 맵한 파일 등)
+        explicit SceneBinaryReader(std::span<const std::byte> data);
+
+    public:
+        bool IsValid() const;
+
+        std::string_view GetName() const;
+        std::string_view GetString(std::uint32_t index) const;
+
+        std::span<const SceneBinaryGameObject> GetGameObjects() const;
+        std::span<const SceneBinaryBlock> GetBlocks() const;
+
+        // encoding이 Transform인 블록
+        std::span<const SceneBinaryTransform> GetTransforms(const SceneBinaryBlock& block) const;
+        // encoding이 MessagePack인 블록
+        std::span<const SceneBinaryComponent> GetComponents(const SceneBinaryBlock& block) const;
+        std::span<const std::uint8_t> GetComponentData(const SceneBinaryComponent& record) const;
+        // encoding이 StaticMeshRenderer / SkeletalMeshRenderer인 블록
+        std::span<const SceneBinaryMeshRenderer> GetMeshRenderers(const SceneBinaryBlock& block) const;
+        std::span<const SceneBinaryLight> GetLights(const SceneBinaryBlock& block) const;
+        std::span<const SceneBinaryCamera> GetCameras(const SceneBinaryBlock& block) const;
+        // encoding이 BoxCollider / SphereCollider / CapsuleCollider인 블록
+        std::span<const SceneBinaryCollider> GetColliders(const SceneBinaryBlock& block) const;
+        std::span<const SceneBinaryRigidbody> GetRigidbodies(const SceneBinaryBlock& block) const;
+
+    private:
+        bool Validate() const;
+        bool ValidateBlock(const SceneBinaryBlock& block) const;
+        bool IsInRange(std::uint64_t offset, std::uint64_t size) const;
+
+        template <typename T>
+        std::span<const T> GetArray(std::uint32_t offset, std::uint32_t count) const
+        {
+            return { reinterpret_cast<const T*>(m_data.data() + offset), count };
+        }
+    };
+
+    // JSON 씬 (Scene::SaveToJson과 같은 구조) <-> 바이너리 씬
+    class SceneBinary
+    {
+    public:
+        static bool ConvertFromJson(const json& scene, std::vector<std::byte>& outData);
+        static bool ConvertToJson(std::span<const std::byte> data, json& outScene);
+    };
+}
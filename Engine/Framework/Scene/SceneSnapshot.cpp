@@ -0,0 +1,480 @@
+﻿#include "EnginePCH.h"
+#include "SceneSnapshot.h"
+
+#include <functional>
+#include <unordered_set>
+
+#include "Framework/Object/GameObject/GameObject.h"
+#include "Framework/Object/Component/Component.h"
+#include "Framework/Object/Component/ComponentFactory.h"
+#include "Framework/Object/Component/Transform.h"
+#include "Framework/Object/Component/RectTransform.h"
+#include "Framework/Object/Component/Rigidbody.h"
+#include "Framework/Object/Component/Collider.h"
+#include "Framework/Object/Component/CharacterController.h"
+#include "Framework/Object/Component/Script.h"
+#include "Framework/Scene/Scene.h"
+
+namespace engine
+{
+    namespace
+    {
+        // 값이 바뀌었으면 Load로 덮지 않고 다시 만듦 (PhysX 객체를 Awake에서 설정대로 새로 만들도록)
+        bool HasPhysicsObject(Component* component)
+        {
+            return ComponentCast<Rigidbody>(component) != nullptr ||
+                ComponentCast<Collider>(component) != nullptr ||
+                ComponentCast<CharacterController>(component) != nullptr;
+        }
+
+        template <typename T>
+        T* ResolveHandle(Handle handle)
+        {
+            return static_cast<T*>(Object::GetObjectFromHandle(handle));
+        }
+    }
+
+    void SceneSnapshot::Capture(const Scene& scene)
+    {
+        Clear();
+
+        m_sceneName = scene.GetName();
+
+        const auto& gameObjects = scene.GetGameObjects();
+        m_gameObjects.reserve(gameObjects.size());
+        m_components.reserve(gameObjects.size() * 2);
+
+        // 부모가 항상 앞에 오도록 계층 순서로 (Restore에서 부모부터 되돌림)
+        std::function<void(Transform*, std::uint32_t)> traverse = [&](Transform* transform, std::uint32_t parent)
+            {
+                GameObject* go = transform->GetGameObject();
+                if (go->IsPendingKill())
+                {
+                    return;
+                }
+
+                const std::uint32_t index = static_cast<std::uint32_t>(m_gameObjects.size());
+
+                GameObjectEntry& entry = m_gameObjects.emplace_back();
+                entry.handle = go->GetHandle();
+                entry.name = go->m_name;
+                entry.parent = parent;
+                entry.active = go->m_active;
+                entry.isRectTransform = ComponentCast<RectTransform>(transform) != nullptr;
+                entry.transformActive = transform->IsActiveSelf();
+                entry.position = transform->GetLocalPosition();
+                entry.rotation = transform->GetLocalRotation();
+                entry.scale = transform->GetLocalScale();
+                entry.firstComponent = static_cast<std::uint32_t>(m_components.size());
+
+                if (entry.isRectTransform)
+                {
+                    AddComponent(entry, transform);
+                }
+
+                for (const auto& component : go->m_components)
+                {
+                    // 교체된 기본 Transform은 삭제 대기 중
+                    if (component->IsPendingKill())
+                    {
+                        continue;
+                    }
+
+                    if (component.get() == transform)
+                    {
+                        entry.transformIndex = entry.componentCount - (entry.isRectTransform ? 1 : 0);
+                        continue;
+                    }
+
+                    AddComponent(entry, component.get());
+                }
+
+                for (Transform* child : transform->GetChildren())
+                {
+                    traverse(child, index);
+                }
+            };
+
+        for (const auto& go : gameObjects)
+        {
+            if (go->GetTransform()->GetParent() == nullptr)
+            {
+                traverse(go->GetTransform(), NoParent);
+            }
+        }
+    }
+
+    SceneRestoreStats SceneSnapshot::Restore(Scene& scene)
+    {
+        SceneRestoreStats stats;
+
+        if (scene.GetName() != m_sceneName)
+        {
+            scene.SetName(m_sceneName);
+        }
+
+        std::vector<GameObject*> gameObjects(m_gameObjects.size(), nullptr);
+        std::vector<bool> isRecreated(m_gameObjects.size(), false);
+        std::vector<Component*> components(m_components.size(), nullptr);
+
+        std::unordered_set<const GameObject*> keptGameObjects;
+        keptGameObjects.reserve(m_gameObjects.size());
+
+        // 1. GameObject와 컴포넌트
+        for (std::size_t i = 0; i < m_gameObjects.size(); ++i)
+        {
+            const GameObjectEntry& entry = m_gameObjects[i];
+
+            GameObject* go = ResolveHandle<GameObject>(entry.handle);
+            if (go != nullptr && !go->IsPendingKill())
+            {
+                // Play 중에 Transform 종류가 바뀌었으면 통째로 다시 만듦
+                const bool isRectTransform = ComponentCast<RectTransform>(go->GetTransform()) != nullptr;
+                if (isRectTransform != entry.isRectTransform)
+                {
+                    go->Destroy();
+                    ++stats.destroyedCount;
+
+                    go = nullptr;
+                }
+            }
+            else
+            {
+                go = nullptr;
+            }
+
+            const std::span<Component*> liveComponents{ components.data() + entry.firstComponent, entry.componentCount };
+
+            if (go == nullptr)
+            {
+                gameObjects[i] = CreateGameObject(scene, entry, liveComponents);
+                isRecreated[i] = true;
+                ++stats.recreatedCount;
+
+                continue;
+            }
+
+            gameObjects[i] = go;
+            keptGameObjects.insert(go);
+
+            if (go->m_name != entry.name)
+            {
+                go->SetName(entry.name);
+            }
+
+            const std::span<const ComponentEntry> componentEntries{ m_components.data() + entry.firstComponent, entry.componentCount };
+
+            // Play 중에 추가된 컴포넌트 (Destroy 중에 목록이 바뀌지 않도록 처음 개수만)
+            const std::size_t liveCount = go->m_components.size();
+            for (std::size_t j = 0; j < liveCount; ++j)
+            {
+                Component* component = go->m_components[j].get();
+                if (component->IsPendingKill() || (component == go->GetTransform() && !entry.isRectTransform))
+                {
+                    continue;
+                }
+
+                const Handle handle = component->GetHandle();
+                const bool isCaptured = std::ranges::any_of(componentEntries, [handle](const ComponentEntry& c) { return c.handle == handle; });
+                if (!isCaptured)
+                {
+                    component->Destroy();
+                    ++stats.destroyedCount;
+                }
+            }
+
+            if (!entry.isRectTransform)
+            {
+                Transform* transform = go->GetTransform();
+
+                if (transform->GetLocalPosition() != entry.position ||
+                    transform->GetLocalRotation() != entry.rotation ||
+                    transform->GetLocalScale() != entry.scale ||
+                    transform->IsActiveSelf() != entry.transformActive)
+                {
+                    transform->SetLocalPosition(entry.position);
+                    transform->SetLocalRotation(entry.rotation);
+                    transform->SetLocalScale(entry.scale);
+                    transform->SetActive(entry.transformActive);
+                    ++stats.restoredCount;
+                }
+                else
+                {
+                    ++stats.unchangedCount;
+                }
+            }
+
+            for (std::size_t j = 0; j < componentEntries.size(); ++j)
+            {
+                const ComponentEntry& componentEntry = componentEntries[j];
+
+                Component* component = ResolveHandle<Component>(componentEntry.handle);
+                if (component == nullptr || component->IsPendingKill() || component->GetGameObject() != go)
+                {
+                    liveComponents[j] = CreateComponent(go, componentEntry);
+                    ++stats.recreatedCount;
+                    continue;
+                }
+
+                // 스크립트는 Save에 없는 멤버가 다음 Play로 넘어가지 않도록 항상 다시 만듦
+                const bool isScript = ComponentCast<ScriptBase>(component) != nullptr;
+
+                if (!isScript && IsSameData(component, componentEntry))
+                {
+                    liveComponents[j] = component;
+                    ++stats.unchangedCount;
+                    continue;
+                }
+
+                if (isScript || HasPhysicsObject(component))
+                {
+                    component->Destroy();
+                    liveComponents[j] = CreateComponent(go, componentEntry);
+                    ++stats.recreatedCount;
+                    continue;
+                }
+
+                liveComponents[j] = component;
+
+                if (componentEntry.dataSize > 0)
+                {
+                    const auto data = GetData(componentEntry);
+                    component->Load(json::from_msgpack(data.begin(), data.end()));
+                }
+                ++stats.restoredCount;
+            }
+        }
+
+        // 2. 부모 (계층 순서라 부모는 이미 제자리이므로 순환이 생기지 않음)
+        for (std::size_t i = 0; i < m_gameObjects.size(); ++i)
+        {
+            const std::uint32_t parentIndex = m_gameObjects[i].parent;
+            Transform* parent = parentIndex != NoParent ? gameObjects[parentIndex]->GetTransform() : nullptr;
+
+            Transform* transform = gameObjects[i]->GetTransform();
+            if (transform->GetParent() != parent)
+            {
+                transform->SetParent(parent);
+            }
+        }
+
+        // 형제 순서 (계층 순서라 같은 부모의 자식은 Capture 때 순서대로 나옴)
+        std::vector<std::uint32_t> siblingCounts(m_gameObjects.size(), 0);
+        for (std::size_t i = 0; i < m_gameObjects.size(); ++i)
+        {
+            const std::uint32_t parentIndex = m_gameObjects[i].parent;
+            if (parentIndex != NoParent)
+            {
+                gameObjects[i]->GetTransform()->SetSiblingIndex(siblingCounts[parentIndex]++);
+            }
+        }
+
+        // 3. 활성 상태 (부모부터)
+        for (std::size_t i = 0; i < m_gameObjects.size(); ++i)
+        {
+            GameObject* go = gameObjects[i];
+
+            if (!isRecreated[i])
+            {
+                go->SetActive(m_gameObjects[i].active);
+                continue;
+            }
+
+            Transform* parent = go->GetTransform()->GetParent();
+            go->UpdateActiveInHierarchy(parent != nullptr ? parent->GetGameObject()->IsActive() : true);
+        }
+
+        // 4. Play 중에 생긴 GameObject (부모를 되돌린 뒤라 자식으로 옮겨진 기존 오브젝트는 같이 지워지지 않음)
+        for (const auto& go : scene.GetGameObjects())
+        {
+            if (!go->IsPendingKill() && !keptGameObjects.contains(go.get()))
+            {
+                go->Destroy();
+                ++stats.destroyedCount;
+            }
+        }
+
+        scene.ProcessPendingKills();
+
+        // 5. 순서 (삭제가 swap-remove라 지운 뒤에 맞춤)
+        RestoreOrder(scene, gameObjects, components);
+
+        return stats;
+    }
+
+    void SceneSnapshot::Clear()
+    {
+        m_sceneName.clear();
+        m_gameObjects.clear();
+        m_components.clear();
+        m_types.clear();
+        m_data.clear();
+    }
+
+    bool SceneSnapshot::IsEmpty() const
+    {
+        return m_gameObjects.empty();
+    }
+
+    std::size_t SceneSnapshot::GetMemorySize() const
+    {
+        std::size_t size = m_gameObjects.capacity() * sizeof(GameObjectEntry) +
+            m_components.capacity() * sizeof(ComponentEntry) +
+            m_data.capacity();
+
+        for (const auto& entry : m_gameObjects)
+        {
+            size += entry.name.capacity();
+        }
+
+        for (const auto& type : m_types)
+        {
+            size += sizeof(std::string) + type.capacity();
+        }
+
+        return size;
+    }
+
+    std::uint32_t SceneSnapshot::AddType(const std::string& type)
+    {
+        // 타입 종류는 많지 않으므로 선형 탐색
+        if (auto iter = std::ranges::find(m_types, type); iter != m_types.end())
+        {
+            return static_cast<std::uint32_t>(iter - m_types.begin());
+        }
+
+        m_types.push_back(type);
+        return static_cast<std::uint32_t>(m_types.size() - 1);
+    }
+
+    void SceneSnapshot::AddComponent(GameObjectEntry& entry, const Component* component)
+    {
+        json compJson;
+        component->Save(compJson);
+
+        ComponentEntry& componentEntry = m_components.emplace_back();
+        componentEntry.handle = component->GetHandle();
+        componentEntry.type = AddType(component->GetType());
+        componentEntry.dataOffset = static_cast<std::uint32_t>(m_data.size());
+
+        if (!compJson.empty())
+        {
+            json::to_msgpack(compJson, m_data);
+        }
+
+        componentEntry.dataSize = static_cast<std::uint32_t>(m_data.size()) - componentEntry.dataOffset;
+
+        ++entry.componentCount;
+    }
+
+    std::span<const std::uint8_t> SceneSnapshot::GetData(const ComponentEntry& entry) const
+    {
+        return { m_data.data() + entry.dataOffset, entry.dataSize };
+    }
+
+    bool SceneSnapshot::IsSameData(const Component* component, const ComponentEntry& entry)
+    {
+        json compJson;
+        component->Save(compJson);
+
+        if (compJson.empty())
+        {
+            return entry.dataSize == 0;
+        }
+
+        m_compareBuffer.clear();
+        json::to_msgpack(compJson, m_compareBuffer);
+
+        return std::ranges::equal(m_compareBuffer, GetData(entry));
+    }
+
+    void SceneSnapshot::RestoreOrder(Scene& scene, std::span<GameObject* const> gameObjects, std::span<Component* const> components)
+    {
+        std::vector<Component*> order;
+
+        for (std::size_t i = 0; i < m_gameObjects.size(); ++i)
+        {
+            const GameObjectEntry& entry = m_gameObjects[i];
+            GameObject* go = gameObjects[i];
+
+            // RectTransform 항목은 Transform 자리에 넣으므로 건너뜀
+            const std::uint32_t first = entry.firstComponent + (entry.isRectTransform ? 1 : 0);
+            const std::uint32_t last = entry.firstComponent + entry.componentCount;
+
+            order.clear();
+            for (std::uint32_t j = first; j < last; ++j)
+            {
+                if (components[j] != nullptr)
+                {
+                    order.push_back(components[j]);
+                }
+            }
+
+            const std::size_t transformIndex = std::min<std::size_t>(entry.transformIndex, order.size());
+            order.insert(order.begin() + transformIndex, go->GetTransform());
+
+            go->ReorderComponents(order);
+        }
+
+        // Capture가 계층 순서로 담았으므로 루트끼리의 순서도 그대로 맞춰짐
+        scene.ReorderGameObjects(gameObjects);
+    }
+
+    GameObject* SceneSnapshot::CreateGameObject(Scene& scene, const GameObjectEntry& entry, std::span<Component*> components)
+    {
+        GameObject* go = scene.CreateGameObject(entry.name);
+        go->m_active = entry.active;
+
+        if (!entry.isRectTransform)
+        {
+            Transform* transform = go->GetTransform();
+            transform->SetActive(entry.transformActive);
+            transform->SetLocalPosition(entry.position);
+            transform->SetLocalRotation(entry.rotation);
+            transform->SetLocalScale(entry.scale);
+        }
+
+        // RectTransform이면 첫 번째 항목
+        for (std::uint32_t i = 0; i < entry.componentCount; ++i)
+        {
+            components[i] = CreateComponent(go, m_components[entry.firstComponent + i]);
+        }
+
+        return go;
+    }
+
+    Component* SceneSnapshot::CreateComponent(GameObject* gameObject, const ComponentEntry& entry)
+    {
+        const std::string& type = m_types[entry.type];
+
+        json compJson;
+        if (entry.dataSize > 0)
+        {
+            const auto data = GetData(entry);
+            compJson = json::from_msgpack(data.begin(), data.end());
+        }
+
+        if (type == "RectTransform")
+        {
+            RectTransform* rt = gameObject->ReplaceTransformWithRectTransform();
+            if (rt != nullptr)
+            {
+                rt->Load(compJson);
+            }
+            return rt;
+        }
+
+        auto component = ComponentFactory::Get().Create(type);
+        if (!component)
+        {
+            LOG_ERROR("SceneSnapshot::CreateComponent - 등록되지 않은 컴포넌트: {}", type);
+            return nullptr;
+        }
+
+        if (entry.dataSize > 0)
+        {
+            component->Load(compJson);
+        }
+        return gameObject->AddComponent(std::move(component));
+    }
+}
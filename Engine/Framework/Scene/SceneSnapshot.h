@@ -0,0 +1,90 @@
+﻿#pragma once
+
+#include <span>
+
+#include "Framework/Object/Handle.h"
+
+namespace engine
+{
+    class Scene;
+    class GameObject;
+    class Component;
+
+    // Restore에서 손댄 양 (컴포넌트 단위, GameObject를 통째로 만들거나 지운 것은 GameObject 하나로 셈)
+    struct SceneRestoreStats
+    {
+        std::size_t unchangedCount = 0;
+        std::size_t restoredCount = 0;  // 값만 되돌림 (Transform 직접 / 나머지는 Load)
+        std::size_t recreatedCount = 0; // 지워졌거나 물리 객체를 가졌거나 스크립트라 다시 만듦
+        std::size_t destroyedCount = 0; // Play 중에 추가된 것
+    };
+
+    // 에디터 Play 직전 상태를 JSON 트리 없이 메모리에 들고 있다가 Stop에서 바뀐 것만 되돌림
+    // - GameObject / 컴포넌트는 핸들로 찾으므로 살아남은 객체는 그대로 (포인터, 렌더 등록, 물리 Actor 유지)
+    // - Transform은 TRS를 그대로, 나머지 컴포넌트는 Save 결과를 MessagePack으로 저장하고 바이트 비교
+    // - Save에 없는 런타임 값은 Scene::EndPlay가 부르는 Component::ResetRuntimeState에서 되돌림
+    //   스크립트는 멤버를 마음대로 들고 있으므로 값이 같아도 다시 만듦
+    // - 루트 / 형제 순서와 컴포넌트 순서도 Capture 때로 되돌림
+    class SceneSnapshot
+    {
+    private:
+        static constexpr std::uint32_t NoParent = UINT32_MAX;
+
+        struct GameObjectEntry
+        {
+            Handle handle;
+            std::string name;
+            std::uint32_t parent = NoParent; // m_gameObjects 번호 (부모가 항상 앞)
+            bool active = true;
+
+            // RectTransform이면 TRS 대신 첫 번째 컴포넌트 항목에 Save 결과가 있음
+            bool isRectTransform = false;
+            bool transformActive = true;
+            Vector3 position;
+            Quaternion rotation;
+            Vector3 scale;
+
+            std::uint32_t transformIndex = 0; // Transform 앞에 있던 다른 컴포넌트 개수
+            std::uint32_t firstComponent = 0;
+            std::uint32_t componentCount = 0;
+        };
+
+        struct ComponentEntry
+        {
+            Handle handle;
+            std::uint32_t type = 0; // m_types 번호
+            std::uint32_t dataOffset = 0;
+            std::uint32_t dataSize = 0; // 0이면 Save 결과가 비어 있음 (만들기만 하고 Load 안 함)
+        };
+
+        std::string m_sceneName; // Play 중에 씬을 바꿨으면 이름까지 되돌림
+        std::vector<GameObjectEntry> m_gameObjects;
+        std::vector<ComponentEntry> m_components;
+        std::vector<std::string> m_types;
+        std::vector<std::uint8_t> m_data;
+
+        std::vector<std::uint8_t> m_compareBuffer; // Restore에서 현재 값을 인코딩할 때 재사용
+
+    public:
+        // ProcessPendingAdds로 대기열을 비운 뒤에 호출
+        void Capture(const Scene& scene);
+
+        // EndPlay 뒤, 물리 씬을 지우기 전에 호출 (물리 컴포넌트가 Actor를 정리할 수 있도록)
+        SceneRestoreStats Restore(Scene& scene);
+
+        void Clear();
+        bool IsEmpty() const;
+        std::size_t GetMemorySize() const;
+
+    private:
+        std::uint32_t AddType(const std::string& type);
+        void AddComponent(GameObjectEntry& entry, const Component* component);
+        std::span<const std::uint8_t> GetData(const ComponentEntry& entry) const;
+        bool IsSameData(const Component* component, const ComponentEntry& entry);
+
+        // components에 항목별로 만든 컴포넌트를 채움
+        GameObject* CreateGameObject(Scene& scene, const GameObjectEntry& entry, std::span<Component*> components);
+        Component* CreateComponent(GameObject* gameObject, const ComponentEntry& entry);
+        void RestoreOrder(Scene& scene, std::span<GameObject* const> gameObjects, std::span<Component* const> components);
+    };
+}
@@ -1,16 +1,44 @@
 ﻿#include "EnginePCH.h"
 #include "AnimatorSystem.h"
 
+#include "Common/Utility/JobSystem.h"
+
 namespace engine
 {
     void AnimatorSystem::Update()
     {
+        m_parallelAnimators.clear();
+
         for (auto animator : m_components)
         {
-            if (animator->IsActive())
+            if (!animator->IsActive())
+            {
+                continue;
+            }
+
+            if (animator->CanUpdateInParallel())
             {
+                m_parallelAnimators.push_back(animator);
+            }
+            else
+            {
+                // 렌더러 등 공유 상태를 건드리는 애니메이터는 메인 스레드에서
                 animator->Update();
             }
         }
+
+        // 애니메이터 하나가 본 최대 128개를 계산하므로 작게 나눔
+        constexpr std::uint32_t grainSize = 2;
+
+        // ParallelFor는 모든 구간이 끝날 때까지 기다리므로
+        // 반환 이후 RenderSystem::Update에서 본 행렬을 읽어도 안전함
+        JobSystem::Get().ParallelFor(static_cast<std::uint32_t>(m_parallelAnimators.size()), grainSize,
+            [this](std::uint32_t begin, std::uint32_t end)
+            {
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    m_parallelAnimators[i]->Update();
+                }
+            });
     }
 }
\ No newline at end of file
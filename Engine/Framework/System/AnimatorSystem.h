@@ -8,6 +8,9 @@ namespace engine
     class AnimatorSystem :
         public System<Animator>
     {
+    private:
+        std::vector<Animator*> m_parallelAnimators; // 이번 프레임에 워커로 넘길 애니메이터
+
     public:
         void Update();
     };
@@ -2,13 +2,20 @@
 #include "CameraSystem.h"
 
 #include "Core/Graphics/Device/GraphicsDevice.h"
+#include "Framework/Object/Component/Transform.h"
 
 namespace engine
 {
+    CameraSystem::CameraSystem()
+    {
+        m_cameras.Reserve(16);
+    }
+
     void CameraSystem::Register(Camera* camera)
     {
         System::Register(camera);
 
+        m_cameras.Get<RegisteredColumn>(camera->m_slot) = 1;
         m_mainCamera = camera;
 
         const auto& viewport = GraphicsDevice::Get().GetViewport();
@@ -21,14 +28,58 @@ namespace engine
     {
         System::Unregister(camera);
 
+        m_cameras.Get<RegisteredColumn>(camera->m_slot) = 0;
         m_mainCamera = nullptr;
     }
 
     void CameraSystem::Update()
     {
-        if (m_mainCamera != nullptr)
+        const auto& registered = m_cameras.GetColumn<RegisteredColumn>();
+        const auto& projectionTypes = m_cameras.GetColumn<ProjectionTypeColumn>();
+        const auto& nears = m_cameras.GetColumn<NearColumn>();
+        const auto& fars = m_cameras.GetColumn<FarColumn>();
+        const auto& fovs = m_cameras.GetColumn<FovColumn>();
+        const auto& scales = m_cameras.GetColumn<ScaleColumn>();
+        const auto& widths = m_cameras.GetColumn<WidthColumn>();
+        const auto& heights = m_cameras.GetColumn<HeightColumn>();
+
+        auto& worlds = m_cameras.GetColumn<WorldColumn>();
+        auto& views = m_cameras.GetColumn<ViewColumn>();
+        auto& projections = m_cameras.GetColumn<ProjectionColumn>();
+        auto& frustums = m_cameras.GetColumn<FrustumColumn>();
+
+        for (std::size_t slot = 0; slot < registered.size(); ++slot)
         {
-            m_mainCamera->Update();
+            if (registered[slot] == 0)
+            {
+                continue;
+            }
+
+            // scale을 뺀 world
+            const Matrix world = m_cameras.GetOwner(static_cast<std::int32_t>(slot))->GetTransform()->GetWorld();
+
+            Vector3 scale;
+            Quaternion rotation;
+            Vector3 translation;
+            world.Decompose(scale, rotation, translation);
+
+            const Vector3 forward = Vector3::Transform(Vector3::UnitZ, rotation);
+            const Vector3 up = Vector3::Transform(Vector3::UnitY, rotation);
+
+            worlds[slot] = Matrix::CreateWorld(translation, forward, up);
+            views[slot] = DirectX::XMMatrixLookToLH(translation, forward, up);
+
+            if (projectionTypes[slot] == ProjectionType::Perspective)
+            {
+                projections[slot] = DirectX::XMMatrixPerspectiveFovLH(ToRadian(fovs[slot]), widths[slot] / heights[slot], nears[slot], fars[slot]);
+            }
+            else
+            {
+                projections[slot] = DirectX::XMMatrixOrthographicLH(widths[slot] * scales[slot], heights[slot] * scales[slot], nears[slot], fars[slot]);
+            }
+
+            frustums[slot] = DirectX::BoundingFrustum(projections[slot]);
+            frustums[slot].Transform(frustums[slot], worlds[slot]);
         }
     }
 
@@ -36,4 +87,35 @@ namespace engine
     {
         return m_mainCamera;
     }
+
+    std::size_t CameraSystem::GetSlotCount() const
+    {
+        return m_cameras.GetSize();
+    }
+
+    std::int32_t CameraSystem::CreateSlot(Camera* owner)
+    {
+        return m_cameras.Add(owner,
+            ProjectionType::Perspective,
+            Matrix::Identity,
+            Matrix::Identity,
+            Matrix::Identity,
+            DirectX::BoundingFrustum{},
+            1.0f,       // near
+            5000.0f,    // far
+            50.0f,      // fov
+            1.0f,       // scale
+            1.0f,       // width
+            1.0f,       // height
+            1,          // dirty
+            0);         // registered
+    }
+
+    void CameraSystem::DestroySlot(std::int32_t slot)
+    {
+        if (Camera* moved = m_cameras.Remove(slot); moved != nullptr)
+        {
+            moved->m_slot = slot;
+        }
+    }
 }
\ No newline at end of file
@@ -1,23 +1,57 @@
 ﻿#pragma once
 
 #include "Framework/System/System.h"
+#include "Framework/System/ComponentColumns.h"
 #include "Framework/Object/Component/Camera.h"
 
 namespace engine
 {
+    // Camera 데이터는 여기서 열 단위로 들고 있고 Camera 컴포넌트는 slot 번호만 가짐 (LightSystem과 같음)
     class CameraSystem :
         public System<Camera>
     {
     private:
+        enum CameraColumn : std::size_t
+        {
+            ProjectionTypeColumn,
+            WorldColumn, // scale이 제거된 world 행렬
+            ViewColumn,
+            ProjectionColumn,
+            FrustumColumn,
+            NearColumn,
+            FarColumn,
+            FovColumn,
+            ScaleColumn, // Orthographic용
+            WidthColumn,
+            HeightColumn,
+            DirtyColumn,
+            RegisteredColumn // Initialize로 등록됐으면 1
+        };
+
+        ComponentColumns<Camera, ProjectionType, Matrix, Matrix, Matrix, DirectX::BoundingFrustum,
+            float, float, float, float, float, float, std::uint8_t, std::uint8_t> m_cameras;
+
         Camera* m_mainCamera = nullptr;
 
     public:
+        CameraSystem();
+
     public:
         void Register(Camera* camera) override;
         void Unregister(Camera* camera) override;
 
+        // 등록된 카메라의 world / view / projection / frustum을 열 단위로 갱신
         void Update();
 
         Camera* GetMainCamera() const;
+
+        std::size_t GetSlotCount() const;
+
+    private:
+        std::int32_t CreateSlot(Camera* owner);
+        void DestroySlot(std::int32_t slot);
+
+    private:
+        friend class Camera;
     };
 }
\ No newline at end of file
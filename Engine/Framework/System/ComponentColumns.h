@@ -0,0 +1,89 @@
+﻿#pragma once
+
+#include <tuple>
+
+namespace engine
+{
+    // 컴포넌트 타입 하나의 데이터를 열(column)마다 vector 하나로 빽빽하게 저장
+    // 행 번호가 slot이고 컴포넌트는 slot만 들고 있는 핸들 (TransformSystem과 같은 방식)
+    // 삭제하면 마지막 행을 빈 자리로 옮기므로 0 ~ GetSize() - 1이 항상 채워져 있어서 시스템이 앞에서부터 쭉 읽으면 됨
+    template <typename Owner, typename... Columns>
+    class ComponentColumns
+    {
+    private:
+        std::tuple<std::vector<Columns>...> m_columns;
+        std::vector<Owner*> m_owners;
+
+    public:
+        void Reserve(std::size_t capacity)
+        {
+            std::apply([capacity](auto&... column) { (column.reserve(capacity), ...); }, m_columns);
+            m_owners.reserve(capacity);
+        }
+
+        std::int32_t Add(Owner* owner, const Columns&... values)
+        {
+            std::apply([&values...](auto&... column) { (column.push_back(values), ...); }, m_columns);
+            m_owners.push_back(owner);
+
+            return static_cast<std::int32_t>(m_owners.size() - 1);
+        }
+
+        // 마지막 행을 slot으로 옮기고 옮겨진 행의 Owner를 돌려줌 (slot이 마지막이었으면 nullptr)
+        // 호출한 쪽에서 돌려받은 Owner의 slot을 갱신해야 함
+        Owner* Remove(std::int32_t slot)
+        {
+            assert(0 <= slot && slot < static_cast<std::int32_t>(m_owners.size()));
+
+            const std::size_t last = m_owners.size() - 1;
+            Owner* moved = nullptr;
+
+            if (static_cast<std::size_t>(slot) != last)
+            {
+                std::apply([slot, last](auto&... column) { ((column[slot] = std::move(column[last])), ...); }, m_columns);
+                m_owners[slot] = m_owners[last];
+                moved = m_owners[slot];
+            }
+
+            std::apply([](auto&... column) { (column.pop_back(), ...); }, m_columns);
+            m_owners.pop_back();
+
+            return moved;
+        }
+
+        template <std::size_t Column>
+        auto& Get(std::int32_t slot)
+        {
+            return std::get<Column>(m_columns)[slot];
+        }
+
+        template <std::size_t Column>
+        const auto& Get(std::int32_t slot) const
+        {
+            return std::get<Column>(m_columns)[slot];
+        }
+
+        // 열 전체 (시스템의 일괄 갱신용)
+        template <std::size_t Column>
+        auto& GetColumn()
+        {
+            return std::get<Column>(m_columns);
+        }
+
+        template <std::size_t Column>
+        const auto& GetColumn() const
+        {
+            return std::get<Column>(m_columns);
+        }
+
+        Owner* GetOwner(std::int32_t slot) const
+        {
+            return m_owners[slot];
+        }
+
+        std::size_t GetSize() const
+        {
+            return m_owners.size();
+        }
+    };
+}
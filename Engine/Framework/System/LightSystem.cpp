@@ -3,11 +3,39 @@
 
 namespace engine
 {
+	LightSystem::LightSystem()
+	{
+		m_lights.Reserve(256);
+	}
+
+	void LightSystem::Register(Light* light)
+	{
+		System::Register(light);
+
+		m_lights.Get<RegisteredColumn>(light->m_slot) = 1;
+	}
+
+	void LightSystem::Unregister(Light* light)
+	{
+		System::Unregister(light);
+
+		m_lights.Get<RegisteredColumn>(light->m_slot) = 0;
+	}
+
 	Light* LightSystem::GetMainLight() const
 	{
-		for (auto light : m_components)
+		const auto& types = m_lights.GetColumn<TypeColumn>();
+		const auto& registered = m_lights.GetColumn<RegisteredColumn>();
+
+		for (std::size_t slot = 0; slot < types.size(); ++slot)
 		{
-			if (light->IsActive() && light->GetLightType() == LightType::Directional)
+			if (types[slot] != LightType::Directional || registered[slot] == 0)
+			{
+				continue;
+			}
+
+			Light* light = m_lights.GetOwner(static_cast<std::int32_t>(slot));
+			if (light->IsActive())
 			{
 				return light;
 			}
@@ -19,4 +47,32 @@ namespace engine
 	{
 		return m_components;
 	}
+
+	std::size_t LightSystem::GetSlotCount() const
+	{
+		return m_lights.GetSize();
+	}
+
+	std::int32_t LightSystem::CreateSlot(Light* owner)
+	{
+		return m_lights.Add(owner,
+			LightType::Directional,
+			Vector3(1.0f, 1.0f, 1.0f),
+			1.0f,		// intensity
+			10.0f,		// range
+			45.0f,		// angle
+			90000.0f,	// near
+			100000.0f,	// far
+			1000.0f,	// forward distance
+			0.9f,		// height ratio
+			0);			// registered
+	}
+
+	void LightSystem::DestroySlot(std::int32_t slot)
+	{
+		if (Light* moved = m_lights.Remove(slot); moved != nullptr)
+		{
+			moved->m_slot = slot;
+		}
+	}
 }
\ No newline at end of file
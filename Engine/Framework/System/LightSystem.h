@@ -1,15 +1,51 @@
 ﻿#pragma once
 
 #include "Framework/System/System.h"
+#include "Framework/System/ComponentColumns.h"
 #include "Framework/Object/Component/Light.h"
 
 namespace engine
 {
+	// Light 데이터는 여기서 열 단위로 들고 있고 Light 컴포넌트는 slot 번호만 가짐
+	// slot은 Light가 생성될 때 만들어짐 (Initialize 전에 Load로 값을 채우므로 Register와는 따로)
 	class LightSystem :
 		public System<Light>
 	{
+	private:
+		enum LightColumn : std::size_t
+		{
+			TypeColumn,
+			ColorColumn,
+			IntensityColumn,
+			RangeColumn,
+			AngleColumn,
+			NearColumn,
+			FarColumn,
+			ForwardDistColumn,
+			HeightRatioColumn,
+			RegisteredColumn // Initialize로 등록됐으면 1
+		};
+
+		ComponentColumns<Light, LightType, Vector3, float, float, float, float, float, float, float, std::uint8_t> m_lights;
+
+	public:
+		LightSystem();
+
 	public:
+		void Register(Light* light) override;
+		void Unregister(Light* light) override;
+
+		// 등록된 활성 Directional 중 slot이 가장 앞인 것 (타입 열만 훑고 후보일 때만 Light를 봄)
 		Light* GetMainLight() const;
 		const std::vector<Light*>& GetLights() const;
+
+		std::size_t GetSlotCount() const;
+
+	private:
+		std::int32_t CreateSlot(Light* owner);
+		void DestroySlot(std::int32_t slot);
+
+	private:
+		friend class Light;
 	};
 }
\ No newline at end of file
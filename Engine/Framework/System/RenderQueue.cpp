@@ -0,0 +1,426 @@
+﻿#include "EnginePCH.h"
+#include "RenderQueue.h"
+
+#include "Core/Graphics/Device/CommandContext.h"
+#include "Core/Graphics/Data/ShaderSlotTypes.h"
+
+namespace engine
+{
+    namespace
+    {
+        constexpr int PassShift = 60;
+        constexpr int ShaderShift = 44;
+        constexpr int MaterialShift = 28;
+        constexpr int MeshShift = 12;
+        constexpr std::uint64_t FieldMask = 0xFFFF;
+        constexpr std::uint64_t DepthMask = 0xFFF;
+
+        std::uint64_t HashPointer(std::uint64_t seed, const void* pointer)
+        {
+            std::uint64_t value = seed ^ static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(pointer));
+            value *= 0x9E3779B97F4A7C15ULL;
+            return value ^ (value >> 29);
+        }
+
+        // 상위 16비트 (곱셈 해시는 상위 비트가 고르게 섞임)
+        std::uint64_t ToField(std::uint64_t hash)
+        {
+            return (hash >> 48) & FieldMask;
+        }
+
+        // 렌더러마다 Textures가 따로 있어도 바인드할 SRV가 같으면 같은 머티리얼
+        bool IsSameTextures(const DrawPacket& a, const DrawPacket& b)
+        {
+            if (a.textureCount != b.textureCount)
+            {
+                return false;
+            }
+
+            return std::equal(a.textures.begin(), a.textures.begin() + a.textureCount, b.textures.begin());
+        }
+
+        // 같은 섹션을 같은 상태로 그리는 다른 렌더러의 packet
+        // 상수 버퍼는 묶음의 첫 packet 렌더러 것만 올리므로 instanceKey로 그 내용까지 같아야 함
+        bool CanInstanceTogether(const DrawPacket& a, const DrawPacket& b)
+        {
+            return a.instanceKey != 0 &&
+                a.instanceKey == b.instanceKey &&
+                a.instancedVertexShader &&
+                !a.usesRendererDraw && !b.usesRendererDraw &&
+                a.type == b.type &&
+                a.boneIndex == b.boneIndex &&
+                a.vertexShader == b.vertexShader &&
+                a.pixelShader == b.pixelShader &&
+                a.inputLayout == b.inputLayout &&
+                a.instancedVertexShader == b.instancedVertexShader &&
+                a.instancedInputLayout == b.instancedInputLayout &&
+                a.vertexBuffer == b.vertexBuffer && a.vertexStride == b.vertexStride &&
+                a.indexBuffer == b.indexBuffer && a.indexFormat == b.indexFormat &&
+                a.samplerState == b.samplerState &&
+                a.indexCount == b.indexCount && a.startIndex == b.startIndex && a.baseVertex == b.baseVertex &&
+                IsSameTextures(a, b);
+        }
+    }
+
+    RenderQueueStats& RenderQueueStats::operator+=(const RenderQueueStats& other)
+    {
+        packetCount += other.packetCount;
+        drawCount += other.drawCount;
+        bindCount += other.bindCount;
+        skippedBindCount += other.skippedBindCount;
+        instancedDrawCount += other.instancedDrawCount;
+        instanceCount += other.instanceCount;
+        commandListCount += other.commandListCount;
+
+        return *this;
+    }
+
+    RenderQueue::RenderQueue(const Vector3& viewPosition) :
+        m_viewPosition{ viewPosition }
+    {
+    }
+
+    void RenderQueue::Reserve(std::size_t packetCount)
+    {
+        m_packets.reserve(packetCount);
+        m_items.reserve(packetCount);
+    }
+
+    void RenderQueue::Add(const DrawPacket& packet, const Vector3& worldPosition)
+    {
+        const float depth = Vector3::Distance(m_viewPosition, worldPosition);
+
+        m_items.push_back(SortItem{ MakeSortKey(packet, depth), static_cast<std::uint32_t>(m_packets.size()) });
+        m_packets.push_back(packet);
+    }
+
+    void RenderQueue::Sort()
+    {
+        const std::size_t count = m_items.size();
+        if (count < 2)
+        {
+            return;
+        }
+
+        FrameVector<SortItem> buffer;
+        buffer.resize(count);
+
+        SortItem* src = m_items.data();
+        SortItem* dst = buffer.data();
+
+        for (int shift = 0; shift < 64; shift += 8)
+        {
+            std::array<std::uint32_t, 256> offsets{};
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                ++offsets[(src[i].key >> shift) & 0xFF];
+            }
+
+            // 모든 키가 이 자리에서 같으면 순서가 바뀌지 않음 (패스 / 깊이 상위 비트 등)
+            if (offsets[(src[0].key >> shift) & 0xFF] == count)
+            {
+                continue;
+            }
+
+            std::uint32_t offset = 0;
+            for (auto& bucket : offsets)
+            {
+                const std::uint32_t bucketCount = bucket;
+                bucket = offset;
+                offset += bucketCount;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                dst[offsets[(src[i].key >> shift) & 0xFF]++] = src[i];
+            }
+
+            std::swap(src, dst);
+        }
+
+        if (src != m_items.data())
+        {
+            std::copy(src, src + count, m_items.data());
+        }
+    }
+
+    void RenderQueue::BuildInstanceBatches()
+    {
+        m_batches.clear();
+        m_instances.clear();
+        m_batches.reserve(m_items.size());
+
+        std::size_t first = 0;
+        while (first < m_items.size())
+        {
+            const DrawPacket& packet = m_packets[m_items[first].index];
+
+            std::size_t last = first + 1;
+            while (last < m_items.size() && CanInstanceTogether(packet, m_packets[m_items[last].index]))
+            {
+                ++last;
+            }
+
+            DrawBatch batch{};
+            batch.firstItem = static_cast<std::uint32_t>(first);
+            batch.itemCount = static_cast<std::uint32_t>(last - first);
+            batch.firstInstance = static_cast<std::uint32_t>(m_instances.size());
+
+            if (batch.itemCount > 1)
+            {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    const Matrix& world = m_packets[m_items[i].index].world;
+                    m_instances.push_back(InstanceData{ world, world.Invert().Transpose() });
+                }
+            }
+
+            m_batches.push_back(batch);
+            first = last;
+        }
+    }
+
+    RenderQueueStats RenderQueue::Submit(CommandContext* context, BufferHandle instanceBuffer) const
+    {
+        return Submit(context, instanceBuffer, 0, GetBatchCount());
+    }
+
+    RenderQueueStats RenderQueue::Submit(CommandContext* context, BufferHandle instanceBuffer, std::size_t firstBatch, std::size_t batchCount) const
+    {
+        RenderQueueStats stats;
+
+        if (context != nullptr && batchCount > 0)
+        {
+            context->SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+        }
+
+        auto needsBind = [&stats](bool isSame)
+            {
+                if (isSame)
+                {
+                    ++stats.skippedBindCount;
+                    return false;
+                }
+
+                ++stats.bindCount;
+                return true;
+            };
+
+        const DrawPacket* previous = nullptr; // nullptr이면 모든 상태를 다시 바인드
+        VertexShaderHandle boundVertexShader; // 인스턴싱 여부에 따라 packet.vertexShader와 다름
+        InputLayoutHandle boundInputLayout;
+        bool isInstanceBufferBound = false;
+
+        for (std::size_t i = firstBatch; i < firstBatch + batchCount; ++i)
+        {
+            const DrawBatch batch = GetBatch(i);
+            const DrawPacket& packet = m_packets[m_items[batch.firstItem].index];
+            const bool isInstanced = batch.itemCount > 1;
+
+            stats.packetCount += batch.itemCount;
+
+            if (packet.usesRendererDraw)
+            {
+                if (context != nullptr)
+                {
+                    context->DrawRenderer(*packet.renderer, packet.type);
+                    context->SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+                }
+                ++stats.drawCount;
+
+                // 렌더러가 무엇을 바인드했는지 모르므로 다음 packet은 전부 다시 바인드
+                previous = nullptr;
+                isInstanceBufferBound = false;
+                continue;
+            }
+
+            const bool hasPrevious = previous != nullptr;
+
+            // 상수 버퍼는 렌더러끼리 같은 버퍼를 쓰므로 렌더러가 바뀌면 다시 올림
+            if (!hasPrevious || previous->renderer != packet.renderer)
+            {
+                ++stats.bindCount;
+                if (context != nullptr)
+                {
+                    packet.renderer->BindConstants(*context, packet.type, packet.boneIndex);
+                }
+            }
+            else if (needsBind(previous->boneIndex == packet.boneIndex) && context != nullptr)
+            {
+                packet.renderer->BindBoneIndex(*context, packet.boneIndex);
+            }
+
+            const VertexShaderHandle vertexShader = isInstanced ? packet.instancedVertexShader : packet.vertexShader;
+            const InputLayoutHandle inputLayout = isInstanced ? packet.instancedInputLayout : packet.inputLayout;
+
+            if (needsBind(hasPrevious && boundVertexShader == vertexShader) && context != nullptr)
+            {
+                context->SetVertexShader(vertexShader);
+            }
+            boundVertexShader = vertexShader;
+
+            if (needsBind(hasPrevious && previous->pixelShader == packet.pixelShader) && context != nullptr)
+            {
+                context->SetPixelShader(packet.pixelShader);
+            }
+
+            if (needsBind(hasPrevious && boundInputLayout == inputLayout) && context != nullptr)
+            {
+                context->SetInputLayout(inputLayout);
+            }
+            boundInputLayout = inputLayout;
+
+            if (needsBind(hasPrevious && previous->vertexBuffer == packet.vertexBuffer && previous->vertexStride == packet.vertexStride) &&
+                context != nullptr)
+            {
+                context->SetVertexBuffer(0, packet.vertexBuffer, packet.vertexStride);
+            }
+
+            if (needsBind(hasPrevious && previous->indexBuffer == packet.indexBuffer && previous->indexFormat == packet.indexFormat) &&
+                context != nullptr)
+            {
+                context->SetIndexBuffer(packet.indexBuffer, packet.indexFormat);
+            }
+
+            if (needsBind(hasPrevious && previous->samplerState == packet.samplerState) && context != nullptr)
+            {
+                context->SetPSSampler(static_cast<std::uint32_t>(SamplerSlot::Linear), packet.samplerState);
+            }
+
+            if (packet.textureCount > 0 && needsBind(hasPrevious && IsSameTextures(*previous, packet)) && context != nullptr)
+            {
+                context->SetPSShaderResources(static_cast<std::uint32_t>(TextureSlot::BaseColor), packet.textureCount, packet.textures.data());
+            }
+
+            if (isInstanced)
+            {
+                // 인스턴스 버퍼는 패스 전체가 한 버퍼이므로 한 번만 (일반 packet의 입력 레이아웃은 슬롯 1을 읽지 않음)
+                if (needsBind(isInstanceBufferBound) && context != nullptr)
+                {
+                    assert(instanceBuffer);
+
+                    context->SetVertexBuffer(1, instanceBuffer, sizeof(InstanceData));
+                }
+                isInstanceBufferBound = true;
+
+                if (context != nullptr)
+                {
+                    context->DrawIndexedInstanced(packet.indexCount, batch.itemCount, packet.startIndex, packet.baseVertex, batch.firstInstance);
+                }
+                ++stats.instancedDrawCount;
+                stats.instanceCount += batch.itemCount;
+            }
+            else if (context != nullptr)
+            {
+                context->DrawIndexed(packet.indexCount, packet.startIndex, packet.baseVertex);
+            }
+            ++stats.drawCount;
+
+            previous = &packet;
+        }
+
+        return stats;
+    }
+
+    FrameVector<RenderQueue::SubmitChunk> RenderQueue::MakeSubmitChunks(std::size_t chunkCount, std::size_t minBatchCount) const
+    {
+        const std::size_t batchCount = GetBatchCount();
+
+        std::size_t recordableCount = 0;
+        for (std::size_t i = 0; i < batchCount; ++i)
+        {
+            if (!IsRendererDrawBatch(i))
+            {
+                ++recordableCount;
+            }
+        }
+
+        chunkCount = std::max<std::size_t>(chunkCount, 1);
+        const std::size_t chunkSize = std::max((recordableCount + chunkCount - 1) / chunkCount, std::max<std::size_t>(minBatchCount, 1));
+
+        FrameVector<SubmitChunk> chunks;
+
+        for (std::size_t i = 0; i < batchCount; ++i)
+        {
+            const bool isRecordable = !IsRendererDrawBatch(i);
+
+            if (!chunks.empty())
+            {
+                SubmitChunk& last = chunks.back();
+
+                // usesRendererDraw 묶음은 크기와 상관없이 이어 붙임
+                if (last.isRecordable == isRecordable && (!isRecordable || last.batchCount < chunkSize))
+                {
+                    ++last.batchCount;
+                    continue;
+                }
+            }
+
+            chunks.push_back(SubmitChunk{ static_cast<std::uint32_t>(i), 1, isRecordable });
+        }
+
+        return chunks;
+    }
+
+    std::size_t RenderQueue::GetBatchCount() const
+    {
+        return m_batches.empty() ? m_items.size() : m_batches.size();
+    }
+
+    std::size_t RenderQueue::GetPacketCount() const
+    {
+        return m_items.size();
+    }
+
+    const DrawPacket& RenderQueue::GetPacket(std::size_t order) const
+    {
+        return m_packets[m_items[order].index];
+    }
+
+    std::uint64_t RenderQueue::GetSortKey(std::size_t order) const
+    {
+        return m_items[order].key;
+    }
+
+    std::span<const InstanceData> RenderQueue::GetInstances() const
+    {
+        return { m_instances.data(), m_instances.size() };
+    }
+
+    RenderQueue::DrawBatch RenderQueue::GetBatch(std::size_t batchIndex) const
+    {
+        return m_batches.empty() ? DrawBatch{ static_cast<std::uint32_t>(batchIndex), 1, 0 } : m_batches[batchIndex];
+    }
+
+    bool RenderQueue::IsRendererDrawBatch(std::size_t batchIndex) const
+    {
+        return m_packets[m_items[GetBatch(batchIndex).firstItem].index].usesRendererDraw;
+    }
+
+    std::uint64_t RenderQueue::MakeSortKey(const DrawPacket& packet, float depth)
+    {
+        std::uint64_t key = static_cast<std::uint64_t>(packet.type) << PassShift;
+
+        // 상태를 모르는 packet은 패스 안에서 맨 뒤로 모음
+        if (packet.usesRendererDraw)
+        {
+            return key | (FieldMask << ShaderShift) | (FieldMask << MaterialShift) | (FieldMask << MeshShift);
+        }
+
+        const std::uint64_t shader = ToField(HashPointer(HashPointer(0, packet.vertexShader.Get()), packet.pixelShader.Get()));
+
+        std::uint64_t material = packet.textureCount ^ packet.instanceKey;
+        for (std::uint32_t i = 0; i < packet.textureCount; ++i)
+        {
+            material = HashPointer(material, packet.textures[i].Get());
+        }
+        material = ToField(HashPointer(material, packet.samplerState.Get()));
+
+        const std::uint64_t mesh = ToField(HashPointer(HashPointer(packet.startIndex, packet.vertexBuffer.Get()), packet.indexBuffer.Get()));
+
+        const float normalizedDepth = std::clamp(depth / MaxSortDepth, 0.0f, 1.0f);
+        const std::uint64_t depthKey = static_cast<std::uint64_t>(normalizedDepth * DepthMask) & DepthMask;
+
+        return key | (shader << ShaderShift) | (material << MaterialShift) | (mesh << MeshShift) | depthKey;
+    }
+}
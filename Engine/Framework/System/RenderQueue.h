@@ -0,0 +1,142 @@
+﻿#pragma once
+
+#include <span>
+
+#include "Common/Utility/FrameArena.h"
+#include "Core/Graphics/Device/GraphicsHandles.h"
+#include "Core/Graphics/Data/Vertex.h"
+#include "Framework/Object/Component/Renderer.h"
+
+namespace engine
+{
+    class CommandContext;
+
+    // 섹션 하나를 그리는 데 필요한 상태 (렌더러가 CollectDrawPackets에서 채움)
+    // 핸들은 비교 / 바인드에만 쓰고 소유하지 않음 (프레임 안에서만 유효)
+    struct DrawPacket
+    {
+        static constexpr std::uint32_t MaxTextureCount = 6; // Textures::Count
+
+        const Renderer* renderer = nullptr; // 바뀌면 BindConstants
+        RenderType type = RenderType::Opaque;
+        std::int32_t boneIndex = -1; // CbObject::boneIndex (rigid 스켈레탈 메시 섹션), 바뀌면 BindBoneIndex
+
+        // true면 상태 대신 CommandContext::DrawRenderer로 renderer->Draw(type)를 맡김 (아직 packet을 만들지 않는 렌더러)
+        // D3D11 백엔드는 즉시 context로 그리고, null 백엔드는 기록만 하고 렌더러를 부르지 않음
+        bool usesRendererDraw = false;
+
+        VertexShaderHandle vertexShader;
+        PixelShaderHandle pixelShader; // 비어 있으면 깊이만
+        InputLayoutHandle inputLayout;
+        BufferHandle vertexBuffer;
+        std::uint32_t vertexStride = 0;
+        BufferHandle indexBuffer;
+        IndexFormat indexFormat = IndexFormat::Unknown;
+        SamplerHandle samplerState; // SamplerSlot::Linear
+        std::array<ShaderResourceHandle, MaxTextureCount> textures{}; // Textures::AsHandles 순서
+        std::uint32_t textureCount = 0; // BaseColor부터 몇 개를 바인드할지 (그림자 cutout은 BaseColor만)
+
+        std::uint32_t indexCount = 0;
+        std::uint32_t startIndex = 0;
+        std::int32_t baseVertex = 0;
+
+        // 인스턴싱 (instanceKey가 0이면 하지 않음)
+        // 바로 붙어 있는 packet끼리 위 상태와 instanceKey가 모두 같으면 instanced VS로 한 번에 그림
+        std::uint64_t instanceKey = 0; // 상수 버퍼 내용처럼 포인터로 비교할 수 없는 상태의 해시
+        Matrix world; // 값으로 복사 (Transform의 world는 slot 배열 안에 있어서 Submit 전에 재할당될 수 있음)
+        VertexShaderHandle instancedVertexShader;
+        InputLayoutHandle instancedInputLayout; // 슬롯 1에 InstanceData
+    };
+
+    struct RenderQueueStats
+    {
+        std::uint32_t packetCount = 0;
+        std::uint32_t drawCount = 0;
+        std::uint32_t bindCount = 0; // 실제로 바꾼 상태 (셰이더 / 레이아웃 / 버퍼 / 샘플러 / 텍스처 / 상수 버퍼)
+        std::uint32_t skippedBindCount = 0; // 바로 앞 packet과 같아서 건너뛴 상태
+        std::uint32_t instancedDrawCount = 0; // drawCount 중 DrawIndexedInstanced
+        std::uint32_t instanceCount = 0; // instanced 드로우로 그린 packet
+        std::uint32_t commandListCount = 0; // 워커에서 deferred context로 기록해서 실행한 command list
+
+        RenderQueueStats& operator+=(const RenderQueueStats& other);
+    };
+
+    // 한 패스 (Begin / End 한 쌍)에서 그릴 packet을 모아 정렬하고, 바뀐 상태만 바인드하면서 그림
+    // 정렬 키 (상위 비트부터): pass 4 | 셰이더 16 | 머티리얼 16 | 메시 16 | 깊이 12
+    // - 셰이더 / 머티리얼 / 메시는 핸들 해시이므로 충돌하면 묶이지 않을 뿐 결과는 같음 (Submit은 실제 핸들을 비교)
+    // - 깊이는 같은 상태 안에서 앞에서 뒤로 그리기 위한 것
+    // - 메시에는 섹션 시작 인덱스, 머티리얼에는 instanceKey까지 섞어서 인스턴싱할 packet이 붙도록 함
+    // packet은 프레임 아레나에 두므로 프레임 안에서만 씀 (멤버로 들고 있지 않음)
+    class RenderQueue
+    {
+    public:
+        static constexpr float MaxSortDepth = 1000.0f; // 이보다 멀면 깊이 키가 같음
+
+        // Submit을 나눠서 기록할 연속한 드로우 묶음 구간
+        // isRecordable이 false면 usesRendererDraw packet (렌더러가 전역 context로 그리므로 즉시 context에서만)
+        struct SubmitChunk
+        {
+            std::uint32_t firstBatch;
+            std::uint32_t batchCount;
+            bool isRecordable;
+        };
+
+    private:
+        struct SortItem
+        {
+            std::uint64_t key;
+            std::uint32_t index;
+        };
+
+        // m_items에서 연속한 packet 묶음, itemCount가 2 이상이면 인스턴싱
+        struct DrawBatch
+        {
+            std::uint32_t firstItem;
+            std::uint32_t itemCount;
+            std::uint32_t firstInstance; // m_instances 번호
+        };
+
+        Vector3 m_viewPosition;
+
+        FrameVector<DrawPacket> m_packets;
+        FrameVector<SortItem> m_items; // Sort 전에는 추가한 순서
+        FrameVector<DrawBatch> m_batches; // 비어 있으면 packet마다 따로 그림
+        FrameVector<InstanceData> m_instances;
+
+    public:
+        explicit RenderQueue(const Vector3& viewPosition);
+
+    public:
+        void Reserve(std::size_t packetCount);
+        void Add(const DrawPacket& packet, const Vector3& worldPosition);
+
+        // 64비트 키 LSD radix sort (8비트씩, 모든 키가 같은 자리는 건너뜀), 키가 같으면 추가한 순서 유지
+        void Sort();
+
+        // Sort 뒤에 호출, 인스턴싱할 packet을 묶고 행렬을 m_instances에 모음 (GetInstances를 인스턴스 버퍼에 올려서 Submit에 넘김)
+        void BuildInstanceBatches();
+
+        // context가 nullptr이면 렌더러도 부르지 않고 횟수만 셈 (가짜 렌더러로 하는 헤드리스 검사 / 벤치마크용)
+        RenderQueueStats Submit(CommandContext* context, BufferHandle instanceBuffer = {}) const;
+
+        // [firstBatch, firstBatch + batchCount) 드로우 묶음만, 처음에 모든 상태를 다시 바인드함 (deferred context는 상태를 물려받지 않음)
+        // 렌더러 상태는 읽기만 하므로 usesRendererDraw가 아닌 구간은 여러 스레드에서 동시에 불러도 됨
+        RenderQueueStats Submit(CommandContext* context, BufferHandle instanceBuffer, std::size_t firstBatch, std::size_t batchCount) const;
+
+        // 기록할 수 있는 드로우 묶음을 minBatchCount 이상씩 대략 chunkCount개로 나눔 (usesRendererDraw 묶음은 따로 끊음)
+        FrameVector<SubmitChunk> MakeSubmitChunks(std::size_t chunkCount, std::size_t minBatchCount) const;
+
+        // BuildInstanceBatches 전이면 packet 수
+        std::size_t GetBatchCount() const;
+        std::size_t GetPacketCount() const;
+        const DrawPacket& GetPacket(std::size_t order) const;
+        std::uint64_t GetSortKey(std::size_t order) const;
+        std::span<const InstanceData> GetInstances() const;
+
+        static std::uint64_t MakeSortKey(const DrawPacket& packet, float depth);
+
+    private:
+        DrawBatch GetBatch(std::size_t batchIndex) const;
+        bool IsRendererDrawBatch(std::size_t batchIndex) const;
+    };
+}
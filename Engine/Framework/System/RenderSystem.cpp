@@ -1,9 +1,13 @@
 ﻿#include "EnginePCH.h"
 #include "RenderSystem.h"
 
+#include "Common/Utility/FrameArena.h"
+#include "Common/Utility/JobSystem.h"
+
 #include "Core/Graphics/Resource/ResourceManager.h"
 #include "Core/Graphics/Data/ConstantBufferTypes.h"
 #include "Core/Graphics/Data/ShaderSlotTypes.h"
+#include "Core/Graphics/Device/D3D11Handles.h"
 #include "Core/Graphics/Resource/ConstantBuffer.h"
 #include "Core/Graphics/Resource/SamplerState.h"
 #include "Core/Graphics/Resource/Texture.h"
@@ -13,6 +17,7 @@
 #include "Core/Graphics/Resource/RasterizerState.h"
 #include "Core/Graphics/Resource/IndexBuffer.h"
 #include "Core/Graphics/Resource/BlendState.h"
+#include "Core/Graphics/Resource/DynamicVertexBuffer.h"
 
 #include "Framework/Scene/SceneManager.h"
 #include "Framework/Scene/Scene.h"
@@ -33,6 +38,9 @@ namespace engine
     namespace
     {
         TimePoint g_startTime = Clock::now();
+
+        // command list 하나에 담을 최소 드로우 수 (너무 잘게 나누면 기록 / 실행 비용이 더 큼)
+        constexpr std::size_t MinBatchesPerCommandList = 64;
     }
 
     RenderSystem::RenderSystem()
@@ -115,12 +123,35 @@ namespace engine
         {
             m_pickingIdCB = ResourceManager::Get().GetOrCreateConstantBuffer("PickingId", sizeof(CbPickingId));
         }
+
+        // 처음 인스턴싱할 때 만듦
+        m_instanceBuffer = std::make_shared<DynamicVertexBuffer>();
+
+        // sprite batch
+        {
+            m_spriteVertexBuffer = std::make_shared<DynamicVertexBuffer>();
+
+            m_spriteIndexBuffer = std::make_shared<IndexBuffer>();
+            m_spriteIndexBuffer->Create(SpriteBatch::MakeIndices(SpriteBatch::MaxBatchSpriteCount));
+
+            m_spriteBatchVS = ResourceManager::Get().GetOrCreateVertexShader("Resource/Shader/Vertex/Sprite_Batch_VS.hlsl");
+            m_shadowSpriteBatchVS = ResourceManager::Get().GetOrCreateVertexShader("Resource/Shader/Vertex/Shadow_Sprite_Batch_VS.hlsl");
+            m_spriteBatchInputLayout = m_spriteBatchVS->GetOrCreateInputLayout<SpriteVertex>();
+        }
     }
 
     void RenderSystem::Register(Renderer* renderer)
     {
         System<Renderer>::Register(renderer);
 
+        // 메시 교체 등으로 재등록되는 경우 로컬 AABB가 바뀌었을 수 있음
+        renderer->m_isBoundsDirty = true;
+
+        if (IsWorldRenderer(renderer) && renderer->m_boundsProxy == DynamicAabbTree::NullNode)
+        {
+            renderer->m_boundsProxy = m_boundsTree.CreateProxy(renderer->GetWorldBounds(), renderer);
+        }
+
         if (renderer->HasRenderType(RenderType::Opaque))
         {
             AddRenderer(m_opaqueList, renderer, RenderType::Opaque);
@@ -144,6 +175,18 @@ namespace engine
 
     void RenderSystem::Unregister(Renderer* renderer)
     {
+        if (renderer->m_boundsProxy != DynamicAabbTree::NullNode)
+        {
+            m_boundsTree.DestroyProxy(renderer->m_boundsProxy);
+            renderer->m_boundsProxy = DynamicAabbTree::NullNode;
+        }
+
+        if (renderer->m_isBoundsQueued)
+        {
+            std::erase(m_boundsUpdateQueue, renderer);
+            renderer->m_isBoundsQueued = false;
+        }
+
         RemoveRenderer(m_opaqueList, renderer, RenderType::Opaque);
         RemoveRenderer(m_cutoutList, renderer, RenderType::Cutout);
         RemoveRenderer(m_transparentList, renderer, RenderType::Transparent);
@@ -154,10 +197,17 @@ namespace engine
 
     void RenderSystem::Update()
     {
-        for (auto renderer : m_components)
-        {
-            renderer->Update();
-        }
+        // 렌더러끼리는 서로 건드리지 않으므로 (본 행렬 복사 등) 나눠서 처리
+        constexpr std::uint32_t grainSize = 64;
+
+        JobSystem::Get().ParallelFor(static_cast<std::uint32_t>(m_components.size()), grainSize,
+            [this](std::uint32_t begin, std::uint32_t end)
+            {
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    m_components[i]->Update();
+                }
+            });
     }
 
     void RenderSystem::Render()
@@ -215,6 +265,7 @@ namespace engine
 #endif // _DEBUG
 
         const Matrix viewProjection = view * projection;
+        m_frameViewProjection = viewProjection;
 
         auto& lightSystem = SystemManager::Get().GetLightSystem();
         auto* mainLight = lightSystem.GetMainLight();
@@ -222,6 +273,7 @@ namespace engine
         Vector3 lightColor = Vector3(0.0f, 0.0f, 0.0f);
 
         Matrix lightView, lightProjection;
+        Vector3 lightPosition = cameraPosition;
 
         float lightIntensity = 1.0f;
         if (mainLight != nullptr)
@@ -232,7 +284,7 @@ namespace engine
             lightIntensity = mainLight->GetIntensity();
 
             Vector3 focusPosition = cameraPosition + cameraForward * mainLight->GetForwardDist();
-            Vector3 lightPosition = focusPosition + -lightDir * mainLight->GetLightFar() * mainLight->GetHeightRatio();
+            lightPosition = focusPosition + -lightDir * mainLight->GetLightFar() * mainLight->GetHeightRatio();
             lightView = DirectX::XMMatrixLookAtLH(lightPosition, focusPosition, lightUp);
             lightProjection = DirectX::XMMatrixPerspectiveFovLH(
                 ToRadian(mainLight->GetAngle()),
@@ -242,6 +294,36 @@ namespace engine
         }
         lightDir.Normalize();
 
+        // frustum culling
+        // BoundingFrustum은 원근 투영만 표현할 수 있으므로 직교 투영이면 컬링하지 않음
+        DirectX::BoundingFrustum cameraFrustum;
+        DirectX::BoundingFrustum lightFrustum;
+        const bool isPerspective = projection._44 == 0.0f;
+        const bool useCameraCulling = m_useFrustumCulling && isPerspective;
+        const bool useLightCulling = m_useFrustumCulling && mainLight != nullptr;
+
+        if (useCameraCulling)
+        {
+            cameraFrustum = DirectX::BoundingFrustum(projection);
+            cameraFrustum.Transform(cameraFrustum, view.Invert());
+        }
+
+        if (useLightCulling)
+        {
+            lightFrustum = DirectX::BoundingFrustum(lightProjection);
+            lightFrustum.Transform(lightFrustum, lightView.Invert());
+        }
+
+        UpdateBoundsTree();
+
+        m_cullingStats = CullingStats{};
+        m_cullingStats.treeProxyCount = m_boundsTree.GetProxyCount();
+        m_cullingStats.treeHeight = m_boundsTree.GetHeight();
+
+        m_renderQueueStats = RenderQueueStats{};
+        m_spriteBatchStats = SpriteBatchStats{};
+        m_nullCommands.Reset();
+
         CbFrame cbFrame;
         cbFrame.view = view.Transpose();
         cbFrame.projection = projection.Transpose();
@@ -281,43 +363,67 @@ namespace engine
 
         if (!isCameraOff)
         {
+            if (useCameraCulling)
+            {
+                m_cullingStats.cameraTested = CullRenderersInTree(
+                    cameraFrustum, m_visibleOpaqueList, m_visibleCutoutList, &m_visibleTransparentList);
+            }
+            else
+            {
+                m_cullingStats.cameraTested += CullRenderers(m_opaqueList, nullptr, m_visibleOpaqueList);
+                m_cullingStats.cameraTested += CullRenderers(m_cutoutList, nullptr, m_visibleCutoutList);
+                m_cullingStats.cameraTested += CullRenderers(m_transparentList, nullptr, m_visibleTransparentList);
+            }
+            m_cullingStats.cameraVisible = static_cast<std::uint32_t>(
+                m_visibleOpaqueList.size() + m_visibleCutoutList.size() + m_visibleTransparentList.size());
+
+            if (useLightCulling)
+            {
+                m_cullingStats.shadowTested = CullRenderersInTree(
+                    lightFrustum, m_shadowOpaqueList, m_shadowCutoutList, nullptr);
+            }
+            else
+            {
+                m_cullingStats.shadowTested += CullRenderers(m_opaqueList, nullptr, m_shadowOpaqueList);
+                m_cullingStats.shadowTested += CullRenderers(m_cutoutList, nullptr, m_shadowCutoutList);
+            }
+            m_cullingStats.shadowVisible = static_cast<std::uint32_t>(m_shadowOpaqueList.size() + m_shadowCutoutList.size());
+
             graphics.BeginDrawShadowPass();
             {
-                for (auto renderer : m_opaqueList)
-                {
-                    if (renderer->IsActive())
-                    {
-                        renderer->Draw(RenderType::Shadow);
-                    }
-                }
+                GetSubmitContext().BeginPass("Shadow");
 
-                for (auto renderer : m_cutoutList)
-                {
-                    if (renderer->IsActive())
-                    {
-                        renderer->Draw(RenderType::Shadow);
-                    }
-                }
+                RenderQueue queue{ lightPosition };
+                queue.Reserve(m_shadowOpaqueList.size() + m_shadowCutoutList.size());
+
+                SpriteBatch sprites;
+
+                CollectDrawPackets(m_shadowOpaqueList, RenderType::Shadow, queue, sprites);
+                CollectDrawPackets(m_shadowCutoutList, RenderType::Shadow, queue, sprites);
+
+                SubmitDrawPackets(queue);
+                DrawSprites(sprites, RenderType::Shadow);
+
+                GetSubmitContext().EndPass();
             }
             graphics.EndDrawShadowPass();
 
             graphics.BeginDrawGeometryPass();
             {
-                for (auto renderer : m_opaqueList)
-                {
-                    if (renderer->IsActive())
-                    {
-                        renderer->Draw(RenderType::Opaque);
-                    }
-                }
+                GetSubmitContext().BeginPass("Geometry");
 
-                for (auto renderer : m_cutoutList)
-                {
-                    if (renderer->IsActive())
-                    {
-                        renderer->Draw(RenderType::Cutout);
-                    }
-                }
+                RenderQueue queue{ cameraPosition };
+                queue.Reserve(m_visibleOpaqueList.size() + m_visibleCutoutList.size());
+
+                SpriteBatch sprites;
+
+                CollectDrawPackets(m_visibleOpaqueList, RenderType::Opaque, queue, sprites);
+                CollectDrawPackets(m_visibleCutoutList, RenderType::Cutout, queue, sprites);
+
+                SubmitDrawPackets(queue);
+                DrawSprites(sprites, RenderType::Opaque);
+
+                GetSubmitContext().EndPass();
             }
             graphics.EndDrawGeometryPass();
 
@@ -362,38 +468,7 @@ namespace engine
                 }
 #endif // _DEBUG
 
-                context->OMSetBlendState(m_transparentBlendState->GetRawBlendState(), nullptr, 0xFFFFFFFF);
-                context->OMSetDepthStencilState(m_transparentDSState->GetRawDepthStencilState(), 0);
-
-                static std::vector<std::pair<float, Renderer*>> sortList;
-                sortList.clear();
-                if (sortList.capacity() < m_transparentList.size())
-                {
-                    sortList.reserve(static_cast<size_t>(m_transparentList.size() * 1.5f));
-                }
-                Vector3 camPos = cameraPosition;
-                
-                for (auto* renderer : m_transparentList)
-                {
-                    if (renderer->IsActive())
-                    {
-                        float distSq = Vector3::DistanceSquared(camPos, renderer->GetTransform()->GetWorld().Translation());
-                        sortList.emplace_back(distSq, renderer);
-                    }
-                }
-                
-                std::sort(sortList.begin(), sortList.end(),
-                    [](const auto& a, const auto& b) {
-                        return a.first > b.first;
-                    });
-
-                for (auto pair : sortList)
-                {
-                    pair.second->Draw(RenderType::Transparent);
-                }
-
-                context->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFF);
-                context->OMSetDepthStencilState(nullptr, 0);
+                DrawTransparents(cameraPosition);
             }
             graphics.EndDrawForwardPass();
         }
@@ -454,11 +529,335 @@ namespace engine
         m_bloomSoftKnee = bloomSoftKnee;
     }
 
+    void RenderSystem::QueryFrustum(const DirectX::BoundingFrustum& frustum, std::vector<Renderer*>& out)
+    {
+        UpdateBoundsTree();
+
+        out.clear();
+        m_boundsTree.QueryFrustum(frustum, [&](void* userData)
+            {
+                auto* renderer = static_cast<Renderer*>(userData);
+                if (renderer->IsActive() && frustum.Intersects(renderer->GetWorldBounds()))
+                {
+                    out.push_back(renderer);
+                }
+
+                return true;
+            });
+    }
+
+    void RenderSystem::QueryBox(const DirectX::BoundingBox& box, std::vector<Renderer*>& out)
+    {
+        UpdateBoundsTree();
+
+        out.clear();
+        m_boundsTree.QueryBox(box, [&](void* userData)
+            {
+                auto* renderer = static_cast<Renderer*>(userData);
+                if (renderer->IsActive() && box.Intersects(renderer->GetWorldBounds()))
+                {
+                    out.push_back(renderer);
+                }
+
+                return true;
+            });
+    }
+
+    void RenderSystem::QuerySphere(const DirectX::BoundingSphere& sphere, std::vector<Renderer*>& out)
+    {
+        UpdateBoundsTree();
+
+        out.clear();
+        m_boundsTree.QuerySphere(sphere, [&](void* userData)
+            {
+                auto* renderer = static_cast<Renderer*>(userData);
+                if (renderer->IsActive() && sphere.Intersects(renderer->GetWorldBounds()))
+                {
+                    out.push_back(renderer);
+                }
+
+                return true;
+            });
+    }
+
+    Renderer* RenderSystem::Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, float& outDistance)
+    {
+        UpdateBoundsTree();
+
+        Renderer* closest = nullptr;
+        outDistance = maxDistance;
+
+        m_boundsTree.QueryRay(origin, direction, maxDistance, [&](void* userData, float)
+            {
+                auto* renderer = static_cast<Renderer*>(userData);
+
+                float distance = 0.0f;
+                if (renderer->IsActive() &&
+                    renderer->GetWorldBounds().Intersects(origin, direction, distance) &&
+                    distance < outDistance)
+                {
+                    closest = renderer;
+                    outDistance = distance;
+                }
+
+                return outDistance;
+            });
+
+        return closest;
+    }
+
+    void RenderSystem::QueueBoundsUpdate(Renderer* renderer)
+    {
+        if (renderer->m_boundsProxy == DynamicAabbTree::NullNode || renderer->m_isBoundsQueued)
+        {
+            return;
+        }
+
+        renderer->m_isBoundsQueued = true;
+        m_boundsUpdateQueue.push_back(renderer);
+    }
+
+    bool RenderSystem::IsFrustumCullingEnabled() const
+    {
+        return m_useFrustumCulling;
+    }
+
+    void RenderSystem::SetFrustumCullingEnabled(bool enabled)
+    {
+        m_useFrustumCulling = enabled;
+    }
+
+    const CullingStats& RenderSystem::GetCullingStats() const
+    {
+        return m_cullingStats;
+    }
+
+    bool RenderSystem::IsDrawPacketSortEnabled() const
+    {
+        return m_sortDrawPackets;
+    }
+
+    void RenderSystem::SetDrawPacketSortEnabled(bool enabled)
+    {
+        m_sortDrawPackets = enabled;
+    }
+
+    bool RenderSystem::IsInstancingEnabled() const
+    {
+        return m_useInstancing;
+    }
+
+    void RenderSystem::SetInstancingEnabled(bool enabled)
+    {
+        m_useInstancing = enabled;
+    }
+
+    bool RenderSystem::IsNullBackendEnabled() const
+    {
+        return m_useNullBackend;
+    }
+
+    void RenderSystem::SetNullBackendEnabled(bool enabled)
+    {
+        m_useNullBackend = enabled;
+    }
+
+    const CommandStats& RenderSystem::GetNullBackendStats() const
+    {
+        return m_nullCommands.GetStats();
+    }
+
+    bool RenderSystem::IsParallelRecordingEnabled() const
+    {
+        return m_recordInParallel;
+    }
+
+    void RenderSystem::SetParallelRecordingEnabled(bool enabled)
+    {
+        m_recordInParallel = enabled;
+    }
+
+    const RenderQueueStats& RenderSystem::GetRenderQueueStats() const
+    {
+        return m_renderQueueStats;
+    }
+
+    bool RenderSystem::IsSpriteBatchingEnabled() const
+    {
+        return m_batchSprites;
+    }
+
+    void RenderSystem::SetSpriteBatchingEnabled(bool enabled)
+    {
+        m_batchSprites = enabled;
+    }
+
+    const SpriteBatchStats& RenderSystem::GetSpriteBatchStats() const
+    {
+        return m_spriteBatchStats;
+    }
+
+    void RenderSystem::SubmitDrawPackets(RenderQueue& queue)
+    {
+        if (m_sortDrawPackets)
+        {
+            queue.Sort();
+        }
+
+        BufferHandle instanceBuffer;
+        if (m_useInstancing)
+        {
+            queue.BuildInstanceBatches();
+
+            if (const auto instances = queue.GetInstances(); !instances.empty())
+            {
+                m_instanceBuffer->Update(GetSubmitContext(), instances);
+                instanceBuffer = ToHandle(m_instanceBuffer->GetRawBuffer());
+            }
+        }
+
+        // null 백엔드는 한 context에 순서대로 기록
+        if (m_useNullBackend)
+        {
+            m_renderQueueStats += queue.Submit(&m_nullCommands, instanceBuffer);
+            return;
+        }
+
+        ID3D11DeviceContext* immediateContext = GraphicsDevice::Get().GetDeviceContext().Get();
+        CommandContext& immediateCommands = GraphicsDevice::Get().GetCommandContext();
+
+        JobSystem& jobSystem = JobSystem::Get();
+        const auto chunks = queue.MakeSubmitChunks(jobSystem.GetWorkerCount() + 1, MinBatchesPerCommandList);
+
+        FrameVector<std::uint32_t> recordedChunks; // chunks 번호, 순서가 곧 deferred context 번호
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            if (chunks[i].isRecordable)
+            {
+                recordedChunks.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+        // 나눌 것이 없으면 기록 / 실행 비용만 늘어남
+        if (!m_recordInParallel || jobSystem.GetWorkerCount() == 0 || recordedChunks.size() < 2)
+        {
+            m_renderQueueStats += queue.Submit(&immediateCommands, instanceBuffer);
+            return;
+        }
+
+        m_deferredContexts.Reserve(GraphicsDevice::Get().GetDevice().Get(), recordedChunks.size());
+
+        DeviceContextState passState;
+        passState.Capture(immediateContext);
+
+        FrameVector<RenderQueueStats> chunkStats;
+        chunkStats.resize(chunks.size());
+
+        jobSystem.ParallelFor(static_cast<std::uint32_t>(recordedChunks.size()), 1,
+            [&](std::uint32_t begin, std::uint32_t end)
+            {
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    const RenderQueue::SubmitChunk& chunk = chunks[recordedChunks[i]];
+
+                    passState.Apply(m_deferredContexts.GetContext(i));
+                    chunkStats[recordedChunks[i]] = queue.Submit(&m_deferredContexts.GetCommandContext(i), instanceBuffer, chunk.firstBatch, chunk.batchCount);
+                    m_deferredContexts.Finish(i);
+                }
+            });
+
+        // 기록은 순서 없이 끝나므로 실행은 chunk 순서대로 (usesRendererDraw는 사이에 즉시 context로)
+        std::size_t recordedIndex = 0;
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            if (chunks[i].isRecordable)
+            {
+                m_deferredContexts.Execute(immediateContext, recordedIndex++);
+                ++chunkStats[i].commandListCount;
+            }
+            else
+            {
+                chunkStats[i] = queue.Submit(&immediateCommands, instanceBuffer, chunks[i].firstBatch, chunks[i].batchCount);
+            }
+
+            m_renderQueueStats += chunkStats[i];
+        }
+    }
+
+    CommandContext& RenderSystem::GetSubmitContext()
+    {
+        if (m_useNullBackend)
+        {
+            return m_nullCommands;
+        }
+
+        return GraphicsDevice::Get().GetCommandContext();
+    }
+
+    void RenderSystem::CollectDrawPackets(const std::vector<Renderer*>& renderers, RenderType type, RenderQueue& queue, SpriteBatch& sprites)
+    {
+        for (auto renderer : renderers)
+        {
+            if (m_batchSprites && renderer->CollectSprite(type, sprites))
+            {
+                continue;
+            }
+
+            renderer->CollectDrawPackets(type, queue);
+        }
+    }
+
+    void RenderSystem::DrawSprites(SpriteBatch& sprites, RenderType type)
+    {
+        if (sprites.IsEmpty())
+        {
+            return;
+        }
+
+        sprites.Build(type != RenderType::Transparent);
+
+        CommandContext& commands = GetSubmitContext();
+
+        m_spriteVertexBuffer->Update(commands, sprites.GetVertices());
+
+        commands.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+        commands.SetVertexBuffer(0, ToHandle(m_spriteVertexBuffer->GetRawBuffer()), sizeof(SpriteVertex));
+        commands.SetIndexBuffer(ToHandle(m_spriteIndexBuffer->GetRawBuffer()), ToIndexFormat(m_spriteIndexBuffer->GetIndexFormat()));
+        commands.SetInputLayout(ToHandle(m_spriteBatchInputLayout->GetRawInputLayout()));
+        commands.SetVertexShader(ToHandle(type == RenderType::Shadow ? m_shadowSpriteBatchVS->GetRawShader() : m_spriteBatchVS->GetRawShader()));
+        commands.SetPSSampler(static_cast<std::uint32_t>(SamplerSlot::Linear), ToHandle(m_linearSamplerState->GetSamplerState().Get()));
+
+        m_spriteBatchStats += sprites.Submit(commands);
+
+        sprites.Clear();
+    }
+
     GameObject* RenderSystem::PickObject(int mouseX, int mouseY)
     {
         auto& graphics = GraphicsDevice::Get();
         const auto& context = graphics.GetDeviceContext();
 
+        // 마우스 레이가 어떤 렌더러의 AABB에도 닿지 않으면 GPU 피킹(readback)을 생략
+        {
+            const D3D11_VIEWPORT& viewport = graphics.GetViewport();
+            const float ndcX = 2.0f * static_cast<float>(mouseX) / viewport.Width - 1.0f;
+            const float ndcY = 1.0f - 2.0f * static_cast<float>(mouseY) / viewport.Height;
+
+            const Matrix invViewProjection = m_frameViewProjection.Invert();
+            const Vector3 nearPoint = Vector3::Transform(Vector3(ndcX, ndcY, 0.0f), invViewProjection);
+            const Vector3 farPoint = Vector3::Transform(Vector3(ndcX, ndcY, 1.0f), invViewProjection);
+
+            Vector3 direction = farPoint - nearPoint;
+            const float length = direction.Length();
+            direction /= length;
+
+            float distance = 0.0f;
+            if (length > 0.0f && Raycast(nearPoint, direction, length, distance) == nullptr)
+            {
+                return nullptr;
+            }
+        }
+
         graphics.BeginDrawPickingPass();
         {
             context->PSSetConstantBuffers(static_cast<UINT>(ConstantBufferSlot::PickingId), 1, m_pickingIdCB->GetBuffer().GetAddressOf());
@@ -520,6 +919,101 @@ namespace engine
         renderer->m_systemIndices[static_cast<size_t>(type)] = -1;
     }
 
+    std::uint32_t RenderSystem::CullRenderers(const std::vector<Renderer*>& renderers, const DirectX::BoundingFrustum* frustum, std::vector<Renderer*>& out)
+    {
+        out.clear();
+
+        std::uint32_t tested = 0;
+        for (auto renderer : renderers)
+        {
+            if (!renderer->IsActive())
+            {
+                continue;
+            }
+
+            ++tested;
+
+            if (frustum != nullptr && !frustum->Intersects(renderer->GetWorldBounds()))
+            {
+                continue;
+            }
+
+            out.push_back(renderer);
+        }
+
+        return tested;
+    }
+
+    std::uint32_t RenderSystem::CullRenderersInTree(
+        const DirectX::BoundingFrustum& frustum,
+        std::vector<Renderer*>& opaque,
+        std::vector<Renderer*>& cutout,
+        std::vector<Renderer*>* transparent)
+    {
+        opaque.clear();
+        cutout.clear();
+        if (transparent != nullptr)
+        {
+            transparent->clear();
+        }
+
+        std::uint32_t tested = 0;
+        m_boundsTree.QueryFrustum(frustum, [&](void* userData)
+            {
+                auto* renderer = static_cast<Renderer*>(userData);
+                if (!renderer->IsActive())
+                {
+                    return true;
+                }
+
+                ++tested;
+
+                // 트리는 여유분이 붙은 AABB라 실제 AABB로 한번 더 검사
+                if (!frustum.Intersects(renderer->GetWorldBounds()))
+                {
+                    return true;
+                }
+
+                const auto& indices = renderer->m_systemIndices;
+                if (indices[static_cast<size_t>(RenderType::Opaque)] != -1)
+                {
+                    opaque.push_back(renderer);
+                }
+
+                if (indices[static_cast<size_t>(RenderType::Cutout)] != -1)
+                {
+                    cutout.push_back(renderer);
+                }
+
+                if (transparent != nullptr && indices[static_cast<size_t>(RenderType::Transparent)] != -1)
+                {
+                    transparent->push_back(renderer);
+                }
+
+                return true;
+            });
+
+        return tested;
+    }
+
+    void RenderSystem::UpdateBoundsTree()
+    {
+        for (auto renderer : m_boundsUpdateQueue)
+        {
+            m_boundsTree.MoveProxy(renderer->m_boundsProxy, renderer->GetWorldBounds());
+            renderer->m_isBoundsQueued = false;
+        }
+
+        m_boundsUpdateQueue.clear();
+    }
+
+    bool RenderSystem::IsWorldRenderer(const Renderer* renderer)
+    {
+        return renderer->HasRenderType(RenderType::Opaque) ||
+            renderer->HasRenderType(RenderType::Cutout) ||
+            renderer->HasRenderType(RenderType::Transparent);
+    }
+
     void RenderSystem::DrawGlobalLight()
     {
         const auto& context = GraphicsDevice::Get().GetDeviceContext();
@@ -701,20 +1195,13 @@ namespace engine
         context->OMSetBlendState(m_transparentBlendState->GetRawBlendState(), nullptr, 0xFFFFFFFF);
         context->OMSetDepthStencilState(m_transparentDSState->GetRawDepthStencilState(), 0);
 
-        static std::vector<std::pair<float, Renderer*>> sortList;
-        sortList.clear();
-        if (sortList.capacity() < m_transparentList.size())
-        {
-            sortList.reserve(static_cast<size_t>(m_transparentList.size() * 1.5f));
-        }
+        FrameVector<std::pair<float, Renderer*>> sortList;
+        sortList.reserve(m_visibleTransparentList.size());
 
-        for (auto* renderer : m_transparentList)
+        for (auto* renderer : m_visibleTransparentList)
         {
-            if (renderer->IsActive())
-            {
-                float distSq = Vector3::DistanceSquared(cameraPosition, renderer->GetTransform()->GetWorld().Translation());
-                sortList.emplace_back(distSq, renderer);
-            }
+            float distSq = Vector3::DistanceSquared(cameraPosition, renderer->GetTransform()->GetWorld().Translation());
+            sortList.emplace_back(distSq, renderer);
         }
 
         std::sort(sortList.begin(), sortList.end(),
@@ -722,11 +1209,21 @@ namespace engine
                 return a.first > b.first;
             });
 
-        for (auto pair : sortList)
+        FrameVector<Renderer*> renderers;
+        renderers.reserve(sortList.size());
+        for (const auto& pair : sortList)
         {
-            pair.second->Draw(RenderType::Transparent);
+            renderers.push_back(pair.second);
         }
 
+        // 스프라이트 (파티클 등)는 이어진 것끼리 묶고, 다른 렌더러 앞에서 끊어서 뒤에서 앞 순서를 지킴
+        SpriteBatch sprites;
+        SpriteBatch::DrawInOrder({ renderers.data(), renderers.size() }, RenderType::Transparent, m_batchSprites, sprites, GetSubmitContext(),
+            [this](SpriteBatch& batch)
+            {
+                DrawSprites(batch, RenderType::Transparent);
+            });
+
         context->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFF);
         context->OMSetDepthStencilState(nullptr, 0);
     }
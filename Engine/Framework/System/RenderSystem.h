@@ -1,6 +1,11 @@
 ﻿#pragma once
 
+#include "Common/Math/DynamicAabbTree.h"
+#include "Core/Graphics/Device/DeferredContextPool.h"
+#include "Core/Graphics/Device/NullCommandContext.h"
 #include "Framework/System/System.h"
+#include "Framework/System/RenderQueue.h"
+#include "Framework/System/SpriteBatch.h"
 #include "Framework/Object/Component/Renderer.h"
 
 namespace engine
@@ -18,6 +23,17 @@ namespace engine
     class PixelShader;
     class BlendState;
     class GameObject;
+    class DynamicVertexBuffer;
+
+    struct CullingStats
+    {
+        std::uint32_t cameraTested = 0;
+        std::uint32_t cameraVisible = 0;
+        std::uint32_t shadowTested = 0;
+        std::uint32_t shadowVisible = 0;
+        std::int32_t treeProxyCount = 0;
+        std::int32_t treeHeight = 0;
+    };
 
     class RenderSystem :
         public System<Renderer>
@@ -28,6 +44,44 @@ namespace engine
         std::vector<Renderer*> m_transparentList;
         std::vector<Renderer*> m_screenList;
 
+        // 컬링을 통과한 렌더러 (매 프레임 다시 채움)
+        std::vector<Renderer*> m_visibleOpaqueList;
+        std::vector<Renderer*> m_visibleCutoutList;
+        std::vector<Renderer*> m_visibleTransparentList;
+        std::vector<Renderer*> m_shadowOpaqueList;
+        std::vector<Renderer*> m_shadowCutoutList;
+
+        bool m_useFrustumCulling = true;
+        CullingStats m_cullingStats;
+
+        bool m_sortDrawPackets = true; // 끄면 추가한 순서대로 그림 (바인드 횟수 비교용)
+        bool m_useInstancing = true; // 정렬 뒤 붙어 있는 같은 섹션을 DrawIndexedInstanced로 묶음
+        RenderQueueStats m_renderQueueStats; // 그림자 + 지오메트리 패스
+
+        std::shared_ptr<DynamicVertexBuffer> m_instanceBuffer;
+
+        bool m_recordInParallel = true; // 그림자 / 지오메트리 packet을 워커에서 deferred context로 나눠 기록
+        DeferredContextPool m_deferredContexts;
+
+        // 켜면 그림자 / 지오메트리 packet과 배칭한 스프라이트를 GPU 대신 null 백엔드에 기록 (프레임별 제출 비용 / 바인드 / 업로드 확인용)
+        bool m_useNullBackend = false;
+        NullCommandContext m_nullCommands{ false };
+
+        bool m_batchSprites = true; // 기본 셰이더 SpriteRenderer를 SpriteBatch로 묶음
+        SpriteBatchStats m_spriteBatchStats;
+
+        std::shared_ptr<DynamicVertexBuffer> m_spriteVertexBuffer;
+        std::shared_ptr<IndexBuffer> m_spriteIndexBuffer;
+        std::shared_ptr<VertexShader> m_spriteBatchVS;
+        std::shared_ptr<VertexShader> m_shadowSpriteBatchVS;
+        std::shared_ptr<InputLayout> m_spriteBatchInputLayout;
+
+        // 월드에 그려지는 렌더러(Screen 제외)의 BVH
+        DynamicAabbTree m_boundsTree;
+        std::vector<Renderer*> m_boundsUpdateQueue;
+
+        Matrix m_frameViewProjection; // 피킹 레이 계산용
+
         std::shared_ptr<ConstantBuffer> m_frameCB;
         std::shared_ptr<SamplerState> m_comparisonSamplerState;
         std::shared_ptr<SamplerState> m_clampSamplerState;
@@ -90,13 +144,66 @@ namespace engine
 
         GameObject* PickObject(int mouseX, int mouseY);
 
+        // BVH 공간 쿼리 (활성화된 렌더러만, 월드 AABB 기준)
+        void QueryFrustum(const DirectX::BoundingFrustum& frustum, std::vector<Renderer*>& out);
+        void QueryBox(const DirectX::BoundingBox& box, std::vector<Renderer*>& out);
+        void QuerySphere(const DirectX::BoundingSphere& sphere, std::vector<Renderer*>& out);
+        Renderer* Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, float& outDistance);
+
+        void QueueBoundsUpdate(Renderer* renderer);
+
+        bool IsFrustumCullingEnabled() const;
+        void SetFrustumCullingEnabled(bool enabled);
+        const CullingStats& GetCullingStats() const;
+
+        bool IsDrawPacketSortEnabled() const;
+        void SetDrawPacketSortEnabled(bool enabled);
+        bool IsInstancingEnabled() const;
+        void SetInstancingEnabled(bool enabled);
+        bool IsNullBackendEnabled() const;
+        void SetNullBackendEnabled(bool enabled);
+        const CommandStats& GetNullBackendStats() const; // 이번 프레임
+        bool IsParallelRecordingEnabled() const;
+        void SetParallelRecordingEnabled(bool enabled);
+        const RenderQueueStats& GetRenderQueueStats() const;
+
+        bool IsSpriteBatchingEnabled() const;
+        void SetSpriteBatchingEnabled(bool enabled);
+        const SpriteBatchStats& GetSpriteBatchStats() const;
+
     private:
         void AddRenderer(std::vector<Renderer*>& v, Renderer* renderer, RenderType type);
         void RemoveRenderer(std::vector<Renderer*>& v, Renderer* renderer, RenderType type);
 
+        // 활성화된 렌더러 중 frustum과 겹치는 것만 out에 담고, 검사한 개수를 반환 (frustum이 nullptr이면 컬링 안 함)
+        std::uint32_t CullRenderers(const std::vector<Renderer*>& renderers, const DirectX::BoundingFrustum* frustum, std::vector<Renderer*>& out);
+
+        // BVH로 frustum 안의 렌더러를 타입별 리스트에 나눠 담고, 정밀 검사한 개수를 반환 (transparent가 nullptr이면 생략)
+        std::uint32_t CullRenderersInTree(
+            const DirectX::BoundingFrustum& frustum,
+            std::vector<Renderer*>& opaque,
+            std::vector<Renderer*>& cutout,
+            std::vector<Renderer*>* transparent);
+
+        // 모은 packet을 정렬하고 (꺼져 있으면 그대로) 인스턴싱할 것을 묶어서 그린 뒤 통계에 더함
+        void SubmitDrawPackets(RenderQueue& queue);
+
+        // packet / 스프라이트를 기록할 곳 (null 백엔드 또는 즉시 context)
+        CommandContext& GetSubmitContext();
+
+        // 배칭할 수 있는 스프라이트는 sprites에, 나머지는 queue에
+        void CollectDrawPackets(const std::vector<Renderer*>& renderers, RenderType type, RenderQueue& queue, SpriteBatch& sprites);
+
+        // 모은 스프라이트를 묶어서 그리고 비움 (반투명은 추가한 순서 그대로)
+        void DrawSprites(SpriteBatch& sprites, RenderType type);
+
+        void UpdateBoundsTree();
+        static bool IsWorldRenderer(const Renderer* renderer);
+
         void DrawGlobalLight();
         void DrawLocalLight();
         void DrawSkybox();
+        // 보이는 반투명 렌더러를 뒤에서 앞으로 (스프라이트는 SpriteBatch::DrawInOrder로 묶음)
         void DrawTransparents(const Vector3& cameraPosition);
     };
 }
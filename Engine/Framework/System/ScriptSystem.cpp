@@ -59,6 +59,11 @@ namespace engine
         }
     }
 
+    void ScriptSystem::ScheduleStart(ScriptBase* script)
+    {
+        AddScript(m_startScripts, script, ScriptEvent::Start);
+    }
+
     void ScriptSystem::AddScript(std::vector<ScriptBase*>& v, ScriptBase* script, ScriptEvent type)
     {
         if (script->m_systemIndices[static_cast<size_t>(type)] != -1)
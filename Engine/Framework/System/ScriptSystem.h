@@ -20,6 +20,9 @@ namespace engine
         void CallStart();
         void CallUpdate();
 
+        // 에디터 Play를 다시 시작할 때 Start를 한 번 더 부르도록 등록
+        void ScheduleStart(ScriptBase* script);
+
     private:
         void AddScript(std::vector<ScriptBase*>& v, ScriptBase* script, ScriptEvent type);
         void RemoveScript(std::vector<ScriptBase*>& v, ScriptBase* script, ScriptEvent type);
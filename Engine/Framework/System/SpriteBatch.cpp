@@ -0,0 +1,218 @@
+﻿#include "EnginePCH.h"
+#include "SpriteBatch.h"
+
+#include "Core/Graphics/Data/ShaderSlotTypes.h"
+#include "Core/Graphics/Device/CommandContext.h"
+#include "Framework/Object/Component/Renderer.h"
+
+namespace engine
+{
+    namespace
+    {
+        // GeometryGenerator::MakeQuad(1, 1)
+        constexpr std::array<Vector2, SpriteBatch::VerticesPerSprite> g_quadPositions
+        {
+            Vector2{ -0.5f, -0.5f },
+            Vector2{ -0.5f, 0.5f },
+            Vector2{ 0.5f, 0.5f },
+            Vector2{ 0.5f, -0.5f }
+        };
+
+        constexpr std::array<Vector2, SpriteBatch::VerticesPerSprite> g_quadTexCoords
+        {
+            Vector2{ 0.0f, 1.0f },
+            Vector2{ 0.0f, 0.0f },
+            Vector2{ 1.0f, 0.0f },
+            Vector2{ 1.0f, 1.0f }
+        };
+
+        bool IsSameState(const SpriteDrawItem& a, const SpriteDrawItem& b)
+        {
+            return a.pixelShader == b.pixelShader &&
+                a.texture == b.texture &&
+                a.rasterizerState == b.rasterizerState;
+        }
+    }
+
+    SpriteBatchStats& SpriteBatchStats::operator+=(const SpriteBatchStats& other)
+    {
+        spriteCount += other.spriteCount;
+        drawCount += other.drawCount;
+
+        return *this;
+    }
+
+    void SpriteBatch::Reserve(std::size_t spriteCount)
+    {
+        m_items.reserve(spriteCount);
+    }
+
+    void SpriteBatch::Add(const SpriteDrawItem& item)
+    {
+        m_items.push_back(item);
+    }
+
+    void SpriteBatch::Build(bool sortByState)
+    {
+        m_vertices.clear();
+        m_batches.clear();
+
+        if (m_items.empty())
+        {
+            return;
+        }
+
+        if (sortByState)
+        {
+            std::stable_sort(m_items.begin(), m_items.end(), [](const SpriteDrawItem& a, const SpriteDrawItem& b)
+                {
+                    return std::tie(a.pixelShader, a.texture, a.rasterizerState) <
+                        std::tie(b.pixelShader, b.texture, b.rasterizerState);
+                });
+        }
+
+        m_vertices.resize(m_items.size() * VerticesPerSprite);
+
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            const SpriteDrawItem& item = m_items[i];
+
+            ExpandQuad(item, m_vertices.data() + i * VerticesPerSprite);
+
+            if (!m_batches.empty())
+            {
+                Batch& last = m_batches.back();
+                const SpriteDrawItem& first = m_items[last.firstSprite];
+
+                if (IsSameState(first, item) && last.spriteCount < MaxBatchSpriteCount)
+                {
+                    ++last.spriteCount;
+                    continue;
+                }
+            }
+
+            m_batches.push_back(Batch{ item.pixelShader, item.texture, item.rasterizerState, static_cast<std::uint32_t>(i), 1 });
+        }
+    }
+
+    SpriteBatchStats SpriteBatch::Submit(CommandContext& context) const
+    {
+        // 스프라이트마다 컬 모드가 다르므로 끝나면 패스의 래스터라이저 상태로 되돌림
+        const RasterizerStateHandle passRasterizerState = context.GetRasterizerState();
+
+        const Batch* previous = nullptr;
+        for (const Batch& batch : m_batches)
+        {
+            if (previous == nullptr || previous->pixelShader != batch.pixelShader)
+            {
+                context.SetPixelShader(batch.pixelShader);
+            }
+
+            if (previous == nullptr || previous->texture != batch.texture)
+            {
+                context.SetPSShaderResources(static_cast<std::uint32_t>(TextureSlot::BaseColor), 1, &batch.texture);
+            }
+
+            if (previous == nullptr || previous->rasterizerState != batch.rasterizerState)
+            {
+                context.SetRasterizerState(batch.rasterizerState);
+            }
+
+            context.DrawIndexed(batch.spriteCount * IndicesPerSprite, 0, static_cast<std::int32_t>(batch.firstSprite * VerticesPerSprite));
+
+            previous = &batch;
+        }
+
+        context.SetRasterizerState(passRasterizerState);
+
+        return SpriteBatchStats{
+            static_cast<std::uint32_t>(m_items.size()),
+            static_cast<std::uint32_t>(m_batches.size()) };
+    }
+
+    void SpriteBatch::Clear()
+    {
+        m_items.clear();
+        m_vertices.clear();
+        m_batches.clear();
+    }
+
+    bool SpriteBatch::IsEmpty() const
+    {
+        return m_items.empty();
+    }
+
+    std::span<const SpriteVertex> SpriteBatch::GetVertices() const
+    {
+        return { m_vertices.data(), m_vertices.size() };
+    }
+
+    std::span<const SpriteBatch::Batch> SpriteBatch::GetBatches() const
+    {
+        return { m_batches.data(), m_batches.size() };
+    }
+
+    void SpriteBatch::ExpandQuad(const SpriteDrawItem& item, SpriteVertex* outVertices)
+    {
+        const Vector2 shift{ -(item.pivot.x - 0.5f), item.pivot.y - 0.5f };
+
+        for (UINT i = 0; i < VerticesPerSprite; ++i)
+        {
+            const Vector2 position = g_quadPositions[i] + shift;
+
+            outVertices[i].position = Vector3::Transform(Vector3{ position.x, position.y, 0.0f }, item.world);
+            outVertices[i].texCoord = g_quadTexCoords[i] * item.uvScale + item.uvOffset;
+            outVertices[i].color = item.color;
+        }
+    }
+
+    std::vector<WORD> SpriteBatch::MakeIndices(UINT spriteCount)
+    {
+        std::vector<WORD> indices;
+        indices.reserve(static_cast<std::size_t>(spriteCount) * IndicesPerSprite);
+
+        for (UINT i = 0; i < spriteCount; ++i)
+        {
+            const WORD base = static_cast<WORD>(i * VerticesPerSprite);
+
+            indices.push_back(base);
+            indices.push_back(static_cast<WORD>(base + 1));
+            indices.push_back(static_cast<WORD>(base + 2));
+            indices.push_back(base);
+            indices.push_back(static_cast<WORD>(base + 2));
+            indices.push_back(static_cast<WORD>(base + 3));
+        }
+
+        return indices;
+    }
+
+    void SpriteBatch::DrawInOrder(
+        std::span<Renderer* const> renderers,
+        RenderType type,
+        bool batchSprites,
+        SpriteBatch& batch,
+        CommandContext& context,
+        const std::function<void(SpriteBatch&)>& flush)
+    {
+        for (const Renderer* renderer : renderers)
+        {
+            if (batchSprites && renderer->CollectSprite(type, batch))
+            {
+                continue;
+            }
+
+            // 순서를 지키기 위해 앞에 모인 스프라이트를 먼저 그림
+            if (!batch.IsEmpty())
+            {
+                flush(batch);
+            }
+
+            context.DrawRenderer(*renderer, type);
+        }
+
+        if (!batch.IsEmpty())
+        {
+            flush(batch);
+        }
+    }
+}
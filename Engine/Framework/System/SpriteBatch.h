@@ -0,0 +1,97 @@
+﻿#pragma once
+
+#include <functional>
+#include <span>
+
+#include "Common/Utility/FrameArena.h"
+#include "Core/Graphics/Device/GraphicsHandles.h"
+#include "Core/Graphics/Data/Vertex.h"
+
+namespace engine
+{
+    class CommandContext;
+    class Renderer;
+    enum class RenderType;
+
+    // 스프라이트 하나 (SpriteRenderer가 CollectSprite에서 채움)
+    // 핸들은 비교 / 바인드에만 쓰고 소유하지 않음 (프레임 안에서만 유효)
+    struct SpriteDrawItem
+    {
+        PixelShaderHandle pixelShader; // 비어 있으면 깊이만 (그림자)
+        ShaderResourceHandle texture;
+        RasterizerStateHandle rasterizerState;
+
+        Matrix world; // 1x1 쿼드 기준 (이미지 크기 / 빌보드 포함)
+        Vector2 uvOffset{ 0.0f, 0.0f };
+        Vector2 uvScale{ 1.0f, 1.0f };
+        Vector2 pivot{ 0.5f, 0.5f };
+        Vector4 color{ 1.0f, 1.0f, 1.0f, 1.0f };
+    };
+
+    struct SpriteBatchStats
+    {
+        std::uint32_t spriteCount = 0;
+        std::uint32_t drawCount = 0;
+
+        SpriteBatchStats& operator+=(const SpriteBatchStats& other);
+    };
+
+    // 스프라이트를 픽셀 셰이더 / 텍스처 / 래스터라이저 상태가 같은 것끼리 묶고, 쿼드를 월드 공간 정점으로 펼침
+    // - Build(true): 상태 순으로 정렬해서 묶음 (불투명 / cutout / 그림자)
+    // - Build(false): 추가한 순서를 지키고 바로 붙은 것만 묶음 (반투명은 뒤에서 앞 순서로 추가)
+    // 디바이스를 쓰지 않음 (정점 버퍼에 올려서 그리는 것은 RenderSystem)
+    class SpriteBatch
+    {
+    public:
+        static constexpr UINT VerticesPerSprite = 4;
+        static constexpr UINT IndicesPerSprite = 6;
+        static constexpr UINT MaxBatchSpriteCount = 65536 / VerticesPerSprite; // 16비트 인덱스 (baseVertex로 묶음마다 0부터)
+
+        struct Batch
+        {
+            PixelShaderHandle pixelShader;
+            ShaderResourceHandle texture;
+            RasterizerStateHandle rasterizerState;
+            std::uint32_t firstSprite;
+            std::uint32_t spriteCount;
+        };
+
+    private:
+        FrameVector<SpriteDrawItem> m_items;
+        FrameVector<SpriteVertex> m_vertices;
+        FrameVector<Batch> m_batches;
+
+    public:
+        void Reserve(std::size_t spriteCount);
+        void Add(const SpriteDrawItem& item);
+
+        // 키가 같으면 추가한 순서 유지
+        void Build(bool sortByState);
+        void Clear();
+
+        bool IsEmpty() const;
+        std::span<const SpriteVertex> GetVertices() const;
+        std::span<const Batch> GetBatches() const;
+
+        // Build 뒤에 호출, 묶음마다 바뀐 픽셀 셰이더 / 텍스처 / 래스터라이저 상태만 바인드하고 DrawIndexed
+        // 정점 / 인덱스 버퍼, VS, 샘플러는 호출한 쪽에서 바인드, 끝나면 래스터라이저 상태를 처음 것으로 되돌림
+        SpriteBatchStats Submit(CommandContext& context) const;
+
+        // Quad_VS와 같은 계산 (pivot 이동 -> world, uv * uvScale + uvOffset), 정점 순서는 DefaultQuad와 같음
+        static void ExpandQuad(const SpriteDrawItem& item, SpriteVertex* outVertices);
+
+        // 스프라이트마다 0, 1, 2, 0, 2, 3
+        static std::vector<WORD> MakeIndices(UINT spriteCount);
+
+        // 순서를 지켜야 하는 패스 (반투명, renderers는 뒤에서 앞으로 정렬된 순서)
+        // 배칭할 수 있는 스프라이트는 batch에 모으고, 다른 렌더러를 만나면 모은 것을 flush로 먼저 그린 뒤 context.DrawRenderer로 맡김
+        // flush는 Build(false) / Submit 후 batch를 비워야 함 (끝에 남은 것도 flush로 그림)
+        static void DrawInOrder(
+            std::span<Renderer* const> renderers,
+            RenderType type,
+            bool batchSprites,
+            SpriteBatch& batch,
+            CommandContext& context,
+            const std::function<void(SpriteBatch&)>& flush);
+    };
+}
@@ -3,6 +3,60 @@
 
 namespace engine
 {
+    TransformSystem::TransformSystem()
+    {
+        constexpr std::size_t initialCapacity = 4096;
+
+        m_localPositions.reserve(initialCapacity);
+        m_localRotations.reserve(initialCapacity);
+        m_localScales.reserve(initialCapacity);
+        m_worlds.reserve(initialCapacity);
+        m_parents.reserve(initialCapacity);
+        m_worldVersions.reserve(initialCapacity);
+        m_dirtyFlags.reserve(initialCapacity);
+        m_owners.reserve(initialCapacity);
+        m_dirtySlots.reserve(initialCapacity);
+    }
+
+    void TransformSystem::UpdateWorldMatrices()
+    {
+        if (m_isOrderDirty)
+        {
+            SortByDepth();
+        }
+
+        if (m_dirtyCount == 0)
+        {
+            m_dirtySlots.clear();
+            return;
+        }
+
+        // slot은 depth 순이므로 번호 순으로 돌면 부모가 먼저 갱신됨
+        std::sort(m_dirtySlots.begin(), m_dirtySlots.end());
+
+        for (const std::int32_t i : m_dirtySlots)
+        {
+            if (m_dirtyFlags[i] == 0)
+            {
+                continue;
+            }
+
+            const Matrix local = Matrix::CreateScale(m_localScales[i]) *
+                Matrix::CreateFromQuaternion(m_localRotations[i]) *
+                Matrix::CreateTranslation(m_localPositions[i]);
+
+            // 정렬되어 있으므로 부모는 이미 갱신됨
+            const std::int32_t parent = m_parents[i];
+            m_worlds[i] = parent != -1 ? local * m_worlds[parent] : local;
+
+            ++m_worldVersions[i];
+            m_dirtyFlags[i] = 0;
+        }
+
+        m_dirtySlots.clear();
+        m_dirtyCount = 0;
+    }
+
     void TransformSystem::UnmarkDirtyThisFrame()
     {
         for (auto& transform : m_components)
@@ -13,4 +67,218 @@ namespace engine
             }
         }
     }
-}
\ No newline at end of file
+
+    std::size_t TransformSystem::GetSlotCount() const
+    {
+        return m_owners.size() - m_freeSlots.size();
+    }
+
+    std::int32_t TransformSystem::CreateSlot(Transform* owner)
+    {
+        ++m_dirtyCount;
+
+        // 새 Transform은 루트이므로 빈 slot 어디에 넣어도 순서가 깨지지 않음
+        if (!m_freeSlots.empty())
+        {
+            const std::int32_t slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+
+            m_localPositions[slot] = Vector3(0.0f, 0.0f, 0.0f);
+            m_localRotations[slot] = Quaternion::Identity;
+            m_localScales[slot] = Vector3(1.0f, 1.0f, 1.0f);
+            m_worlds[slot] = Matrix::Identity;
+            m_parents[slot] = -1;
+            m_dirtyFlags[slot] = 1;
+            m_owners[slot] = owner;
+            m_dirtySlots.push_back(slot);
+
+            return slot;
+        }
+
+        m_localPositions.emplace_back(0.0f, 0.0f, 0.0f);
+        m_localRotations.push_back(Quaternion::Identity);
+        m_localScales.emplace_back(1.0f, 1.0f, 1.0f);
+        m_worlds.push_back(Matrix::Identity);
+        m_parents.push_back(-1);
+        m_worldVersions.push_back(0);
+        m_dirtyFlags.push_back(1);
+        m_owners.push_back(owner);
+
+        const std::int32_t slot = static_cast<std::int32_t>(m_owners.size() - 1);
+        m_dirtySlots.push_back(slot);
+
+        return slot;
+    }
+
+    void TransformSystem::DestroySlot(std::int32_t slot)
+    {
+        assert(0 <= slot && slot < static_cast<std::int32_t>(m_owners.size()));
+
+        if (m_dirtyFlags[slot] != 0)
+        {
+            --m_dirtyCount;
+        }
+
+        // 자식은 Transform에서 먼저 떼어낸 상태여야 함
+        // 빈 slot은 그대로 두고 재사용하다가 재정렬할 때 압축
+        m_parents[slot] = FreeSlot;
+        m_dirtyFlags[slot] = 0;
+        m_owners[slot] = nullptr;
+        m_freeSlots.push_back(slot);
+
+        // 빈 slot이 절반을 넘으면 다음 갱신 때 압축
+        if (m_freeSlots.size() * 2 > m_owners.size())
+        {
+            m_isOrderDirty = true;
+        }
+    }
+
+    void TransformSystem::SetParentSlot(std::int32_t slot, std::int32_t parentSlot)
+    {
+        m_parents[slot] = parentSlot;
+
+        if (parentSlot > slot)
+        {
+            m_isOrderDirty = true;
+        }
+    }
+
+    Matrix TransformSystem::GetWorld(std::int32_t slot)
+    {
+        if (m_dirtyFlags[slot] != 0)
+        {
+            RecalculateWorld(slot);
+        }
+
+        return m_worlds[slot];
+    }
+
+    bool TransformSystem::MarkDirty(std::int32_t slot)
+    {
+        if (m_dirtyFlags[slot] != 0)
+        {
+            return false;
+        }
+
+        m_dirtyFlags[slot] = 1;
+        ++m_dirtyCount;
+        m_dirtySlots.push_back(slot);
+
+        return true;
+    }
+
+    void TransformSystem::RecalculateWorld(std::int32_t slot)
+    {
+        const Matrix local = Matrix::CreateScale(m_localScales[slot]) *
+            Matrix::CreateFromQuaternion(m_localRotations[slot]) *
+            Matrix::CreateTranslation(m_localPositions[slot]);
+
+        const std::int32_t parent = m_parents[slot];
+        if (parent != -1)
+        {
+            m_worlds[slot] = local * GetWorld(parent);
+        }
+        else
+        {
+            m_worlds[slot] = local;
+        }
+
+        ++m_worldVersions[slot];
+        m_dirtyFlags[slot] = 0;
+        --m_dirtyCount;
+    }
+
+    void TransformSystem::SortByDepth()
+    {
+        const std::int32_t count = static_cast<std::int32_t>(m_owners.size());
+
+        m_depths.assign(count, -1);
+        m_order.clear();
+        for (std::int32_t i = 0; i < count; ++i)
+        {
+            if (m_parents[i] == FreeSlot)
+            {
+                continue;
+            }
+
+            GetDepth(i);
+            m_order.push_back(i);
+        }
+
+        std::stable_sort(m_order.begin(), m_order.end(),
+            [this](std::int32_t a, std::int32_t b)
+            {
+                return m_depths[a] < m_depths[b];
+            });
+
+        const std::int32_t aliveCount = static_cast<std::int32_t>(m_order.size());
+
+        m_remap.resize(count);
+        for (std::int32_t i = 0; i < aliveCount; ++i)
+        {
+            m_remap[m_order[i]] = i;
+        }
+
+        ApplyOrder(m_localPositions);
+        ApplyOrder(m_localRotations);
+        ApplyOrder(m_localScales);
+        ApplyOrder(m_worlds);
+        ApplyOrder(m_parents);
+        ApplyOrder(m_worldVersions);
+        ApplyOrder(m_dirtyFlags);
+        ApplyOrder(m_owners);
+
+        for (std::int32_t i = 0; i < aliveCount; ++i)
+        {
+            if (m_parents[i] != -1)
+            {
+                m_parents[i] = m_remap[m_parents[i]];
+            }
+
+            if (m_owners[i] != nullptr)
+            {
+                m_owners[i]->m_slot = i;
+            }
+        }
+
+        // slot 번호가 바뀌었으므로 dirty 목록을 새 번호로 다시 만듦 (재정렬 자체가 전체를 도므로 같이 훑음)
+        m_dirtySlots.clear();
+        for (std::int32_t i = 0; i < aliveCount; ++i)
+        {
+            if (m_dirtyFlags[i] != 0)
+            {
+                m_dirtySlots.push_back(i);
+            }
+        }
+
+        m_freeSlots.clear();
+        m_isOrderDirty = false;
+    }
+
+    std::int32_t TransformSystem::GetDepth(std::int32_t slot)
+    {
+        if (m_depths[slot] != -1)
+        {
+            return m_depths[slot];
+        }
+
+        const std::int32_t parent = m_parents[slot];
+        m_depths[slot] = parent != -1 ? GetDepth(parent) + 1 : 0;
+
+        return m_depths[slot];
+    }
+
+    template <typename T>
+    void TransformSystem::ApplyOrder(std::vector<T>& v)
+    {
+        std::vector<T> sorted;
+        sorted.reserve(v.size());
+
+        for (std::int32_t index : m_order)
+        {
+            sorted.push_back(v[index]);
+        }
+
+        v.swap(sorted);
+    }
+}
@@ -5,10 +5,61 @@
 
 namespace engine
 {
+    // Transform 데이터는 여기서 SoA로 들고 있고 Transform 컴포넌트는 slot 번호만 가짐
+    // slot은 depth 순으로 정렬되어 있어서 부모가 항상 자식보다 앞에 옴 (계층이 바뀌면 UpdateWorldMatrices에서 재정렬)
     class TransformSystem :
         public System<Transform>
     {
+    private:
+        static constexpr std::int32_t FreeSlot = -2;
+
+        std::vector<Vector3> m_localPositions;
+        std::vector<Quaternion> m_localRotations;
+        std::vector<Vector3> m_localScales;
+        std::vector<Matrix> m_worlds;
+        std::vector<std::int32_t> m_parents; // 부모 slot, 없으면 -1, 빈 slot이면 FreeSlot
+        std::vector<std::uint32_t> m_worldVersions;
+        std::vector<std::uint8_t> m_dirtyFlags;
+        std::vector<Transform*> m_owners;
+        std::vector<std::int32_t> m_freeSlots;
+        std::vector<std::int32_t> m_dirtySlots; // dirty가 된 slot (GetWorld가 먼저 갱신했거나 지워진 slot도 남아 있을 수 있음)
+
+        std::uint32_t m_dirtyCount = 0;
+        bool m_isOrderDirty = false;
+
+        // 재정렬용
+        std::vector<std::int32_t> m_depths;
+        std::vector<std::int32_t> m_order;
+        std::vector<std::int32_t> m_remap;
+
+    public:
+        TransformSystem();
+
     public:
+        // 부모 -> 자식 순서로 dirty인 world 행렬을 한번에 갱신 (dirty인 slot만 방문)
+        void UpdateWorldMatrices();
         void UnmarkDirtyThisFrame();
+
+        std::size_t GetSlotCount() const;
+
+    private:
+        std::int32_t CreateSlot(Transform* owner);
+        void DestroySlot(std::int32_t slot);
+        void SetParentSlot(std::int32_t slot, std::int32_t parentSlot);
+
+        // slot 배열은 새 Transform이 생기면 재할당되므로 값으로 돌려줌
+        Matrix GetWorld(std::int32_t slot);
+        bool MarkDirty(std::int32_t slot); // 이미 dirty였으면 false
+        void RecalculateWorld(std::int32_t slot);
+
+        void SortByDepth();
+        std::int32_t GetDepth(std::int32_t slot);
+
+        template <typename T>
+        void ApplyOrder(std::vector<T>& v);
+
+    private:
+        friend class Transform;
+        friend class EditorBenchmark;
     };
-}
\ No newline at end of file
+}
@@ -181,6 +181,22 @@ struct PS_INPUT_TEXCOORD
     float2 texCoord : TEXCOORD0;
 };
 
+// SpriteVertex (Vertex.h), SpriteBatch가 월드 공간으로 펼친 쿼드
+struct VS_INPUT_SPRITE
+{
+    float3 position : POSITION;
+    float2 texCoord : TEXCOORD0;
+    float4 color : COLOR0;
+};
+
+// 앞부분이 PS_INPUT_TEXCOORD와 같으므로 Mask_Cutout_PS / Picking_PS도 그대로 받을 수 있음
+struct PS_INPUT_SPRITE
+{
+    float4 position : SV_Position;
+    float2 texCoord : TEXCOORD0;
+    float4 color : COLOR0;
+};
+
 struct VS_INPUT_SKINNING
 {
     float3 position : POSITION;
@@ -201,6 +217,34 @@ struct VS_INPUT_COMMON
     float3 binormal : BINORMAL;
 };
 
+// CompactVertex (Vertex.h), DecodeCompactVertex로 VS_INPUT_COMMON으로 풀어서 씀
+struct VS_INPUT_COMPACT
+{
+    float3 position : POSITION;
+    float2 texCoord : TEXCOORD0;
+    float2 normal : NORMAL; // 8면체 좌표
+    float4 tangent : TANGENT; // xy: 8면체 좌표 [0, 1], w: binormal 부호 (0: -1, 1: +1)
+};
+
+// CommonVertex + InstanceData (Vertex.h), 행렬은 CbObject 대신 인스턴스 버퍼의 행으로 받음
+struct VS_INPUT_COMMON_INSTANCED
+{
+    float3 position : POSITION;
+    float2 texCoord : TEXCOORD0;
+    float3 normal : NORMAL;
+    float3 tangent : TANGENT;
+    float3 binormal : BINORMAL;
+    
+    float4 world0 : INSTANCE_WORLD0;
+    float4 world1 : INSTANCE_WORLD1;
+    float4 world2 : INSTANCE_WORLD2;
+    float4 world3 : INSTANCE_WORLD3;
+    float4 worldInverseTranspose0 : INSTANCE_NORMAL0;
+    float4 worldInverseTranspose1 : INSTANCE_NORMAL1;
+    float4 worldInverseTranspose2 : INSTANCE_NORMAL2;
+    float4 worldInverseTranspose3 : INSTANCE_NORMAL3;
+};
+
 struct PS_INPUT_GBUFFER
 {
     float4 position : SV_Position;
@@ -250,6 +294,29 @@ float3 DecodeNormal(float3 n)
     return n * 2.0f - 1.0f;
 }
 
+// 8면체 좌표 [-1, 1]^2 -> 단위 벡터 (VertexCompression.cpp와 같은 식)
+float3 DecodeOctahedral(float2 e)
+{
+    float3 n = float3(e, 1.0f - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.xy += n.xy >= 0.0f ? -t : t;
+    
+    return normalize(n);
+}
+
+VS_INPUT_COMMON DecodeCompactVertex(VS_INPUT_COMPACT input)
+{
+    VS_INPUT_COMMON output;
+    
+    output.position = input.position;
+    output.texCoord = input.texCoord;
+    output.normal = DecodeOctahedral(input.normal);
+    output.tangent = DecodeOctahedral(input.tangent.xy * 2.0f - 1.0f);
+    output.binormal = cross(output.normal, output.tangent) * (input.tangent.w > 0.5f ? 1.0f : -1.0f);
+    
+    return output;
+}
+
 float GetLuminance(float3 color)
 {
     return dot(color, float3(0.2126f, 0.7152f, 0.0722f));
@@ -0,0 +1,13 @@
+#include "../Include/Shared.hlsli"
+
+PS_OUTPUT_GBUFFER main(PS_INPUT_SPRITE input)
+{
+    PS_OUTPUT_GBUFFER output = (PS_OUTPUT_GBUFFER) 0;
+    
+    output.baseColor = g_texBaseColor.Sample(g_samLinear, input.texCoord);
+    output.baseColor.rgb *= input.color.rgb;
+    
+    output.normal = float4(0.0f, 0.0f, 0.0f, 0.0f);
+    
+    return output;
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+#include "../Include/Shared.hlsli"
+
+float4 main(PS_INPUT_SPRITE input) : SV_Target
+{
+    return g_texBaseColor.Sample(g_samLinear, input.texCoord) * input.color;
+}
\ No newline at end of file
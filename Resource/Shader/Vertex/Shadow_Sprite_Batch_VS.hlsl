@@ -0,0 +1,12 @@
+#include "../Include/Shared.hlsli"
+
+PS_INPUT_SPRITE main(VS_INPUT_SPRITE input)
+{
+    PS_INPUT_SPRITE output = (PS_INPUT_SPRITE) 0;
+    
+    output.position = mul(float4(input.position, 1.0f), g_mainLightViewProjection);
+    output.texCoord = input.texCoord;
+    output.color = input.color;
+    
+    return output;
+}
\ No newline at end of file
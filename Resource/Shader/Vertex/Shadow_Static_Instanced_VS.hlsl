@@ -0,0 +1,15 @@
+#include "../Include/Shared.hlsli"
+
+PS_INPUT_TEXCOORD main(VS_INPUT_COMMON_INSTANCED input)
+{
+    PS_INPUT_TEXCOORD output = (PS_INPUT_TEXCOORD) 0;
+    
+    float4x4 world = float4x4(input.world0, input.world1, input.world2, input.world3);
+    
+    output.position = mul(float4(input.position, 1.0f), world);
+    output.position = mul(output.position, g_mainLightViewProjection);
+    
+    output.texCoord = input.texCoord;
+    
+    return output;
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#include "../Include/Shared.hlsli"
+
+PS_INPUT_GBUFFER main(VS_INPUT_COMPACT compactInput)
+{
+    PS_INPUT_GBUFFER output = (PS_INPUT_GBUFFER) 0;
+    VS_INPUT_COMMON input = DecodeCompactVertex(compactInput);
+    
+    output.position = mul(float4(input.position, 1.0f), g_world);
+    output.worldPosition = output.position.xyz;
+    output.position = mul(output.position, g_viewProjection);
+    
+    output.normal = mul(input.normal, (float3x3) g_worldInverseTranspose);
+    output.tangent = mul(input.tangent, (float3x3) g_worldInverseTranspose);
+    output.binormal = mul(input.binormal, (float3x3) g_worldInverseTranspose);
+    
+    output.texCoord = input.texCoord;
+    
+    return output;
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include "../Include/Shared.hlsli"
+
+PS_INPUT_GBUFFER main(VS_INPUT_COMMON_INSTANCED input)
+{
+    PS_INPUT_GBUFFER output = (PS_INPUT_GBUFFER) 0;
+    
+    float4x4 world = float4x4(input.world0, input.world1, input.world2, input.world3);
+    float4x4 worldInverseTranspose = float4x4(input.worldInverseTranspose0, input.worldInverseTranspose1, input.worldInverseTranspose2, input.worldInverseTranspose3);
+    
+    output.position = mul(float4(input.position, 1.0f), world);
+    output.worldPosition = output.position.xyz;
+    output.position = mul(output.position, g_viewProjection);
+    
+    output.normal = mul(input.normal, (float3x3) worldInverseTranspose);
+    output.tangent = mul(input.tangent, (float3x3) worldInverseTranspose);
+    output.binormal = mul(input.binormal, (float3x3) worldInverseTranspose);
+    
+    output.texCoord = input.texCoord;
+    
+    return output;
+}
\ No newline at end of file
@@ -0,0 +1,291 @@
+﻿#include "TestFramework.h"
+#include "JobSystemFixture.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+#include "Common/Utility/FrameArena.h"
+#include "Common/Utility/JobSystem.h"
+
+using namespace engine;
+using namespace engine::test;
+
+// 이 실행 파일의 모든 힙 할당을 세기 위해 전역 operator new를 바꿈
+namespace
+{
+    std::atomic<bool> g_isCounting{ false };
+    std::atomic<std::uint64_t> g_allocationCount{ 0 };
+
+    void* CountedAllocate(std::size_t size)
+    {
+        if (g_isCounting.load(std::memory_order_relaxed))
+        {
+            g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (void* data = std::malloc(size == 0 ? 1 : size))
+        {
+            return data;
+        }
+
+        throw std::bad_alloc();
+    }
+
+    void* CountedAllocate(std::size_t size, std::align_val_t alignment)
+    {
+        if (g_isCounting.load(std::memory_order_relaxed))
+        {
+            g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        const std::size_t align = static_cast<std::size_t>(alignment);
+        if (void* data = std::aligned_alloc(align, (size + align - 1) / align * align))
+        {
+            return data;
+        }
+
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, alignment);
+}
+
+void operator delete(void* data) noexcept
+{
+    std::free(data);
+}
+
+void operator delete[](void* data) noexcept
+{
+    std::free(data);
+}
+
+void operator delete(void* data, std::size_t) noexcept
+{
+    std::free(data);
+}
+
+void operator delete[](void* data, std::size_t) noexcept
+{
+    std::free(data);
+}
+
+void operator delete(void* data, std::align_val_t) noexcept
+{
+    std::free(data);
+}
+
+void operator delete[](void* data, std::align_val_t) noexcept
+{
+    std::free(data);
+}
+
+void operator delete(void* data, std::size_t, std::align_val_t) noexcept
+{
+    std::free(data);
+}
+
+void operator delete[](void* data, std::size_t, std::align_val_t) noexcept
+{
+    std::free(data);
+}
+
+namespace
+{
+    constexpr std::uint32_t ItemCount = 4096;
+
+    // 모든 스레드가 한 구간씩 맡아 FrameArena를 쓰도록 함 (각 스레드의 sub-arena를 미리 만듦)
+    // 다른 구간이 모두 도착할 때까지 기다리므로 한 스레드가 두 구간을 맡을 수 없음
+    void TouchArenaOnEveryThread()
+    {
+        JobSystem& jobSystem = JobSystem::Get();
+        std::atomic<std::uint32_t> arrived{ 0 };
+
+        jobSystem.ParallelFor(jobSystem.GetWorkerCount() + 1, 1, [&arrived](std::uint32_t, std::uint32_t)
+            {
+                FrameVector<std::uint32_t> values;
+                values.reserve(ItemCount);
+
+                arrived.fetch_add(1, std::memory_order_acq_rel);
+                while (arrived.load(std::memory_order_acquire) <= JobSystem::Get().GetWorkerCount())
+                {
+                    std::this_thread::yield();
+                }
+            });
+    }
+
+    // 게임 루프의 한 프레임이 잡 시스템과 프레임 할당기를 쓰는 방식을 흉내냄
+    std::uint64_t SimulateFrame()
+    {
+        JobSystem& jobSystem = JobSystem::Get();
+
+        FrameArena::Get().BeginFrame();
+
+        FrameVector<std::uint32_t> values;
+        values.resize(ItemCount);
+
+        // 컬링 / 스키닝 같은 병렬 루프 (워커 안에서도 프레임 할당)
+        jobSystem.ParallelFor(ItemCount, 256, [&values](std::uint32_t begin, std::uint32_t end)
+            {
+                FrameVector<std::uint32_t> scratch;
+                scratch.reserve(end - begin);
+
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    scratch.push_back(i * 2);
+                }
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    values[i] = scratch[i - begin];
+                }
+            });
+
+        // 의존성이 있는 잡 + 메인 스레드로 돌아오는 잡 (캡처가 InlineSize를 넘지 않는 평범한 람다)
+        JobCounter first;
+        JobCounter second;
+        std::atomic<std::uint64_t> sum{ 0 };
+        std::uint64_t mainThreadSum = 0;
+
+        for (std::uint32_t i = 0; i < 8; ++i)
+        {
+            jobSystem.Run([&values, &sum, i]()
+                {
+                    sum.fetch_add(values[i * 512], std::memory_order_relaxed);
+                },
+                &first);
+        }
+
+        jobSystem.RunAfter(first, [&sum, &mainThreadSum, &jobSystem]()
+            {
+                const std::uint64_t value = sum.load(std::memory_order_relaxed);
+                jobSystem.RunOnMainThread([&mainThreadSum, value]()
+                    {
+                        mainThreadSum = value;
+                    });
+            },
+            &second);
+
+        jobSystem.Wait(second);
+        jobSystem.ExecuteMainThreadJobs();
+
+        return mainThreadSum;
+    }
+}
+
+TEST_CASE(SteadyStateFramesDoNotAllocate)
+{
+    ScopedJobSystem scope;
+
+    // 두 버퍼 모두에 대해 스레드별 sub-arena를 만들고, 잡 노드 풀 / 블록이 자리잡을 때까지 몇 프레임 돌림
+    for (std::uint32_t i = 0; i < 2; ++i)
+    {
+        FrameArena::Get().BeginFrame();
+        TouchArenaOnEveryThread();
+    }
+    for (std::uint32_t i = 0; i < 8; ++i)
+    {
+        SimulateFrame();
+    }
+
+    const std::uint64_t blockAllocationCount = FrameArena::Get().GetStats().blockAllocationCount;
+
+    std::uint64_t expectedSum = 0;
+    for (std::uint32_t i = 0; i < 8; ++i)
+    {
+        expectedSum += i * 512 * 2;
+    }
+
+    bool isSumCorrect = true;
+
+    g_allocationCount.store(0, std::memory_order_relaxed);
+    g_isCounting.store(true, std::memory_order_release);
+
+    for (std::uint32_t i = 0; i < 64; ++i)
+    {
+        isSumCorrect = isSumCorrect && SimulateFrame() == expectedSum;
+    }
+
+    g_isCounting.store(false, std::memory_order_release);
+
+    CHECK(isSumCorrect);
+    CHECK(g_allocationCount.load() == 0);
+    CHECK(FrameArena::Get().GetStats().blockAllocationCount == blockAllocationCount);
+}
+
+TEST_CASE(LargeJobCaptureStillRuns)
+{
+    ScopedJobSystem scope;
+    JobSystem& jobSystem = JobSystem::Get();
+
+    // InlineSize를 넘는 캡처는 그 잡만 힙에 둠
+    std::array<std::uint64_t, 32> payload{};
+    payload.fill(3);
+
+    JobCounter counter;
+    std::atomic<std::uint64_t> sum{ 0 };
+
+    jobSystem.Run([payload, &sum]()
+        {
+            std::uint64_t local = 0;
+            for (const std::uint64_t value : payload)
+            {
+                local += value;
+            }
+            sum.store(local);
+        },
+        &counter);
+
+    jobSystem.Wait(counter);
+
+    CHECK(sum.load() == 96);
+}
+
+TEST_CASE(FrameArenaStatsTrackReservedBytes)
+{
+    FrameArena& arena = FrameArena::Get();
+
+    const FrameArenaStats before = arena.GetStats();
+
+    // 기본 블록보다 큰 할당은 새 블록을 만들고, 예약량이 그만큼 늘어남
+    arena.BeginFrame();
+    constexpr std::size_t LargeSize = 1024 * 1024;
+    void* data = arena.Allocate(LargeSize, 16);
+
+    const FrameArenaStats after = arena.GetStats();
+
+    CHECK(data != nullptr);
+    CHECK(reinterpret_cast<std::uintptr_t>(data) % 16 == 0);
+    CHECK(after.blockAllocationCount > before.blockAllocationCount);
+    CHECK(after.reservedBytes >= before.reservedBytes + LargeSize);
+
+    // 두 프레임 뒤에 그 버퍼를 리셋하면서 블록을 합쳐도 예약량은 줄지 않음
+    arena.BeginFrame();
+    arena.BeginFrame();
+
+    const FrameArenaStats merged = arena.GetStats();
+
+    CHECK(merged.reservedBytes == after.reservedBytes);
+    CHECK(merged.usedBytes >= LargeSize);
+    CHECK(merged.peakUsedBytes >= merged.usedBytes);
+}
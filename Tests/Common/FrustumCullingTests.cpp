@@ -0,0 +1,193 @@
+﻿#include "TestFramework.h"
+
+#include <random>
+
+#include "EnginePCH.h"
+#include "Common/Math/DynamicAabbTree.h"
+
+using namespace engine;
+
+namespace
+{
+    struct CullResult
+    {
+        std::uint32_t tested = 0; // 트리 쿼리가 넘긴 리프 (fat AABB가 frustum과 겹침)
+        std::vector<const DirectX::BoundingBox*> visible; // 실제 AABB까지 통과
+    };
+
+    // RenderSystem::CullRenderersInTree와 같은 순서: 트리 쿼리 -> 실제 AABB로 다시 검사
+    CullResult CullInTree(DynamicAabbTree& tree, const DirectX::BoundingFrustum& frustum)
+    {
+        CullResult result;
+        tree.QueryFrustum(frustum, [&](void* userData)
+            {
+                const auto* box = static_cast<const DirectX::BoundingBox*>(userData);
+
+                ++result.tested;
+                if (frustum.Intersects(*box))
+                {
+                    result.visible.push_back(box);
+                }
+
+                return true;
+            });
+
+        return result;
+    }
+
+    std::size_t CullLinear(const std::vector<DirectX::BoundingBox>& boxes, const DirectX::BoundingFrustum& frustum)
+    {
+        return std::count_if(boxes.begin(), boxes.end(), [&frustum](const DirectX::BoundingBox& box)
+            {
+                return frustum.Intersects(box);
+            });
+    }
+
+    // RenderSystem::Render와 같은 방법으로 월드 공간 카메라 frustum을 만듦
+    DirectX::BoundingFrustum MakeCameraFrustum(const Matrix& view)
+    {
+        const Matrix projection = DirectX::XMMatrixPerspectiveFovLH(ToRadian(60.0f), 1.0f, 0.1f, 100.0f);
+
+        DirectX::BoundingFrustum frustum(projection);
+        frustum.Transform(frustum, view.Invert());
+
+        return frustum;
+    }
+
+    bool Contains(const std::vector<const DirectX::BoundingBox*>& boxes, const DirectX::BoundingBox& box)
+    {
+        return std::find(boxes.begin(), boxes.end(), &box) != boxes.end();
+    }
+}
+
+// 원점에서 +Z를 보는 카메라: 앞 / 가장자리에 걸친 것만 통과하고 뒤 / far 너머 / 옆은 컬링
+TEST_CASE(CameraFrustumPassAndCullCounts)
+{
+    const DirectX::BoundingFrustum frustum = MakeCameraFrustum(Matrix::Identity);
+    const Vector3 extents{ 0.5f, 0.5f, 0.5f };
+
+    // z = 10에서 frustum 반폭은 tan(30) * 10 = 5.77
+    const std::vector<DirectX::BoundingBox> boxes
+    {
+        { Vector3{ 0.0f, 0.0f, 10.0f }, extents },
+        { Vector3{ 2.0f, 1.0f, 20.0f }, extents },
+        { Vector3{ -3.0f, 0.0f, 50.0f }, extents },
+        { Vector3{ 5.77f, 0.0f, 10.0f }, extents }, // 오른쪽 평면에 걸침
+        { Vector3{ 0.0f, 0.0f, -10.0f }, extents }, // 뒤
+        { Vector3{ 0.0f, 0.0f, 150.0f }, extents }, // far 너머
+        { Vector3{ -50.0f, 0.0f, 10.0f }, extents }, // 왼쪽
+        { Vector3{ 0.0f, 50.0f, 10.0f }, extents }, // 위
+    };
+    constexpr std::size_t visibleCount = 4;
+
+    DynamicAabbTree tree;
+    for (const auto& box : boxes)
+    {
+        tree.CreateProxy(box, const_cast<DirectX::BoundingBox*>(&box));
+    }
+
+    const CullResult result = CullInTree(tree, frustum);
+
+    CHECK(CullLinear(boxes, frustum) == visibleCount);
+    CHECK(result.visible.size() == visibleCount);
+    CHECK(result.tested >= visibleCount);
+    CHECK(result.tested < boxes.size());
+
+    for (std::size_t i = 0; i < boxes.size(); ++i)
+    {
+        CHECK(Contains(result.visible, boxes[i]) == (i < visibleCount));
+    }
+}
+
+// fat AABB만 frustum에 걸친 리프는 트리 쿼리에는 나오지만 실제 AABB 검사에서 빠져야 함
+TEST_CASE(FatBoundsAreRecheckedAgainstActualBounds)
+{
+    const DirectX::BoundingFrustum frustum = MakeCameraFrustum(Matrix::Identity);
+
+    // 오른쪽 끝이 -6.5로 z = 10.5의 평면 (-6.06)보다 바깥, 여유분 1을 붙이면 안쪽
+    const DirectX::BoundingBox nearMiss{ Vector3{ -7.0f, 0.0f, 10.0f }, Vector3{ 0.5f, 0.5f, 0.5f } };
+    CHECK(!frustum.Intersects(nearMiss));
+
+    DynamicAabbTree tree;
+    tree.SetMargin(1.0f);
+    tree.CreateProxy(nearMiss, const_cast<DirectX::BoundingBox*>(&nearMiss));
+
+    const CullResult result = CullInTree(tree, frustum);
+
+    CHECK(result.tested == 1);
+    CHECK(result.visible.empty());
+}
+
+// 움직인 렌더러: fat AABB를 벗어나면 다시 삽입되고, 그 안에서 움직이면 트리는 그대로지만 결과는 실제 AABB를 따름
+TEST_CASE(MovedBoundsUpdateCullingResult)
+{
+    const DirectX::BoundingFrustum frustum = MakeCameraFrustum(Matrix::Identity);
+
+    DirectX::BoundingBox box{ Vector3{ 0.0f, 0.0f, 10.0f }, Vector3{ 0.5f, 0.5f, 0.5f } };
+
+    DynamicAabbTree tree;
+    tree.SetMargin(1.0f);
+    const std::int32_t proxy = tree.CreateProxy(box, &box);
+
+    CHECK(CullInTree(tree, frustum).visible.size() == 1);
+
+    // 카메라 뒤로
+    box.Center = Vector3{ 0.0f, 0.0f, -10.0f };
+    CHECK(tree.MoveProxy(proxy, box));
+    CHECK(CullInTree(tree, frustum).visible.empty());
+    CHECK(CullInTree(tree, frustum).tested == 0);
+
+    // near 평면 (0.1) 바로 앞까지, 여유분 안이라 트리는 그대로
+    box.Center = Vector3{ 0.0f, 0.0f, -0.5f };
+    const bool isReinserted = tree.MoveProxy(proxy, box);
+    box.Center = Vector3{ 0.0f, 0.0f, -0.3f };
+    CHECK(isReinserted);
+    CHECK(!tree.MoveProxy(proxy, box));
+    CHECK(CullInTree(tree, frustum).visible.size() == 1);
+}
+
+// 무작위 배치 / 무작위 카메라에서 트리 + 재검사 결과가 선형 검사와 같아야 함 (통과 / 컬링 수가 모두 같음)
+TEST_CASE(TreeCullingMatchesLinearCulling)
+{
+    constexpr std::size_t objectCount = 10000;
+    constexpr int cameraCount = 32;
+    constexpr float worldHalfSize = 200.0f;
+
+    std::mt19937 random{ 1 };
+    std::uniform_real_distribution<float> positionDist(-worldHalfSize, worldHalfSize);
+    std::uniform_real_distribution<float> extentDist(0.5f, 3.0f);
+    std::uniform_real_distribution<float> angleDist(0.0f, DirectX::XM_2PI);
+
+    std::vector<DirectX::BoundingBox> boxes(objectCount);
+    for (auto& box : boxes)
+    {
+        box.Center = Vector3{ positionDist(random), positionDist(random), positionDist(random) };
+        box.Extents = Vector3{ extentDist(random), extentDist(random), extentDist(random) };
+    }
+
+    DynamicAabbTree tree;
+    for (auto& box : boxes)
+    {
+        tree.CreateProxy(box, &box);
+    }
+
+    std::size_t totalVisible = 0;
+    for (int i = 0; i < cameraCount; ++i)
+    {
+        const Matrix world = Matrix::CreateFromYawPitchRoll(angleDist(random), angleDist(random), 0.0f) *
+            Matrix::CreateTranslation(positionDist(random), positionDist(random), positionDist(random));
+        const DirectX::BoundingFrustum frustum = MakeCameraFrustum(world.Invert());
+
+        const CullResult result = CullInTree(tree, frustum);
+        const std::size_t linearVisible = CullLinear(boxes, frustum);
+
+        CHECK(result.visible.size() == linearVisible);
+        CHECK(result.tested < objectCount);
+
+        totalVisible += linearVisible;
+    }
+
+    // 카메라마다 일부만 보여야 의미 있는 검사
+    CHECK(totalVisible > 0);
+    CHECK(totalVisible < objectCount * cameraCount / 2);
+}
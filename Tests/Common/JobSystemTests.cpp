@@ -0,0 +1,350 @@
+﻿#include "TestFramework.h"
+#include "JobSystemFixture.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Common/Utility/JobSystem.h"
+
+using namespace engine;
+using namespace engine::test;
+
+TEST_CASE(ParallelForVisitsEveryIndexOnce)
+{
+    ScopedJobSystem scope;
+    JobSystem& jobSystem = JobSystem::Get();
+
+    CHECK(jobSystem.GetWorkerCount() == WorkerCount);
+
+    // 나누어떨어지지 않는 개수 / grain보다 작은 개수 / grain 1 / 0개
+    const std::uint32_t counts[] = { 10007, 5, 64, 0 };
+    const std::uint32_t grainSizes[] = { 128, 64, 1, 16 };
+
+    for (std::size_t c = 0; c < std::size(counts); ++c)
+    {
+        const std::uint32_t count = counts[c];
+        std::vector<std::atomic<std::uint32_t>> visits(count);
+
+        jobSystem.ParallelFor(count, grainSizes[c], [&visits](std::uint32_t begin, std::uint32_t end)
+            {
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    visits[i].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+
+        bool isEachOnce = true;
+        for (const auto& visit : visits)
+        {
+            isEachOnce = isEachOnce && visit.load() == 1;
+        }
+        CHECK(isEachOnce);
+    }
+}
+
+TEST_CASE(ParallelForUsesWorkers)
+{
+    ScopedJobSystem scope;
+
+    std::mutex mutex;
+    std::vector<std::thread::id> threadIds;
+
+    // 구간마다 잠깐 멈춰서 워커가 훔쳐갈 시간을 줌
+    JobSystem::Get().ParallelFor(64, 1, [&](std::uint32_t, std::uint32_t)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            std::lock_guard lock(mutex);
+            if (std::find(threadIds.begin(), threadIds.end(), std::this_thread::get_id()) == threadIds.end())
+            {
+                threadIds.push_back(std::this_thread::get_id());
+            }
+        });
+
+    CHECK(threadIds.size() > 1);
+}
+
+TEST_CASE(RunAfterWaitsForDependency)
+{
+    ScopedJobSystem scope;
+    JobSystem& jobSystem = JobSystem::Get();
+
+    std::atomic<std::uint32_t> finishedCount{ 0 };
+    std::atomic<std::uint32_t> countSeenByContinuation{ 0 };
+
+    JobCounter dependency;
+    JobCounter done;
+
+    for (int i = 0; i < 32; ++i)
+    {
+        jobSystem.Run([&finishedCount]()
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                finishedCount.fetch_add(1);
+            },
+            &dependency);
+    }
+
+    jobSystem.RunAfter(dependency, [&]()
+        {
+            countSeenByContinuation = finishedCount.load();
+        },
+        &done);
+
+    jobSystem.Wait(done);
+
+    CHECK(dependency.IsDone());
+    CHECK(countSeenByContinuation.load() == 32);
+}
+
+TEST_CASE(RunAfterChainsInOrder)
+{
+    ScopedJobSystem scope;
+    JobSystem& jobSystem = JobSystem::Get();
+
+    constexpr int StageCount = 8;
+
+    std::mutex mutex;
+    std::vector<int> order;
+
+    JobCounter stages[StageCount];
+
+    // 첫 단계가 끝나기 전에 뒤 단계를 모두 걸어둠 (RunAfter가 다음 단계 카운터를 바로 늘리므로 사슬이 됨)
+    jobSystem.Run([&]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+            std::lock_guard lock(mutex);
+            order.push_back(0);
+        },
+        &stages[0]);
+
+    for (int i = 1; i < StageCount; ++i)
+    {
+        jobSystem.RunAfter(stages[i - 1], [&, i]()
+            {
+                std::lock_guard lock(mutex);
+                order.push_back(i);
+            },
+            &stages[i]);
+    }
+
+    jobSystem.Wait(stages[StageCount - 1]);
+
+    CHECK(order.size() == StageCount);
+    for (int i = 0; i < static_cast<int>(order.size()); ++i)
+    {
+        CHECK(order[i] == i);
+    }
+}
+
+TEST_CASE(RunAfterCompletedDependencyRunsImmediately)
+{
+    ScopedJobSystem scope;
+    JobSystem& jobSystem = JobSystem::Get();
+
+    JobCounter finished; // 아무것도 걸지 않았으므로 이미 0
+    JobCounter done;
+    std::atomic<bool> hasRun{ false };
+
+    jobSystem.RunAfter(finished, [&hasRun]() { hasRun = true; }, &done);
+    jobSystem.Wait(done);
+
+    CHECK(hasRun.load());
+}
+
+TEST_CASE(NestedWaitDoesNotDeadlock)
+{
+    ScopedJobSystem scope;
+    JobSystem& jobSystem = JobSystem::Get();
+
+    constexpr std::uint32_t OuterCount = 16;
+    constexpr std::uint32_t InnerCount = 16;
+
+    std::atomic<std::uint32_t> innerCount{ 0 };
+    JobCounter outer;
+
+    // 워커 수보다 많은 잡이 모두 안에서 Wait해도 기다리는 스레드가 다른 잡을 실행하므로 끝나야 함
+    for (std::uint32_t i = 0; i < OuterCount; ++i)
+    {
+        jobSystem.Run([&jobSystem, &innerCount]()
+            {
+                JobCounter inner;
+                for (std::uint32_t j = 0; j < InnerCount; ++j)
+                {
+                    jobSystem.Run([&innerCount]() { innerCount.fetch_add(1); }, &inner);
+                }
+
+                jobSystem.Wait(inner);
+                CHECK(inner.IsDone());
+            },
+            &outer);
+    }
+
+    jobSystem.Wait(outer);
+
+    CHECK(innerCount.load() == OuterCount * InnerCount);
+}
+
+TEST_CASE(NestedParallelFor)
+{
+    ScopedJobSystem scope;
+    JobSystem& jobSystem = JobSystem::Get();
+
+    std::atomic<std::uint32_t> total{ 0 };
+
+    jobSystem.ParallelFor(8, 1, [&](std::uint32_t, std::uint32_t)
+        {
+            jobSystem.ParallelFor(100, 10, [&total](std::uint32_t begin, std::uint32_t end)
+                {
+                    total.fetch_add(end - begin);
+                });
+        });
+
+    CHECK(total.load() == 800);
+}
+
+TEST_CASE(MainThreadJobsRunOnMainThread)
+{
+    ScopedJobSystem scope;
+    JobSystem& jobSystem = JobSystem::Get();
+
+    const std::thread::id mainThreadId = std::this_thread::get_id();
+    CHECK(jobSystem.IsMainThread());
+
+    constexpr std::uint32_t JobCount = 32;
+
+    std::atomic<std::uint32_t> runCount{ 0 };
+    std::atomic<std::uint32_t> offMainThreadCount{ 0 };
+
+    // 다른 스레드에서 메인 스레드 잡을 넣음 (Wait 중인 메인 스레드가 가져가서 실행할 수도 있음)
+    JobCounter queued;
+    for (std::uint32_t i = 0; i < JobCount; ++i)
+    {
+        jobSystem.Run([&]()
+            {
+                jobSystem.RunOnMainThread([&]()
+                    {
+                        if (std::this_thread::get_id() != mainThreadId)
+                        {
+                            offMainThreadCount.fetch_add(1);
+                        }
+                        runCount.fetch_add(1);
+                    });
+            },
+            &queued);
+    }
+
+    // 넣는 잡만 기다렸으므로 남은 메인 스레드 잡은 ExecuteMainThreadJobs에서 실행됨
+    jobSystem.Wait(queued);
+    jobSystem.ExecuteMainThreadJobs();
+
+    CHECK(runCount.load() == JobCount);
+    CHECK(offMainThreadCount.load() == 0);
+}
+
+TEST_CASE(MainThreadWaitRunsMainThreadJobs)
+{
+    ScopedJobSystem scope;
+    JobSystem& jobSystem = JobSystem::Get();
+
+    const std::thread::id mainThreadId = std::this_thread::get_id();
+
+    std::atomic<bool> ranOnMainThread{ false };
+    JobCounter done;
+
+    // 다른 잡이 넣은 메인 스레드 잡의 카운터를 메인 스레드가 Wait하면 Wait 안에서 실행됨
+    JobCounter queued;
+    jobSystem.Run([&]()
+        {
+            jobSystem.RunOnMainThread([&]()
+                {
+                    ranOnMainThread = std::this_thread::get_id() == mainThreadId;
+                },
+                &done);
+        },
+        &queued);
+
+    jobSystem.Wait(queued);
+    jobSystem.Wait(done);
+
+    CHECK(ranOnMainThread.load());
+}
+
+// 백그라운드 잡 (에셋 임포트)은 메인 스레드의 Wait / ParallelFor가 대신 실행하지 않고 워커만 실행
+TEST_CASE(BackgroundJobsNeverRunOnMainThread)
+{
+    ScopedJobSystem scope;
+    JobSystem& jobSystem = JobSystem::Get();
+
+    constexpr std::uint32_t BackgroundCount = 8;
+
+    const std::thread::id mainThreadId = std::this_thread::get_id();
+    std::atomic<std::uint32_t> mainThreadRunCount{ 0 };
+    std::atomic<std::uint32_t> finishedCount{ 0 };
+
+    // 워커를 모두 붙잡아 두어서 로드가 큐에 남아 있는 동안 메인 스레드가 기다리게 함
+    std::atomic<std::uint32_t> blockedCount{ 0 };
+    std::atomic<bool> isGateOpen{ false };
+    JobCounter blockers;
+    for (std::uint32_t i = 0; i < WorkerCount; ++i)
+    {
+        jobSystem.Run([&]()
+            {
+                blockedCount.fetch_add(1);
+                while (!isGateOpen.load())
+                {
+                    std::this_thread::yield();
+                }
+            },
+            &blockers);
+    }
+    while (blockedCount.load() < WorkerCount)
+    {
+        std::this_thread::yield();
+    }
+
+    JobCounter loads;
+    for (std::uint32_t i = 0; i < BackgroundCount; ++i)
+    {
+        jobSystem.RunInBackground([&]()
+            {
+                if (std::this_thread::get_id() == mainThreadId)
+                {
+                    mainThreadRunCount.fetch_add(1);
+                }
+                finishedCount.fetch_add(1);
+            },
+            &loads);
+    }
+
+    // 프레임 잡을 기다리는 동안 메인 스레드는 빈 시간이 있어도 로드를 집어 가면 안 됨
+    for (int frame = 0; frame < 4; ++frame)
+    {
+        std::atomic<std::uint32_t> visitCount{ 0 };
+        jobSystem.ParallelFor(256, 16, [&visitCount](std::uint32_t begin, std::uint32_t end)
+            {
+                visitCount.fetch_add(end - begin);
+            });
+        CHECK(visitCount.load() == 256);
+
+        JobCounter frameJobs;
+        jobSystem.Run([]()
+            {
+            },
+            &frameJobs);
+        jobSystem.Wait(frameJobs);
+    }
+
+    CHECK(finishedCount.load() == 0);
+
+    // 워커가 풀리면 로드를 끝냄 (메인 스레드가 직접 기다려도 실행은 워커가)
+    isGateOpen = true;
+    jobSystem.Wait(blockers);
+    jobSystem.Wait(loads);
+
+    CHECK(finishedCount.load() == BackgroundCount);
+    CHECK(mainThreadRunCount.load() == 0);
+}
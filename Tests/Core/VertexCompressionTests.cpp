@@ -0,0 +1,235 @@
+﻿#include "TestFramework.h"
+
+#include <random>
+
+#include "EnginePCH.h"
+#include "Core/Graphics/Data/VertexCompression.h"
+
+using namespace engine;
+
+namespace
+{
+    constexpr std::size_t VertexCount = 4096;
+
+    // 16비트 SNORM 8면체 노멀 / 10비트 UNORM 8면체 탄젠트의 최대 각도 오차 (라디안)
+    // (양자화 간격 절반이 8면체 접힘에 따라 늘어난 값, 실측 약 0.00006 / 0.0076)
+    constexpr float NormalAngleTolerance = 0.0001f;
+    constexpr float TangentAngleTolerance = 0.01f;
+
+    Vector3 MakeDirection(std::mt19937& random)
+    {
+        std::normal_distribution<float> dist(0.0f, 1.0f);
+
+        Vector3 direction;
+        do
+        {
+            direction = Vector3{ dist(random), dist(random), dist(random) };
+        } while (direction.LengthSquared() < 1e-6f);
+
+        direction.Normalize();
+        return direction;
+    }
+
+    // acos는 1 근처에서 float 오차가 커서 작은 각도를 잴 수 없으므로 atan2 사용
+    float GetAngle(const Vector3& a, const Vector3& b)
+    {
+        return std::atan2(a.Cross(b).Length(), a.Dot(b));
+    }
+
+    // 무작위 위치 / UV와 서로 수직인 normal / tangent, 면마다 다른 binormal 부호
+    template <typename TVertex>
+    TVertex MakeVertex(std::mt19937& random)
+    {
+        std::uniform_real_distribution<float> positionDist(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> texCoordDist(-4.0f, 4.0f);
+
+        TVertex vertex;
+        vertex.position = Vector3{ positionDist(random), positionDist(random), positionDist(random) };
+        vertex.texCoord = Vector2{ texCoordDist(random), texCoordDist(random) };
+        vertex.normal = MakeDirection(random);
+
+        Vector3 tangent;
+        do
+        {
+            const Vector3 direction = MakeDirection(random);
+            tangent = direction - vertex.normal * direction.Dot(vertex.normal);
+        } while (tangent.LengthSquared() < 1e-4f);
+
+        tangent.Normalize();
+        vertex.tangent = tangent;
+
+        const float sign = random() % 2 == 0 ? 1.0f : -1.0f;
+        vertex.binormal = vertex.normal.Cross(vertex.tangent) * sign;
+
+        return vertex;
+    }
+
+    struct SurfaceError
+    {
+        float position = 0.0f;
+        float texCoord = 0.0f; // 1보다 크면 상대 오차
+        float normalAngle = 0.0f;
+        float tangentAngle = 0.0f;
+        float binormalAngle = 0.0f;
+    };
+
+    template <typename TVertex>
+    void AccumulateError(const TVertex& original, const TVertex& decoded, SurfaceError& error)
+    {
+        error.position = std::max(error.position, (decoded.position - original.position).Length());
+
+        for (const auto& [before, after] : { std::pair{ original.texCoord.x, decoded.texCoord.x }, std::pair{ original.texCoord.y, decoded.texCoord.y } })
+        {
+            error.texCoord = std::max(error.texCoord, std::abs(after - before) / std::max(1.0f, std::abs(before)));
+        }
+
+        error.normalAngle = std::max(error.normalAngle, GetAngle(original.normal, decoded.normal));
+        error.tangentAngle = std::max(error.tangentAngle, GetAngle(original.tangent, decoded.tangent));
+        error.binormalAngle = std::max(error.binormalAngle, GetAngle(original.binormal, decoded.binormal));
+    }
+}
+
+// 축 방향 / 아래 반구 / 접는 경계 / 길이 0 입력
+TEST_CASE(OctahedralRoundTripKeepsDirection)
+{
+    const Vector3 directions[] = {
+        Vector3::UnitX, -Vector3::UnitX, Vector3::UnitY, -Vector3::UnitY, Vector3::UnitZ, -Vector3::UnitZ,
+        Vector3{ 1.0f, 1.0f, 1.0f }, Vector3{ -1.0f, 1.0f, -1.0f }, Vector3{ 1.0f, -1.0f, -1.0f }, Vector3{ -1.0f, -1.0f, -0.001f } };
+
+    float maxAngle = 0.0f;
+    bool isInRange = true;
+    for (Vector3 direction : directions)
+    {
+        direction.Normalize();
+
+        const Vector2 encoded = EncodeOctahedral(direction);
+        isInRange = isInRange && std::abs(encoded.x) <= 1.0f && std::abs(encoded.y) <= 1.0f;
+
+        maxAngle = std::max(maxAngle, GetAngle(direction, DecodeOctahedral(encoded)));
+    }
+
+    CHECK(isInRange);
+    CHECK(maxAngle < 1e-5f);
+
+    const Vector3 zero = DecodeOctahedral(EncodeOctahedral(Vector3::Zero));
+    CHECK(GetAngle(zero, Vector3::UnitZ) < 1e-6f);
+}
+
+// CommonVertex -> CompactVertex -> CommonVertex
+TEST_CASE(CompactVertexRoundTripStaysWithinBounds)
+{
+    std::mt19937 random{ 20 };
+
+    std::vector<CommonVertex> vertices;
+    for (std::size_t i = 0; i < VertexCount; ++i)
+    {
+        vertices.push_back(MakeVertex<CommonVertex>(random));
+    }
+
+    const std::vector<CompactVertex> compact = EncodeCompactVertices(vertices);
+    CHECK(compact.size() == vertices.size());
+
+    SurfaceError error;
+    bool isSignKept = true;
+    bool isUnitLength = true;
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+        const CommonVertex decoded = DecodeCompactVertex(compact[i]);
+        AccumulateError(vertices[i], decoded, error);
+
+        // binormal 부호(UV가 뒤집힌 면)가 유지되어야 노멀 맵이 뒤집히지 않음
+        isSignKept = isSignKept && decoded.binormal.Dot(vertices[i].binormal) > 0.0f;
+        isUnitLength = isUnitLength
+            && std::abs(decoded.normal.Length() - 1.0f) < 1e-4f
+            && std::abs(decoded.tangent.Length() - 1.0f) < 1e-4f
+            && std::abs(decoded.binormal.Length() - 1.0f) < 1e-4f;
+    }
+
+    CHECK(error.position == 0.0f);
+    CHECK(error.texCoord <= 1.0f / 2048.0f); // half의 가수 10비트 반올림
+    CHECK(error.normalAngle < NormalAngleTolerance);
+    CHECK(error.tangentAngle < TangentAngleTolerance);
+    CHECK(error.binormalAngle < NormalAngleTolerance + TangentAngleTolerance);
+    CHECK(isSignKept);
+    CHECK(isUnitLength);
+}
+
+// BoneWeightVertex -> CompactBoneWeightVertex -> BoneWeightVertex
+// 본 번호는 그대로, 가중치는 합이 정확히 1이고 가중치마다 2/255 이내
+TEST_CASE(CompactBoneWeightVertexKeepsBonesAndWeights)
+{
+    std::mt19937 random{ 21 };
+    std::uniform_real_distribution<float> weightDist(0.0f, 1.0f);
+
+    std::vector<BoneWeightVertex> vertices;
+    for (std::size_t i = 0; i < VertexCount; ++i)
+    {
+        BoneWeightVertex vertex = MakeVertex<BoneWeightVertex>(random);
+
+        // 영향 본 수 1 ~ 4개
+        const std::size_t influenceCount = 1 + random() % 4;
+        float sum = 0.0f;
+        for (std::size_t k = 0; k < influenceCount; ++k)
+        {
+            vertex.blendIndices[k] = static_cast<unsigned int>(random() % 128);
+            vertex.blendWeights[k] = weightDist(random) + 0.01f;
+            sum += vertex.blendWeights[k];
+        }
+        for (std::size_t k = 0; k < influenceCount; ++k)
+        {
+            vertex.blendWeights[k] /= sum;
+        }
+
+        vertices.push_back(vertex);
+    }
+
+    const std::vector<CompactBoneWeightVertex> compact = EncodeCompactVertices(vertices);
+    CHECK(compact.size() == vertices.size());
+
+    SurfaceError error;
+    bool isBoneKept = true;
+    bool isSumOne = true;
+    float maxWeightError = 0.0f;
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+        const BoneWeightVertex decoded = DecodeCompactVertex(compact[i]);
+        AccumulateError(vertices[i], decoded, error);
+
+        float sum = 0.0f;
+        for (int k = 0; k < 4; ++k)
+        {
+            isBoneKept = isBoneKept && decoded.blendIndices[k] == vertices[i].blendIndices[k];
+            maxWeightError = std::max(maxWeightError, std::abs(decoded.blendWeights[k] - vertices[i].blendWeights[k]));
+            sum += decoded.blendWeights[k];
+        }
+        isSumOne = isSumOne && std::abs(sum - 1.0f) < 1e-5f;
+    }
+
+    CHECK(error.position == 0.0f);
+    CHECK(error.normalAngle < NormalAngleTolerance);
+    CHECK(error.tangentAngle < TangentAngleTolerance);
+    CHECK(isBoneKept);
+    CHECK(isSumOne);
+    CHECK(maxWeightError <= 2.0f / 255.0f + 1e-6f);
+}
+
+// 0xFFFF는 strip cut 값이므로 0xFFFE까지만 16비트로 변환
+TEST_CASE(ShortIndicesOnlyWhenEveryIndexFits)
+{
+    const std::vector<DWORD> small{ 0, 1, 2, 2, 1, 0xFFFE };
+    std::vector<WORD> converted{ 7 };
+
+    CHECK(TryConvertToShortIndices(small, converted));
+    CHECK((converted == std::vector<WORD>{ 0, 1, 2, 2, 1, 0xFFFE }));
+
+    const std::vector<DWORD> cut{ 0, 1, 0xFFFF };
+    CHECK(!TryConvertToShortIndices(cut, converted));
+    CHECK(converted.empty());
+
+    const std::vector<DWORD> large{ 0, 70000, 2 };
+    CHECK(!TryConvertToShortIndices(large, converted));
+    CHECK(converted.empty());
+
+    CHECK(TryConvertToShortIndices(std::span<const DWORD>{}, converted));
+    CHECK(converted.empty());
+}
@@ -0,0 +1,334 @@
+﻿#include "TestFramework.h"
+#include "JobSystemFixture.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EnginePCH.h"
+#include "Framework/Asset/PendingFbxLoads.h"
+#include "Framework/Asset/StaticMeshData.h"
+#include "Framework/Asset/MaterialData.h"
+#include "Framework/Asset/SkeletalMeshData.h"
+
+using namespace engine;
+using namespace engine::test;
+
+namespace
+{
+    // FBXAssetData 대신 워커에서 채워지는 가짜 (파일을 읽지 않고 종류에 맞는 빈 데이터를 만듦)
+    class TestFbx
+    {
+    public:
+        static inline std::atomic<std::int32_t> createCount{ 0 };
+        static inline std::atomic<std::int32_t> skeletalCreateCount{ 0 };
+        static inline std::atomic<bool> isGateOpen{ true }; // 닫혀 있으면 워커가 임포트를 끝내지 않고 기다림
+
+    private:
+        std::shared_ptr<StaticMeshData> m_staticMesh;
+        std::shared_ptr<MaterialData> m_material;
+        std::shared_ptr<SkeletalMeshData> m_skeletalMesh;
+
+    public:
+        static void Reset()
+        {
+            createCount = 0;
+            skeletalCreateCount = 0;
+            isGateOpen = true;
+        }
+
+        void Create(FBXAssetKind kind, const std::string&)
+        {
+            while (!isGateOpen.load())
+            {
+                std::this_thread::yield();
+            }
+
+            if (kind == FBXAssetKind::Skeletal)
+            {
+                m_skeletalMesh = std::make_shared<SkeletalMeshData>();
+                skeletalCreateCount.fetch_add(1);
+            }
+            else
+            {
+                m_staticMesh = std::make_shared<StaticMeshData>();
+                m_material = std::make_shared<MaterialData>();
+            }
+
+            createCount.fetch_add(1);
+        }
+
+        std::shared_ptr<StaticMeshData> GetStaticMeshData() const
+        {
+            return m_staticMesh;
+        }
+
+        std::shared_ptr<MaterialData> GetMaterialData() const
+        {
+            return m_material;
+        }
+
+        std::shared_ptr<SkeletalMeshData> GetSkeletalMeshData() const
+        {
+            return m_skeletalMesh;
+        }
+
+        std::shared_ptr<SkeletonData> GetSkeletonData() const
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<AnimationData> GetAnimationData() const
+        {
+            return nullptr;
+        }
+    };
+
+    using TestLoads = PendingFbxLoads<TestFbx>;
+
+    // AssetManager::PublishCompletedLoads와 같은 순서 (목록에서 먼저 빼고 알림)
+    void PublishCompleted(TestLoads& loads)
+    {
+        std::vector<std::shared_ptr<TestLoads::Load>> completed;
+        loads.TakeCompleted(completed);
+
+        for (const auto& load : completed)
+        {
+            TestLoads::Complete(*load);
+        }
+    }
+
+    void PublishAll(TestLoads& loads)
+    {
+        while (!loads.IsEmpty())
+        {
+            PublishCompleted(loads);
+            std::this_thread::yield();
+        }
+    }
+
+    AssetRequest<StaticMeshData> RequestStaticMesh(TestLoads& loads, const std::string& filePath, LifeScope scope = LifeScope::Owning)
+    {
+        return TestLoads::Join<StaticMeshData>(loads.GetOrStart(FBXAssetKind::Static, filePath, scope).staticMesh);
+    }
+}
+
+// 같은 파일을 여러 번 요청해도 임포트는 한 번이고, 모든 요청이 같은 데이터를 받음
+TEST_CASE(DuplicateRequestsJoinOneImport)
+{
+    ScopedJobSystem scope;
+    TestFbx::Reset();
+    TestFbx::isGateOpen = false;
+
+    TestLoads loads;
+
+    constexpr std::int32_t RequestCount = 8;
+
+    std::vector<AssetRequest<StaticMeshData>> requests;
+    std::int32_t callbackCount = 0;
+    for (std::int32_t i = 0; i < RequestCount; ++i)
+    {
+        requests.push_back(RequestStaticMesh(loads, "Assets/Models/Robot.fbx"));
+        requests.back().Then([&callbackCount](const std::shared_ptr<StaticMeshData>&)
+            {
+                ++callbackCount;
+            });
+    }
+    TestLoads::Load& load = loads.GetOrStart(FBXAssetKind::Static, "Assets/Models/Robot.fbx", LifeScope::Owning);
+    AssetRequest<MaterialData> material = TestLoads::Join<MaterialData>(load.material);
+    AssetRequest<StaticMeshData> other = RequestStaticMesh(loads, "Assets/Models/Tree.fbx");
+
+    // 요청한 종류의 상태만 만들어짐
+    CHECK(load.staticMesh != nullptr && load.material != nullptr);
+    CHECK(load.skeletalMesh == nullptr && load.skeleton == nullptr && load.animation == nullptr);
+
+    bool isAnyReady = other.IsReady() || material.IsReady();
+    for (const auto& request : requests)
+    {
+        isAnyReady = isAnyReady || request.IsReady();
+    }
+    CHECK(!isAnyReady);
+    CHECK(callbackCount == 0);
+
+    TestFbx::isGateOpen = true;
+    PublishAll(loads);
+
+    CHECK(TestFbx::createCount.load() == 2);
+    CHECK(callbackCount == RequestCount);
+
+    const std::shared_ptr<StaticMeshData> data = requests.front().Get();
+    CHECK(data != nullptr);
+
+    bool isShared = true;
+    for (const auto& request : requests)
+    {
+        isShared = isShared && request.IsReady() && request.Get() == data;
+    }
+    CHECK(isShared);
+    CHECK(material.IsReady() && material.Get() != nullptr);
+    CHECK(other.IsReady() && other.Get() != nullptr && other.Get() != data);
+}
+
+// 같은 파일이라도 종류 (Static / Skeletal / CompactStatic)가 다르면 따로 임포트됨
+TEST_CASE(EachKindLoadsSeparately)
+{
+    ScopedJobSystem scope;
+    TestFbx::Reset();
+    TestFbx::isGateOpen = false;
+
+    TestLoads loads;
+
+    TestLoads::Load& staticLoad = loads.GetOrStart(FBXAssetKind::Static, "Assets/Models/Robot.fbx", LifeScope::Owning);
+    TestLoads::Load& skeletalLoad = loads.GetOrStart(FBXAssetKind::Skeletal, "Assets/Models/Robot.fbx", LifeScope::Owning);
+    TestLoads::Load& compactLoad = loads.GetOrStart(FBXAssetKind::CompactStatic, "Assets/Models/Robot.fbx", LifeScope::Owning);
+
+    CHECK(&staticLoad != &skeletalLoad && &staticLoad != &compactLoad && &skeletalLoad != &compactLoad);
+    CHECK(staticLoad.kind == FBXAssetKind::Static);
+    CHECK(skeletalLoad.kind == FBXAssetKind::Skeletal);
+    CHECK(compactLoad.kind == FBXAssetKind::CompactStatic);
+    CHECK(&loads.GetOrStart(FBXAssetKind::Skeletal, "Assets/Models/Robot.fbx", LifeScope::Owning) == &skeletalLoad);
+
+    AssetRequest<StaticMeshData> staticMesh = TestLoads::Join<StaticMeshData>(staticLoad.staticMesh);
+    AssetRequest<SkeletalMeshData> skeletalMesh = TestLoads::Join<SkeletalMeshData>(skeletalLoad.skeletalMesh);
+    AssetRequest<StaticMeshData> compactMesh = TestLoads::Join<StaticMeshData>(compactLoad.staticMesh);
+
+    TestFbx::isGateOpen = true;
+    PublishAll(loads);
+
+    CHECK(TestFbx::createCount.load() == 3);
+    CHECK(TestFbx::skeletalCreateCount.load() == 1);
+    CHECK(staticMesh.IsReady() && staticMesh.Get() != nullptr);
+    CHECK(compactMesh.IsReady() && compactMesh.Get() != nullptr && compactMesh.Get() != staticMesh.Get());
+    CHECK(skeletalMesh.IsReady() && skeletalMesh.Get() != nullptr);
+}
+
+// 진행 중인 로드에 합류하면 수명은 가장 긴 쪽 (Global < Scene < Owning)으로 합쳐지고 줄어들지 않음
+TEST_CASE(JoinedRequestsKeepLongestScope)
+{
+    ScopedJobSystem scope;
+    TestFbx::Reset();
+    TestFbx::isGateOpen = false;
+
+    TestLoads loads;
+
+    TestLoads::Load& load = loads.GetOrStart(FBXAssetKind::Static, "Assets/Models/Robot.fbx", LifeScope::Owning);
+    CHECK(load.scope == LifeScope::Owning);
+
+    loads.GetOrStart(FBXAssetKind::Static, "Assets/Models/Robot.fbx", LifeScope::Scene);
+    CHECK(load.scope == LifeScope::Scene);
+
+    loads.GetOrStart(FBXAssetKind::Static, "Assets/Models/Robot.fbx", LifeScope::Owning);
+    CHECK(load.scope == LifeScope::Scene);
+
+    // 동기 로드로 끝낼 때의 수명도 합쳐짐
+    loads.GetOrStart(FBXAssetKind::Skeletal, "Assets/Models/Robot.fbx", LifeScope::Owning);
+
+    TestFbx::isGateOpen = true;
+    const std::shared_ptr<TestLoads::Load> finished = loads.Finish(FBXAssetKind::Skeletal, "Assets/Models/Robot.fbx", LifeScope::Global);
+    CHECK(finished != nullptr && finished->scope == LifeScope::Global);
+    CHECK(load.scope == LifeScope::Scene);
+
+    PublishAll(loads);
+}
+
+// 비동기 요청이 걸린 파일을 동기로 읽으면 진행 중인 로드를 기다려 넘기고 다시 임포트하지 않음
+TEST_CASE(FinishWaitsForPendingLoad)
+{
+    ScopedJobSystem scope;
+    TestFbx::Reset();
+
+    TestLoads loads;
+
+    AssetRequest<StaticMeshData> request = RequestStaticMesh(loads, "Assets/Models/Robot.fbx");
+    bool isNotified = false;
+    request.Then([&isNotified](const std::shared_ptr<StaticMeshData>&)
+        {
+            isNotified = true;
+        });
+
+    CHECK(loads.Finish(FBXAssetKind::Static, "Assets/Models/Tree.fbx", LifeScope::Owning) == nullptr);
+    CHECK(loads.Finish(FBXAssetKind::Skeletal, "Assets/Models/Robot.fbx", LifeScope::Owning) == nullptr);
+
+    const std::shared_ptr<TestLoads::Load> load = loads.Finish(FBXAssetKind::Static, "Assets/Models/Robot.fbx", LifeScope::Owning);
+    CHECK(load != nullptr && load->counter.IsDone());
+    CHECK(load != nullptr && load->fbx->GetStaticMeshData() != nullptr);
+    CHECK(loads.IsEmpty());
+    CHECK(!isNotified);
+
+    // 캐시에 넣은 뒤 호출한 쪽이 게시
+    TestLoads::Complete(*load);
+    CHECK(isNotified);
+    CHECK(request.IsReady() && request.Get() == load->fbx->GetStaticMeshData());
+    CHECK(TestFbx::createCount.load() == 1);
+
+    // 이미 뺐으므로 다음 프레임의 게시는 아무것도 하지 않음
+    PublishCompleted(loads);
+    CHECK(TestFbx::createCount.load() == 1);
+}
+
+// 게시 중인 콜백에서 새 요청을 걸어도 목록이 깨지지 않음
+TEST_CASE(CallbackCanRequestDuringPublish)
+{
+    ScopedJobSystem scope;
+    TestFbx::Reset();
+
+    TestLoads loads;
+
+    AssetRequest<StaticMeshData> chained;
+    AssetRequest<StaticMeshData> again;
+    AssetRequest<StaticMeshData> first = RequestStaticMesh(loads, "Assets/Models/Robot.fbx");
+    first.Then([&loads, &chained, &again](const std::shared_ptr<StaticMeshData>&)
+        {
+            chained = RequestStaticMesh(loads, "Assets/Models/Robot_Weapon.fbx");
+            again = RequestStaticMesh(loads, "Assets/Models/Robot.fbx");
+        });
+
+    PublishAll(loads);
+
+    CHECK(first.IsReady());
+    CHECK(chained.IsReady() && chained.Get() != nullptr);
+
+    // 게시한 로드는 목록에서 빠졌으므로 새로 임포트됨 (AssetManager에서는 그 전에 캐시가 받음)
+    CHECK(again.IsReady() && again.Get() != nullptr && again.Get() != first.Get());
+    CHECK(TestFbx::createCount.load() == 3);
+}
+
+// 여러 파일을 섞어 요청해도 끝나기 전에는 파일마다 한 번씩만 임포트
+TEST_CASE(ManyPathsImportOncePerPath)
+{
+    ScopedJobSystem scope;
+    TestFbx::Reset();
+    TestFbx::isGateOpen = false;
+
+    TestLoads loads;
+
+    constexpr std::int32_t PathCount = 64;
+    constexpr std::int32_t RequestsPerPath = 4;
+
+    std::vector<std::vector<AssetRequest<StaticMeshData>>> requests(PathCount);
+    for (std::int32_t round = 0; round < RequestsPerPath; ++round)
+    {
+        for (std::int32_t i = 0; i < PathCount; ++i)
+        {
+            requests[i].push_back(RequestStaticMesh(loads, "Assets/Generated/" + std::to_string(i) + ".fbx"));
+        }
+
+        PublishCompleted(loads);
+    }
+
+    TestFbx::isGateOpen = true;
+    PublishAll(loads);
+
+    CHECK(TestFbx::createCount.load() == PathCount);
+
+    bool isShared = true;
+    for (const auto& pathRequests : requests)
+    {
+        for (const auto& request : pathRequests)
+        {
+            isShared = isShared && request.IsReady() && request.Get() != nullptr && request.Get() == pathRequests.front().Get();
+        }
+    }
+    CHECK(isShared);
+}
@@ -0,0 +1,172 @@
+﻿#include "TestFramework.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
+
+#include "EnginePCH.h"
+#include "Framework/Object/Object.h"
+
+using namespace engine;
+
+namespace
+{
+    class TestObject :
+        public Object
+    {
+    public:
+        std::string GetType() const override
+        {
+            return "TestObject";
+        }
+    };
+
+    // 공유 슬롯에 넣는 핸들 (index << 32 | generation, 0이면 비어 있음)
+    std::uint64_t Pack(Handle handle)
+    {
+        return static_cast<std::uint64_t>(handle.index) << 32 | handle.generation;
+    }
+
+    Handle Unpack(std::uint64_t value)
+    {
+        return Handle{ static_cast<std::uint32_t>(value >> 32), static_cast<std::uint32_t>(value) };
+    }
+}
+
+TEST_CASE(HandleResolvesUntilObjectIsDestroyed)
+{
+    auto object = std::make_unique<TestObject>();
+    const Handle handle = object->GetHandle();
+
+    CHECK(handle.IsValid());
+    CHECK(Object::GetObjectFromHandle(handle) == object.get());
+
+    object.reset();
+
+    CHECK(Object::GetObjectFromHandle(handle) == nullptr);
+}
+
+// 엔트리를 다시 쓰면 세대가 바뀌어서 이전 핸들이 새 객체를 가리키지 않아야 함
+TEST_CASE(ReusedEntryInvalidatesOldHandle)
+{
+    auto first = std::make_unique<TestObject>();
+    const Handle oldHandle = first->GetHandle();
+    first.reset();
+
+    auto second = std::make_unique<TestObject>();
+    const Handle newHandle = second->GetHandle();
+
+    CHECK(newHandle != oldHandle);
+    CHECK(Object::GetObjectFromHandle(oldHandle) == nullptr);
+    CHECK(Object::GetObjectFromHandle(newHandle) == second.get());
+}
+
+// 청크 (1024개) 여러 개에 걸쳐 만들어도 먼저 만든 객체의 핸들이 그대로 풀려야 함
+TEST_CASE(HandlesStayValidAcrossChunks)
+{
+    constexpr std::size_t objectCount = 5000;
+
+    std::vector<std::unique_ptr<TestObject>> objects;
+    for (std::size_t i = 0; i < objectCount; ++i)
+    {
+        objects.push_back(std::make_unique<TestObject>());
+    }
+
+    std::size_t resolvedCount = 0;
+    for (const auto& object : objects)
+    {
+        resolvedCount += Object::GetObjectFromHandle(object->GetHandle()) == object.get() ? 1 : 0;
+    }
+
+    CHECK(resolvedCount == objectCount);
+}
+
+// 모든 스레드에서 생성 / 삭제 / 다른 스레드 핸들 조회를 동시에 (EditorBenchmark::RunObjectRegistryStress와 같은 내용)
+// TSan 빌드에서도 돌림
+TEST_CASE(ConcurrentCreateDestroyAndLookup)
+{
+    constexpr std::uint32_t threadCount = 8;
+    constexpr std::uint32_t iterationCount = 20000;
+    constexpr std::uint32_t liveCount = 64; // 스레드마다 동시에 살아있는 객체 수
+    constexpr std::uint32_t publishedCount = 4096;
+
+    std::vector<std::atomic<std::uint64_t>> published(publishedCount);
+    std::atomic<std::uint32_t> errorCount = 0;
+    std::atomic<std::uint64_t> foreignHitCount = 0;
+
+    std::vector<std::thread> threads;
+    for (std::uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex]()
+            {
+                std::mt19937 random{ threadIndex + 1 };
+                std::vector<std::unique_ptr<TestObject>> objects(liveCount);
+                std::uint32_t errors = 0;
+                std::uint64_t foreignHits = 0;
+
+                for (std::uint32_t i = 0; i < iterationCount; ++i)
+                {
+                    auto& slot = objects[random() % liveCount];
+
+                    if (slot != nullptr)
+                    {
+                        // 삭제한 핸들은 바로 무효가 되어야 함
+                        const Handle handle = slot->GetHandle();
+                        slot.reset();
+
+                        errors += Object::GetObjectFromHandle(handle) != nullptr ? 1 : 0;
+                    }
+                    else
+                    {
+                        slot = std::make_unique<TestObject>();
+
+                        const Handle handle = slot->GetHandle();
+                        errors += Object::GetObjectFromHandle(handle) != slot.get() ? 1 : 0;
+
+                        published[random() % publishedCount].store(Pack(handle), std::memory_order_relaxed);
+                    }
+
+                    // 다른 스레드 객체는 언제든 삭제될 수 있으므로 조회만 하고 역참조하지 않음
+                    const std::uint64_t value = published[random() % publishedCount].load(std::memory_order_relaxed);
+                    if (value != 0 && Object::GetObjectFromHandle(Unpack(value)) != nullptr)
+                    {
+                        ++foreignHits;
+                    }
+                }
+
+                for (auto& object : objects)
+                {
+                    if (object != nullptr)
+                    {
+                        const Handle handle = object->GetHandle();
+                        object.reset();
+
+                        errors += Object::GetObjectFromHandle(handle) != nullptr ? 1 : 0;
+                    }
+                }
+
+                errorCount += errors;
+                foreignHitCount += foreignHits;
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // 전부 삭제되었으므로 공유 슬롯의 핸들도 모두 무효여야 함
+    std::uint32_t staleCount = 0;
+    for (const auto& value : published)
+    {
+        const std::uint64_t handle = value.load(std::memory_order_relaxed);
+        if (handle != 0 && Object::GetObjectFromHandle(Unpack(handle)) != nullptr)
+        {
+            ++staleCount;
+        }
+    }
+
+    CHECK(errorCount.load() == 0);
+    CHECK(staleCount == 0);
+    CHECK(foreignHitCount.load() > 0); // 다른 스레드가 만든 살아 있는 객체를 실제로 조회했는지
+}
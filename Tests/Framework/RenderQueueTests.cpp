@@ -0,0 +1,530 @@
+﻿#include "TestFramework.h"
+
+#include <random>
+
+#include "EnginePCH.h"
+#include "Core/Graphics/Device/NullCommandContext.h"
+#include "Framework/System/RenderQueue.h"
+
+using namespace engine;
+
+namespace
+{
+    // Draw는 즉시 context로 그리는 렌더러를 흉내 냄 (null 백엔드에서는 불리면 안 됨)
+    class TestRenderer :
+        public Renderer
+    {
+    public:
+        mutable int drawCallCount = 0;
+        mutable int bindConstantsCount = 0;
+
+    public:
+        bool HasRenderType(RenderType type) const override
+        {
+            return true;
+        }
+
+        void Draw(RenderType type) const override
+        {
+            ++drawCallCount;
+        }
+
+        DirectX::BoundingBox GetBounds() const override
+        {
+            return {};
+        }
+
+        void BindConstants(CommandContext& context, RenderType type, std::int32_t boneIndex) const override
+        {
+            ++bindConstantsCount;
+        }
+
+        std::string GetType() const override
+        {
+            return "TestRenderer";
+        }
+    };
+
+    // 헤드리스라 D3D 객체 대신 겹치지 않는 가짜 주소를 씀 (null 백엔드는 역참조하지 않음)
+    struct FakeResources
+    {
+        std::array<std::byte, 64> addressSpace{};
+        std::size_t nextAddress = 0;
+
+        const void* MakeAddress()
+        {
+            return addressSpace.data() + nextAddress++;
+        }
+    };
+
+    DrawPacket MakePacket(const Renderer& renderer, FakeResources& resources)
+    {
+        DrawPacket packet;
+        packet.renderer = &renderer;
+        packet.vertexShader = VertexShaderHandle{ resources.MakeAddress() };
+        packet.pixelShader = PixelShaderHandle{ resources.MakeAddress() };
+        packet.inputLayout = InputLayoutHandle{ resources.MakeAddress() };
+        packet.vertexBuffer = BufferHandle{ resources.MakeAddress() };
+        packet.vertexStride = sizeof(CommonVertex);
+        packet.indexBuffer = BufferHandle{ resources.MakeAddress() };
+        packet.indexFormat = IndexFormat::UInt16;
+        packet.samplerState = SamplerHandle{ resources.MakeAddress() };
+        packet.textures[0] = ShaderResourceHandle{ resources.MakeAddress() };
+        packet.textureCount = 1;
+        packet.indexCount = 36;
+
+        return packet;
+    }
+
+    // 인스턴싱할 수 있는 packet (instanced VS / 레이아웃, instanceKey)
+    DrawPacket MakeInstancedPacket(const Renderer& renderer, FakeResources& resources, std::uint64_t instanceKey)
+    {
+        DrawPacket packet = MakePacket(renderer, resources);
+        packet.instanceKey = instanceKey;
+        packet.instancedVertexShader = VertexShaderHandle{ resources.MakeAddress() };
+        packet.instancedInputLayout = InputLayoutHandle{ resources.MakeAddress() };
+
+        return packet;
+    }
+
+    Matrix MakeWorld(std::int32_t i)
+    {
+        return Matrix::CreateScale(1.0f + 0.5f * i) * Matrix::CreateRotationY(0.3f * i) * Matrix::CreateTranslation(2.0f * i, 1.0f, -3.0f);
+    }
+
+    const RecordedCommand* FindCommand(const NullCommandContext& context, CommandType type)
+    {
+        for (const RecordedCommand& command : context.GetCommands())
+        {
+            if (command.type == type)
+            {
+                return &command;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::size_t CountCommands(const NullCommandContext& context, CommandType type)
+    {
+        const auto commands = context.GetCommands();
+
+        return std::count_if(commands.begin(), commands.end(), [type](const RecordedCommand& command)
+            {
+                return command.type == type;
+            });
+    }
+}
+
+// 아직 packet을 만들지 않는 렌더러는 null 백엔드에서 DrawRenderer로만 기록되고 GPU로 그리지 않아야 함
+TEST_CASE(NullContextRecordsRendererDrawWithoutCallingRenderer)
+{
+    FrameArena::Get().BeginFrame();
+
+    TestRenderer renderer;
+
+    DrawPacket packet;
+    packet.renderer = &renderer;
+    packet.type = RenderType::Cutout;
+    packet.usesRendererDraw = true;
+
+    RenderQueue queue{ Vector3::Zero };
+    queue.Add(packet, Vector3::Zero);
+
+    NullCommandContext context;
+    const RenderQueueStats stats = queue.Submit(&context);
+
+    CHECK(renderer.drawCallCount == 0);
+    CHECK(stats.drawCount == 1);
+    CHECK(context.GetStats().drawCount == 1);
+    CHECK(CountCommands(context, CommandType::DrawRenderer) == 1);
+
+    const auto commands = context.GetCommands();
+    const auto draw = std::find_if(commands.begin(), commands.end(), [](const RecordedCommand& command)
+        {
+            return command.type == CommandType::DrawRenderer;
+        });
+
+    CHECK(draw != commands.end() && draw->object == &renderer);
+    CHECK(draw != commands.end() && draw->value == static_cast<std::uint32_t>(RenderType::Cutout));
+}
+
+// packet 상태는 핸들 그대로 기록되고, 바로 앞과 같은 상태는 다시 바인드하지 않음
+TEST_CASE(NullContextRecordsPacketStateAndSkipsRedundantBinds)
+{
+    FrameArena::Get().BeginFrame();
+
+    TestRenderer renderer;
+    FakeResources resources;
+
+    DrawPacket first = MakePacket(renderer, resources);
+    DrawPacket second = first;
+    second.startIndex = first.indexCount;
+
+    RenderQueue queue{ Vector3::Zero };
+    queue.Add(first, Vector3::Zero);
+    queue.Add(second, Vector3::Zero);
+
+    NullCommandContext context;
+    const RenderQueueStats stats = queue.Submit(&context);
+
+    CHECK(renderer.drawCallCount == 0);
+    CHECK(renderer.bindConstantsCount == 1);
+    CHECK(stats.drawCount == 2);
+    CHECK(CountCommands(context, CommandType::DrawIndexed) == 2);
+    CHECK(CountCommands(context, CommandType::SetVertexShader) == 1);
+    CHECK(CountCommands(context, CommandType::SetPSShaderResources) == 1);
+
+    for (const RecordedCommand& command : context.GetCommands())
+    {
+        if (command.type == CommandType::SetVertexShader)
+        {
+            CHECK(command.object == first.vertexShader.Get());
+        }
+        else if (command.type == CommandType::SetIndexBuffer)
+        {
+            CHECK(command.object == first.indexBuffer.Get());
+            CHECK(command.value == static_cast<std::uint32_t>(IndexFormat::UInt16));
+        }
+        else if (command.type == CommandType::SetPSShaderResources)
+        {
+            CHECK(command.object == first.textures[0].Get());
+            CHECK(command.value == 1);
+        }
+    }
+}
+
+// DrawRenderer 뒤에는 렌더러가 무엇을 바인드했는지 모르므로 다음 packet의 상태를 모두 다시 바인드
+TEST_CASE(PacketAfterRendererDrawRebindsState)
+{
+    FrameArena::Get().BeginFrame();
+
+    TestRenderer renderer;
+    TestRenderer fallbackRenderer;
+    FakeResources resources;
+
+    const DrawPacket packet = MakePacket(renderer, resources);
+
+    DrawPacket fallback;
+    fallback.renderer = &fallbackRenderer;
+    fallback.usesRendererDraw = true;
+
+    RenderQueue queue{ Vector3::Zero };
+    queue.Add(packet, Vector3::Zero);
+    queue.Add(fallback, Vector3::Zero);
+    queue.Add(packet, Vector3::Zero);
+
+    NullCommandContext context;
+    const RenderQueueStats stats = queue.Submit(&context);
+
+    CHECK(fallbackRenderer.drawCallCount == 0);
+    CHECK(stats.drawCount == 3);
+    CHECK(renderer.bindConstantsCount == 2);
+    CHECK(CountCommands(context, CommandType::SetVertexShader) == 2);
+    CHECK(CountCommands(context, CommandType::DrawRenderer) == 1);
+}
+
+// radix sort는 키가 같은 packet의 추가 순서까지 std::stable_sort와 같아야 함
+// 상태 종류를 적게 두고 깊이도 같거나 MaxSortDepth 밖인 것을 섞어서 같은 키가 많이 나오게 함
+TEST_CASE(RadixSortMatchesStableSort)
+{
+    FrameArena::Get().BeginFrame();
+
+    constexpr std::size_t PacketCount = 3000;
+
+    TestRenderer renderer;
+    FakeResources resources;
+    std::mt19937 random{ 21 };
+
+    std::array<DrawPacket, 4> templates;
+    for (auto& packet : templates)
+    {
+        packet = MakePacket(renderer, resources);
+    }
+
+    const std::array<RenderType, 4> types{ RenderType::Shadow, RenderType::Opaque, RenderType::Cutout, RenderType::Transparent };
+    const std::array<Vector3, 4> positions{ Vector3{ 1.0f, 0.0f, 0.0f }, Vector3{ 0.0f, 50.0f, 0.0f }, Vector3{ 0.0f, 0.0f, 2000.0f }, Vector3{ -3000.0f, 0.0f, 0.0f } };
+    std::uniform_real_distribution<float> distanceDist(0.0f, RenderQueue::MaxSortDepth);
+
+    const Vector3 viewPosition{ 0.0f, 0.0f, 0.0f };
+    RenderQueue queue{ viewPosition };
+
+    struct Expected
+    {
+        std::uint64_t key;
+        std::int32_t order;
+    };
+    std::vector<Expected> expected;
+
+    for (std::size_t i = 0; i < PacketCount; ++i)
+    {
+        DrawPacket packet = templates[random() % templates.size()];
+        packet.type = types[random() % types.size()];
+        packet.usesRendererDraw = random() % 16 == 0;
+        packet.startIndex = packet.indexCount * static_cast<std::uint32_t>(random() % 3);
+        packet.baseVertex = static_cast<std::int32_t>(i); // 키에 들어가지 않으므로 추가 순서 표시로 씀
+
+        const Vector3 position = random() % 2 == 0 ? positions[random() % positions.size()] : Vector3{ distanceDist(random), 0.0f, 0.0f };
+
+        queue.Add(packet, position);
+        expected.push_back(Expected{ RenderQueue::MakeSortKey(packet, Vector3::Distance(viewPosition, position)), packet.baseVertex });
+    }
+
+    queue.Sort();
+
+    std::stable_sort(expected.begin(), expected.end(), [](const Expected& lhs, const Expected& rhs)
+        {
+            return lhs.key < rhs.key;
+        });
+
+    CHECK(queue.GetPacketCount() == PacketCount);
+
+    bool isSameOrder = true;
+    std::size_t equalKeyCount = 0;
+    for (std::size_t i = 0; i < PacketCount; ++i)
+    {
+        isSameOrder = isSameOrder && queue.GetSortKey(i) == expected[i].key && queue.GetPacket(i).baseVertex == expected[i].order;
+
+        if (i > 0 && expected[i].key == expected[i - 1].key)
+        {
+            ++equalKeyCount;
+        }
+    }
+
+    CHECK(isSameOrder);
+    CHECK(equalKeyCount > PacketCount / 4); // 안정성을 실제로 검사했는지
+}
+
+// 모든 키가 같으면 모든 자리를 건너뛰고 추가 순서 그대로, 0개 / 1개도 그대로
+TEST_CASE(RadixSortKeepsOrderOfEqualKeys)
+{
+    FrameArena::Get().BeginFrame();
+
+    TestRenderer renderer;
+    FakeResources resources;
+
+    DrawPacket packet = MakePacket(renderer, resources);
+
+    RenderQueue empty{ Vector3::Zero };
+    empty.Sort();
+    CHECK(empty.GetPacketCount() == 0);
+
+    RenderQueue queue{ Vector3::Zero };
+    for (std::int32_t i = 0; i < 100; ++i)
+    {
+        packet.baseVertex = i;
+        queue.Add(packet, Vector3::UnitX);
+    }
+    queue.Sort();
+
+    bool isSameOrder = true;
+    for (std::size_t i = 0; i < queue.GetPacketCount(); ++i)
+    {
+        isSameOrder = isSameOrder && queue.GetPacket(i).baseVertex == static_cast<std::int32_t>(i);
+    }
+    CHECK(isSameOrder);
+
+    // 패스가 가장 높은 비트이므로 나머지와 상관없이 패스 순서로
+    RenderQueue passes{ Vector3::Zero };
+    packet.type = RenderType::Transparent;
+    passes.Add(packet, Vector3::Zero);
+    packet.type = RenderType::Shadow;
+    passes.Add(packet, Vector3{ 500.0f, 0.0f, 0.0f });
+    passes.Sort();
+
+    CHECK(passes.GetPacket(0).type == RenderType::Shadow);
+    CHECK(passes.GetPacket(1).type == RenderType::Transparent);
+}
+
+// 상태와 instanceKey가 같은 packet은 한 번의 DrawIndexedInstanced로, 인스턴스에는 정렬된 순서의 world / 역전치 행렬
+TEST_CASE(SameStatePacketsBecomeOneInstancedDraw)
+{
+    FrameArena::Get().BeginFrame();
+
+    constexpr std::int32_t InstanceCount = 5;
+
+    TestRenderer renderer;
+    FakeResources resources;
+
+    DrawPacket packet = MakeInstancedPacket(renderer, resources, 7);
+    DrawPacket other = packet;
+    other.instanceKey = 9; // 상수 버퍼 내용이 다른 머티리얼
+
+    RenderQueue queue{ Vector3::Zero };
+    for (std::int32_t i = 0; i < InstanceCount; ++i)
+    {
+        packet.world = MakeWorld(i);
+        queue.Add(packet, packet.world.Translation());
+    }
+    queue.Add(other, Vector3::Zero);
+
+    queue.Sort();
+    queue.BuildInstanceBatches();
+
+    CHECK(queue.GetBatchCount() == 2);
+
+    const auto instances = queue.GetInstances();
+    CHECK(instances.size() == InstanceCount);
+
+    // 인스턴스 i는 정렬 뒤 i번째로 그려지는 같은 그룹의 packet
+    std::size_t instance = 0;
+    bool isSameMatrix = true;
+    for (std::size_t i = 0; i < queue.GetPacketCount() && instance < instances.size(); ++i)
+    {
+        const DrawPacket& sorted = queue.GetPacket(i);
+        if (sorted.instanceKey != packet.instanceKey)
+        {
+            continue;
+        }
+
+        isSameMatrix = isSameMatrix
+            && instances[instance].world == sorted.world
+            && instances[instance].worldInverseTranspose == sorted.world.Invert().Transpose();
+        ++instance;
+    }
+    CHECK(instance == InstanceCount);
+    CHECK(isSameMatrix);
+
+    const BufferHandle instanceBuffer{ resources.MakeAddress() };
+
+    NullCommandContext context;
+    const RenderQueueStats stats = queue.Submit(&context, instanceBuffer);
+
+    CHECK(stats.packetCount == InstanceCount + 1);
+    CHECK(stats.drawCount == 2);
+    CHECK(stats.instancedDrawCount == 1);
+    CHECK(stats.instanceCount == InstanceCount);
+
+    CHECK(CountCommands(context, CommandType::DrawIndexedInstanced) == 1);
+    CHECK(CountCommands(context, CommandType::DrawIndexed) == 1);
+
+    const RecordedCommand* draw = FindCommand(context, CommandType::DrawIndexedInstanced);
+    CHECK(draw != nullptr && draw->value == InstanceCount && draw->slot == 0);
+
+    // instanced VS / 레이아웃으로 그리고 슬롯 1에 인스턴스 버퍼
+    bool isInstanceBufferBound = false;
+    bool isInstancedShaderBound = false;
+    for (const RecordedCommand& command : context.GetCommands())
+    {
+        isInstanceBufferBound = isInstanceBufferBound || (command.type == CommandType::SetVertexBuffer && command.slot == 1 && command.object == instanceBuffer.Get());
+        isInstancedShaderBound = isInstancedShaderBound || (command.type == CommandType::SetVertexShader && command.object == packet.instancedVertexShader.Get());
+    }
+    CHECK(isInstanceBufferBound);
+    CHECK(isInstancedShaderBound);
+}
+
+// 두 그룹은 인스턴스 버퍼를 이어서 쓰고 (두 번째 드로우의 시작 인스턴스), 버퍼는 한 번만 바인드
+TEST_CASE(InstancedGroupsShareOneInstanceBuffer)
+{
+    FrameArena::Get().BeginFrame();
+
+    TestRenderer renderer;
+    FakeResources resources;
+
+    DrawPacket first = MakeInstancedPacket(renderer, resources, 7);
+    DrawPacket second = first;
+    second.startIndex = first.indexCount; // 같은 버퍼의 다른 섹션
+
+    RenderQueue queue{ Vector3::Zero };
+    for (std::int32_t i = 0; i < 3; ++i)
+    {
+        first.world = MakeWorld(i);
+        queue.Add(first, Vector3::Zero);
+    }
+    for (std::int32_t i = 0; i < 4; ++i)
+    {
+        second.world = MakeWorld(i);
+        queue.Add(second, Vector3::Zero);
+    }
+
+    queue.Sort();
+    queue.BuildInstanceBatches();
+
+    CHECK(queue.GetBatchCount() == 2);
+    CHECK(queue.GetInstances().size() == 7);
+
+    NullCommandContext context;
+    const RenderQueueStats stats = queue.Submit(&context, BufferHandle{ resources.MakeAddress() });
+
+    CHECK(stats.instancedDrawCount == 2);
+    CHECK(stats.instanceCount == 7);
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> draws; // (시작 인스턴스, 인스턴스 수)
+    std::size_t instanceBufferBindCount = 0;
+    for (const RecordedCommand& command : context.GetCommands())
+    {
+        if (command.type == CommandType::DrawIndexedInstanced)
+        {
+            draws.emplace_back(command.slot, command.value);
+        }
+        else if (command.type == CommandType::SetVertexBuffer && command.slot == 1)
+        {
+            ++instanceBufferBindCount;
+        }
+    }
+
+    CHECK(draws.size() == 2);
+    CHECK(draws.size() == 2 && draws[0].first == 0 && draws[1].first == draws[0].second);
+    CHECK(draws.size() == 2 && draws[0].second + draws[1].second == 7);
+    CHECK(instanceBufferBindCount == 1);
+}
+
+// instanceKey가 0 / instanced VS가 없음 / usesRendererDraw / 본 번호가 다르면 묶지 않음
+TEST_CASE(PacketsThatCannotInstanceStaySeparate)
+{
+    FrameArena::Get().BeginFrame();
+
+    TestRenderer renderer;
+    FakeResources resources;
+
+    const DrawPacket instanced = MakeInstancedPacket(renderer, resources, 7);
+
+    DrawPacket noKey = instanced;
+    noKey.instanceKey = 0;
+
+    DrawPacket noInstancedShader = instanced;
+    noInstancedShader.instancedVertexShader = {};
+
+    DrawPacket rendererDraw = instanced;
+    rendererDraw.usesRendererDraw = true;
+
+    const DrawPacket cases[] = { noKey, noInstancedShader, rendererDraw };
+
+    for (const DrawPacket& packet : cases)
+    {
+        RenderQueue queue{ Vector3::Zero };
+        for (std::int32_t i = 0; i < 3; ++i)
+        {
+            queue.Add(packet, Vector3::Zero);
+        }
+
+        queue.Sort();
+        queue.BuildInstanceBatches();
+
+        CHECK(queue.GetBatchCount() == 3);
+        CHECK(queue.GetInstances().empty());
+
+        const RenderQueueStats stats = queue.Submit(nullptr);
+        CHECK(stats.drawCount == 3);
+        CHECK(stats.instancedDrawCount == 0);
+    }
+
+    // 본 번호가 바뀌는 곳에서 끊김
+    RenderQueue queue{ Vector3::Zero };
+    for (std::int32_t boneIndex : { 0, 0, 1, 1, 1 })
+    {
+        DrawPacket packet = instanced;
+        packet.boneIndex = boneIndex;
+        queue.Add(packet, Vector3::Zero);
+    }
+
+    queue.Sort();
+    queue.BuildInstanceBatches();
+
+    CHECK(queue.GetBatchCount() == 2);
+    CHECK(queue.GetInstances().size() == 5);
+
+    const RenderQueueStats stats = queue.Submit(nullptr);
+    CHECK(stats.instancedDrawCount == 2);
+    CHECK(stats.instanceCount == 5);
+}
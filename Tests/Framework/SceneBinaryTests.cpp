@@ -0,0 +1,235 @@
+﻿#include "TestFramework.h"
+
+#include "EnginePCH.h"
+#include "Framework/Scene/SceneBinary.h"
+
+using namespace engine;
+
+namespace
+{
+    // parents[i]는 i번 GameObject의 부모 ID (-1이면 루트), 컴포넌트는 Transform 뒤에 types 순서
+    json MakeScene(const std::vector<int>& parents, const std::vector<std::vector<std::string>>& types = {})
+    {
+        json scene;
+        scene["Name"] = "Test";
+        scene["NumGameObjects"] = parents.size();
+        scene["GameObjects"] = json::array();
+
+        for (std::size_t i = 0; i < parents.size(); ++i)
+        {
+            json goJson;
+            goJson["ID"] = i;
+            goJson["Name"] = "GameObject" + std::to_string(i);
+            goJson["Active"] = true;
+
+            if (parents[i] != -1)
+            {
+                goJson["ParentID"] = parents[i];
+            }
+
+            json components = json::array();
+            components.push_back({ { "Type", "Transform" }, { "Active", true },
+                { "Position", Vector3(static_cast<float>(i), 0.0f, 0.0f) }, { "Rotation", Quaternion::Identity }, { "Scale", Vector3::One } });
+
+            if (i < types.size())
+            {
+                for (const auto& type : types[i])
+                {
+                    components.push_back({ { "Type", type }, { "Value", static_cast<int>(i) } });
+                }
+            }
+
+            goJson["Components"] = std::move(components);
+            scene["GameObjects"].push_back(std::move(goJson));
+        }
+
+        return scene;
+    }
+
+    // 각 컴포넌트의 Save와 같은 키 (타입별 블록으로 가는 타입들 + MessagePack으로 가는 스크립트)
+    json MakeHotComponents()
+    {
+        json components = json::array();
+        components.push_back({ { "Type", "StaticMeshRenderer" }, { "Active", true },
+            { "MeshFilePath", "Resource/Model/Box.fbx" }, { "VSFilePath", "Resource/Shader/Vertex/StaticMesh_VS.hlsl" },
+            { "OpaquePSFilePath", "Resource/Shader/Pixel/Opaque_PS.hlsl" }, { "CutoutPSFilePath", "Resource/Shader/Pixel/Cutout_PS.hlsl" },
+            { "TransparentPSFilePath", "" }, { "MaterialBaseColor", Vector4(1.0f, 0.5f, 0.25f, 1.0f) },
+            { "MaterialEmissive", Vector3(0.0f, 0.0f, 0.0f) }, { "MaterialRoughness", 0.5f }, { "MaterialMetalness", 0.25f },
+            { "MaterialAmbientOcclusion", 1.0f }, { "OverrideMaterial", true }, { "CompactVertex", true } });
+        components.push_back({ { "Type", "PlayerScript" }, { "Active", true }, { "Speed", 3 } });
+        components.push_back({ { "Type", "Light" }, { "Active", false }, { "LightType", 2 }, { "Color", Vector3(1.0f, 0.5f, 0.0f) },
+            { "Intensity", 2.0f }, { "Range", 10.0f }, { "Angle", 45.0f }, { "Near", 0.5f }, { "Far", 100.0f },
+            { "ForwardDistance", 20.0f }, { "HeightRatio", 0.5f } });
+        components.push_back({ { "Type", "Camera" }, { "Active", true }, { "Near", 0.25f }, { "Far", 1000.0f }, { "FOV", 60.0f } });
+        components.push_back({ { "Type", "BoxCollider" }, { "Active", true }, { "center", { 0.0f, 0.5f, 0.0f } }, { "rotation", { 0.0f, 90.0f, 0.0f } },
+            { "isTrigger", false }, { "layer", 1 }, { "collisionMask", 4294967295u }, { "size", { 1.0f, 2.0f, 3.0f } } });
+        components.push_back({ { "Type", "CapsuleCollider" }, { "Active", true }, { "center", { 0.0f, 1.0f, 0.0f } }, { "rotation", { 0.0f, 0.0f, 0.0f } },
+            { "isTrigger", true }, { "layer", 2 }, { "collisionMask", 3 }, { "radius", 0.5f }, { "height", 2.0f } });
+        components.push_back({ { "Type", "Rigidbody" }, { "Active", true }, { "type", 1 }, { "mass", 2.0f }, { "linearDamping", 0.25f },
+            { "angularDamping", 0.5f }, { "useGravity", false }, { "constraints", 56 }, { "layer", 1 } });
+
+        return components;
+    }
+
+    std::vector<SceneBinaryEncoding> GetBlockEncodings(const std::vector<std::byte>& data)
+    {
+        std::vector<SceneBinaryEncoding> encodings;
+        for (const auto& block : SceneBinaryReader{ data }.GetBlocks())
+        {
+            encodings.push_back(block.encoding);
+        }
+
+        return encodings;
+    }
+
+    std::vector<std::string> GetComponentTypes(const json& goJson)
+    {
+        std::vector<std::string> types;
+        for (const auto& compJson : goJson["Components"])
+        {
+            types.push_back(compJson["Type"].get<std::string>());
+        }
+
+        return types;
+    }
+}
+
+TEST_CASE(RoundTripKeepsComponentOrder)
+{
+    // 블록은 타입이 처음 나온 순서 (A, B)이므로 1번은 블록 순서와 JSON 순서가 다름
+    const json scene = MakeScene({ -1, 0 }, { { "A", "B" }, { "B", "A", "C" } });
+
+    std::vector<std::byte> data;
+    CHECK(SceneBinary::ConvertFromJson(scene, data));
+    CHECK(SceneBinaryReader{ data }.IsValid());
+
+    json loaded;
+    CHECK(SceneBinary::ConvertToJson(data, loaded));
+    CHECK(loaded["GameObjects"].size() == 2);
+
+    CHECK((GetComponentTypes(loaded["GameObjects"][0]) == std::vector<std::string>{ "Transform", "A", "B" }));
+    CHECK((GetComponentTypes(loaded["GameObjects"][1]) == std::vector<std::string>{ "Transform", "B", "A", "C" }));
+    CHECK(loaded["GameObjects"][1]["ParentID"] == 0);
+    CHECK(loaded["GameObjects"][1]["Components"][0]["Position"]["x"] == 1.0f);
+}
+
+TEST_CASE(AcceptsDeepParentChain)
+{
+    std::vector<int> parents(256);
+    for (std::size_t i = 0; i < parents.size(); ++i)
+    {
+        parents[i] = static_cast<int>(i) - 1;
+    }
+
+    std::vector<std::byte> data;
+    CHECK(SceneBinary::ConvertFromJson(MakeScene(parents), data));
+    CHECK(SceneBinaryReader{ data }.IsValid());
+}
+
+TEST_CASE(RejectsTwoObjectParentCycle)
+{
+    // A -> B -> A
+    std::vector<std::byte> data;
+    CHECK(SceneBinary::ConvertFromJson(MakeScene({ 1, 0 }), data));
+    CHECK(!SceneBinaryReader{ data }.IsValid());
+
+    json loaded;
+    CHECK(!SceneBinary::ConvertToJson(data, loaded));
+}
+
+TEST_CASE(RejectsLongerCycleBehindValidChain)
+{
+    // 0은 루트, 1 -> 0은 정상, 2 -> 3 -> 4 -> 2가 순환이고 5는 순환에 매달림
+    std::vector<std::byte> data;
+    CHECK(SceneBinary::ConvertFromJson(MakeScene({ -1, 0, 3, 4, 2, 2 }), data));
+    CHECK(!SceneBinaryReader{ data }.IsValid());
+}
+
+TEST_CASE(RejectsSelfParentInFile)
+{
+    std::vector<std::byte> data;
+    CHECK(SceneBinary::ConvertFromJson(MakeScene({ -1, 0 }), data));
+    CHECK(SceneBinaryReader{ data }.IsValid());
+
+    // 변환기는 자기 자신을 부모로 쓰지 않으므로 파일을 직접 고침
+    SceneBinaryHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    SceneBinaryGameObject gameObject;
+    const std::size_t offset = header.gameObjectOffset + sizeof(SceneBinaryGameObject);
+    std::memcpy(&gameObject, data.data() + offset, sizeof(gameObject));
+    gameObject.parent = 1;
+    std::memcpy(data.data() + offset, &gameObject, sizeof(gameObject));
+
+    CHECK(!SceneBinaryReader{ data }.IsValid());
+}
+
+TEST_CASE(HotTypesUseTypedBlocks)
+{
+    json scene = MakeScene({ -1 });
+    for (auto& compJson : MakeHotComponents())
+    {
+        scene["GameObjects"][0]["Components"].push_back(std::move(compJson));
+    }
+
+    std::vector<std::byte> data;
+    CHECK(SceneBinary::ConvertFromJson(scene, data));
+    CHECK(SceneBinaryReader{ data }.IsValid());
+
+    CHECK((GetBlockEncodings(data) == std::vector<SceneBinaryEncoding>{ SceneBinaryEncoding::Transform, SceneBinaryEncoding::StaticMeshRenderer,
+        SceneBinaryEncoding::MessagePack, SceneBinaryEncoding::Light, SceneBinaryEncoding::Camera, SceneBinaryEncoding::BoxCollider,
+        SceneBinaryEncoding::CapsuleCollider, SceneBinaryEncoding::Rigidbody }));
+
+    // 타입별 레코드에서 다시 만든 JSON도 Save와 같은 키 / 값 / 순서
+    json loaded;
+    CHECK(SceneBinary::ConvertToJson(data, loaded));
+    CHECK(loaded["GameObjects"][0]["Components"] == scene["GameObjects"][0]["Components"]);
+}
+
+TEST_CASE(IncompleteHotTypeFallsBackToMessagePack)
+{
+    json scene = MakeScene({ -1, -1 });
+
+    json light = MakeHotComponents()[2];
+    scene["GameObjects"][0]["Components"].push_back(light);
+
+    // 키가 빠진 Light는 기본값을 알 수 없으므로 같은 타입의 MessagePack 블록으로 감
+    light.erase("Range");
+    scene["GameObjects"][1]["Components"].push_back(light);
+
+    std::vector<std::byte> data;
+    CHECK(SceneBinary::ConvertFromJson(scene, data));
+    CHECK(SceneBinaryReader{ data }.IsValid());
+
+    CHECK((GetBlockEncodings(data) == std::vector<SceneBinaryEncoding>{ SceneBinaryEncoding::Transform, SceneBinaryEncoding::Light,
+        SceneBinaryEncoding::MessagePack }));
+
+    json loaded;
+    CHECK(SceneBinary::ConvertToJson(data, loaded));
+    CHECK(loaded["GameObjects"][0]["Components"] == scene["GameObjects"][0]["Components"]);
+    CHECK(loaded["GameObjects"][1]["Components"] == scene["GameObjects"][1]["Components"]);
+}
+
+TEST_CASE(RejectsMeshRendererStringOutOfRange)
+{
+    json scene = MakeScene({ -1 });
+    scene["GameObjects"][0]["Components"].push_back(MakeHotComponents()[0]);
+
+    std::vector<std::byte> data;
+    CHECK(SceneBinary::ConvertFromJson(scene, data));
+    CHECK(SceneBinaryReader{ data }.IsValid());
+
+    SceneBinaryHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    SceneBinaryBlock block;
+    std::memcpy(&block, data.data() + header.blockOffset + sizeof(SceneBinaryBlock), sizeof(block));
+    CHECK(block.encoding == SceneBinaryEncoding::StaticMeshRenderer);
+
+    SceneBinaryMeshRenderer record;
+    std::memcpy(&record, data.data() + block.recordOffset, sizeof(record));
+    record.meshFilePath = header.stringCount;
+    std::memcpy(data.data() + block.recordOffset, &record, sizeof(record));
+
+    CHECK(!SceneBinaryReader{ data }.IsValid());
+}
@@ -0,0 +1,129 @@
+﻿#include "TestFramework.h"
+
+#include <random>
+
+#include "EnginePCH.h"
+#include "Framework/Animation/SkinningKernel.h"
+
+using namespace engine;
+
+namespace
+{
+    constexpr std::size_t BoneCount = 96;
+
+    // 부모가 항상 앞에 있는 무작위 트리 (SetupSkeletonInstance와 같은 순서 조건)
+    std::vector<Bone> MakeSkeleton(std::mt19937& random)
+    {
+        std::vector<Bone> bones;
+        bones.reserve(BoneCount);
+
+        for (std::size_t i = 0; i < BoneCount; ++i)
+        {
+            const int parentIndex = i == 0 ? -1 : static_cast<int>(random() % i);
+            bones.emplace_back("Bone" + std::to_string(i), parentIndex, static_cast<unsigned int>(i), Matrix::Identity);
+        }
+
+        return bones;
+    }
+
+    AnimationPose MakePose(std::mt19937& random)
+    {
+        std::uniform_real_distribution<float> positionDist(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> angleDist(-DirectX::XM_PI, DirectX::XM_PI);
+        std::uniform_real_distribution<float> scaleDist(0.8f, 1.25f);
+
+        AnimationPose pose;
+        for (std::size_t i = 0; i < BoneCount; ++i)
+        {
+            pose.positions.push_back(Vector3{ positionDist(random), positionDist(random), positionDist(random) });
+            pose.rotations.push_back(Quaternion::CreateFromYawPitchRoll(angleDist(random), angleDist(random), angleDist(random)));
+            pose.scales.push_back(Vector3{ scaleDist(random), scaleDist(random), scaleDist(random) });
+        }
+
+        return pose;
+    }
+
+    // 값이 클수록 float 오차도 커지므로 상대 오차로 비교
+    float GetMaxRelativeError(const Matrix& a, const Matrix& b)
+    {
+        const float* lhs = &a._11;
+        const float* rhs = &b._11;
+
+        float maxError = 0.0f;
+        for (int k = 0; k < 16; ++k)
+        {
+            maxError = std::max(maxError, std::abs(lhs[k] - rhs[k]) / std::max(1.0f, std::abs(rhs[k])));
+        }
+
+        return maxError;
+    }
+}
+
+// XMVECTOR 커널과 SimpleMath 기준 구현이 스키닝 행렬 / 모델 행렬 모두 같은 값을 내야 함
+TEST_CASE(SimdKernelMatchesScalarReference)
+{
+    constexpr int poseCount = 32;
+    constexpr float tolerance = 1e-4f;
+
+    std::mt19937 random{ 10 };
+
+    std::vector<Bone> bones = MakeSkeleton(random);
+    std::vector<Bone> referenceBones = bones;
+
+    BoneMatrixArray boneOffsets{};
+    for (std::size_t i = 0; i < BoneCount; ++i)
+    {
+        const AnimationPose offsetPose = MakePose(random);
+        boneOffsets[i] = Matrix::CreateFromQuaternion(offsetPose.rotations[i]) * Matrix::CreateTranslation(offsetPose.positions[i]);
+    }
+
+    float maxSkinningError = 0.0f;
+    float maxModelError = 0.0f;
+
+    for (int poseIndex = 0; poseIndex < poseCount; ++poseIndex)
+    {
+        const AnimationPose pose = MakePose(random);
+
+        BoneMatrixArray matrices{};
+        BoneMatrixArray referenceMatrices{};
+        BuildSkinningMatrices(pose, bones, boneOffsets, matrices);
+        BuildSkinningMatricesReference(pose, referenceBones, boneOffsets, referenceMatrices);
+
+        for (std::size_t i = 0; i < BoneCount; ++i)
+        {
+            maxSkinningError = std::max(maxSkinningError, GetMaxRelativeError(matrices[i], referenceMatrices[i]));
+            maxModelError = std::max(maxModelError, GetMaxRelativeError(bones[i].model, referenceBones[i].model));
+        }
+    }
+
+    CHECK(maxSkinningError < tolerance);
+    CHECK(maxModelError < tolerance);
+}
+
+// offset이 바인드 포즈 model의 역행렬이면 바인드 포즈의 스키닝 행렬은 단위 행렬
+TEST_CASE(BindPoseProducesIdentitySkinning)
+{
+    std::mt19937 random{ 11 };
+
+    std::vector<Bone> bones = MakeSkeleton(random);
+    const AnimationPose bindPose = MakePose(random);
+
+    BoneMatrixArray boneOffsets{};
+    BoneMatrixArray matrices{};
+    BuildSkinningMatricesReference(bindPose, bones, boneOffsets, matrices);
+
+    for (const Bone& bone : bones)
+    {
+        boneOffsets[bone.index] = bone.model.Invert();
+    }
+
+    BuildSkinningMatrices(bindPose, bones, boneOffsets, matrices);
+
+    float maxError = 0.0f;
+    for (std::size_t i = 0; i < BoneCount; ++i)
+    {
+        maxError = std::max(maxError, GetMaxRelativeError(matrices[i], Matrix::Identity));
+    }
+
+    CHECK(maxError < 1e-3f);
+}
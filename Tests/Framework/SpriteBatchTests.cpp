@@ -0,0 +1,432 @@
+﻿#include "TestFramework.h"
+
+#include "EnginePCH.h"
+#include "Core/Graphics/Device/NullCommandContext.h"
+#include "Framework/Object/Component/Renderer.h"
+#include "Framework/System/SpriteBatch.h"
+
+using namespace engine;
+
+namespace
+{
+    // 헤드리스라 D3D 객체 대신 겹치지 않는 가짜 주소를 씀 (null 백엔드는 역참조하지 않음)
+    struct FakeResources
+    {
+        std::array<std::byte, 16> addressSpace{};
+        std::size_t nextAddress = 0;
+
+        const void* MakeAddress()
+        {
+            return addressSpace.data() + nextAddress++;
+        }
+    };
+
+    // 추가 순서를 color.x에 표시 (상태 비교에 들어가지 않음)
+    SpriteDrawItem MakeItem(PixelShaderHandle pixelShader, ShaderResourceHandle texture, RasterizerStateHandle rasterizerState, float order)
+    {
+        SpriteDrawItem item;
+        item.pixelShader = pixelShader;
+        item.texture = texture;
+        item.rasterizerState = rasterizerState;
+        item.color = Vector4{ order, 1.0f, 1.0f, 1.0f };
+
+        return item;
+    }
+
+    float GetOrder(const SpriteBatch& batch, std::size_t sprite)
+    {
+        return batch.GetVertices()[sprite * SpriteBatch::VerticesPerSprite].color.x;
+    }
+
+    bool IsNear(const Vector3& a, const Vector3& b)
+    {
+        return (a - b).Length() < 1e-5f;
+    }
+
+    bool IsNear(const Vector2& a, const Vector2& b)
+    {
+        return (a - b).Length() < 1e-6f;
+    }
+
+    // 파티클처럼 스프라이트로 모이는 렌더러 (isSprite가 false면 메시처럼 직접 그리는 렌더러)
+    class TestRenderer :
+        public Renderer
+    {
+    public:
+        SpriteDrawItem item;
+        bool isSprite = true;
+        mutable int drawCallCount = 0;
+
+    public:
+        bool HasRenderType(RenderType type) const override
+        {
+            return true;
+        }
+
+        void Draw(RenderType type) const override
+        {
+            ++drawCallCount;
+        }
+
+        DirectX::BoundingBox GetBounds() const override
+        {
+            return {};
+        }
+
+        bool CollectSprite(RenderType type, SpriteBatch& batch) const override
+        {
+            if (!isSprite)
+            {
+                return false;
+            }
+
+            batch.Add(item);
+            return true;
+        }
+
+        std::string GetType() const override
+        {
+            return "TestRenderer";
+        }
+    };
+
+    // RenderSystem::DrawSprites에서 버퍼 / VS 바인드를 뺀 것
+    void FlushSprites(SpriteBatch& batch, CommandContext& context, std::vector<std::uint32_t>& flushedCounts)
+    {
+        batch.Build(false);
+        flushedCounts.push_back(batch.Submit(context).spriteCount);
+        batch.Clear();
+    }
+}
+
+// Build(true)는 상태가 같은 스프라이트를 한 묶음으로 모으고, 묶음 안에서는 추가한 순서를 지킴
+TEST_CASE(SortedBuildGroupsByStateInAddOrder)
+{
+    FrameArena::Get().BeginFrame();
+
+    FakeResources resources;
+    const PixelShaderHandle pixelShader{ resources.MakeAddress() };
+    const RasterizerStateHandle rasterizerState{ resources.MakeAddress() };
+    const std::array<ShaderResourceHandle, 3> textures{
+        ShaderResourceHandle{ resources.MakeAddress() },
+        ShaderResourceHandle{ resources.MakeAddress() },
+        ShaderResourceHandle{ resources.MakeAddress() } };
+
+    const std::size_t textureOrder[] = { 0, 1, 0, 2, 1, 0, 2, 2 };
+
+    SpriteBatch batch;
+    for (std::size_t i = 0; i < std::size(textureOrder); ++i)
+    {
+        batch.Add(MakeItem(pixelShader, textures[textureOrder[i]], rasterizerState, static_cast<float>(i)));
+    }
+    batch.Build(true);
+
+    const auto batches = batch.GetBatches();
+    CHECK(batches.size() == textures.size());
+    CHECK(batch.GetVertices().size() == std::size(textureOrder) * SpriteBatch::VerticesPerSprite);
+
+    bool isGrouped = true;
+    bool isInAddOrder = true;
+    std::uint32_t nextSprite = 0;
+    for (const auto& group : batches)
+    {
+        isGrouped = isGrouped && group.firstSprite == nextSprite && group.pixelShader == pixelShader && group.rasterizerState == rasterizerState;
+
+        for (std::uint32_t i = group.firstSprite; i < group.firstSprite + group.spriteCount; ++i)
+        {
+            const float order = GetOrder(batch, i);
+            isGrouped = isGrouped && textures[textureOrder[static_cast<std::size_t>(order)]] == group.texture;
+            isInAddOrder = isInAddOrder && (i == group.firstSprite || GetOrder(batch, i - 1) < order);
+        }
+
+        nextSprite += group.spriteCount;
+    }
+
+    CHECK(isGrouped);
+    CHECK(isInAddOrder);
+    CHECK(nextSprite == std::size(textureOrder));
+}
+
+// Build(false)는 뒤에서 앞 순서를 지켜야 하므로 바로 붙은 것만 묶음
+TEST_CASE(UnsortedBuildMergesOnlyAdjacentSprites)
+{
+    FrameArena::Get().BeginFrame();
+
+    FakeResources resources;
+    const PixelShaderHandle pixelShader{ resources.MakeAddress() };
+    const RasterizerStateHandle rasterizerState{ resources.MakeAddress() };
+    const ShaderResourceHandle a{ resources.MakeAddress() };
+    const ShaderResourceHandle b{ resources.MakeAddress() };
+
+    SpriteBatch batch;
+    const ShaderResourceHandle textures[] = { a, a, b, a, a, a };
+    for (std::size_t i = 0; i < std::size(textures); ++i)
+    {
+        batch.Add(MakeItem(pixelShader, textures[i], rasterizerState, static_cast<float>(i)));
+    }
+    batch.Build(false);
+
+    const auto batches = batch.GetBatches();
+    CHECK(batches.size() == 3);
+    CHECK(batches.size() == 3 && batches[0].texture == a && batches[0].firstSprite == 0 && batches[0].spriteCount == 2);
+    CHECK(batches.size() == 3 && batches[1].texture == b && batches[1].firstSprite == 2 && batches[1].spriteCount == 1);
+    CHECK(batches.size() == 3 && batches[2].texture == a && batches[2].firstSprite == 3 && batches[2].spriteCount == 3);
+
+    bool isInAddOrder = true;
+    for (std::size_t i = 0; i < std::size(textures); ++i)
+    {
+        isInAddOrder = isInAddOrder && GetOrder(batch, i) == static_cast<float>(i);
+    }
+    CHECK(isInAddOrder);
+
+    // 다시 Build해도 같은 결과 (정점 / 묶음을 비우고 다시 만듦)
+    batch.Build(false);
+    CHECK(batch.GetBatches().size() == 3);
+    CHECK(batch.GetVertices().size() == std::size(textures) * SpriteBatch::VerticesPerSprite);
+
+    batch.Clear();
+    batch.Build(false);
+    CHECK(batch.IsEmpty());
+    CHECK(batch.GetBatches().empty());
+}
+
+// 16비트 인덱스에 들어가도록 MaxBatchSpriteCount마다 끊음
+TEST_CASE(BatchesSplitAtMaxBatchSpriteCount)
+{
+    FrameArena::Get().BeginFrame();
+
+    FakeResources resources;
+    const SpriteDrawItem item = MakeItem(
+        PixelShaderHandle{ resources.MakeAddress() },
+        ShaderResourceHandle{ resources.MakeAddress() },
+        RasterizerStateHandle{ resources.MakeAddress() },
+        0.0f);
+
+    constexpr std::uint32_t SpriteCount = SpriteBatch::MaxBatchSpriteCount * 2 + 10;
+
+    SpriteBatch batch;
+    batch.Reserve(SpriteCount);
+    for (std::uint32_t i = 0; i < SpriteCount; ++i)
+    {
+        batch.Add(item);
+    }
+    batch.Build(true);
+
+    const auto batches = batch.GetBatches();
+    CHECK(batches.size() == 3);
+    CHECK(batches.size() == 3 && batches[0].spriteCount == SpriteBatch::MaxBatchSpriteCount);
+    CHECK(batches.size() == 3 && batches[1].firstSprite == SpriteBatch::MaxBatchSpriteCount && batches[1].spriteCount == SpriteBatch::MaxBatchSpriteCount);
+    CHECK(batches.size() == 3 && batches[2].firstSprite == SpriteBatch::MaxBatchSpriteCount * 2 && batches[2].spriteCount == 10);
+
+    // 가장 큰 묶음의 마지막 인덱스도 16비트에 들어감
+    const std::vector<WORD> indices = SpriteBatch::MakeIndices(SpriteBatch::MaxBatchSpriteCount);
+    CHECK(indices.size() == SpriteBatch::MaxBatchSpriteCount * SpriteBatch::IndicesPerSprite);
+    CHECK(*std::max_element(indices.begin(), indices.end()) == SpriteBatch::MaxBatchSpriteCount * SpriteBatch::VerticesPerSprite - 1);
+}
+
+// Quad_VS와 같이 pivot만큼 옮긴 1x1 쿼드에 world, uv * uvScale + uvOffset
+TEST_CASE(ExpandQuadMatchesQuadShader)
+{
+    SpriteDrawItem item;
+    item.world = Matrix::CreateScale(2.0f, 4.0f, 1.0f) * Matrix::CreateTranslation(10.0f, 20.0f, 30.0f);
+    item.pivot = Vector2{ 0.0f, 0.0f }; // 왼쪽 위
+    item.uvScale = Vector2{ 0.5f, 0.25f };
+    item.uvOffset = Vector2{ 0.5f, 0.75f };
+    item.color = Vector4{ 0.1f, 0.2f, 0.3f, 0.4f };
+
+    std::array<SpriteVertex, SpriteBatch::VerticesPerSprite> vertices;
+    SpriteBatch::ExpandQuad(item, vertices.data());
+
+    CHECK(IsNear(vertices[0].position, Vector3{ 10.0f, 16.0f, 30.0f }));
+    CHECK(IsNear(vertices[1].position, Vector3{ 10.0f, 20.0f, 30.0f }));
+    CHECK(IsNear(vertices[2].position, Vector3{ 12.0f, 20.0f, 30.0f }));
+    CHECK(IsNear(vertices[3].position, Vector3{ 12.0f, 16.0f, 30.0f }));
+
+    CHECK(IsNear(vertices[0].texCoord, Vector2{ 0.5f, 1.0f }));
+    CHECK(IsNear(vertices[1].texCoord, Vector2{ 0.5f, 0.75f }));
+    CHECK(IsNear(vertices[2].texCoord, Vector2{ 1.0f, 0.75f }));
+    CHECK(IsNear(vertices[3].texCoord, Vector2{ 1.0f, 1.0f }));
+
+    bool isColorCopied = true;
+    for (const auto& vertex : vertices)
+    {
+        isColorCopied = isColorCopied && vertex.color == item.color;
+    }
+    CHECK(isColorCopied);
+
+    // 기본값 (가운데 pivot, 단위 행렬)은 DefaultQuad 그대로
+    SpriteBatch::ExpandQuad(SpriteDrawItem{}, vertices.data());
+
+    CHECK(IsNear(vertices[0].position, Vector3{ -0.5f, -0.5f, 0.0f }));
+    CHECK(IsNear(vertices[2].position, Vector3{ 0.5f, 0.5f, 0.0f }));
+    CHECK(IsNear(vertices[0].texCoord, Vector2{ 0.0f, 1.0f }));
+    CHECK(IsNear(vertices[2].texCoord, Vector2{ 1.0f, 0.0f }));
+}
+
+TEST_CASE(MakeIndicesUsesTwoTrianglesPerSprite)
+{
+    const std::vector<WORD> indices = SpriteBatch::MakeIndices(2);
+
+    CHECK((indices == std::vector<WORD>{ 0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7 }));
+    CHECK(SpriteBatch::MakeIndices(0).empty());
+}
+
+// 묶음마다 바뀐 상태만 바인드하고 baseVertex로 묶음의 정점을 가리키며, 끝나면 패스의 래스터라이저 상태로 되돌림
+TEST_CASE(SubmitBindsChangedStateAndRestoresRasterizerState)
+{
+    FrameArena::Get().BeginFrame();
+
+    FakeResources resources;
+    const PixelShaderHandle pixelShader{ resources.MakeAddress() };
+    const ShaderResourceHandle a{ resources.MakeAddress() };
+    const ShaderResourceHandle b{ resources.MakeAddress() };
+    const RasterizerStateHandle cullBack{ resources.MakeAddress() };
+    const RasterizerStateHandle cullNone{ resources.MakeAddress() };
+    const RasterizerStateHandle passState{ resources.MakeAddress() };
+
+    SpriteBatch batch;
+    batch.Add(MakeItem(pixelShader, a, cullBack, 0.0f));
+    batch.Add(MakeItem(pixelShader, a, cullBack, 1.0f));
+    batch.Add(MakeItem(pixelShader, b, cullBack, 2.0f));
+    batch.Add(MakeItem(pixelShader, b, cullNone, 3.0f));
+    batch.Build(false);
+
+    NullCommandContext context;
+    context.SetRasterizerState(passState);
+
+    const SpriteBatchStats stats = batch.Submit(context);
+
+    CHECK(stats.spriteCount == 4);
+    CHECK(stats.drawCount == 3);
+    CHECK(context.GetRasterizerState() == passState);
+
+    std::vector<RecordedCommand> draws;
+    std::vector<const void*> rasterizerStates;
+    std::size_t pixelShaderCount = 0;
+    std::size_t textureCount = 0;
+    for (const RecordedCommand& command : context.GetCommands().subspan(1)) // 처음 것은 패스 상태
+    {
+        switch (command.type)
+        {
+        case CommandType::DrawIndexed:
+            draws.push_back(command);
+            break;
+        case CommandType::SetRasterizerState:
+            rasterizerStates.push_back(command.object);
+            break;
+        case CommandType::SetPixelShader:
+            ++pixelShaderCount;
+            break;
+        case CommandType::SetPSShaderResources:
+            ++textureCount;
+            break;
+        default:
+            break;
+        }
+    }
+
+    CHECK(pixelShaderCount == 1);
+    CHECK(textureCount == 2);
+    CHECK((rasterizerStates == std::vector<const void*>{ cullBack.Get(), cullNone.Get(), passState.Get() }));
+    CHECK(context.GetCommands().back().type == CommandType::SetRasterizerState);
+
+    CHECK(draws.size() == 3);
+    CHECK(draws.size() == 3 && draws[0].value == 2 * SpriteBatch::IndicesPerSprite && draws[0].baseVertex == 0);
+    CHECK(draws.size() == 3 && draws[1].value == SpriteBatch::IndicesPerSprite && draws[1].baseVertex == 2 * SpriteBatch::VerticesPerSprite);
+    CHECK(draws.size() == 3 && draws[2].value == SpriteBatch::IndicesPerSprite && draws[2].baseVertex == 3 * SpriteBatch::VerticesPerSprite);
+}
+
+// 반투명 패스 (RenderSystem::DrawTransparents): 뒤에서 앞으로 정렬된 렌더러 중 이어진 스프라이트는 한 드로우로,
+// 직접 그리는 렌더러 앞에서는 모은 것을 먼저 그려서 순서를 지킴
+TEST_CASE(TransparentPassBatchesSpritesBetweenRenderers)
+{
+    FrameArena::Get().BeginFrame();
+
+    FakeResources resources;
+    const SpriteDrawItem item = MakeItem(
+        PixelShaderHandle{ resources.MakeAddress() },
+        ShaderResourceHandle{ resources.MakeAddress() },
+        RasterizerStateHandle{ resources.MakeAddress() },
+        0.0f);
+
+    // S S M S S S M S (S: 같은 텍스처의 파티클, M: 메시)
+    const bool isSprite[] = { true, true, false, true, true, true, false, true };
+
+    std::vector<TestRenderer> renderers(std::size(isSprite));
+    std::vector<Renderer*> sorted;
+    for (std::size_t i = 0; i < renderers.size(); ++i)
+    {
+        renderers[i].item = item;
+        renderers[i].isSprite = isSprite[i];
+        sorted.push_back(&renderers[i]);
+    }
+
+    NullCommandContext context;
+    std::vector<std::uint32_t> flushedCounts;
+
+    SpriteBatch batch;
+    SpriteBatch::DrawInOrder(sorted, RenderType::Transparent, true, batch, context,
+        [&context, &flushedCounts](SpriteBatch& sprites)
+        {
+            FlushSprites(sprites, context, flushedCounts);
+        });
+
+    CHECK(batch.IsEmpty());
+    CHECK((flushedCounts == std::vector<std::uint32_t>{ 2, 3, 1 }));
+    CHECK(context.GetStats().drawCount == 5); // 렌더러마다 그리면 8
+
+    // 드로우 순서: 스프라이트 2 -> 메시 -> 스프라이트 3 -> 메시 -> 스프라이트 1
+    std::vector<std::pair<CommandType, std::uint32_t>> draws;
+    for (const RecordedCommand& command : context.GetCommands())
+    {
+        if (command.type == CommandType::DrawIndexed)
+        {
+            draws.emplace_back(command.type, command.value / SpriteBatch::IndicesPerSprite);
+        }
+        else if (command.type == CommandType::DrawRenderer)
+        {
+            draws.emplace_back(command.type, 0);
+        }
+    }
+
+    const std::vector<std::pair<CommandType, std::uint32_t>> expected{
+        { CommandType::DrawIndexed, 2 },
+        { CommandType::DrawRenderer, 0 },
+        { CommandType::DrawIndexed, 3 },
+        { CommandType::DrawRenderer, 0 },
+        { CommandType::DrawIndexed, 1 } };
+    CHECK(draws == expected);
+
+    // null 백엔드는 렌더러를 직접 부르지 않음
+    CHECK(std::all_of(renderers.begin(), renderers.end(), [](const TestRenderer& renderer) { return renderer.drawCallCount == 0; }));
+}
+
+// 배칭을 끄면 모든 렌더러가 DrawRenderer로 하나씩
+TEST_CASE(TransparentPassWithoutBatchingDrawsEachRenderer)
+{
+    FrameArena::Get().BeginFrame();
+
+    std::vector<TestRenderer> renderers(4);
+    std::vector<Renderer*> sorted;
+    for (auto& renderer : renderers)
+    {
+        sorted.push_back(&renderer);
+    }
+
+    NullCommandContext context;
+    std::vector<std::uint32_t> flushedCounts;
+
+    SpriteBatch batch;
+    SpriteBatch::DrawInOrder(sorted, RenderType::Transparent, false, batch, context,
+        [&context, &flushedCounts](SpriteBatch& sprites)
+        {
+            FlushSprites(sprites, context, flushedCounts);
+        });
+
+    CHECK(flushedCounts.empty());
+    CHECK(context.GetStats().drawCount == 4);
+    CHECK(std::count_if(context.GetCommands().begin(), context.GetCommands().end(), [](const RecordedCommand& command)
+        {
+            return command.type == CommandType::DrawRenderer;
+        }) == 4);
+}
@@ -0,0 +1,25 @@
+﻿#pragma once
+
+#include <cstdint>
+
+#include "Common/Utility/JobSystem.h"
+
+// JobSystem을 쓰는 테스트 실행 파일들이 같이 쓰는 고정 워커 수 / 초기화
+namespace engine::test
+{
+    constexpr std::uint32_t WorkerCount = 3;
+
+    // 테스트마다 새로 초기화 (JobSystem은 싱글톤)
+    struct ScopedJobSystem
+    {
+        ScopedJobSystem()
+        {
+            JobSystem::Get().Initialize(WorkerCount);
+        }
+
+        ~ScopedJobSystem()
+        {
+            JobSystem::Get().Shutdown();
+        }
+    };
+}
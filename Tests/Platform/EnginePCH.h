@@ -0,0 +1,70 @@
+﻿#pragma once
+
+// 테스트 빌드용 EnginePCH.h
+// include 경로에서 Engine/보다 앞에 있으므로 엔진 소스의 #include "EnginePCH.h"가 이 파일을 씀
+// Windows / D3D11 / PhysX 없이 수학 타입과 json, 공용 유틸리티만 제공함
+// d3d11.h는 같은 폴더의 최소 정의 (Vertex.h의 입력 레이아웃용)
+// ImGui는 헤더만 (JsonHelper.h의 인라인 함수가 참조하지만 테스트에서 부르지 않으므로 링크하지 않음)
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <chrono>
+#include <cassert>
+#include <array>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <filesystem>
+
+// DirectXMath / SimpleMath가 쓰는 Windows 타입
+#define __cdecl
+
+using UINT = unsigned int;
+using INT = int;
+using WORD = std::uint16_t;
+using DWORD = std::uint32_t;
+using LONG = long;
+using UINT64 = std::uint64_t;
+
+struct RECT
+{
+    LONG left;
+    LONG top;
+    LONG right;
+    LONG bottom;
+};
+
+#include <directxtk/SimpleMath.h>
+#include <DirectXCollision.h>
+
+#include <imgui.h>
+#include <json.hpp>
+
+namespace engine
+{
+    using Vector2 = DirectX::SimpleMath::Vector2;
+    using Vector3 = DirectX::SimpleMath::Vector3;
+    using Vector4 = DirectX::SimpleMath::Vector4;
+    using Matrix = DirectX::SimpleMath::Matrix;
+    using Quaternion = DirectX::SimpleMath::Quaternion;
+    using Color = DirectX::SimpleMath::Color;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using TimePoint = std::chrono::time_point<Clock>;
+
+    using json = nlohmann::ordered_json;
+}
+
+// Debug.h는 Windows 출력 함수를 쓰므로 로그는 버리고 FATAL_CHECK는 바로 중단 (GCC 12에는 <format>도 없음)
+#define FATAL_CHECK(cond, msg) \
+    do { if (!(cond)) { std::abort(); } } while (false)
+#define LOG_ERROR(...) static_cast<void>(0)
+#define LOG_INFO(...) static_cast<void>(0)
+#define LOG_PRINT(...) static_cast<void>(0)
+
+#include "Common/Utility/Singleton.h"
+#include "Common/Utility/JsonHelper.h"
+#include "Common/Math/MathUtility.h"
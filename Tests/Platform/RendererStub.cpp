@@ -0,0 +1,34 @@
+﻿#include "EnginePCH.h"
+#include "Framework/Object/Component/Renderer.h"
+
+// Component.cpp / Renderer.cpp는 GameObject / Scene / RenderSystem을 끌어오므로
+// 테스트용 Renderer 파생 클래스를 만들 수 있을 만큼만 대신 정의함 (시스템 등록 없음)
+namespace engine
+{
+    bool Component::IsActive() const
+    {
+        return m_active;
+    }
+
+    void Component::SetActive(bool active)
+    {
+        m_active = active;
+    }
+
+    Renderer::Renderer()
+    {
+        m_systemIndices.fill(-1);
+    }
+
+    Renderer::~Renderer()
+    {
+    }
+
+    void Renderer::Initialize()
+    {
+    }
+
+    void Renderer::CollectDrawPackets(RenderType type, RenderQueue& queue) const
+    {
+    }
+}
@@ -0,0 +1,36 @@
+﻿#include "EnginePCH.h"
+
+// SimpleMath의 static 상수는 DirectXTK의 SimpleMath.cpp에 정의되어 있으므로 테스트 빌드에서 따로 정의
+namespace DirectX::SimpleMath
+{
+    const Vector2 Vector2::Zero = { 0.0f, 0.0f };
+    const Vector2 Vector2::One = { 1.0f, 1.0f };
+    const Vector2 Vector2::UnitX = { 1.0f, 0.0f };
+    const Vector2 Vector2::UnitY = { 0.0f, 1.0f };
+
+    const Vector3 Vector3::Zero = { 0.0f, 0.0f, 0.0f };
+    const Vector3 Vector3::One = { 1.0f, 1.0f, 1.0f };
+    const Vector3 Vector3::UnitX = { 1.0f, 0.0f, 0.0f };
+    const Vector3 Vector3::UnitY = { 0.0f, 1.0f, 0.0f };
+    const Vector3 Vector3::UnitZ = { 0.0f, 0.0f, 1.0f };
+    const Vector3 Vector3::Up = { 0.0f, 1.0f, 0.0f };
+    const Vector3 Vector3::Down = { 0.0f, -1.0f, 0.0f };
+    const Vector3 Vector3::Right = { 1.0f, 0.0f, 0.0f };
+    const Vector3 Vector3::Left = { -1.0f, 0.0f, 0.0f };
+    const Vector3 Vector3::Forward = { 0.0f, 0.0f, -1.0f };
+    const Vector3 Vector3::Backward = { 0.0f, 0.0f, 1.0f };
+
+    const Vector4 Vector4::Zero = { 0.0f, 0.0f, 0.0f, 0.0f };
+    const Vector4 Vector4::One = { 1.0f, 1.0f, 1.0f, 1.0f };
+    const Vector4 Vector4::UnitX = { 1.0f, 0.0f, 0.0f, 0.0f };
+    const Vector4 Vector4::UnitY = { 0.0f, 1.0f, 0.0f, 0.0f };
+    const Vector4 Vector4::UnitZ = { 0.0f, 0.0f, 1.0f, 0.0f };
+    const Vector4 Vector4::UnitW = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+    const Matrix Matrix::Identity = { 1.0f, 0.0f, 0.0f, 0.0f,
+                                      0.0f, 1.0f, 0.0f, 0.0f,
+                                      0.0f, 0.0f, 1.0f, 0.0f,
+                                      0.0f, 0.0f, 0.0f, 1.0f };
+
+    const Quaternion Quaternion::Identity = { 0.0f, 0.0f, 0.0f, 1.0f };
+}
@@ -0,0 +1,19 @@
+﻿#pragma once
+
+// Windows SDK의 SAL 주석을 비워서 DirectXMath / SimpleMath를 Linux에서 컴파일하기 위한 것
+#define _In_
+#define _In_opt_
+#define _In_reads_(x)
+#define _In_reads_opt_(x)
+#define _In_reads_bytes_(x)
+#define _Out_
+#define _Out_opt_
+#define _Out_writes_(x)
+#define _Out_writes_opt_(x)
+#define _Out_writes_all_(x)
+#define _Out_writes_bytes_(x)
+#define _Inout_
+#define _Inout_updates_(x)
+#define _Use_decl_annotations_
+#define _Success_(x)
+#define _Analysis_assume_(x)
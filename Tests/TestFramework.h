@@ -0,0 +1,39 @@
+﻿#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// 테스트 실행 파일마다 TestMain.cpp와 같이 컴파일하는 최소한의 테스트 등록 / 검사 매크로
+// - TEST_CASE로 정의한 함수를 정의한 순서대로 실행하고, 실패한 CHECK가 하나라도 있으면 1을 반환 (ctest가 실패로 봄)
+// - 인자로 이름을 주면 그 테스트만 실행
+namespace engine::test
+{
+    struct TestCase
+    {
+        const char* name;
+        void (*function)();
+    };
+
+    std::vector<TestCase>& GetTestCases();
+    void ReportFailure(const char* file, int line, const char* expression);
+
+    struct TestRegistrar
+    {
+        TestRegistrar(const char* name, void (*function)())
+        {
+            GetTestCases().push_back(TestCase{ name, function });
+        }
+    };
+}
+
+#define TEST_CASE(name) \
+    static void name(); \
+    static engine::test::TestRegistrar name##Registrar{ #name, &name }; \
+    static void name()
+
+#define CHECK(expression) \
+    ((expression) ? static_cast<void>(0) : engine::test::ReportFailure(__FILE__, __LINE__, #expression))
+
+#define CHECK_NEAR(actual, expected, tolerance) \
+    CHECK(std::abs((actual) - (expected)) <= (tolerance))
@@ -0,0 +1,58 @@
+﻿#include "TestFramework.h"
+
+#include <cstring>
+
+namespace engine::test
+{
+    namespace
+    {
+        int g_failureCount = 0;
+    }
+
+    std::vector<TestCase>& GetTestCases()
+    {
+        static std::vector<TestCase> s_testCases;
+        return s_testCases;
+    }
+
+    void ReportFailure(const char* file, int line, const char* expression)
+    {
+        ++g_failureCount;
+        std::printf("%s(%d): CHECK(%s) failed\n", file, line, expression);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace engine::test;
+
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+
+    int failedCaseCount = 0;
+    int runCount = 0;
+
+    for (const TestCase& testCase : GetTestCases())
+    {
+        if (filter != nullptr && std::strcmp(filter, testCase.name) != 0)
+        {
+            continue;
+        }
+
+        const int failureCount = g_failureCount;
+
+        testCase.function();
+        ++runCount;
+
+        const bool isPassed = g_failureCount == failureCount;
+        if (!isPassed)
+        {
+            ++failedCaseCount;
+        }
+
+        std::printf("[%s] %s\n", isPassed ? "PASS" : "FAIL", testCase.name);
+    }
+
+    std::printf("%d / %d passed\n", runCount - failedCaseCount, runCount);
+
+    return failedCaseCount == 0 && runCount > 0 ? 0 : 1;
+}